@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['error_20codes_0',['Error Codes',['../group__group__bsp__errors.html',1,'']]]
+];
@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['peripheral_20default_20bsp_20settings_0',['Peripheral Default BSP Settings',['../md_source_bsps_cat1a_CY8CKIT_062_WIFI_BT_bsp_settings.html',1,'']]]
+];
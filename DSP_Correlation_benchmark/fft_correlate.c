@@ -0,0 +1,48 @@
+#include "main.h"
+
+// Cross-correlation as IFFT(FFT(a) * conj(FFT(b))) on real FFTs of the next power of two
+// >= len_a + len_b - 1, so the circular result holds every linear lag without wrapping.
+// The template spectrum is kept in the instance: a ranging receiver sends the same ping
+// every time and only pays for it once.
+
+arm_status fft_correlate_init(fft_correlator *c, float32_t *work, float32_t *spec_a, float32_t *spec_b,
+                              uint32_t len_a, uint32_t len_b) {
+    uint32_t fft_len = 32;
+    while (fft_len < len_a + len_b - 1) {
+        fft_len <<= 1;
+    }
+    c->fft_len = fft_len;
+    c->work = work;
+    c->spec_a = spec_a;
+    c->spec_b = spec_b;
+    return arm_rfft_fast_init_f32(&c->rfft, fft_len);
+}
+
+void fft_correlate_set_template(fft_correlator *c, const float32_t *b, uint32_t len_b) {
+    memcpy(c->work, b, len_b * sizeof(float32_t));
+    memset(c->work + len_b, 0, (c->fft_len - len_b) * sizeof(float32_t));
+    arm_rfft_fast_f32(&c->rfft, c->work, c->spec_b, 0);
+
+    // Packed format: [0] is the real DC bin, [1] the real Nyquist bin; both are their own conjugate
+    arm_cmplx_conj_f32(c->spec_b + 2, c->spec_b + 2, c->fft_len / 2 - 1);
+}
+
+// dst gets 2 * len_a - 1 outputs with dst[len_a - 1 + m] = sum_n a[n + m] * b[n]
+void fft_correlate_f32(fft_correlator *c, const float32_t *a, uint32_t len_a, uint32_t len_b, float32_t *dst) {
+    const uint32_t L = c->fft_len;
+
+    memcpy(c->work, a, len_a * sizeof(float32_t));
+    memset(c->work + len_a, 0, (L - len_a) * sizeof(float32_t));
+    arm_rfft_fast_f32(&c->rfft, c->work, c->spec_a, 0);
+
+    c->work[0] = c->spec_a[0] * c->spec_b[0];
+    c->work[1] = c->spec_a[1] * c->spec_b[1];
+    arm_cmplx_mult_cmplx_f32(c->spec_a + 2, c->spec_b + 2, c->work + 2, L / 2 - 1);
+
+    // Inverse transform into spec_a, which is free again; lag m sits at m mod L
+    arm_rfft_fast_f32(&c->rfft, c->work, c->spec_a, 1);
+
+    memset(dst, 0, (len_a - len_b) * sizeof(float32_t));
+    memcpy(dst + len_a - len_b, c->spec_a + L - (len_b - 1), (len_b - 1) * sizeof(float32_t));
+    memcpy(dst + len_a - 1, c->spec_a, len_a * sizeof(float32_t));
+}
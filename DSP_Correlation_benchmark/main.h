@@ -0,0 +1,110 @@
+#ifndef MAIN_H
+#define MAIN_H
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cyhal_clock.h"
+#include "cy_retarget_io.h"
+#include "arm_math.h"
+#include "core_cm4.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Constants
+#define CORR_SIZES_COUNT     5
+#define CORR_LEN_A_MAX       1024
+#define CORR_LEN_B_MAX       256
+#define CORR_OUT_MAX         (2 * CORR_LEN_A_MAX - 1)
+
+// Ping: linear chirp over the template, echo at a third of the remaining span plus noise
+#define PING_START_FREQ      0.05f   // cycles per sample
+#define PING_END_FREQ        0.25f
+#define ECHO_GAIN            0.7f
+#define ECHO_NOISE           0.2f
+
+// FFT-based correlation sweep (direct vs FFT crossover)
+#define FFT_CORR_SIZES_COUNT 7
+#define FFT_CORR_LEN_MAX     2048
+#define FFT_CORR_FFT_MAX     4096
+#define FFT_CORR_PING_LEN    64
+
+// Opt-variant scratch lengths in q15 elements
+#define CORR_OPT_Q15_SCRATCH_LEN(a, b)  (((a) > (b) ? (a) : (b)) + 2 * ((a) < (b) ? (a) : (b)) - 2)
+#define CONV_OPT_SCRATCH1_LEN(a, b)     (((a) > (b) ? (a) : (b)) + 2 * ((a) < (b) ? (a) : (b)) - 2)
+#define CONV_OPT_SCRATCH2_LEN(a, b)     ((a) < (b) ? (a) : (b))
+
+// Attributes
+#define RAM_FUNC __attribute__((section(".cy_ramfunc")))
+
+// Stack Limit
+extern uint32_t __StackLimit;
+
+// Clock Frequency
+extern uint32_t clkFastfreq;
+
+// Signal (A) and template (B) lengths; A >= B as in ranging
+typedef struct {
+    uint16_t len_a;
+    uint16_t len_b;
+} corr_size;
+
+extern const corr_size CORR_SIZES[CORR_SIZES_COUNT];
+extern const int FFT_CORR_SIZES[FFT_CORR_SIZES_COUNT];
+
+// Shared inputs of one size: generated once in f64 and quantised per datatype, with
+// outputs and scratch sized for the largest case
+typedef struct {
+    int len_a;
+    int len_b;
+    float64_t *a_f64;
+    float64_t *b_f64;
+    float64_t *ref_f64;
+    float64_t *test_f64;
+    float32_t *a_f32;
+    float32_t *b_f32;
+    float32_t *dst_f32;
+    q31_t *a_q31;
+    q31_t *b_q31;
+    q31_t *dst_q31;
+    q15_t *a_q15;
+    q15_t *b_q15;
+    q15_t *dst_q15;
+    q7_t *a_q7;
+    q7_t *b_q7;
+    q7_t *dst_q7;
+    q15_t *scratch1;
+    q15_t *scratch2;
+} corr_buffers;
+
+// FFT cross-correlation on arm_rfft_fast_f32, same output layout as arm_correlate_f32
+typedef struct {
+    arm_rfft_fast_instance_f32 rfft;
+    uint32_t fft_len;
+    float32_t *work;        // time-domain input, then the product spectrum
+    float32_t *spec_a;
+    float32_t *spec_b;      // conjugated template spectrum
+} fft_correlator;
+
+arm_status fft_correlate_init(fft_correlator *c, float32_t *work, float32_t *spec_a, float32_t *spec_b,
+                              uint32_t len_a, uint32_t len_b);
+void fft_correlate_set_template(fft_correlator *c, const float32_t *b, uint32_t len_b);
+void fft_correlate_f32(fft_correlator *c, const float32_t *a, uint32_t len_a, uint32_t len_b, float32_t *dst);
+
+// Prototypes for common utilities
+void fill_stack_pattern_to_sp(void);
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+uint32_t measure_stack_usage(void);
+void generate_ping_echo_f64(float64_t *a, int len_a, float64_t *b, int len_b, float64_t scale);
+int corr_buffers_alloc(corr_buffers *b);
+void corr_buffers_free(corr_buffers *b);
+void corr_prepare(corr_buffers *b, int len_a, int len_b);
+void correlate_reference_f64(const float64_t *a, int len_a, const float64_t *b, int len_b, float64_t *dst);
+void conv_reference_f64(const float64_t *a, int len_a, const float64_t *b, int len_b, float64_t *dst);
+float64_t compute_snr_f64(const float64_t *ref, const float64_t *test, int N);
+int peak_index_f64(const float64_t *x, int N);
+void report_corr_result(const char *label, const corr_buffers *b, int first, int num_points, int is_correlation,
+                        uint32_t cycle_count, uint32_t instr_est, uint32_t stack_used, uint32_t scratch_bytes);
+
+#endif // MAIN_H
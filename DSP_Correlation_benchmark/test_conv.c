@@ -0,0 +1,199 @@
+#include "main.h"
+
+// Partial runs compute only the outputs where the template fully overlaps the signal
+#define PARTIAL_FIRST(b)   ((b)->len_b - 1)
+#define PARTIAL_POINTS(b)  ((b)->len_a - (b)->len_b + 1)
+
+RAM_FUNC static void conv_f32(corr_buffers *b, int partial) {
+    const int out_len = b->len_a + b->len_b - 1;
+    const int first = partial ? PARTIAL_FIRST(b) : 0;
+    const int num_points = partial ? PARTIAL_POINTS(b) : out_len;
+    memset(b->dst_f32, 0, out_len * sizeof(float32_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (partial)
+        arm_conv_partial_f32(b->a_f32, b->len_a, b->b_f32, b->len_b, b->dst_f32, first, num_points);
+    else
+        arm_conv_f32(b->a_f32, b->len_a, b->b_f32, b->len_b, b->dst_f32);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < out_len; i++)
+        b->test_f64[i] = b->dst_f32[i];
+    report_corr_result(partial ? "CONV PARTIAL F32" : "CONV F32", b, first, num_points, 0,
+                       cycle_count, instr_est, stack_used, 0);
+}
+
+RAM_FUNC static void conv_q31(corr_buffers *b, int fast, int partial) {
+    static const char *const labels[2][2] = {
+        {"CONV Q31", "CONV FAST Q31"}, {"CONV PARTIAL Q31", "CONV PARTIAL FAST Q31"}
+    };
+    const int out_len = b->len_a + b->len_b - 1;
+    const int first = partial ? PARTIAL_FIRST(b) : 0;
+    const int num_points = partial ? PARTIAL_POINTS(b) : out_len;
+    memset(b->dst_q31, 0, out_len * sizeof(q31_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (partial && fast)
+        arm_conv_partial_fast_q31(b->a_q31, b->len_a, b->b_q31, b->len_b, b->dst_q31, first, num_points);
+    else if (partial)
+        arm_conv_partial_q31(b->a_q31, b->len_a, b->b_q31, b->len_b, b->dst_q31, first, num_points);
+    else if (fast)
+        arm_conv_fast_q31(b->a_q31, b->len_a, b->b_q31, b->len_b, b->dst_q31);
+    else
+        arm_conv_q31(b->a_q31, b->len_a, b->b_q31, b->len_b, b->dst_q31);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < out_len; i++)
+        b->test_f64[i] = (float64_t)b->dst_q31[i] / 2147483648.0;
+    report_corr_result(labels[partial][fast], b, first, num_points, 0, cycle_count, instr_est, stack_used, 0);
+}
+
+// variant: 0 = q15, 1 = fast, 2 = opt, 3 = fast_opt
+RAM_FUNC static void conv_q15(corr_buffers *b, int variant, int partial) {
+    static const char *const labels[2][4] = {
+        {"CONV Q15", "CONV FAST Q15", "CONV OPT Q15", "CONV FAST OPT Q15"},
+        {"CONV PARTIAL Q15", "CONV PARTIAL FAST Q15", "CONV PARTIAL OPT Q15", "CONV PARTIAL FAST OPT Q15"}
+    };
+    const int out_len = b->len_a + b->len_b - 1;
+    const int first = partial ? PARTIAL_FIRST(b) : 0;
+    const int num_points = partial ? PARTIAL_POINTS(b) : out_len;
+    const uint32_t scratch_bytes = variant >= 2
+                                 ? (CONV_OPT_SCRATCH1_LEN(b->len_a, b->len_b) +
+                                    CONV_OPT_SCRATCH2_LEN(b->len_a, b->len_b)) * sizeof(q15_t) : 0;
+    memset(b->dst_q15, 0, out_len * sizeof(q15_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (partial) {
+        if (variant == 3)
+            arm_conv_partial_fast_opt_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15, first, num_points,
+                                          b->scratch1, b->scratch2);
+        else if (variant == 2)
+            arm_conv_partial_opt_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15, first, num_points,
+                                     b->scratch1, b->scratch2);
+        else if (variant == 1)
+            arm_conv_partial_fast_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15, first, num_points);
+        else
+            arm_conv_partial_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15, first, num_points);
+    } else {
+        if (variant == 3)
+            arm_conv_fast_opt_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15, b->scratch1, b->scratch2);
+        else if (variant == 2)
+            arm_conv_opt_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15, b->scratch1, b->scratch2);
+        else if (variant == 1)
+            arm_conv_fast_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15);
+        else
+            arm_conv_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15);
+    }
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < out_len; i++)
+        b->test_f64[i] = (float64_t)b->dst_q15[i] / 32768.0;
+    report_corr_result(labels[partial][variant], b, first, num_points, 0,
+                       cycle_count, instr_est, stack_used, scratch_bytes);
+}
+
+RAM_FUNC static void conv_q7(corr_buffers *b, int opt, int partial) {
+    static const char *const labels[2][2] = {
+        {"CONV Q7", "CONV OPT Q7"}, {"CONV PARTIAL Q7", "CONV PARTIAL OPT Q7"}
+    };
+    const int out_len = b->len_a + b->len_b - 1;
+    const int first = partial ? PARTIAL_FIRST(b) : 0;
+    const int num_points = partial ? PARTIAL_POINTS(b) : out_len;
+    const uint32_t scratch_bytes = opt
+                                 ? (CONV_OPT_SCRATCH1_LEN(b->len_a, b->len_b) +
+                                    CONV_OPT_SCRATCH2_LEN(b->len_a, b->len_b)) * sizeof(q15_t) : 0;
+    memset(b->dst_q7, 0, out_len * sizeof(q7_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (partial && opt)
+        arm_conv_partial_opt_q7(b->a_q7, b->len_a, b->b_q7, b->len_b, b->dst_q7, first, num_points,
+                                b->scratch1, b->scratch2);
+    else if (partial)
+        arm_conv_partial_q7(b->a_q7, b->len_a, b->b_q7, b->len_b, b->dst_q7, first, num_points);
+    else if (opt)
+        arm_conv_opt_q7(b->a_q7, b->len_a, b->b_q7, b->len_b, b->dst_q7, b->scratch1, b->scratch2);
+    else
+        arm_conv_q7(b->a_q7, b->len_a, b->b_q7, b->len_b, b->dst_q7);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < out_len; i++)
+        b->test_f64[i] = (float64_t)b->dst_q7[i] / 128.0;
+    report_corr_result(labels[partial][opt], b, first, num_points, 0,
+                       cycle_count, instr_est, stack_used, scratch_bytes);
+}
+
+RAM_FUNC void benchmark_conv(void) {
+    printf("=== Convolution Benchmark (full and partial, all datatypes and variants) ===\n\r");
+
+    corr_buffers b;
+    if (!corr_buffers_alloc(&b)) {
+        printf("Memory allocation failed for convolution benchmark\n\r");
+    } else {
+        for (int s = 0; s < CORR_SIZES_COUNT; s++) {
+            corr_prepare(&b, CORR_SIZES[s].len_a, CORR_SIZES[s].len_b);
+            conv_reference_f64(b.a_f64, b.len_a, b.b_f64, b.len_b, b.ref_f64);
+
+            printf("\n--- lenA = %d, lenB = %d ---\n\r", b.len_a, b.len_b);
+            for (int partial = 0; partial <= 1; partial++) {
+                conv_f32(&b, partial);
+                conv_q31(&b, 0, partial);
+                conv_q31(&b, 1, partial);
+                for (int variant = 0; variant < 4; variant++)
+                    conv_q15(&b, variant, partial);
+                conv_q7(&b, 0, partial);
+                conv_q7(&b, 1, partial);
+            }
+        }
+    }
+
+    corr_buffers_free(&b);
+    printf("\nBenchmark completed for ARM Convolution.\n\r");
+}
@@ -0,0 +1,161 @@
+#include "main.h"
+
+RAM_FUNC static void correlate_float(corr_buffers *b, int f64) {
+    const int out_len = 2 * b->len_a - 1;
+    float64_t *dst_f64 = b->test_f64;
+
+    memset(b->dst_f32, 0, out_len * sizeof(float32_t));
+    memset(dst_f64, 0, out_len * sizeof(float64_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (f64)
+        arm_correlate_f64(b->a_f64, b->len_a, b->b_f64, b->len_b, dst_f64);
+    else
+        arm_correlate_f32(b->a_f32, b->len_a, b->b_f32, b->len_b, b->dst_f32);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    if (!f64) {
+        for (int i = 0; i < out_len; i++)
+            b->test_f64[i] = b->dst_f32[i];
+    }
+    report_corr_result(f64 ? "CORRELATE F64" : "CORRELATE F32", b, 0, out_len, 1,
+                       cycle_count, instr_est, stack_used, 0);
+}
+
+RAM_FUNC static void correlate_q31(corr_buffers *b, int fast) {
+    const int out_len = 2 * b->len_a - 1;
+    memset(b->dst_q31, 0, out_len * sizeof(q31_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (fast)
+        arm_correlate_fast_q31(b->a_q31, b->len_a, b->b_q31, b->len_b, b->dst_q31);
+    else
+        arm_correlate_q31(b->a_q31, b->len_a, b->b_q31, b->len_b, b->dst_q31);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < out_len; i++)
+        b->test_f64[i] = (float64_t)b->dst_q31[i] / 2147483648.0;
+    report_corr_result(fast ? "CORRELATE FAST Q31" : "CORRELATE Q31", b, 0, out_len, 1,
+                       cycle_count, instr_est, stack_used, 0);
+}
+
+// variant: 0 = q15, 1 = fast, 2 = opt, 3 = fast_opt
+RAM_FUNC static void correlate_q15(corr_buffers *b, int variant) {
+    static const char *const labels[] = {
+        "CORRELATE Q15", "CORRELATE FAST Q15", "CORRELATE OPT Q15", "CORRELATE FAST OPT Q15"
+    };
+    const int out_len = 2 * b->len_a - 1;
+    const uint32_t scratch_bytes = variant >= 2
+                                 ? CORR_OPT_Q15_SCRATCH_LEN(b->len_a, b->len_b) * sizeof(q15_t) : 0;
+    memset(b->dst_q15, 0, out_len * sizeof(q15_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (variant == 3)
+        arm_correlate_fast_opt_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15, b->scratch1);
+    else if (variant == 2)
+        arm_correlate_opt_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15, b->scratch1);
+    else if (variant == 1)
+        arm_correlate_fast_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15);
+    else
+        arm_correlate_q15(b->a_q15, b->len_a, b->b_q15, b->len_b, b->dst_q15);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < out_len; i++)
+        b->test_f64[i] = (float64_t)b->dst_q15[i] / 32768.0;
+    report_corr_result(labels[variant], b, 0, out_len, 1, cycle_count, instr_est, stack_used, scratch_bytes);
+}
+
+RAM_FUNC static void correlate_q7(corr_buffers *b, int opt) {
+    const int out_len = 2 * b->len_a - 1;
+    const uint32_t scratch_bytes = opt
+                                 ? (CONV_OPT_SCRATCH1_LEN(b->len_a, b->len_b) +
+                                    CONV_OPT_SCRATCH2_LEN(b->len_a, b->len_b)) * sizeof(q15_t) : 0;
+    memset(b->dst_q7, 0, out_len * sizeof(q7_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (opt)
+        arm_correlate_opt_q7(b->a_q7, b->len_a, b->b_q7, b->len_b, b->dst_q7, b->scratch1, b->scratch2);
+    else
+        arm_correlate_q7(b->a_q7, b->len_a, b->b_q7, b->len_b, b->dst_q7);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < out_len; i++)
+        b->test_f64[i] = (float64_t)b->dst_q7[i] / 128.0;
+    report_corr_result(opt ? "CORRELATE OPT Q7" : "CORRELATE Q7", b, 0, out_len, 1,
+                       cycle_count, instr_est, stack_used, scratch_bytes);
+}
+
+RAM_FUNC void benchmark_correlate(void) {
+    printf("=== Correlation Benchmark (chirp ping vs noisy echo, all datatypes and variants) ===\n\r");
+
+    corr_buffers b;
+    if (!corr_buffers_alloc(&b)) {
+        printf("Memory allocation failed for correlation benchmark\n\r");
+    } else {
+        for (int s = 0; s < CORR_SIZES_COUNT; s++) {
+            corr_prepare(&b, CORR_SIZES[s].len_a, CORR_SIZES[s].len_b);
+            correlate_reference_f64(b.a_f64, b.len_a, b.b_f64, b.len_b, b.ref_f64);
+
+            printf("\n--- lenA = %d, lenB = %d ---\n\r", b.len_a, b.len_b);
+            correlate_float(&b, 0);
+            correlate_float(&b, 1);
+            correlate_q31(&b, 0);
+            correlate_q31(&b, 1);
+            for (int variant = 0; variant < 4; variant++)
+                correlate_q15(&b, variant);
+            correlate_q7(&b, 0);
+            correlate_q7(&b, 1);
+        }
+    }
+
+    corr_buffers_free(&b);
+    printf("\nBenchmark completed for ARM Correlate.\n\r");
+}
@@ -0,0 +1,109 @@
+#include "main.h"
+
+// Direct arm_correlate_f32 against FFT correlation over growing signal lengths, for a
+// template as long as the signal and for a fixed FFT_CORR_PING_LEN ping. The FFT path is
+// timed with and without the template transform (cached for a fixed ping).
+
+static uint32_t time_direct(const float32_t *a, int len_a, const float32_t *b, int len_b, float32_t *dst) {
+    memset(dst, 0, (2 * len_a - 1) * sizeof(float32_t));
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_correlate_f32(a, len_a, b, len_b, dst);
+
+    return read_cycle_counter() - start_cycles;
+}
+
+RAM_FUNC void benchmark_fft_correlate(void) {
+    printf("=== Direct vs FFT Correlation F32 (crossover search) ===\n\r");
+
+    float64_t *a_f64 = (float64_t*)malloc(FFT_CORR_LEN_MAX * sizeof(float64_t));
+    float64_t *b_f64 = (float64_t*)malloc(FFT_CORR_LEN_MAX * sizeof(float64_t));
+    float32_t *a = (float32_t*)malloc(FFT_CORR_LEN_MAX * sizeof(float32_t));
+    float32_t *b = (float32_t*)malloc(FFT_CORR_LEN_MAX * sizeof(float32_t));
+    float32_t *dst_direct = (float32_t*)malloc((2 * FFT_CORR_LEN_MAX - 1) * sizeof(float32_t));
+    float32_t *dst_fft = (float32_t*)malloc((2 * FFT_CORR_LEN_MAX - 1) * sizeof(float32_t));
+    float32_t *work = (float32_t*)malloc(FFT_CORR_FFT_MAX * sizeof(float32_t));
+    float32_t *spec_a = (float32_t*)malloc(FFT_CORR_FFT_MAX * sizeof(float32_t));
+    float32_t *spec_b = (float32_t*)malloc(FFT_CORR_FFT_MAX * sizeof(float32_t));
+    if (!a_f64 || !b_f64 || !a || !b || !dst_direct || !dst_fft || !work || !spec_a || !spec_b) {
+        printf("Memory allocation failed for FFT correlation\n\r");
+        free(a_f64); free(b_f64); free(a); free(b); free(dst_direct); free(dst_fft);
+        free(work); free(spec_a); free(spec_b);
+        return;
+    }
+
+    for (int fixed_ping = 0; fixed_ping <= 1; fixed_ping++) {
+        int crossover_full = -1;
+        int crossover_cached = -1;
+
+        printf("\n--- Template length: %s ---\n\r", fixed_ping ? "fixed ping (64)" : "equal to signal");
+        for (int s = 0; s < FFT_CORR_SIZES_COUNT; s++) {
+            const int len_a = FFT_CORR_SIZES[s];
+            const int len_b = fixed_ping && len_a > FFT_CORR_PING_LEN ? FFT_CORR_PING_LEN : len_a;
+            fft_correlator c;
+
+            generate_ping_echo_f64(a_f64, len_a, b_f64, len_b, 1.0 / sqrt((float64_t)len_b));
+            for (int i = 0; i < len_a; i++)
+                a[i] = (float32_t)a_f64[i];
+            for (int i = 0; i < len_b; i++)
+                b[i] = (float32_t)b_f64[i];
+            if (fft_correlate_init(&c, work, spec_a, spec_b, len_a, len_b) != ARM_MATH_SUCCESS) {
+                printf("RFFT init failed for lenA = %d, lenB = %d\n\r", len_a, len_b);
+                continue;
+            }
+
+            fill_stack_pattern_to_sp();
+            uint32_t direct_cycles = time_direct(a, len_a, b, len_b, dst_direct);
+
+            enable_cycle_counter();
+            uint32_t start_cycles = read_cycle_counter();
+            fft_correlate_set_template(&c, b, len_b);
+            uint32_t template_cycles = read_cycle_counter() - start_cycles;
+
+            enable_cycle_counter();
+            start_cycles = read_cycle_counter();
+            fft_correlate_f32(&c, a, len_a, len_b, dst_fft);
+            uint32_t cached_cycles = read_cycle_counter() - start_cycles;
+            uint32_t full_cycles = template_cycles + cached_cycles;
+            uint32_t stack_used = measure_stack_usage();
+
+            // Agreement with the direct result, in f64
+            float64_t signal = 0.0, noise = 0.0;
+            for (int i = 0; i < 2 * len_a - 1; i++) {
+                float64_t err = (float64_t)dst_direct[i] - dst_fft[i];
+                signal += (float64_t)dst_direct[i] * dst_direct[i];
+                noise += err * err;
+            }
+
+            printf("\nlenA = %d, lenB = %d, FFT length = %lu\n\r", len_a, len_b, (unsigned long)c.fft_len);
+            printf("Direct Cycle Count: %lu\n\r", (unsigned long)direct_cycles);
+            printf("FFT Cycle Count (with template FFT): %lu (%.2fx)\n\r",
+                   (unsigned long)full_cycles, (float)direct_cycles / full_cycles);
+            printf("FFT Cycle Count (template cached): %lu (%.2fx)\n\r",
+                   (unsigned long)cached_cycles, (float)direct_cycles / cached_cycles);
+            printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+            printf("FFT Working Memory: %lu bytes\n\r", (unsigned long)(3 * c.fft_len * sizeof(float32_t)));
+            printf("SNR FFT vs Direct: %.2f dB\n\r", noise == 0.0 ? INFINITY : 10.0 * log10(signal / noise));
+
+            if (crossover_full < 0 && full_cycles < direct_cycles)
+                crossover_full = len_a;
+            if (crossover_cached < 0 && cached_cycles < direct_cycles)
+                crossover_cached = len_a;
+        }
+
+        printf("\n\r");
+        if (crossover_full > 0)
+            printf("Crossover (with template FFT): FFT faster from lenA = %d\n\r", crossover_full);
+        else
+            printf("Crossover (with template FFT): not reached up to lenA = %d\n\r", FFT_CORR_LEN_MAX);
+        if (crossover_cached > 0)
+            printf("Crossover (template cached): FFT faster from lenA = %d\n\r", crossover_cached);
+        else
+            printf("Crossover (template cached): not reached up to lenA = %d\n\r", FFT_CORR_LEN_MAX);
+    }
+
+    free(a_f64); free(b_f64); free(a); free(b); free(dst_direct); free(dst_fft);
+    free(work); free(spec_a); free(spec_b);
+    printf("\nBenchmark completed for Direct vs FFT Correlation.\n\r");
+}
@@ -0,0 +1,226 @@
+#include "main.h"
+
+const corr_size CORR_SIZES[CORR_SIZES_COUNT] = {
+    {64, 16}, {256, 32}, {256, 64}, {1024, 64}, {1024, 256}
+};
+
+const int FFT_CORR_SIZES[FFT_CORR_SIZES_COUNT] = {32, 64, 128, 256, 512, 1024, 2048};
+
+RAM_FUNC void fill_stack_pattern_to_sp(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp) {
+        *p++ = 0xAAAAAAAA;
+    }
+}
+
+RAM_FUNC void enable_cycle_counter() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;      // Enable trace
+    DWT->CTRL |= (1 << 0);                               // CYCCNTENA
+    DWT->CTRL |= (1 << 16);                              // CPICNT
+    DWT->CTRL |= (1 << 17);                              // EXCCNT
+    DWT->CTRL |= (1 << 18);                              // SLEEPCNT
+    DWT->CTRL |= (1 << 19);                              // LSUCNT
+    DWT->CTRL |= (1 << 20);                              // FOLDCNT
+
+    DWT->CYCCNT = 0;
+    DWT->CPICNT = 0;
+    DWT->EXCCNT = 0;
+    DWT->SLEEPCNT = 0;
+    DWT->LSUCNT = 0;
+    DWT->FOLDCNT = 0;
+}
+
+RAM_FUNC uint32_t read_cycle_counter(void) {
+    return DWT->CYCCNT;
+}
+
+RAM_FUNC uint32_t measure_stack_usage(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp && *p == 0xAAAAAAAA) {
+        p++;
+    }
+    return ((uint32_t)sp - (uint32_t)p);
+}
+
+// Template b is a linear chirp; a holds its echo at a third of the free span, attenuated by
+// ECHO_GAIN, plus uniform noise of amplitude ECHO_NOISE from a fixed LCG. Both are multiplied
+// by scale.
+void generate_ping_echo_f64(float64_t *a, int len_a, float64_t *b, int len_b, float64_t scale) {
+    const int delay = (len_a - len_b) / 3;
+    const float64_t sweep = (PING_END_FREQ - PING_START_FREQ) / len_b;
+    uint32_t seed = 0x2545F491u;
+
+    for (int n = 0; n < len_b; n++) {
+        b[n] = scale * sin(2.0 * M_PI * (PING_START_FREQ * n + 0.5 * sweep * n * n));
+    }
+    for (int n = 0; n < len_a; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        float64_t noise = ECHO_NOISE * ((float64_t)(seed >> 8) / 8388608.0 - 1.0);
+        float64_t echo = (n >= delay && n < delay + len_b) ? ECHO_GAIN * b[n - delay] : 0.0;
+        a[n] = echo + scale * noise;
+    }
+}
+
+static q31_t f64_to_q31_sat(float64_t x) {
+    float64_t v = round(x * 2147483648.0);
+    if (v > 2147483647.0) v = 2147483647.0;
+    if (v < -2147483648.0) v = -2147483648.0;
+    return (q31_t)v;
+}
+
+static q15_t f64_to_q15_sat(float64_t x) {
+    float64_t v = round(x * 32768.0);
+    if (v > 32767.0) v = 32767.0;
+    if (v < -32768.0) v = -32768.0;
+    return (q15_t)v;
+}
+
+static q7_t f64_to_q7_sat(float64_t x) {
+    float64_t v = round(x * 128.0);
+    if (v > 127.0) v = 127.0;
+    if (v < -128.0) v = -128.0;
+    return (q7_t)v;
+}
+
+int corr_buffers_alloc(corr_buffers *b) {
+    const int scratch1_len = CORR_OPT_Q15_SCRATCH_LEN(CORR_LEN_A_MAX, CORR_LEN_B_MAX);
+    b->a_f64    = (float64_t*)malloc(CORR_LEN_A_MAX * sizeof(float64_t));
+    b->b_f64    = (float64_t*)malloc(CORR_LEN_B_MAX * sizeof(float64_t));
+    b->ref_f64  = (float64_t*)malloc(CORR_OUT_MAX * sizeof(float64_t));
+    b->test_f64 = (float64_t*)malloc(CORR_OUT_MAX * sizeof(float64_t));
+    b->a_f32    = (float32_t*)malloc(CORR_LEN_A_MAX * sizeof(float32_t));
+    b->b_f32    = (float32_t*)malloc(CORR_LEN_B_MAX * sizeof(float32_t));
+    b->dst_f32  = (float32_t*)malloc(CORR_OUT_MAX * sizeof(float32_t));
+    b->a_q31    = (q31_t*)malloc(CORR_LEN_A_MAX * sizeof(q31_t));
+    b->b_q31    = (q31_t*)malloc(CORR_LEN_B_MAX * sizeof(q31_t));
+    b->dst_q31  = (q31_t*)malloc(CORR_OUT_MAX * sizeof(q31_t));
+    b->a_q15    = (q15_t*)malloc(CORR_LEN_A_MAX * sizeof(q15_t));
+    b->b_q15    = (q15_t*)malloc(CORR_LEN_B_MAX * sizeof(q15_t));
+    b->dst_q15  = (q15_t*)malloc(CORR_OUT_MAX * sizeof(q15_t));
+    b->a_q7     = (q7_t*)malloc(CORR_LEN_A_MAX * sizeof(q7_t));
+    b->b_q7     = (q7_t*)malloc(CORR_LEN_B_MAX * sizeof(q7_t));
+    b->dst_q7   = (q7_t*)malloc(CORR_OUT_MAX * sizeof(q7_t));
+    b->scratch1 = (q15_t*)malloc(scratch1_len * sizeof(q15_t));
+    b->scratch2 = (q15_t*)malloc(CORR_LEN_B_MAX * sizeof(q15_t));
+
+    return b->a_f64 && b->b_f64 && b->ref_f64 && b->test_f64 &&
+           b->a_f32 && b->b_f32 && b->dst_f32 && b->a_q31 && b->b_q31 && b->dst_q31 &&
+           b->a_q15 && b->b_q15 && b->dst_q15 && b->a_q7 && b->b_q7 && b->dst_q7 &&
+           b->scratch1 && b->scratch2;
+}
+
+void corr_buffers_free(corr_buffers *b) {
+    free(b->a_f64); free(b->b_f64); free(b->ref_f64); free(b->test_f64);
+    free(b->a_f32); free(b->b_f32); free(b->dst_f32);
+    free(b->a_q31); free(b->b_q31); free(b->dst_q31);
+    free(b->a_q15); free(b->b_q15); free(b->dst_q15);
+    free(b->a_q7); free(b->b_q7); free(b->dst_q7);
+    free(b->scratch1); free(b->scratch2);
+}
+
+// Inputs are scaled by 1 / sqrt(len_b) so that no lag of the correlation or convolution
+// reaches 1.0 and the fixed-point variants never saturate.
+void corr_prepare(corr_buffers *b, int len_a, int len_b) {
+    b->len_a = len_a;
+    b->len_b = len_b;
+    generate_ping_echo_f64(b->a_f64, len_a, b->b_f64, len_b, 1.0 / sqrt((float64_t)len_b));
+
+    for (int i = 0; i < len_a; i++) {
+        b->a_f32[i] = (float32_t)b->a_f64[i];
+        b->a_q31[i] = f64_to_q31_sat(b->a_f64[i]);
+        b->a_q15[i] = f64_to_q15_sat(b->a_f64[i]);
+        b->a_q7[i] = f64_to_q7_sat(b->a_f64[i]);
+    }
+    for (int i = 0; i < len_b; i++) {
+        b->b_f32[i] = (float32_t)b->b_f64[i];
+        b->b_q31[i] = f64_to_q31_sat(b->b_f64[i]);
+        b->b_q15[i] = f64_to_q15_sat(b->b_f64[i]);
+        b->b_q7[i] = f64_to_q7_sat(b->b_f64[i]);
+    }
+}
+
+// CMSIS layout for len_a >= len_b: dst[len_a - 1 + m] = sum_n a[n + m] * b[n], 2 * len_a - 1
+// outputs, zero for lags the template cannot reach.
+void correlate_reference_f64(const float64_t *a, int len_a, const float64_t *b, int len_b, float64_t *dst) {
+    for (int m = -(len_a - 1); m < len_a; m++) {
+        float64_t acc = 0.0;
+        for (int n = 0; n < len_b; n++) {
+            if (n + m >= 0 && n + m < len_a) {
+                acc += a[n + m] * b[n];
+            }
+        }
+        dst[len_a - 1 + m] = acc;
+    }
+}
+
+// Full linear convolution, len_a + len_b - 1 outputs
+void conv_reference_f64(const float64_t *a, int len_a, const float64_t *b, int len_b, float64_t *dst) {
+    for (int n = 0; n < len_a + len_b - 1; n++) {
+        float64_t acc = 0.0;
+        for (int k = 0; k < len_b; k++) {
+            if (n - k >= 0 && n - k < len_a) {
+                acc += a[n - k] * b[k];
+            }
+        }
+        dst[n] = acc;
+    }
+}
+
+// Signal-to-noise ratio of test against ref in dB
+float64_t compute_snr_f64(const float64_t *ref, const float64_t *test, int N) {
+    float64_t signal = 0.0, noise = 0.0;
+    for (int i = 0; i < N; i++) {
+        float64_t err = ref[i] - test[i];
+        signal += ref[i] * ref[i];
+        noise += err * err;
+    }
+    if (noise == 0.0) {
+        return INFINITY;
+    }
+    return 10.0 * log10(signal / noise);
+}
+
+int peak_index_f64(const float64_t *x, int N) {
+    int peak = 0;
+    for (int i = 1; i < N; i++) {
+        if (fabs(x[i]) > fabs(x[peak])) {
+            peak = i;
+        }
+    }
+    return peak;
+}
+
+// Scores outputs [first, first + num_points) of test_f64 against ref_f64. For correlations
+// the peak is reported as a lag, which is what a ranging receiver would act on.
+RAM_FUNC void report_corr_result(const char *label, const corr_buffers *b, int first, int num_points, int is_correlation,
+                                 uint32_t cycle_count, uint32_t instr_est, uint32_t stack_used, uint32_t scratch_bytes) {
+    const int partial = !is_correlation && num_points < b->len_a + b->len_b - 1;
+    // Every output of a partial range lies where the template fully overlaps the signal
+    const uint32_t macs = partial ? (uint32_t)num_points * b->len_b : (uint32_t)b->len_a * b->len_b;
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n%s lenA = %d, lenB = %d", label, b->len_a, b->len_b);
+    if (partial) {
+        printf(", outputs %d..%d", first, first + num_points - 1);
+    }
+    printf("\n\r");
+    printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Scratch Buffer: %lu bytes\n\r", (unsigned long)scratch_bytes);
+    printf("Cycles per Output: %.2f\n\r", (float)cycle_count / num_points);
+    printf("Cycles per MAC: %.3f\n\r", (float)cycle_count / macs);
+    printf("SNR vs f64 reference: %.2f dB\n\r",
+           compute_snr_f64(b->ref_f64 + first, b->test_f64 + first, num_points));
+    if (is_correlation) {
+        printf("Peak Lag: %d (f64: %d)\n\r",
+               first + peak_index_f64(b->test_f64 + first, num_points) - (b->len_a - 1),
+               first + peak_index_f64(b->ref_f64 + first, num_points) - (b->len_a - 1));
+    }
+}
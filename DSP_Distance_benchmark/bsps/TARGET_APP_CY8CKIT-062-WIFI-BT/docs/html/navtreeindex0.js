@@ -0,0 +1,148 @@
+var NAVTREEINDEX0 =
+{
+"group__group__bsp__bt.html":[7,4],
+"group__group__bsp__bt.html#ga58d129cbeb845f8547f2140b8656ef88":[7,4,1],
+"group__group__bsp__bt.html#ga668864091ac3c80319d2051f04b1bddf":[7,4,4],
+"group__group__bsp__bt.html#ga874350ee5d9bfcafa5ddbb771f0770f9":[7,4,2],
+"group__group__bsp__bt.html#ga9090c8f19b0abb9792e62f2649044a7e":[7,4,5],
+"group__group__bsp__bt.html#gab7d4fad6bdee9bdff173acbbf1fbacee":[7,4,3],
+"group__group__bsp__bt.html#gad2a1cd8a260feac884c816510f34c23e":[7,4,6],
+"group__group__bsp__bt.html#gae6fcfdb93cc3e51a046b0cacbc49b4c2":[7,4,0],
+"group__group__bsp__errors.html":[7,0],
+"group__group__bsp__errors.html#gaee745bd3fccec6eb2df1e83fc4c9f775":[7,0,0],
+"group__group__bsp__functions.html":[7,1],
+"group__group__bsp__functions.html#gab989986b285e127f78f61c29f6ccbbfa":[7,1,0],
+"group__group__bsp__pin__state.html":[7,3],
+"group__group__bsp__pin__state.html#ga31577fad7e20fcb174e2ecbea2dd063e":[7,3,1],
+"group__group__bsp__pin__state.html#ga7778aac7809929e1032f406b59cbad90":[7,3,2],
+"group__group__bsp__pin__state.html#gaedfd071923034a335d143b7b64579169":[7,3,0],
+"group__group__bsp__pin__state.html#gafb9176679302bc5b2e002ad7caa56b09":[7,3,3],
+"group__group__bsp__pins.html":[7,2],
+"group__group__bsp__pins__arduino.html":[7,2,3],
+"group__group__bsp__pins__arduino.html#ga0875edb9e551c5eb01ac66dd27faf33a":[7,2,3,13],
+"group__group__bsp__pins__arduino.html#ga1246432b2f280267d3b9fd90028f6244":[7,2,3,16],
+"group__group__bsp__pins__arduino.html#ga3e497e03e8e9d8bd597f01426bc4b70a":[7,2,3,2],
+"group__group__bsp__pins__arduino.html#ga403c81e9f770b42e8a77668c9695b2dd":[7,2,3,14],
+"group__group__bsp__pins__arduino.html#ga5234f3a9694175eb70c5e20b9c1d30aa":[7,2,3,21],
+"group__group__bsp__pins__arduino.html#ga53d1f02f664bd82f42989ffa5d34912e":[7,2,3,3],
+"group__group__bsp__pins__arduino.html#ga77222cbe7f9f94826b9970c6bc4843aa":[7,2,3,9],
+"group__group__bsp__pins__arduino.html#ga7831843f5ca6c713a7adcb01291640f9":[7,2,3,20],
+"group__group__bsp__pins__arduino.html#ga7d1263cd4a6e3a4225e69496f200519a":[7,2,3,4],
+"group__group__bsp__pins__arduino.html#ga815d622465be76739d8e71d75725b7a5":[7,2,3,7],
+"group__group__bsp__pins__arduino.html#ga82f65194bfe335814d88649a2033b2f4":[7,2,3,5],
+"group__group__bsp__pins__arduino.html#ga87244e296d0eefe46f1bb9a579b435fa":[7,2,3,8],
+"group__group__bsp__pins__arduino.html#ga909572ea000d856223c6298cfd4fd067":[7,2,3,10],
+"group__group__bsp__pins__arduino.html#gaa436fdcdd1417ce4db7d0d8d4615d60b":[7,2,3,12],
+"group__group__bsp__pins__arduino.html#gab89ecd0381439ac9c927af7538f2afc4":[7,2,3,15],
+"group__group__bsp__pins__arduino.html#gabe652026d9d18fa2c626f744e260e36e":[7,2,3,19],
+"group__group__bsp__pins__arduino.html#gac7cddcd52b382156d8cb1af96d7988b8":[7,2,3,17],
+"group__group__bsp__pins__arduino.html#gae4c804044ed1e8745433efc32f1e3de5":[7,2,3,0],
+"group__group__bsp__pins__arduino.html#gae918eeaea45fa81576613eebef34335b":[7,2,3,11],
+"group__group__bsp__pins__arduino.html#gaeb5533ea084a75773bd3f2aaf3363ac9":[7,2,3,1],
+"group__group__bsp__pins__arduino.html#gaf3f59a1b7b94013adedd43cf3598af0a":[7,2,3,6],
+"group__group__bsp__pins__arduino.html#gaf9602a0824b644e2c54716c328b659e8":[7,2,3,18],
+"group__group__bsp__pins__btn.html":[7,2,1],
+"group__group__bsp__pins__btn.html#ga66053f56ad1d1992e7059a8734d8de14":[7,2,1,0],
+"group__group__bsp__pins__btn.html#ga719bfb6bb0a640a38d94febf75e45341":[7,2,1,2],
+"group__group__bsp__pins__btn.html#ga72717d2a6e1a64352274dfb2e5649ee9":[7,2,1,1],
+"group__group__bsp__pins__capsense.html":[7,2,5],
+"group__group__bsp__pins__capsense.html#ga0cfdc4c8461ae89960e23dfc9bc51d14":[7,2,5,10],
+"group__group__bsp__pins__capsense.html#ga2ab777c7d3a69627e91a5c7efed6d320":[7,2,5,8],
+"group__group__bsp__pins__capsense.html#ga2f22955f575e9b43b380bc1c713e4184":[7,2,5,5],
+"group__group__bsp__pins__capsense.html#ga36e321396e39f0173bcc05314b63f72b":[7,2,5,6],
+"group__group__bsp__pins__capsense.html#ga759e657681f3fefc466e0bd23287ab7a":[7,2,5,3],
+"group__group__bsp__pins__capsense.html#ga7dbe2bacd470aab43b4476d382db91c1":[7,2,5,2],
+"group__group__bsp__pins__capsense.html#gab8f05c019bc0eb120ca25fead2b538de":[7,2,5,0],
+"group__group__bsp__pins__capsense.html#gadb772f7b52e92ec5a13c192cf878b010":[7,2,5,4],
+"group__group__bsp__pins__capsense.html#gadd4324b6eaf10be0bbd26b9598372060":[7,2,5,1],
+"group__group__bsp__pins__capsense.html#gaeb41a9ba4c9ae8316bebe53f348cc2ed":[7,2,5,9],
+"group__group__bsp__pins__capsense.html#gaf7f9017ffd06ebcf8ba709d858ba5411":[7,2,5,7],
+"group__group__bsp__pins__comm.html":[7,2,2],
+"group__group__bsp__pins__comm.html#ga020ca7a044acda4b35e451513e5830df":[7,2,2,11],
+"group__group__bsp__pins__comm.html#ga034bfe0f68224dd376a9a79e07ab3451":[7,2,2,2],
+"group__group__bsp__pins__comm.html#ga07b4c8b6a15a1e614ff9be2ebe8088fd":[7,2,2,6],
+"group__group__bsp__pins__comm.html#ga07bdba5ea596bd4136de8a8b98c660e5":[7,2,2,31],
+"group__group__bsp__pins__comm.html#ga157d988297cf9f6e736a6b2568393b57":[7,2,2,35],
+"group__group__bsp__pins__comm.html#ga2ad55ac5a5ea027d72c8f702c7f9bbde":[7,2,2,12],
+"group__group__bsp__pins__comm.html#ga2bae07a55adc9f31e828312bc8fbdd82":[7,2,2,16],
+"group__group__bsp__pins__comm.html#ga2e4aea75f92232352bef06af68df7fbe":[7,2,2,36],
+"group__group__bsp__pins__comm.html#ga3ea3b59f511082e6616882dc64cadbb9":[7,2,2,19],
+"group__group__bsp__pins__comm.html#ga432faefd95828b8d45709aa8302a9433":[7,2,2,14],
+"group__group__bsp__pins__comm.html#ga49990e2184614916af625ad60c670cc9":[7,2,2,32],
+"group__group__bsp__pins__comm.html#ga598aa3824261cb9f6828c45bc93ce1bc":[7,2,2,28],
+"group__group__bsp__pins__comm.html#ga62f968c28d6dd878d706411644df3b04":[7,2,2,30],
+"group__group__bsp__pins__comm.html#ga640c8f2a95b8947b809fa42cd1bd6602":[7,2,2,33],
+"group__group__bsp__pins__comm.html#ga6b1476fd26d05e548b39e3eac8ca067d":[7,2,2,18],
+"group__group__bsp__pins__comm.html#ga819696334214ae0d912c381c7fb574f9":[7,2,2,37],
+"group__group__bsp__pins__comm.html#ga83425838dc05860473aebf66214ed9d3":[7,2,2,10],
+"group__group__bsp__pins__comm.html#ga84aaee84fd3639ebe802f835c02d364a":[7,2,2,21],
+"group__group__bsp__pins__comm.html#ga8643a26f39112d7f87aa8b6ebcdcd1b0":[7,2,2,25],
+"group__group__bsp__pins__comm.html#ga87d62aff3ed8c03d1ce66e2a7fa90f4b":[7,2,2,17],
+"group__group__bsp__pins__comm.html#ga8f50aad29445466679abdcc75dcd9796":[7,2,2,5],
+"group__group__bsp__pins__comm.html#ga9fba070d4040d6aa4f3e429bdfc38946":[7,2,2,4],
+"group__group__bsp__pins__comm.html#gaaea1a4ddc9aa57c45c4d6695b78ee878":[7,2,2,15],
+"group__group__bsp__pins__comm.html#gab480375f418ada758be1e7f32e42b232":[7,2,2,34],
+"group__group__bsp__pins__comm.html#gabeb93b3f9b953934666f83a1a97c4367":[7,2,2,8],
+"group__group__bsp__pins__comm.html#gad03531a5a7bdd646e29d417d45f089a8":[7,2,2,24],
+"group__group__bsp__pins__comm.html#gad178ee7378678fe5829a826f9a4ed0b8":[7,2,2,3],
+"group__group__bsp__pins__comm.html#gad1f1366c88d967f6856c6b89154d9403":[7,2,2,23],
+"group__group__bsp__pins__comm.html#gad8655e49bd423b566bee1346c63c252b":[7,2,2,29],
+"group__group__bsp__pins__comm.html#gad8d3655d655bb752363587ea521c8856":[7,2,2,9],
+"group__group__bsp__pins__comm.html#gad9cac48112cc5b44a707ab741956cd92":[7,2,2,22],
+"group__group__bsp__pins__comm.html#gada7037ba6e38219866f2892f87886b62":[7,2,2,13],
+"group__group__bsp__pins__comm.html#gae0984157f595e2626f420c2f504602b0":[7,2,2,20],
+"group__group__bsp__pins__comm.html#gae1daa9ae5985d8f4002347eee1362c76":[7,2,2,0],
+"group__group__bsp__pins__comm.html#gae4668c08493082ab2d7dca34eb8a9777":[7,2,2,26],
+"group__group__bsp__pins__comm.html#gaea8cd882c067c13b1411796d5235286d":[7,2,2,1],
+"group__group__bsp__pins__comm.html#gaedb2fc7c65fd4765368a9fc8acf16b44":[7,2,2,27],
+"group__group__bsp__pins__comm.html#gaf6282da9ac2be0fe7a4ac84735a24bb0":[7,2,2,7],
+"group__group__bsp__pins__j2.html":[7,2,4],
+"group__group__bsp__pins__j2.html#ga234dcb185b3018eef4e63f99fa6ae432":[7,2,4,11],
+"group__group__bsp__pins__j2.html#ga2928c0efaf596b9a1a2739be34d30afa":[7,2,4,0],
+"group__group__bsp__pins__j2.html#ga351b9a72317c7505803fbdb5bada4611":[7,2,4,17],
+"group__group__bsp__pins__j2.html#ga37bc159883dafce4a540940658d38101":[7,2,4,7],
+"group__group__bsp__pins__j2.html#ga3da7a7ac8f0659e9a5cc2a397cf4aeb0":[7,2,4,4],
+"group__group__bsp__pins__j2.html#ga3db3544314aaadb183474c2b08f90ac6":[7,2,4,6],
+"group__group__bsp__pins__j2.html#ga489d3c35d22a7902ec7fbdd6bac3e96d":[7,2,4,15],
+"group__group__bsp__pins__j2.html#ga48ff7a9d2f79351cd745bf00ebe1d6ea":[7,2,4,2],
+"group__group__bsp__pins__j2.html#ga5192402f5a9902f68c95dc873a6d7737":[7,2,4,12],
+"group__group__bsp__pins__j2.html#ga577ca258727a78c08c13c80317fadebf":[7,2,4,18],
+"group__group__bsp__pins__j2.html#ga582997c2fc8247293d7931cbb840798a":[7,2,4,5],
+"group__group__bsp__pins__j2.html#ga6163fd86d72d8841a5f3426ab8b9a0a3":[7,2,4,13],
+"group__group__bsp__pins__j2.html#ga720c63483ba499f759c07d878894c816":[7,2,4,8],
+"group__group__bsp__pins__j2.html#ga84ef9b47650cc51e597bee8359de6ae2":[7,2,4,3],
+"group__group__bsp__pins__j2.html#gab60587a5479714795602b0bbfaef85a4":[7,2,4,1],
+"group__group__bsp__pins__j2.html#gac784bc4514ae8d3dcb3d519176acb55c":[7,2,4,16],
+"group__group__bsp__pins__j2.html#gaca9046114145221ee2c371e71cce7133":[7,2,4,14],
+"group__group__bsp__pins__j2.html#gacd997157d0fe86fbea789eac342ec458":[7,2,4,9],
+"group__group__bsp__pins__j2.html#gacfd14b254b5a18710b786ec15f43759c":[7,2,4,10],
+"group__group__bsp__pins__led.html":[7,2,0],
+"group__group__bsp__pins__led.html#ga0d77bed8995ff0662adb3f7b2603af88":[7,2,0,0],
+"group__group__bsp__pins__led.html#ga2291710e025db3914eb6414f3b444cb1":[7,2,0,1],
+"group__group__bsp__pins__led.html#ga5e8df86514516cce06b41a40f749c898":[7,2,0,5],
+"group__group__bsp__pins__led.html#ga765a10242952bc96a34adc577fee8a20":[7,2,0,6],
+"group__group__bsp__pins__led.html#ga7a84bfbd7c6bf0109422638747d2f0a8":[7,2,0,8],
+"group__group__bsp__pins__led.html#gaabc3ce31f840a85f1063ff3029ab79eb":[7,2,0,4],
+"group__group__bsp__pins__led.html#gacc2bba8588b183ec1d448eda9a039d7c":[7,2,0,3],
+"group__group__bsp__pins__led.html#gacfc93533aad62754acf05cdf9c376125":[7,2,0,7],
+"group__group__bsp__pins__led.html#gad0f804ddeb67eb76f649fcdcb633e9c7":[7,2,0,10],
+"group__group__bsp__pins__led.html#gae7dcc47d4d611d3511c279de6992647a":[7,2,0,9],
+"group__group__bsp__pins__led.html#gaeee5786a7d2dbb36b7a0c7433a76a038":[7,2,0,2],
+"group__group__bsp__pins__wco.html":[7,2,6],
+"group__group__bsp__pins__wco.html#ga6f2a01a38771377b6fe57eb673f21380":[7,2,6,1],
+"group__group__bsp__pins__wco.html#gac07a2f3b38920ceba85a621a2196d18f":[7,2,6,0],
+"index.html":[],
+"index.html#autotoc_md1":[0],
+"index.html#autotoc_md2":[1],
+"index.html#autotoc_md3":[1,0],
+"index.html#autotoc_md4":[1,1],
+"index.html#autotoc_md5":[2],
+"index.html#autotoc_md6":[2,0],
+"index.html#autotoc_md7":[2,1],
+"index.html#autotoc_md8":[3],
+"index.html#autotoc_md9":[4],
+"md_bsp_settings.html":[6],
+"md_source_bsps_mt_bsp_user_guide.html":[5],
+"modules.html":[7],
+"pages.html":[]
+};
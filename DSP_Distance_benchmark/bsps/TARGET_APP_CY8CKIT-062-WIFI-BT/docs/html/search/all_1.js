@@ -0,0 +1,5 @@
+var searchData=
+[
+  ['bluetooth_20configuration_20structure_0',['Bluetooth Configuration Structure',['../group__group__bsp__bt.html',1,'']]],
+  ['button_20pins_1',['Button Pins',['../group__group__bsp__pins__btn.html',1,'']]]
+];
@@ -0,0 +1,52 @@
+#ifndef MAIN_H
+#define MAIN_H
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cyhal_clock.h"
+#include "cy_retarget_io.h"
+#include "arm_math.h"
+#include "core_cm4.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Constants
+#define DIST_SIZES_COUNT     4
+#define DIST_SIZE_MAX        512
+#define BOOL_SIZES_COUNT     4
+#define BOOL_SIZE_MAX        2048     // bits
+#define MINKOWSKI_ORDER      3
+
+// Gesture templates: 6-axis IMU frames, query 1/8 longer than the template and time-warped
+#define GESTURE_LENS_COUNT   3
+#define GESTURE_LEN_MAX      96
+#define GESTURE_DIMS         6
+#define GESTURE_QUERY_LEN(t) ((t) + (t) / 8)
+#define GESTURE_BUDGET_MS    10
+
+// Attributes
+#define RAM_FUNC __attribute__((section(".cy_ramfunc")))
+
+// Stack Limit
+extern uint32_t __StackLimit;
+
+// Clock Frequency
+extern uint32_t clkFastfreq;
+
+extern const int DIST_SIZES[DIST_SIZES_COUNT];
+extern const int BOOL_SIZES[BOOL_SIZES_COUNT];
+extern const int GESTURE_LENS[GESTURE_LENS_COUNT];
+
+// Prototypes for common utilities
+void fill_stack_pattern_to_sp(void);
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+uint32_t measure_stack_usage(void);
+void generate_uniform_f32(float32_t *out, int N, float32_t lo, float32_t hi, uint32_t seed);
+void generate_bits(uint32_t *out, int num_bits, uint32_t seed);
+void generate_gesture_f32(float32_t *frames, int len, int template_len, uint32_t seed);
+void report_distance_result(const char *label, int N, uint32_t cycle_count, uint32_t instr_est,
+                            uint32_t stack_used, float64_t value);
+
+#endif // MAIN_H
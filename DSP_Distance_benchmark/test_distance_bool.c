@@ -0,0 +1,62 @@
+#include "main.h"
+
+// Boolean distances take bit-packed vectors (32 bools per word) and a count of bools
+typedef float32_t (*bool_distance_fn)(const uint32_t *pA, const uint32_t *pB, uint32_t numberOfBools);
+
+static const bool_distance_fn BOOL_FUNCS[] = {
+    arm_dice_distance, arm_hamming_distance, arm_jaccard_distance,
+    arm_kulsinski_distance, arm_rogerstanimoto_distance, arm_russellrao_distance,
+    arm_sokalmichener_distance, arm_sokalsneath_distance, arm_yule_distance
+};
+
+static const char *const BOOL_LABELS[] = {
+    "DICE", "HAMMING", "JACCARD", "KULSINSKI", "ROGERSTANIMOTO", "RUSSELLRAO",
+    "SOKALMICHENER", "SOKALSNEATH", "YULE"
+};
+
+#define BOOL_FUNCS_COUNT (sizeof(BOOL_FUNCS) / sizeof(BOOL_FUNCS[0]))
+
+RAM_FUNC static void distance_bool(int metric, const uint32_t *a, const uint32_t *b, int num_bits) {
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    float32_t value = BOOL_FUNCS[metric](a, b, num_bits);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    report_distance_result(BOOL_LABELS[metric], num_bits, cycle_count, instr_est, stack_used, value);
+}
+
+RAM_FUNC void benchmark_distance_bool(void) {
+    printf("=== Boolean Distance Benchmark (bit-packed vectors) ===\n\r");
+
+    uint32_t *a = (uint32_t*)malloc(BOOL_SIZE_MAX / 32 * sizeof(uint32_t));
+    uint32_t *b = (uint32_t*)malloc(BOOL_SIZE_MAX / 32 * sizeof(uint32_t));
+    if (!a || !b) {
+        printf("Memory allocation failed for boolean vectors\n\r");
+        free(a); free(b);
+        return;
+    }
+
+    for (int s = 0; s < BOOL_SIZES_COUNT; s++) {
+        const int num_bits = BOOL_SIZES[s];
+        generate_bits(a, num_bits, 0x9E3779B9u + num_bits);
+        generate_bits(b, num_bits, 0x7F4A7C15u + num_bits);
+
+        printf("\n--- Bools = %d ---\n\r", num_bits);
+        for (int m = 0; m < (int)BOOL_FUNCS_COUNT; m++)
+            distance_bool(m, a, b, num_bits);
+    }
+
+    free(a); free(b);
+    printf("\nBenchmark completed for ARM Boolean Distance.\n\r");
+}
@@ -0,0 +1,143 @@
+#include "main.h"
+
+typedef enum {
+    DIST_BRAYCURTIS = 0,
+    DIST_CANBERRA,
+    DIST_CHEBYSHEV,
+    DIST_CITYBLOCK,
+    DIST_CORRELATION,
+    DIST_COSINE,
+    DIST_EUCLIDEAN,
+    DIST_JENSENSHANNON,
+    DIST_MINKOWSKI,
+    DIST_F32_COUNT
+} dist_f32_metric;
+
+static const char *const DIST_F32_LABELS[DIST_F32_COUNT] = {
+    "BRAYCURTIS F32", "CANBERRA F32", "CHEBYSHEV F32", "CITYBLOCK F32", "CORRELATION F32",
+    "COSINE F32", "EUCLIDEAN F32", "JENSENSHANNON F32", "MINKOWSKI (p = 3) F32"
+};
+
+// Jensen-Shannon expects probability vectors: strictly positive entries summing to 1
+static void normalize_probability(const float32_t *in, float32_t *out, int N) {
+    float32_t sum = 0.0f;
+    for (int i = 0; i < N; i++) {
+        out[i] = fabsf(in[i]) + 1e-3f;
+        sum += out[i];
+    }
+    for (int i = 0; i < N; i++)
+        out[i] /= sum;
+}
+
+RAM_FUNC static void distance_f32(dist_f32_metric metric, const float32_t *a, const float32_t *b,
+                                  float32_t *a_work, float32_t *b_work, int N) {
+    float32_t value = 0.0f;
+
+    // Correlation distance centres and scales its inputs in place; JS needs distributions
+    if (metric == DIST_CORRELATION) {
+        memcpy(a_work, a, N * sizeof(float32_t));
+        memcpy(b_work, b, N * sizeof(float32_t));
+    } else if (metric == DIST_JENSENSHANNON) {
+        normalize_probability(a, a_work, N);
+        normalize_probability(b, b_work, N);
+    }
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    switch (metric) {
+    case DIST_BRAYCURTIS:    value = arm_braycurtis_distance_f32(a, b, N); break;
+    case DIST_CANBERRA:      value = arm_canberra_distance_f32(a, b, N); break;
+    case DIST_CHEBYSHEV:     value = arm_chebyshev_distance_f32(a, b, N); break;
+    case DIST_CITYBLOCK:     value = arm_cityblock_distance_f32(a, b, N); break;
+    case DIST_CORRELATION:   value = arm_correlation_distance_f32(a_work, b_work, N); break;
+    case DIST_COSINE:        value = arm_cosine_distance_f32(a, b, N); break;
+    case DIST_EUCLIDEAN:     value = arm_euclidean_distance_f32(a, b, N); break;
+    case DIST_JENSENSHANNON: value = arm_jensenshannon_distance_f32(a_work, b_work, N); break;
+    case DIST_MINKOWSKI:     value = arm_minkowski_distance_f32(a, b, MINKOWSKI_ORDER, N); break;
+    default: break;
+    }
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    report_distance_result(DIST_F32_LABELS[metric], N, cycle_count, instr_est, stack_used, value);
+}
+
+// metric: 0 = chebyshev, 1 = cityblock, 2 = cosine, 3 = euclidean
+RAM_FUNC static void distance_f64(int metric, const float64_t *a, const float64_t *b, int N) {
+    static const char *const labels[] = {
+        "CHEBYSHEV F64", "CITYBLOCK F64", "COSINE F64", "EUCLIDEAN F64"
+    };
+    float64_t value;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (metric == 3)
+        value = arm_euclidean_distance_f64(a, b, N);
+    else if (metric == 2)
+        value = arm_cosine_distance_f64(a, b, N);
+    else if (metric == 1)
+        value = arm_cityblock_distance_f64(a, b, N);
+    else
+        value = arm_chebyshev_distance_f64(a, b, N);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    report_distance_result(labels[metric], N, cycle_count, instr_est, stack_used, value);
+}
+
+RAM_FUNC void benchmark_distance_f32(void) {
+    printf("=== Floating-Point Distance Benchmark (F32 and F64 metrics) ===\n\r");
+
+    float32_t *a = (float32_t*)malloc(DIST_SIZE_MAX * sizeof(float32_t));
+    float32_t *b = (float32_t*)malloc(DIST_SIZE_MAX * sizeof(float32_t));
+    float32_t *a_work = (float32_t*)malloc(DIST_SIZE_MAX * sizeof(float32_t));
+    float32_t *b_work = (float32_t*)malloc(DIST_SIZE_MAX * sizeof(float32_t));
+    float64_t *a_f64 = (float64_t*)malloc(DIST_SIZE_MAX * sizeof(float64_t));
+    float64_t *b_f64 = (float64_t*)malloc(DIST_SIZE_MAX * sizeof(float64_t));
+    if (!a || !b || !a_work || !b_work || !a_f64 || !b_f64) {
+        printf("Memory allocation failed for distance vectors\n\r");
+        free(a); free(b); free(a_work); free(b_work); free(a_f64); free(b_f64);
+        return;
+    }
+
+    for (int s = 0; s < DIST_SIZES_COUNT; s++) {
+        const int N = DIST_SIZES[s];
+
+        // Feature-vector style data: mostly positive so Bray-Curtis and Canberra stay well defined
+        generate_uniform_f32(a, N, -0.25f, 1.0f, 0x1234u + N);
+        generate_uniform_f32(b, N, -0.25f, 1.0f, 0x5678u + N);
+        for (int i = 0; i < N; i++) {
+            a_f64[i] = a[i];
+            b_f64[i] = b[i];
+        }
+
+        printf("\n--- N = %d ---\n\r", N);
+        for (int m = 0; m < DIST_F32_COUNT; m++)
+            distance_f32((dist_f32_metric)m, a, b, a_work, b_work, N);
+        for (int m = 0; m < 4; m++)
+            distance_f64(m, a_f64, b_f64, N);
+    }
+
+    free(a); free(b); free(a_work); free(b_work); free(a_f64); free(b_f64);
+    printf("\nBenchmark completed for ARM Distance F32.\n\r");
+}
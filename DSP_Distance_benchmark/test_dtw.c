@@ -0,0 +1,135 @@
+#include "main.h"
+
+// Gesture template matching: a time-warped 6-axis query against one stored template.
+// One comparison is the Q x T frame distance matrix (arm_euclidean_distance_f32 per frame
+// pair) followed by arm_dtw_distance_f32; the warping path is optional and timed on top.
+
+// window: 0 = none, 1 = Sakoe-Chiba (T / 4), 2 = slanted band (T / 8)
+static const char *const DTW_WINDOW_LABELS[] = {
+    "no window", "Sakoe-Chiba, size T/4", "slanted band, size T/8"
+};
+
+#define DTW_WINDOWS_COUNT 3
+
+RAM_FUNC static uint32_t build_distance_matrix(const float32_t *query, int query_len,
+                                               const float32_t *templ, int templ_len,
+                                               arm_matrix_instance_f32 *dist) {
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+
+    for (int q = 0; q < query_len; q++) {
+        for (int t = 0; t < templ_len; t++) {
+            dist->pData[q * templ_len + t] = arm_euclidean_distance_f32(&query[q * GESTURE_DIMS],
+                                                                        &templ[t * GESTURE_DIMS],
+                                                                        GESTURE_DIMS);
+        }
+    }
+
+    return read_cycle_counter() - start_cycles;
+}
+
+RAM_FUNC static void dtw_f32(int window, int templ_len, uint32_t matrix_cycles,
+                             const arm_matrix_instance_f32 *dist, arm_matrix_instance_q7 *win,
+                             arm_matrix_instance_f32 *dtw, int16_t *path) {
+    const int query_len = dist->numRows;
+    float32_t distance = 0.0f;
+    uint32_t path_len = 0;
+
+    if (window > 0) {
+        arm_dtw_window type = window == 1 ? ARM_DTW_SAKOE_CHIBA_WINDOW : ARM_DTW_SLANTED_BAND_WINDOW;
+        int32_t size = window == 1 ? templ_len / 4 : templ_len / 8;
+        if (arm_dtw_init_window_q7(type, size, win) != ARM_MATH_SUCCESS) {
+            printf("\nDTW window init failed for %s\n\r", DTW_WINDOW_LABELS[window]);
+            return;
+        }
+    }
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_status status = arm_dtw_distance_f32(dist, window > 0 ? win : NULL, dtw, &distance);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    arm_dtw_path_f32(dtw, path, &path_len);
+    uint32_t path_cycles = read_cycle_counter() - start_cycles;
+
+    const uint32_t compare_cycles = matrix_cycles + cycle_count;
+    const uint32_t budget_cycles = clkFastfreq / 1000 * GESTURE_BUDGET_MS;
+    float time_us = (float)compare_cycles / clkFastfreq * 1e6f;
+
+    printf("\nDTW F32 (%s) Q = %d, T = %d\n\r", DTW_WINDOW_LABELS[window], query_len, templ_len);
+    if (status != ARM_MATH_SUCCESS)
+        printf("arm_dtw_distance_f32 returned status %d\n\r", status);
+    printf("DTW Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Path Cycle Count: %lu (path length %lu)\n\r", (unsigned long)path_cycles, (unsigned long)path_len);
+    printf("Cycles per Template Comparison (matrix + DTW): %lu\n\r", (unsigned long)compare_cycles);
+    printf("Execution Time per Template (approx): %.3f us\n\r", time_us);
+    printf("Templates per %d ms Budget: %lu (with path: %lu)\n\r", GESTURE_BUDGET_MS,
+           (unsigned long)(budget_cycles / compare_cycles),
+           (unsigned long)(budget_cycles / (compare_cycles + path_cycles)));
+    printf("DTW Distance: %.6f\n\r", distance);
+}
+
+RAM_FUNC void benchmark_dtw(void) {
+    printf("=== DTW Gesture Template Matching Benchmark (F32, %d-axis frames) ===\n\r", GESTURE_DIMS);
+
+    const int query_max = GESTURE_QUERY_LEN(GESTURE_LEN_MAX);
+    float32_t *query = (float32_t*)malloc(query_max * GESTURE_DIMS * sizeof(float32_t));
+    float32_t *templ = (float32_t*)malloc(GESTURE_LEN_MAX * GESTURE_DIMS * sizeof(float32_t));
+    float32_t *dist_data = (float32_t*)malloc(query_max * GESTURE_LEN_MAX * sizeof(float32_t));
+    float32_t *dtw_data = (float32_t*)malloc(query_max * GESTURE_LEN_MAX * sizeof(float32_t));
+    q7_t *win_data = (q7_t*)malloc(query_max * GESTURE_LEN_MAX * sizeof(q7_t));
+    int16_t *path = (int16_t*)malloc(2 * (query_max + GESTURE_LEN_MAX) * sizeof(int16_t));
+    if (!query || !templ || !dist_data || !dtw_data || !win_data || !path) {
+        printf("Memory allocation failed for DTW buffers\n\r");
+        free(query); free(templ); free(dist_data); free(dtw_data); free(win_data); free(path);
+        return;
+    }
+
+    for (int g = 0; g < GESTURE_LENS_COUNT; g++) {
+        const int templ_len = GESTURE_LENS[g];
+        const int query_len = GESTURE_QUERY_LEN(templ_len);
+        arm_matrix_instance_f32 dist, dtw;
+        arm_matrix_instance_q7 win;
+
+        arm_mat_init_f32(&dist, query_len, templ_len, dist_data);
+        arm_mat_init_f32(&dtw, query_len, templ_len, dtw_data);
+        win.numRows = query_len;
+        win.numCols = templ_len;
+        win.pData = win_data;
+
+        generate_gesture_f32(templ, templ_len, templ_len, 0xC0FFEEu + templ_len);
+        generate_gesture_f32(query, query_len, templ_len, 0xBEEF01u + templ_len);
+
+        fill_stack_pattern_to_sp();
+        uint32_t matrix_cycles = build_distance_matrix(query, query_len, templ, templ_len, &dist);
+        uint32_t stack_used = measure_stack_usage();
+
+        printf("\n--- Template length T = %d, query length Q = %d ---\n\r", templ_len, query_len);
+        printf("Distance Matrix Cycle Count: %lu (%.1f cycles per frame pair)\n\r",
+               (unsigned long)matrix_cycles, (float)matrix_cycles / (query_len * templ_len));
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("DTW Working Memory: %lu bytes\n\r",
+               (unsigned long)(query_len * templ_len * (2 * sizeof(float32_t) + sizeof(q7_t))));
+
+        for (int w = 0; w < DTW_WINDOWS_COUNT; w++)
+            dtw_f32(w, templ_len, matrix_cycles, &dist, &win, &dtw, path);
+    }
+
+    free(query); free(templ); free(dist_data); free(dtw_data); free(win_data); free(path);
+    printf("\nBenchmark completed for ARM DTW.\n\r");
+}
@@ -0,0 +1,96 @@
+#include "main.h"
+
+const int DIST_SIZES[DIST_SIZES_COUNT] = {8, 32, 128, 512};
+const int BOOL_SIZES[BOOL_SIZES_COUNT] = {32, 128, 512, 2048};
+const int GESTURE_LENS[GESTURE_LENS_COUNT] = {32, 64, 96};
+
+RAM_FUNC void fill_stack_pattern_to_sp(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp) {
+        *p++ = 0xAAAAAAAA;
+    }
+}
+
+RAM_FUNC void enable_cycle_counter() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;      // Enable trace
+    DWT->CTRL |= (1 << 0);                               // CYCCNTENA
+    DWT->CTRL |= (1 << 16);                              // CPICNT
+    DWT->CTRL |= (1 << 17);                              // EXCCNT
+    DWT->CTRL |= (1 << 18);                              // SLEEPCNT
+    DWT->CTRL |= (1 << 19);                              // LSUCNT
+    DWT->CTRL |= (1 << 20);                              // FOLDCNT
+
+    DWT->CYCCNT = 0;
+    DWT->CPICNT = 0;
+    DWT->EXCCNT = 0;
+    DWT->SLEEPCNT = 0;
+    DWT->LSUCNT = 0;
+    DWT->FOLDCNT = 0;
+}
+
+RAM_FUNC uint32_t read_cycle_counter(void) {
+    return DWT->CYCCNT;
+}
+
+RAM_FUNC uint32_t measure_stack_usage(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp && *p == 0xAAAAAAAA) {
+        p++;
+    }
+    return ((uint32_t)sp - (uint32_t)p);
+}
+
+// Uniform values in [lo, hi) from a fixed LCG, so every run sees the same data
+void generate_uniform_f32(float32_t *out, int N, float32_t lo, float32_t hi, uint32_t seed) {
+    for (int i = 0; i < N; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        out[i] = lo + (hi - lo) * ((float32_t)(seed >> 8) / 16777216.0f);
+    }
+}
+
+// Packed boolean vector, 32 bools per word, unused bits of the last word cleared
+void generate_bits(uint32_t *out, int num_bits, uint32_t seed) {
+    const int words = (num_bits + 31) / 32;
+    for (int i = 0; i < words; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        out[i] = seed;
+    }
+    if (num_bits % 32) {
+        out[words - 1] &= (1u << (num_bits % 32)) - 1u;
+    }
+}
+
+// Synthetic 6-axis gesture: one sinusoid per axis over the template duration, plus 0.05
+// noise. Sampled at len points; when len differs from template_len the time axis is also
+// bent (up to 1/16 of the template) so that DTW has some warping to undo.
+void generate_gesture_f32(float32_t *frames, int len, int template_len, uint32_t seed) {
+    for (int i = 0; i < len; i++) {
+        float32_t t = (float32_t)i * (template_len - 1) / (len - 1);
+        if (len != template_len) {
+            t += template_len / 16.0f * sinf(M_PI * i / (len - 1));
+        }
+        for (int d = 0; d < GESTURE_DIMS; d++) {
+            seed = seed * 1664525u + 1013904223u;
+            float32_t noise = 0.05f * ((float32_t)(seed >> 8) / 8388608.0f - 1.0f);
+            frames[i * GESTURE_DIMS + d] = sinf(2.0f * M_PI * (d % 3 + 1) * t / template_len + d) + noise;
+        }
+    }
+}
+
+RAM_FUNC void report_distance_result(const char *label, int N, uint32_t cycle_count, uint32_t instr_est,
+                                     uint32_t stack_used, float64_t value) {
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n%s N = %d\n\r", label, N);
+    printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Cycles per Element: %.3f\n\r", (float)cycle_count / N);
+    printf("Distance: %.6f\n\r", value);
+}
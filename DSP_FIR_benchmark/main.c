@@ -2,6 +2,10 @@
 
 void benchmark_fir_f32(void);
 void benchmark_fir_q15(void);
+void benchmark_fir_tap_sweep(void);
+void benchmark_fir_decimate(void);
+void benchmark_fir_interpolate(void);
+void benchmark_lms(void);
 
 uint32_t clkFastfreq = 0;
 
@@ -42,6 +46,22 @@ RAM_FUNC int main(void)
     benchmark_fir_q15();
     printf("\n\r");
 
+    printf("*****Benchmarking ARM FIR Tap-Count Sweep (F32/Q15/Q31, fast variants)*****\n\r");
+    benchmark_fir_tap_sweep();
+    printf("\n\r");
+
+    printf("*****Benchmarking ARM FIR Decimate (F32/Q15)*****\n\r");
+    benchmark_fir_decimate();
+    printf("\n\r");
+
+    printf("*****Benchmarking ARM FIR Interpolate (F32/Q15)*****\n\r");
+    benchmark_fir_interpolate();
+    printf("\n\r");
+
+    printf("*****Benchmarking ARM LMS / NLMS (F32/Q15/Q31, tap x block sweep)*****\n\r");
+    benchmark_lms();
+    printf("\n\r");
+
 
     printf("All tests are completed.\n\r");
     printf("Finish CMSIS FFT Benchmark\n\r");
@@ -19,6 +19,33 @@
 #define NUM_TAPS_q15             8
 #define SNR_THRESHOLD_F32    75.0f
 
+// Tap-count sweep (f32/q15/q31 and the fast variants against an f64 reference)
+#define TAP_SIZES_COUNT      6
+#define NUM_TAPS_MAX         256
+#define SWEEP_BLOCK_SIZE     256
+#define SWEEP_CUTOFF_FREQ    6000.0f
+#define SWEEP_STOPBAND_FREQ  12000.0f
+
+// LMS / NLMS identification of an unknown low-pass FIR from the tap-sweep input
+#define LMS_TAP_SIZES_COUNT  4
+#define LMS_BLOCK_SIZES_COUNT 3
+#define LMS_NUM_TAPS_MAX     64
+#define LMS_BLOCK_SIZE_MAX   64
+#define LMS_SIGNAL_LEN       2048
+#define LMS_WINDOW           64    // error power is tracked per window of this many samples
+#define LMS_NUM_WINDOWS      (LMS_SIGNAL_LEN / LMS_WINDOW)
+#define LMS_MU_TAPS          0.25f // LMS step size is LMS_MU_TAPS / num_taps
+#define NLMS_MU              0.02f
+#define LMS_CONVERGED_DB     -30.0f
+
+// Polyphase resampling stage (16 kHz <-> 4 kHz)
+#define RESAMPLE_FACTOR      4
+#define RESAMPLE_IN_FREQ     16000.0f
+#define NUM_TAPS_POLY        32    // NUM_TAPS rounded up to a multiple of RESAMPLE_FACTOR
+#define NUM_TAPS_Q15_EVEN    30    // arm_fir_q15 needs an even tap count
+#define RESAMPLE_DEC_STATE_LEN(block)    (NUM_TAPS + (block) - 1)
+#define RESAMPLE_INTERP_STATE_LEN(block) (NUM_TAPS_POLY / RESAMPLE_FACTOR + (block) / RESAMPLE_FACTOR - 1)
+
 // Sine, step, ramp, and noise signal frequency and amplitude for generation
 #define SINE_FREQ            1000.0f
 #define SAMPLING_FREQ        48000.0f
@@ -35,13 +62,47 @@ extern uint32_t clkFastfreq;
 extern const int FIR_SIZES[];
 #define FIR_SIZES_COUNT 6
 #define Q15_SCALE 32767
+#define Q31_SCALE 2147483647.0
+
+extern const int TAP_SIZES[];
+extern const int LMS_TAP_SIZES[];
+extern const int LMS_BLOCK_SIZES[];
 extern const float32_t firCoeffs32[NUM_TAPS_ARRAY_SIZE];
 extern const q15_t firCoeffsQ15[NUM_TAPS_q15];
 
+// Resampling stage instances; block_size is counted in high-rate (16 kHz) samples
+typedef struct {
+    arm_fir_decimate_instance_f32 dec;
+    arm_fir_interpolate_instance_f32 interp;
+    float32_t interp_coeffs[NUM_TAPS_POLY];
+    uint32_t block_size;
+} resample_stage_f32;
+
+typedef struct {
+    arm_fir_decimate_instance_q15 dec;
+    arm_fir_interpolate_instance_q15 interp;
+    q15_t dec_coeffs[NUM_TAPS];
+    q15_t interp_coeffs[NUM_TAPS_POLY];
+    uint32_t block_size;
+} resample_stage_q15;
+
+arm_status resample_init_f32(resample_stage_f32 *r, float32_t *dec_state, float32_t *interp_state, uint32_t block_size);
+void resample_down_f32(const resample_stage_f32 *r, const float32_t *in, float32_t *out);
+void resample_up_f32(const resample_stage_f32 *r, const float32_t *in, float32_t *out);
+arm_status resample_init_q15(resample_stage_q15 *r, q15_t *dec_state, q15_t *interp_state, uint32_t block_size);
+void resample_down_q15(const resample_stage_q15 *r, const q15_t *in, q15_t *out);
+void resample_up_q15(const resample_stage_q15 *r, const q15_t *in, q15_t *out);
+
 // Prototypes for common utilities
 void fill_stack_pattern_to_sp(void);
 void enable_cycle_counter(void);
 uint32_t read_cycle_counter(void);
 uint32_t measure_stack_usage(void);
+void design_lowpass_f64(float64_t *coeffs, int num_taps, float64_t cutoff_norm);
+void generate_two_tone_f64(float64_t *out, int N);
+void fir_reference_f64(const float64_t *coeffs, int num_taps, const float64_t *input, float64_t *output, int N);
+float64_t compute_snr_f64(const float64_t *ref, const float64_t *test, int N, float64_t *max_abs_err);
+q15_t f64_to_q15_sat(float64_t x);
+q31_t f64_to_q31_sat(float64_t x);
 
 #endif // MAIN_H
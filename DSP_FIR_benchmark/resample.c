@@ -0,0 +1,72 @@
+#include "main.h"
+
+// 16 kHz <-> 4 kHz resampling built on the CMSIS polyphase FIR decimator/interpolator.
+// firCoeffs32 has zeros every fourth tap around its centre (a quarter-band low-pass),
+// so the same prototype serves as anti-alias filter for decimation and anti-imaging
+// filter for interpolation. The interpolator requires numTaps to be a multiple of L,
+// hence the zero padding to NUM_TAPS_POLY, and a gain of L to make up for the L-1
+// zeros inserted between input samples.
+
+RAM_FUNC arm_status resample_init_f32(resample_stage_f32 *r, float32_t *dec_state, float32_t *interp_state, uint32_t block_size)
+{
+    arm_status status;
+
+    r->block_size = block_size;
+    for (int k = 0; k < NUM_TAPS_POLY; k++) {
+        r->interp_coeffs[k] = (k < NUM_TAPS) ? firCoeffs32[k] * RESAMPLE_FACTOR : 0.0f;
+    }
+
+    status = arm_fir_decimate_init_f32(&r->dec, NUM_TAPS, RESAMPLE_FACTOR,
+                                       firCoeffs32, dec_state, block_size);
+    if (status != ARM_MATH_SUCCESS) {
+        return status;
+    }
+    return arm_fir_interpolate_init_f32(&r->interp, RESAMPLE_FACTOR, NUM_TAPS_POLY,
+                                        r->interp_coeffs, interp_state, block_size / RESAMPLE_FACTOR);
+}
+
+// block_size samples in, block_size / RESAMPLE_FACTOR samples out
+RAM_FUNC void resample_down_f32(const resample_stage_f32 *r, const float32_t *in, float32_t *out)
+{
+    arm_fir_decimate_f32(&r->dec, in, out, r->block_size);
+}
+
+// block_size / RESAMPLE_FACTOR samples in, block_size samples out
+RAM_FUNC void resample_up_f32(const resample_stage_f32 *r, const float32_t *in, float32_t *out)
+{
+    arm_fir_interpolate_f32(&r->interp, in, out, r->block_size / RESAMPLE_FACTOR);
+}
+
+RAM_FUNC arm_status resample_init_q15(resample_stage_q15 *r, q15_t *dec_state, q15_t *interp_state, uint32_t block_size)
+{
+    float32_t scaled[NUM_TAPS_POLY];
+    arm_status status;
+
+    r->block_size = block_size;
+    arm_float_to_q15(firCoeffs32, r->dec_coeffs, NUM_TAPS);
+
+    // The centre tap scaled by L is just above 1.0 and saturates to 0x7FFF (~0.2% gain
+    // error on one polyphase branch), which is below the q15 output resolution of interest.
+    for (int k = 0; k < NUM_TAPS_POLY; k++) {
+        scaled[k] = (k < NUM_TAPS) ? firCoeffs32[k] * RESAMPLE_FACTOR : 0.0f;
+    }
+    arm_float_to_q15(scaled, r->interp_coeffs, NUM_TAPS_POLY);
+
+    status = arm_fir_decimate_init_q15(&r->dec, NUM_TAPS, RESAMPLE_FACTOR,
+                                       r->dec_coeffs, dec_state, block_size);
+    if (status != ARM_MATH_SUCCESS) {
+        return status;
+    }
+    return arm_fir_interpolate_init_q15(&r->interp, RESAMPLE_FACTOR, NUM_TAPS_POLY,
+                                        r->interp_coeffs, interp_state, block_size / RESAMPLE_FACTOR);
+}
+
+RAM_FUNC void resample_down_q15(const resample_stage_q15 *r, const q15_t *in, q15_t *out)
+{
+    arm_fir_decimate_q15(&r->dec, in, out, r->block_size);
+}
+
+RAM_FUNC void resample_up_q15(const resample_stage_q15 *r, const q15_t *in, q15_t *out)
+{
+    arm_fir_interpolate_q15(&r->interp, in, out, r->block_size / RESAMPLE_FACTOR);
+}
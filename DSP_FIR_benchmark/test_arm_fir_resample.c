@@ -0,0 +1,324 @@
+#include "main.h"
+
+RAM_FUNC static void report_resample_result(const char *label, int N, int out_len,
+                                            uint32_t cycle_count, uint32_t instr_est, uint32_t stack_used) {
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n%s N = %d (%d output samples)\n\r", label, N, out_len);
+    printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Cycles per Output Sample: %.2f\n\r", (float)cycle_count / out_len);
+}
+
+// Decimate by RESAMPLE_FACTOR: polyphase decimator vs full-rate FIR followed by dropping
+// three of every four outputs. N counts input samples at RESAMPLE_IN_FREQ.
+RAM_FUNC void benchmark_fir_decimate(void) {
+    printf("=== FIR Decimate-by-%d Benchmark (sine input, various N) ===\n\r", RESAMPLE_FACTOR);
+    for (int idx = 0; idx < FIR_SIZES_COUNT; idx++) {
+        int N = FIR_SIZES[idx];
+        int M = N / RESAMPLE_FACTOR;
+
+        float32_t *input_f32 = (float32_t*)malloc(N * sizeof(float32_t));
+        float32_t *full_f32 = (float32_t*)malloc(N * sizeof(float32_t));
+        float32_t *drop_f32 = (float32_t*)malloc(M * sizeof(float32_t));
+        float32_t *dec_f32 = (float32_t*)malloc(M * sizeof(float32_t));
+        float32_t *firState_f32 = (float32_t*)calloc(NUM_TAPS + N - 1, sizeof(float32_t));
+        float32_t *decState_f32 = (float32_t*)calloc(RESAMPLE_DEC_STATE_LEN(N), sizeof(float32_t));
+        float32_t *interpState_f32 = (float32_t*)calloc(RESAMPLE_INTERP_STATE_LEN(N), sizeof(float32_t));
+        q15_t *input_q15 = (q15_t*)malloc(N * sizeof(q15_t));
+        q15_t *full_q15 = (q15_t*)malloc(N * sizeof(q15_t));
+        q15_t *drop_q15 = (q15_t*)malloc(M * sizeof(q15_t));
+        q15_t *dec_q15 = (q15_t*)malloc(M * sizeof(q15_t));
+        q15_t *firState_q15 = (q15_t*)calloc(NUM_TAPS_Q15_EVEN + N - 1, sizeof(q15_t));
+        q15_t *decState_q15 = (q15_t*)calloc(RESAMPLE_DEC_STATE_LEN(N), sizeof(q15_t));
+        q15_t *interpState_q15 = (q15_t*)calloc(RESAMPLE_INTERP_STATE_LEN(N), sizeof(q15_t));
+        resample_stage_f32 *rs_f32 = (resample_stage_f32*)malloc(sizeof(resample_stage_f32));
+        resample_stage_q15 *rs_q15 = (resample_stage_q15*)malloc(sizeof(resample_stage_q15));
+        if (!input_f32 || !full_f32 || !drop_f32 || !dec_f32 || !firState_f32 || !decState_f32 || !interpState_f32 ||
+            !input_q15 || !full_q15 || !drop_q15 || !dec_q15 || !firState_q15 || !decState_q15 || !interpState_q15 ||
+            !rs_f32 || !rs_q15) {
+            printf("Memory allocation failed for N = %d\n\r", N);
+            free(input_f32); free(full_f32); free(drop_f32); free(dec_f32);
+            free(firState_f32); free(decState_f32); free(interpState_f32);
+            free(input_q15); free(full_q15); free(drop_q15); free(dec_q15);
+            free(firState_q15); free(decState_q15); free(interpState_q15);
+            free(rs_f32); free(rs_q15);
+            continue;
+        }
+
+        for (int i = 0; i < N; i++) {
+            input_f32[i] = sinf(2 * M_PI * SINE_FREQ * i / RESAMPLE_IN_FREQ);
+        }
+        arm_float_to_q15(input_f32, input_q15, N);
+
+        // arm_fir_q15 needs an even length: pad firCoeffs32 with one zero tap at the front of the
+        // time-reversed array, i.e. on the oldest sample, so the response is unchanged
+        q15_t firCoeffs_q15_even[NUM_TAPS_Q15_EVEN] = {0};
+        arm_float_to_q15(firCoeffs32, &firCoeffs_q15_even[NUM_TAPS_Q15_EVEN - NUM_TAPS], NUM_TAPS);
+
+        arm_fir_instance_f32 S_f32;
+        arm_fir_init_f32(&S_f32, NUM_TAPS, (float32_t*)firCoeffs32, firState_f32, N);
+        arm_fir_instance_q15 S_q15;
+        arm_fir_init_q15(&S_q15, NUM_TAPS_Q15_EVEN, firCoeffs_q15_even, firState_q15, N);
+        if (resample_init_f32(rs_f32, decState_f32, interpState_f32, N) != ARM_MATH_SUCCESS ||
+            resample_init_q15(rs_q15, decState_q15, interpState_q15, N) != ARM_MATH_SUCCESS) {
+            printf("Resample stage init failed for N = %d\n\r", N);
+        } else {
+            // ---- f32 filter-then-drop ----
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            uint32_t start_cycles = read_cycle_counter();
+
+            arm_fir_f32(&S_f32, input_f32, full_f32, N);
+            for (int m = 0; m < M; m++) {
+                drop_f32[m] = full_f32[m * RESAMPLE_FACTOR];
+            }
+
+            uint32_t end_cycles = read_cycle_counter();
+            uint32_t cycle_count = end_cycles - start_cycles;
+            uint32_t instr_est = cycle_count
+                               - DWT->CPICNT
+                               - DWT->EXCCNT
+                               - DWT->SLEEPCNT
+                               - DWT->LSUCNT
+                               + DWT->FOLDCNT;
+            uint32_t stack_used = measure_stack_usage();
+            uint32_t baseline_cycles = cycle_count;
+            report_resample_result("FIR F32 filter-then-drop", N, M, cycle_count, instr_est, stack_used);
+
+            // ---- f32 polyphase decimator ----
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            start_cycles = read_cycle_counter();
+
+            resample_down_f32(rs_f32, input_f32, dec_f32);
+
+            end_cycles = read_cycle_counter();
+            cycle_count = end_cycles - start_cycles;
+            instr_est = cycle_count
+                      - DWT->CPICNT
+                      - DWT->EXCCNT
+                      - DWT->SLEEPCNT
+                      - DWT->LSUCNT
+                      + DWT->FOLDCNT;
+            stack_used = measure_stack_usage();
+            report_resample_result("FIR DECIMATE F32", N, M, cycle_count, instr_est, stack_used);
+
+            float32_t max_diff_f32 = 0.0f;
+            for (int m = 0; m < M; m++) {
+                float32_t d = fabsf(dec_f32[m] - drop_f32[m]);
+                if (d > max_diff_f32) max_diff_f32 = d;
+            }
+            printf("Speed-up vs filter-then-drop: %.2fx\n\r", (float)baseline_cycles / cycle_count);
+            printf("Max |decimate - filter-then-drop|: %.3e\n\r", max_diff_f32);
+
+            // ---- q15 filter-then-drop ----
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            start_cycles = read_cycle_counter();
+
+            arm_fir_q15(&S_q15, input_q15, full_q15, N);
+            for (int m = 0; m < M; m++) {
+                drop_q15[m] = full_q15[m * RESAMPLE_FACTOR];
+            }
+
+            end_cycles = read_cycle_counter();
+            cycle_count = end_cycles - start_cycles;
+            instr_est = cycle_count
+                      - DWT->CPICNT
+                      - DWT->EXCCNT
+                      - DWT->SLEEPCNT
+                      - DWT->LSUCNT
+                      + DWT->FOLDCNT;
+            stack_used = measure_stack_usage();
+            baseline_cycles = cycle_count;
+            report_resample_result("FIR Q15 filter-then-drop", N, M, cycle_count, instr_est, stack_used);
+
+            // ---- q15 polyphase decimator ----
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            start_cycles = read_cycle_counter();
+
+            resample_down_q15(rs_q15, input_q15, dec_q15);
+
+            end_cycles = read_cycle_counter();
+            cycle_count = end_cycles - start_cycles;
+            instr_est = cycle_count
+                      - DWT->CPICNT
+                      - DWT->EXCCNT
+                      - DWT->SLEEPCNT
+                      - DWT->LSUCNT
+                      + DWT->FOLDCNT;
+            stack_used = measure_stack_usage();
+            report_resample_result("FIR DECIMATE Q15", N, M, cycle_count, instr_est, stack_used);
+
+            int max_diff_q15 = 0;
+            for (int m = 0; m < M; m++) {
+                int d = abs(dec_q15[m] - drop_q15[m]);
+                if (d > max_diff_q15) max_diff_q15 = d;
+            }
+            printf("Speed-up vs filter-then-drop: %.2fx\n\r", (float)baseline_cycles / cycle_count);
+            printf("Max |decimate - filter-then-drop|: %d LSB\n\r", max_diff_q15);
+        }
+
+        free(input_f32); free(full_f32); free(drop_f32); free(dec_f32);
+        free(firState_f32); free(decState_f32); free(interpState_f32);
+        free(input_q15); free(full_q15); free(drop_q15); free(dec_q15);
+        free(firState_q15); free(decState_q15); free(interpState_q15);
+        free(rs_f32); free(rs_q15);
+    }
+    printf("\nBenchmark completed for ARM FIR Decimate.\n\r");
+}
+
+// Interpolate by RESAMPLE_FACTOR: polyphase interpolator vs zero-stuffing followed by a
+// full-rate FIR on the same NUM_TAPS_POLY prototype. N counts output samples at RESAMPLE_IN_FREQ.
+RAM_FUNC void benchmark_fir_interpolate(void) {
+    printf("=== FIR Interpolate-by-%d Benchmark (sine input, various N) ===\n\r", RESAMPLE_FACTOR);
+    for (int idx = 0; idx < FIR_SIZES_COUNT; idx++) {
+        int N = FIR_SIZES[idx];
+        int M = N / RESAMPLE_FACTOR;
+
+        float32_t *input_f32 = (float32_t*)malloc(M * sizeof(float32_t));
+        float32_t *stuffed_f32 = (float32_t*)malloc(N * sizeof(float32_t));
+        float32_t *full_f32 = (float32_t*)malloc(N * sizeof(float32_t));
+        float32_t *interp_f32 = (float32_t*)malloc(N * sizeof(float32_t));
+        float32_t *firState_f32 = (float32_t*)calloc(NUM_TAPS_POLY + N - 1, sizeof(float32_t));
+        float32_t *decState_f32 = (float32_t*)calloc(RESAMPLE_DEC_STATE_LEN(N), sizeof(float32_t));
+        float32_t *interpState_f32 = (float32_t*)calloc(RESAMPLE_INTERP_STATE_LEN(N), sizeof(float32_t));
+        q15_t *input_q15 = (q15_t*)malloc(M * sizeof(q15_t));
+        q15_t *stuffed_q15 = (q15_t*)malloc(N * sizeof(q15_t));
+        q15_t *full_q15 = (q15_t*)malloc(N * sizeof(q15_t));
+        q15_t *interp_q15 = (q15_t*)malloc(N * sizeof(q15_t));
+        q15_t *firState_q15 = (q15_t*)calloc(NUM_TAPS_POLY + N - 1, sizeof(q15_t));
+        q15_t *decState_q15 = (q15_t*)calloc(RESAMPLE_DEC_STATE_LEN(N), sizeof(q15_t));
+        q15_t *interpState_q15 = (q15_t*)calloc(RESAMPLE_INTERP_STATE_LEN(N), sizeof(q15_t));
+        resample_stage_f32 *rs_f32 = (resample_stage_f32*)malloc(sizeof(resample_stage_f32));
+        resample_stage_q15 *rs_q15 = (resample_stage_q15*)malloc(sizeof(resample_stage_q15));
+        if (!input_f32 || !stuffed_f32 || !full_f32 || !interp_f32 || !firState_f32 || !decState_f32 || !interpState_f32 ||
+            !input_q15 || !stuffed_q15 || !full_q15 || !interp_q15 || !firState_q15 || !decState_q15 || !interpState_q15 ||
+            !rs_f32 || !rs_q15) {
+            printf("Memory allocation failed for N = %d\n\r", N);
+            free(input_f32); free(stuffed_f32); free(full_f32); free(interp_f32);
+            free(firState_f32); free(decState_f32); free(interpState_f32);
+            free(input_q15); free(stuffed_q15); free(full_q15); free(interp_q15);
+            free(firState_q15); free(decState_q15); free(interpState_q15);
+            free(rs_f32); free(rs_q15);
+            continue;
+        }
+
+        // Low-rate input at RESAMPLE_IN_FREQ / RESAMPLE_FACTOR
+        for (int i = 0; i < M; i++) {
+            input_f32[i] = sinf(2 * M_PI * SINE_FREQ * i * RESAMPLE_FACTOR / RESAMPLE_IN_FREQ);
+        }
+        arm_float_to_q15(input_f32, input_q15, M);
+
+        if (resample_init_f32(rs_f32, decState_f32, interpState_f32, N) != ARM_MATH_SUCCESS ||
+            resample_init_q15(rs_q15, decState_q15, interpState_q15, N) != ARM_MATH_SUCCESS) {
+            printf("Resample stage init failed for N = %d\n\r", N);
+        } else {
+            // Baseline filters reuse the stage's gain-corrected prototype
+            arm_fir_instance_f32 S_f32;
+            arm_fir_init_f32(&S_f32, NUM_TAPS_POLY, rs_f32->interp_coeffs, firState_f32, N);
+            arm_fir_instance_q15 S_q15;
+            arm_fir_init_q15(&S_q15, NUM_TAPS_POLY, rs_q15->interp_coeffs, firState_q15, N);
+
+            // ---- f32 zero-stuff-then-filter ----
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            uint32_t start_cycles = read_cycle_counter();
+
+            for (int m = 0; m < M; m++) {
+                stuffed_f32[m * RESAMPLE_FACTOR] = input_f32[m];
+                for (int l = 1; l < RESAMPLE_FACTOR; l++) {
+                    stuffed_f32[m * RESAMPLE_FACTOR + l] = 0.0f;
+                }
+            }
+            arm_fir_f32(&S_f32, stuffed_f32, full_f32, N);
+
+            uint32_t end_cycles = read_cycle_counter();
+            uint32_t cycle_count = end_cycles - start_cycles;
+            uint32_t instr_est = cycle_count
+                               - DWT->CPICNT
+                               - DWT->EXCCNT
+                               - DWT->SLEEPCNT
+                               - DWT->LSUCNT
+                               + DWT->FOLDCNT;
+            uint32_t stack_used = measure_stack_usage();
+            uint32_t baseline_cycles = cycle_count;
+            report_resample_result("FIR F32 zero-stuff-then-filter", N, N, cycle_count, instr_est, stack_used);
+
+            // ---- f32 polyphase interpolator ----
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            start_cycles = read_cycle_counter();
+
+            resample_up_f32(rs_f32, input_f32, interp_f32);
+
+            end_cycles = read_cycle_counter();
+            cycle_count = end_cycles - start_cycles;
+            instr_est = cycle_count
+                      - DWT->CPICNT
+                      - DWT->EXCCNT
+                      - DWT->SLEEPCNT
+                      - DWT->LSUCNT
+                      + DWT->FOLDCNT;
+            stack_used = measure_stack_usage();
+            report_resample_result("FIR INTERPOLATE F32", N, N, cycle_count, instr_est, stack_used);
+            printf("Speed-up vs zero-stuff-then-filter: %.2fx\n\r", (float)baseline_cycles / cycle_count);
+
+            // ---- q15 zero-stuff-then-filter ----
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            start_cycles = read_cycle_counter();
+
+            for (int m = 0; m < M; m++) {
+                stuffed_q15[m * RESAMPLE_FACTOR] = input_q15[m];
+                for (int l = 1; l < RESAMPLE_FACTOR; l++) {
+                    stuffed_q15[m * RESAMPLE_FACTOR + l] = 0;
+                }
+            }
+            arm_fir_q15(&S_q15, stuffed_q15, full_q15, N);
+
+            end_cycles = read_cycle_counter();
+            cycle_count = end_cycles - start_cycles;
+            instr_est = cycle_count
+                      - DWT->CPICNT
+                      - DWT->EXCCNT
+                      - DWT->SLEEPCNT
+                      - DWT->LSUCNT
+                      + DWT->FOLDCNT;
+            stack_used = measure_stack_usage();
+            baseline_cycles = cycle_count;
+            report_resample_result("FIR Q15 zero-stuff-then-filter", N, N, cycle_count, instr_est, stack_used);
+
+            // ---- q15 polyphase interpolator ----
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            start_cycles = read_cycle_counter();
+
+            resample_up_q15(rs_q15, input_q15, interp_q15);
+
+            end_cycles = read_cycle_counter();
+            cycle_count = end_cycles - start_cycles;
+            instr_est = cycle_count
+                      - DWT->CPICNT
+                      - DWT->EXCCNT
+                      - DWT->SLEEPCNT
+                      - DWT->LSUCNT
+                      + DWT->FOLDCNT;
+            stack_used = measure_stack_usage();
+            report_resample_result("FIR INTERPOLATE Q15", N, N, cycle_count, instr_est, stack_used);
+            printf("Speed-up vs zero-stuff-then-filter: %.2fx\n\r", (float)baseline_cycles / cycle_count);
+        }
+
+        free(input_f32); free(stuffed_f32); free(full_f32); free(interp_f32);
+        free(firState_f32); free(decState_f32); free(interpState_f32);
+        free(input_q15); free(stuffed_q15); free(full_q15); free(interp_q15);
+        free(firState_q15); free(decState_q15); free(interpState_q15);
+        free(rs_f32); free(rs_q15);
+    }
+    printf("\nBenchmark completed for ARM FIR Interpolate.\n\r");
+}
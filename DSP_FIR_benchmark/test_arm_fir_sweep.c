@@ -0,0 +1,189 @@
+#include "main.h"
+
+// Shared buffers for one tap-count sweep. Inputs are generated once in f64 and
+// quantised per datatype; every variant is scored against the same f64 reference.
+typedef struct {
+    int N;
+    float64_t *input_f64;
+    float64_t *ref_f64;
+    float64_t *test_f64;
+    float64_t *coeffs_f64;
+    float32_t *input_f32;
+    float32_t *output_f32;
+    float32_t *coeffs_f32;
+    float32_t *state_f32;
+    q15_t *input_q15;
+    q15_t *output_q15;
+    q15_t *coeffs_q15;
+    q15_t *state_q15;
+    q31_t *input_q31;
+    q31_t *output_q31;
+    q31_t *coeffs_q31;
+    q31_t *state_q31;
+} fir_sweep_buffers;
+
+RAM_FUNC static void report_sweep_result(const char *variant, int taps, const fir_sweep_buffers *b,
+                                         uint32_t cycle_count, uint32_t instr_est, uint32_t stack_used) {
+    float64_t max_abs_err = 0.0;
+    float64_t snr_db = compute_snr_f64(b->ref_f64, b->test_f64, b->N, &max_abs_err);
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+    float cycles_per_tap_sample = (float)cycle_count / ((float)taps * b->N);
+
+    printf("\nFIR %s taps = %d, N = %d\n\r", variant, taps, b->N);
+    printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Cycles per Tap-Sample: %.3f\n\r", cycles_per_tap_sample);
+    printf("SNR vs f64 reference: %.2f dB\n\r", snr_db);
+    printf("Max Abs Error: %.3e\n\r", max_abs_err);
+}
+
+RAM_FUNC static void sweep_fir_f32(int taps, fir_sweep_buffers *b) {
+    arm_fir_instance_f32 S;
+    arm_fir_init_f32(&S, taps, b->coeffs_f32, b->state_f32, b->N);
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_fir_f32(&S, b->input_f32, b->output_f32, b->N);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < b->N; i++)
+        b->test_f64[i] = b->output_f32[i];
+    report_sweep_result("F32", taps, b, cycle_count, instr_est, stack_used);
+}
+
+RAM_FUNC static void sweep_fir_q15(int taps, fir_sweep_buffers *b, int fast) {
+    arm_fir_instance_q15 S;
+    if (arm_fir_init_q15(&S, taps, b->coeffs_q15, b->state_q15, b->N) != ARM_MATH_SUCCESS) {
+        printf("FIR Q15 init failed for taps = %d\n\r", taps);
+        return;
+    }
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (fast)
+        arm_fir_fast_q15(&S, b->input_q15, b->output_q15, b->N);
+    else
+        arm_fir_q15(&S, b->input_q15, b->output_q15, b->N);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < b->N; i++)
+        b->test_f64[i] = (float64_t)b->output_q15[i] / 32768.0;
+    report_sweep_result(fast ? "FAST Q15" : "Q15", taps, b, cycle_count, instr_est, stack_used);
+}
+
+RAM_FUNC static void sweep_fir_q31(int taps, fir_sweep_buffers *b, int fast) {
+    arm_fir_instance_q31 S;
+    arm_fir_init_q31(&S, taps, b->coeffs_q31, b->state_q31, b->N);
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (fast)
+        arm_fir_fast_q31(&S, b->input_q31, b->output_q31, b->N);
+    else
+        arm_fir_q31(&S, b->input_q31, b->output_q31, b->N);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    for (int i = 0; i < b->N; i++)
+        b->test_f64[i] = (float64_t)b->output_q31[i] / 2147483648.0;
+    report_sweep_result(fast ? "FAST Q31" : "Q31", taps, b, cycle_count, instr_est, stack_used);
+}
+
+RAM_FUNC void benchmark_fir_tap_sweep(void) {
+    printf("=== FIR Tap-Count Sweep (low-pass, two-tone input, N = %d) ===\n\r", SWEEP_BLOCK_SIZE);
+
+    fir_sweep_buffers b;
+    int N = SWEEP_BLOCK_SIZE;
+    b.N = N;
+    b.input_f64  = (float64_t*)malloc(N * sizeof(float64_t));
+    b.ref_f64    = (float64_t*)malloc(N * sizeof(float64_t));
+    b.test_f64   = (float64_t*)malloc(N * sizeof(float64_t));
+    b.coeffs_f64 = (float64_t*)malloc(NUM_TAPS_MAX * sizeof(float64_t));
+    b.input_f32  = (float32_t*)malloc(N * sizeof(float32_t));
+    b.output_f32 = (float32_t*)malloc(N * sizeof(float32_t));
+    b.coeffs_f32 = (float32_t*)malloc(NUM_TAPS_MAX * sizeof(float32_t));
+    b.state_f32  = (float32_t*)calloc(NUM_TAPS_MAX + N - 1, sizeof(float32_t));
+    b.input_q15  = (q15_t*)malloc(N * sizeof(q15_t));
+    b.output_q15 = (q15_t*)malloc(N * sizeof(q15_t));
+    b.coeffs_q15 = (q15_t*)malloc(NUM_TAPS_MAX * sizeof(q15_t));
+    b.state_q15  = (q15_t*)calloc(NUM_TAPS_MAX + N - 1, sizeof(q15_t));
+    b.input_q31  = (q31_t*)malloc(N * sizeof(q31_t));
+    b.output_q31 = (q31_t*)malloc(N * sizeof(q31_t));
+    b.coeffs_q31 = (q31_t*)malloc(NUM_TAPS_MAX * sizeof(q31_t));
+    b.state_q31  = (q31_t*)calloc(NUM_TAPS_MAX + N - 1, sizeof(q31_t));
+
+    if (!b.input_f64 || !b.ref_f64 || !b.test_f64 || !b.coeffs_f64 ||
+        !b.input_f32 || !b.output_f32 || !b.coeffs_f32 || !b.state_f32 ||
+        !b.input_q15 || !b.output_q15 || !b.coeffs_q15 || !b.state_q15 ||
+        !b.input_q31 || !b.output_q31 || !b.coeffs_q31 || !b.state_q31) {
+        printf("Memory allocation failed for FIR tap sweep\n\r");
+    } else {
+        // In-band tone plus a stop-band tone; peak 0.75 leaves headroom for the fast accumulators
+        generate_two_tone_f64(b.input_f64, N);
+        for (int i = 0; i < N; i++) {
+            b.input_f32[i] = (float32_t)b.input_f64[i];
+            b.input_q15[i] = f64_to_q15_sat(b.input_f64[i]);
+            b.input_q31[i] = f64_to_q31_sat(b.input_f64[i]);
+        }
+
+        for (int idx = 0; idx < TAP_SIZES_COUNT; idx++) {
+            int taps = TAP_SIZES[idx];
+
+            design_lowpass_f64(b.coeffs_f64, taps, SWEEP_CUTOFF_FREQ / SAMPLING_FREQ);
+            for (int k = 0; k < taps; k++) {
+                b.coeffs_f32[k] = (float32_t)b.coeffs_f64[k];
+                b.coeffs_q15[k] = f64_to_q15_sat(b.coeffs_f64[k]);
+                b.coeffs_q31[k] = f64_to_q31_sat(b.coeffs_f64[k]);
+            }
+            fir_reference_f64(b.coeffs_f64, taps, b.input_f64, b.ref_f64, N);
+
+            printf("\n--- NUM_TAPS = %d ---\n\r", taps);
+            sweep_fir_f32(taps, &b);
+            sweep_fir_q15(taps, &b, 0);
+            sweep_fir_q15(taps, &b, 1);
+            sweep_fir_q31(taps, &b, 0);
+            sweep_fir_q31(taps, &b, 1);
+        }
+    }
+
+    free(b.input_f64); free(b.ref_f64); free(b.test_f64); free(b.coeffs_f64);
+    free(b.input_f32); free(b.output_f32); free(b.coeffs_f32); free(b.state_f32);
+    free(b.input_q15); free(b.output_q15); free(b.coeffs_q15); free(b.state_q15);
+    free(b.input_q31); free(b.output_q31); free(b.coeffs_q31); free(b.state_q31);
+    printf("\nBenchmark completed for ARM FIR tap-count sweep.\n\r");
+}
@@ -0,0 +1,251 @@
+#include "main.h"
+
+// System identification: the adaptive filter sees the tap-sweep two-tone input x and adapts
+// towards d = plant(x), where the plant is a low-pass FIR with as many taps as the filter.
+// Every q15/q31 run is compared with the f32 run of the same algorithm, tap count and block
+// size: where it converges (error power below LMS_CONVERGED_DB for good) and how far down.
+typedef struct {
+    float32_t *x_f32;
+    float32_t *d_f32;
+    float32_t *out_f32;
+    float32_t *err_f32;
+    float32_t *coeffs_f32;
+    float32_t *state_f32;
+    q15_t *x_q15;
+    q15_t *d_q15;
+    q15_t *out_q15;
+    q15_t *err_q15;
+    q15_t *coeffs_q15;
+    q15_t *state_q15;
+    q31_t *x_q31;
+    q31_t *d_q31;
+    q31_t *out_q31;
+    q31_t *err_q31;
+    q31_t *coeffs_q31;
+    q31_t *state_q31;
+    float64_t d_energy[LMS_NUM_WINDOWS];
+} lms_buffers;
+
+typedef struct {
+    float64_t err_energy[LMS_NUM_WINDOWS];
+    uint32_t steady_cycles;     // cycles over the second half of the signal
+    uint32_t max_block_cycles;
+    uint32_t stack_used;
+} lms_result;
+
+static void lms_add_block_cycles(lms_result *r, int start, uint32_t cycle_count) {
+    if (start >= LMS_SIGNAL_LEN / 2)
+        r->steady_cycles += cycle_count;
+    if (cycle_count > r->max_block_cycles)
+        r->max_block_cycles = cycle_count;
+}
+
+// First sample after which every window stays below LMS_CONVERGED_DB, or -1
+static int lms_converged_at(const lms_buffers *b, const lms_result *r) {
+    int w = LMS_NUM_WINDOWS;
+    while (w > 0 && 10.0 * log10(r->err_energy[w - 1] / b->d_energy[w - 1] + 1e-30) < LMS_CONVERGED_DB)
+        w--;
+    return w == LMS_NUM_WINDOWS ? -1 : w * LMS_WINDOW;
+}
+
+static float64_t lms_final_db(const lms_buffers *b, const lms_result *r) {
+    return 10.0 * log10(r->err_energy[LMS_NUM_WINDOWS - 1] / b->d_energy[LMS_NUM_WINDOWS - 1] + 1e-30);
+}
+
+RAM_FUNC static void report_lms_result(const char *variant, int taps, int block_size, const lms_buffers *b,
+                                       const lms_result *r, const lms_result *ref) {
+    const int converged = lms_converged_at(b, r);
+    const int ref_converged = lms_converged_at(b, ref);
+    const float cycles_per_sample = (float)r->steady_cycles / (LMS_SIGNAL_LEN / 2);
+
+    printf("\n%s taps = %d, block = %d\n\r", variant, taps, block_size);
+    printf("Steady-State Cycles per Sample: %.2f\n\r", cycles_per_sample);
+    printf("Steady-State Cycles per Tap-Sample: %.3f\n\r", cycles_per_sample / taps);
+    printf("Max Block Cycle Count: %lu\n\r", (unsigned long)r->max_block_cycles);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)r->stack_used);
+    if (converged < 0)
+        printf("Converged at Sample: never (F32: %d)\n\r", ref_converged);
+    else
+        printf("Converged at Sample: %d (F32: %d)\n\r", converged, ref_converged);
+    printf("Final Error Power: %.2f dB (F32: %.2f dB)\n\r", lms_final_db(b, r), lms_final_db(b, ref));
+    if (r != ref) {
+        if (converged < 0 && ref_converged < 0) {
+            printf("Convergence vs F32: NOT CONVERGED\n\r");
+        } else {
+            int match = converged >= 0 && ref_converged >= 0 && abs(converged - ref_converged) <= 2 * LMS_WINDOW;
+            printf("Convergence vs F32: %s\n\r", match ? "EQUIVALENT" : "DIFFERENT");
+        }
+    }
+}
+
+RAM_FUNC static void run_lms_f32(int taps, int block_size, int norm, const lms_buffers *b, lms_result *r) {
+    arm_lms_instance_f32 S;
+    arm_lms_norm_instance_f32 SN;
+    const float32_t mu = norm ? NLMS_MU : LMS_MU_TAPS / taps;
+
+    memset(r, 0, sizeof(*r));
+    memset(b->coeffs_f32, 0, taps * sizeof(float32_t));
+    memset(b->state_f32, 0, (taps + block_size - 1) * sizeof(float32_t));
+    if (norm)
+        arm_lms_norm_init_f32(&SN, taps, b->coeffs_f32, b->state_f32, mu, block_size);
+    else
+        arm_lms_init_f32(&S, taps, b->coeffs_f32, b->state_f32, mu, block_size);
+
+    fill_stack_pattern_to_sp();
+    for (int start = 0; start < LMS_SIGNAL_LEN; start += block_size) {
+        enable_cycle_counter();
+        uint32_t start_cycles = read_cycle_counter();
+
+        if (norm)
+            arm_lms_norm_f32(&SN, b->x_f32 + start, b->d_f32 + start, b->out_f32, b->err_f32, block_size);
+        else
+            arm_lms_f32(&S, b->x_f32 + start, b->d_f32 + start, b->out_f32, b->err_f32, block_size);
+
+        lms_add_block_cycles(r, start, read_cycle_counter() - start_cycles);
+        for (int i = 0; i < block_size; i++)
+            r->err_energy[(start + i) / LMS_WINDOW] += (float64_t)b->err_f32[i] * b->err_f32[i];
+    }
+    r->stack_used = measure_stack_usage();
+}
+
+RAM_FUNC static void run_lms_q15(int taps, int block_size, int norm, const lms_buffers *b, lms_result *r) {
+    arm_lms_instance_q15 S;
+    arm_lms_norm_instance_q15 SN;
+    const q15_t mu = f64_to_q15_sat(norm ? NLMS_MU : LMS_MU_TAPS / taps);
+
+    memset(r, 0, sizeof(*r));
+    memset(b->coeffs_q15, 0, taps * sizeof(q15_t));
+    memset(b->state_q15, 0, (taps + block_size - 1) * sizeof(q15_t));
+    if (norm)
+        arm_lms_norm_init_q15(&SN, taps, b->coeffs_q15, b->state_q15, mu, block_size, 0);
+    else
+        arm_lms_init_q15(&S, taps, b->coeffs_q15, b->state_q15, mu, block_size, 0);
+
+    fill_stack_pattern_to_sp();
+    for (int start = 0; start < LMS_SIGNAL_LEN; start += block_size) {
+        enable_cycle_counter();
+        uint32_t start_cycles = read_cycle_counter();
+
+        if (norm)
+            arm_lms_norm_q15(&SN, b->x_q15 + start, b->d_q15 + start, b->out_q15, b->err_q15, block_size);
+        else
+            arm_lms_q15(&S, b->x_q15 + start, b->d_q15 + start, b->out_q15, b->err_q15, block_size);
+
+        lms_add_block_cycles(r, start, read_cycle_counter() - start_cycles);
+        for (int i = 0; i < block_size; i++) {
+            float64_t e = (float64_t)b->err_q15[i] / 32768.0;
+            r->err_energy[(start + i) / LMS_WINDOW] += e * e;
+        }
+    }
+    r->stack_used = measure_stack_usage();
+}
+
+RAM_FUNC static void run_lms_q31(int taps, int block_size, int norm, const lms_buffers *b, lms_result *r) {
+    arm_lms_instance_q31 S;
+    arm_lms_norm_instance_q31 SN;
+    const q31_t mu = f64_to_q31_sat(norm ? NLMS_MU : LMS_MU_TAPS / taps);
+
+    memset(r, 0, sizeof(*r));
+    memset(b->coeffs_q31, 0, taps * sizeof(q31_t));
+    memset(b->state_q31, 0, (taps + block_size - 1) * sizeof(q31_t));
+    if (norm)
+        arm_lms_norm_init_q31(&SN, taps, b->coeffs_q31, b->state_q31, mu, block_size, 0);
+    else
+        arm_lms_init_q31(&S, taps, b->coeffs_q31, b->state_q31, mu, block_size, 0);
+
+    fill_stack_pattern_to_sp();
+    for (int start = 0; start < LMS_SIGNAL_LEN; start += block_size) {
+        enable_cycle_counter();
+        uint32_t start_cycles = read_cycle_counter();
+
+        if (norm)
+            arm_lms_norm_q31(&SN, b->x_q31 + start, b->d_q31 + start, b->out_q31, b->err_q31, block_size);
+        else
+            arm_lms_q31(&S, b->x_q31 + start, b->d_q31 + start, b->out_q31, b->err_q31, block_size);
+
+        lms_add_block_cycles(r, start, read_cycle_counter() - start_cycles);
+        for (int i = 0; i < block_size; i++) {
+            float64_t e = (float64_t)b->err_q31[i] / 2147483648.0;
+            r->err_energy[(start + i) / LMS_WINDOW] += e * e;
+        }
+    }
+    r->stack_used = measure_stack_usage();
+}
+
+RAM_FUNC void benchmark_lms(void) {
+    printf("=== LMS / NLMS Sweep (plant identification, two-tone input, %d samples) ===\n\r", LMS_SIGNAL_LEN);
+
+    lms_buffers b;
+    lms_result *ref = (lms_result*)malloc(sizeof(lms_result));
+    lms_result *res = (lms_result*)malloc(sizeof(lms_result));
+    float64_t *x_f64 = (float64_t*)malloc(LMS_SIGNAL_LEN * sizeof(float64_t));
+    float64_t *d_f64 = (float64_t*)malloc(LMS_SIGNAL_LEN * sizeof(float64_t));
+    float64_t *plant = (float64_t*)malloc(LMS_NUM_TAPS_MAX * sizeof(float64_t));
+    const int state_len = LMS_NUM_TAPS_MAX + LMS_BLOCK_SIZE_MAX - 1;
+    b.x_f32      = (float32_t*)malloc(LMS_SIGNAL_LEN * sizeof(float32_t));
+    b.d_f32      = (float32_t*)malloc(LMS_SIGNAL_LEN * sizeof(float32_t));
+    b.out_f32    = (float32_t*)malloc(LMS_BLOCK_SIZE_MAX * sizeof(float32_t));
+    b.err_f32    = (float32_t*)malloc(LMS_BLOCK_SIZE_MAX * sizeof(float32_t));
+    b.coeffs_f32 = (float32_t*)malloc(LMS_NUM_TAPS_MAX * sizeof(float32_t));
+    b.state_f32  = (float32_t*)malloc(state_len * sizeof(float32_t));
+    b.x_q15      = (q15_t*)malloc(LMS_SIGNAL_LEN * sizeof(q15_t));
+    b.d_q15      = (q15_t*)malloc(LMS_SIGNAL_LEN * sizeof(q15_t));
+    b.out_q15    = (q15_t*)malloc(LMS_BLOCK_SIZE_MAX * sizeof(q15_t));
+    b.err_q15    = (q15_t*)malloc(LMS_BLOCK_SIZE_MAX * sizeof(q15_t));
+    b.coeffs_q15 = (q15_t*)malloc(LMS_NUM_TAPS_MAX * sizeof(q15_t));
+    b.state_q15  = (q15_t*)malloc(state_len * sizeof(q15_t));
+    b.x_q31      = (q31_t*)malloc(LMS_SIGNAL_LEN * sizeof(q31_t));
+    b.d_q31      = (q31_t*)malloc(LMS_SIGNAL_LEN * sizeof(q31_t));
+    b.out_q31    = (q31_t*)malloc(LMS_BLOCK_SIZE_MAX * sizeof(q31_t));
+    b.err_q31    = (q31_t*)malloc(LMS_BLOCK_SIZE_MAX * sizeof(q31_t));
+    b.coeffs_q31 = (q31_t*)malloc(LMS_NUM_TAPS_MAX * sizeof(q31_t));
+    b.state_q31  = (q31_t*)malloc(state_len * sizeof(q31_t));
+
+    if (!ref || !res || !x_f64 || !d_f64 || !plant ||
+        !b.x_f32 || !b.d_f32 || !b.out_f32 || !b.err_f32 || !b.coeffs_f32 || !b.state_f32 ||
+        !b.x_q15 || !b.d_q15 || !b.out_q15 || !b.err_q15 || !b.coeffs_q15 || !b.state_q15 ||
+        !b.x_q31 || !b.d_q31 || !b.out_q31 || !b.err_q31 || !b.coeffs_q31 || !b.state_q31) {
+        printf("Memory allocation failed for LMS sweep\n\r");
+    } else {
+        generate_two_tone_f64(x_f64, LMS_SIGNAL_LEN);
+        for (int i = 0; i < LMS_SIGNAL_LEN; i++) {
+            b.x_f32[i] = (float32_t)x_f64[i];
+            b.x_q15[i] = f64_to_q15_sat(x_f64[i]);
+            b.x_q31[i] = f64_to_q31_sat(x_f64[i]);
+        }
+
+        for (int t = 0; t < LMS_TAP_SIZES_COUNT; t++) {
+            int taps = LMS_TAP_SIZES[t];
+
+            design_lowpass_f64(plant, taps, SWEEP_CUTOFF_FREQ / SAMPLING_FREQ);
+            fir_reference_f64(plant, taps, x_f64, d_f64, LMS_SIGNAL_LEN);
+            memset(b.d_energy, 0, sizeof(b.d_energy));
+            for (int i = 0; i < LMS_SIGNAL_LEN; i++) {
+                b.d_f32[i] = (float32_t)d_f64[i];
+                b.d_q15[i] = f64_to_q15_sat(d_f64[i]);
+                b.d_q31[i] = f64_to_q31_sat(d_f64[i]);
+                b.d_energy[i / LMS_WINDOW] += d_f64[i] * d_f64[i];
+            }
+
+            for (int bs = 0; bs < LMS_BLOCK_SIZES_COUNT; bs++) {
+                int block_size = LMS_BLOCK_SIZES[bs];
+
+                printf("\n--- NUM_TAPS = %d, BLOCK_SIZE = %d ---\n\r", taps, block_size);
+                for (int norm = 0; norm <= 1; norm++) {
+                    run_lms_f32(taps, block_size, norm, &b, ref);
+                    report_lms_result(norm ? "NLMS F32" : "LMS F32", taps, block_size, &b, ref, ref);
+                    run_lms_q15(taps, block_size, norm, &b, res);
+                    report_lms_result(norm ? "NLMS Q15" : "LMS Q15", taps, block_size, &b, res, ref);
+                    run_lms_q31(taps, block_size, norm, &b, res);
+                    report_lms_result(norm ? "NLMS Q31" : "LMS Q31", taps, block_size, &b, res, ref);
+                }
+            }
+        }
+    }
+
+    free(ref); free(res); free(x_f64); free(d_f64); free(plant);
+    free(b.x_f32); free(b.d_f32); free(b.out_f32); free(b.err_f32); free(b.coeffs_f32); free(b.state_f32);
+    free(b.x_q15); free(b.d_q15); free(b.out_q15); free(b.err_q15); free(b.coeffs_q15); free(b.state_q15);
+    free(b.x_q31); free(b.d_q31); free(b.out_q31); free(b.err_q31); free(b.coeffs_q31); free(b.state_q31);
+    printf("\nBenchmark completed for ARM LMS / NLMS.\n\r");
+}
@@ -57,3 +57,79 @@ const float32_t firCoeffs32[NUM_TAPS] = {
 const q15_t firCoeffsQ15[NUM_TAPS_q15] = {
 		2411, 4172, 5626, 6446, 6446, 5626, 4172, 2411 // Coefficients padded to make NUM_TAPS even
 };
+
+const int TAP_SIZES[] = {8, 16, 32, 64, 128, 256};
+const int LMS_TAP_SIZES[] = {8, 16, 32, 64};
+const int LMS_BLOCK_SIZES[] = {1, 16, 64};
+
+// Hamming-windowed sinc low-pass, normalised to unity DC gain.
+// cutoff_norm is the cut-off frequency divided by the sampling frequency.
+void design_lowpass_f64(float64_t *coeffs, int num_taps, float64_t cutoff_norm) {
+    float64_t centre = (num_taps - 1) / 2.0;
+    float64_t sum = 0.0;
+    for (int i = 0; i < num_taps; i++) {
+        float64_t m = i - centre;
+        float64_t sinc = (m == 0.0) ? 2.0 * cutoff_norm
+                                    : sin(2.0 * M_PI * cutoff_norm * m) / (M_PI * m);
+        float64_t window = 0.54 - 0.46 * cos(2.0 * M_PI * i / (num_taps - 1));
+        coeffs[i] = sinc * window;
+        sum += coeffs[i];
+    }
+    for (int i = 0; i < num_taps; i++) {
+        coeffs[i] /= sum;
+    }
+}
+
+// Tap-sweep input: 0.5 amplitude in-band tone plus 0.25 amplitude stop-band tone, peak 0.75
+void generate_two_tone_f64(float64_t *out, int N) {
+    for (int i = 0; i < N; i++) {
+        out[i] = 0.5 * sin(2 * M_PI * SINE_FREQ * i / SAMPLING_FREQ)
+               + 0.25 * sin(2 * M_PI * SWEEP_STOPBAND_FREQ * i / SAMPLING_FREQ);
+    }
+}
+
+// Direct-form FIR in double precision, zero initial state (same convention as arm_fir_*).
+void fir_reference_f64(const float64_t *coeffs, int num_taps, const float64_t *input, float64_t *output, int N) {
+    for (int n = 0; n < N; n++) {
+        float64_t acc = 0.0;
+        for (int k = 0; k < num_taps && k <= n; k++) {
+            acc += coeffs[k] * input[n - k];
+        }
+        output[n] = acc;
+    }
+}
+
+// Signal-to-noise ratio of test against ref in dB, optionally returning the largest absolute error.
+float64_t compute_snr_f64(const float64_t *ref, const float64_t *test, int N, float64_t *max_abs_err) {
+    float64_t signal = 0.0, noise = 0.0, max_err = 0.0;
+    for (int i = 0; i < N; i++) {
+        float64_t err = ref[i] - test[i];
+        signal += ref[i] * ref[i];
+        noise += err * err;
+        if (fabs(err) > max_err) {
+            max_err = fabs(err);
+        }
+    }
+    if (max_abs_err) {
+        *max_abs_err = max_err;
+    }
+    if (noise == 0.0) {
+        return INFINITY;
+    }
+    return 10.0 * log10(signal / noise);
+}
+
+// Round to Q15 / Q31, saturating values outside [-1, 1).
+q15_t f64_to_q15_sat(float64_t x) {
+    float64_t v = round(x * 32768.0);
+    if (v > 32767.0) v = 32767.0;
+    if (v < -32768.0) v = -32768.0;
+    return (q15_t)v;
+}
+
+q31_t f64_to_q31_sat(float64_t x) {
+    float64_t v = round(x * 2147483648.0);
+    if (v > Q31_SCALE) v = Q31_SCALE;
+    if (v < -2147483648.0) v = -2147483648.0;
+    return (q31_t)v;
+}
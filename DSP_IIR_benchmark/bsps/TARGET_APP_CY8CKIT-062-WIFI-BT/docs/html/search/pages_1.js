@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['modustoolbox™_20board_20support_20package_20_28bsp_29_20overview_0',['ModusToolbox™ Board Support Package (BSP) Overview',['../md_source_bsps_mt_bsp_user_guide.html',1,'']]]
+];
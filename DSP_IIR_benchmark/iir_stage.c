@@ -0,0 +1,42 @@
+#include "main.h"
+
+// Butterworth low-pass stage on top of the CMSIS biquad cascades. The instance owns its
+// coefficient and state arrays, so one iir_lowpass_* per filtered channel is all that is needed.
+
+RAM_FUNC arm_status iir_lowpass_init_f32(iir_lowpass_f32 *f, int num_stages, float64_t cutoff_norm)
+{
+    float64_t design[5 * IIR_MAX_STAGES];
+
+    if (num_stages < 1 || num_stages > IIR_MAX_STAGES) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    design_butterworth_lowpass_f64(design, num_stages, cutoff_norm);
+    for (int i = 0; i < 5 * num_stages; i++) {
+        f->coeffs[i] = (float32_t)design[i];
+    }
+    arm_biquad_cascade_df2T_init_f32(&f->S, num_stages, f->coeffs, f->state);
+    return ARM_MATH_SUCCESS;
+}
+
+RAM_FUNC void iir_lowpass_process_f32(const iir_lowpass_f32 *f, const float32_t *in, float32_t *out, uint32_t block_size)
+{
+    arm_biquad_cascade_df2T_f32(&f->S, in, out, block_size);
+}
+
+RAM_FUNC arm_status iir_lowpass_init_q15(iir_lowpass_q15 *f, int num_stages, float64_t cutoff_norm)
+{
+    float64_t design[5 * IIR_MAX_STAGES];
+
+    if (num_stages < 1 || num_stages > IIR_MAX_STAGES) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    design_butterworth_lowpass_f64(design, num_stages, cutoff_norm);
+    biquad_coeffs_to_q15(design, f->coeffs, num_stages);
+    arm_biquad_cascade_df1_init_q15(&f->S, num_stages, f->coeffs, f->state, IIR_POST_SHIFT);
+    return ARM_MATH_SUCCESS;
+}
+
+RAM_FUNC void iir_lowpass_process_q15(const iir_lowpass_q15 *f, const q15_t *in, q15_t *out, uint32_t block_size)
+{
+    arm_biquad_cascade_df1_q15(&f->S, in, out, block_size);
+}
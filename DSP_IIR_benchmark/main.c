@@ -0,0 +1,59 @@
+#include "main.h"
+
+void benchmark_biquad_df2T_f32(void);
+void benchmark_biquad_df1_q15(void);
+void benchmark_biquad_df1_q31(void);
+void benchmark_iir_vs_fir(void);
+
+uint32_t clkFastfreq = 0;
+
+RAM_FUNC int main(void)
+{
+    __disable_irq();  // Disable all interrupts
+    cy_rslt_t result;
+
+    // Initialize the device and board peripherals
+    result = cybsp_init();
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Initialize retarget-io to use the debug UART port
+    result = cy_retarget_io_init_fc(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                    CYBSP_DEBUG_UART_CTS, CYBSP_DEBUG_UART_RTS, CY_RETARGET_IO_BAUDRATE);
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Get the clock frequency
+    clkFastfreq = Cy_SysClk_ClkFastGetFrequency();
+
+    // Print system details
+    printf("\n\r");
+    printf("-----Starting CMSIS IIR Benchmark-----\n\r");
+    printf("\n\r");
+    printf("CPU Clock Frequency: %lu Hz\n\r", clkFastfreq);
+    printf("\n\r");
+
+    // Perform benchmarks
+    printf("*****Benchmarking ARM Biquad Cascade DF2T F32*****\n\r");
+    benchmark_biquad_df2T_f32();
+    printf("\n\r");
+
+    printf("*****Benchmarking ARM Biquad Cascade DF1 Q15 (and fast)*****\n\r");
+    benchmark_biquad_df1_q15();
+    printf("\n\r");
+
+    printf("*****Benchmarking ARM Biquad Cascade DF1 Q31 (and fast)*****\n\r");
+    benchmark_biquad_df1_q31();
+    printf("\n\r");
+
+    printf("*****Benchmarking IIR vs equivalent-response FIR*****\n\r");
+    benchmark_iir_vs_fir();
+    printf("\n\r");
+
+    printf("All tests are completed.\n\r");
+    printf("Finish CMSIS IIR Benchmark\n\r");
+
+    return 0;
+}
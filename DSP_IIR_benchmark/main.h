@@ -0,0 +1,75 @@
+#ifndef MAIN_H
+#define MAIN_H
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cyhal_clock.h"
+#include "cy_retarget_io.h"
+#include "arm_math.h"
+#include "core_cm4.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Constants
+#define NUM_TAPS             29
+#define IIR_MAX_STAGES       8
+#define IIR_POST_SHIFT       1     // q15/q31 coefficients stored at half scale (|a1| approaches 2)
+#define BLOCK_SIZES_COUNT    6
+#define STAGE_COUNTS_COUNT   4
+#define BLOCK_SIZE_MAX       1024
+
+// Two-tone input: in-band tone plus a stop-band tone, same as the FIR sweep
+#define SINE_FREQ            1000.0f
+#define SAMPLING_FREQ        48000.0f
+#define IIR_CUTOFF_FREQ      6000.0f
+#define IIR_STOPBAND_FREQ    12000.0f
+
+// Attributes
+#define RAM_FUNC __attribute__((section(".cy_ramfunc")))
+
+// Stack Limit
+extern uint32_t __StackLimit;
+
+// Clock Frequency
+extern uint32_t clkFastfreq;
+
+extern const int BLOCK_SIZES[];
+extern const int STAGE_COUNTS[];
+extern const float32_t firCoeffs32[NUM_TAPS];
+
+// Low-pass filter stage built on the biquad cascades; coefficients are designed at init
+typedef struct {
+    arm_biquad_cascade_df2T_instance_f32 S;
+    float32_t coeffs[5 * IIR_MAX_STAGES];
+    float32_t state[2 * IIR_MAX_STAGES];
+} iir_lowpass_f32;
+
+typedef struct {
+    arm_biquad_casd_df1_inst_q15 S;
+    q15_t coeffs[6 * IIR_MAX_STAGES];
+    q15_t state[4 * IIR_MAX_STAGES];
+} iir_lowpass_q15;
+
+arm_status iir_lowpass_init_f32(iir_lowpass_f32 *f, int num_stages, float64_t cutoff_norm);
+void iir_lowpass_process_f32(const iir_lowpass_f32 *f, const float32_t *in, float32_t *out, uint32_t block_size);
+arm_status iir_lowpass_init_q15(iir_lowpass_q15 *f, int num_stages, float64_t cutoff_norm);
+void iir_lowpass_process_q15(const iir_lowpass_q15 *f, const q15_t *in, q15_t *out, uint32_t block_size);
+
+// Prototypes for common utilities
+void fill_stack_pattern_to_sp(void);
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+uint32_t measure_stack_usage(void);
+void generate_two_tone_f64(float64_t *out, int N);
+void design_butterworth_lowpass_f64(float64_t *coeffs, int num_stages, float64_t cutoff_norm);
+void biquad_coeffs_to_q15(const float64_t *coeffs, q15_t *out, int num_stages);
+void biquad_coeffs_to_q31(const float64_t *coeffs, q31_t *out, int num_stages);
+void biquad_reference_f64(const float64_t *coeffs, int num_stages, const float64_t *input, float64_t *output, int N);
+float64_t compute_snr_f64(const float64_t *ref, const float64_t *test, int N);
+float64_t fir_magnitude_f64(const float32_t *coeffs, int num_taps, float64_t freq_norm);
+float64_t butterworth_magnitude_f64(int order, float64_t cutoff_norm, float64_t freq_norm);
+void report_iir_result(const char *label, int num_stages, int N, uint32_t cycle_count,
+                       uint32_t instr_est, uint32_t stack_used, float64_t snr_db);
+
+#endif // MAIN_H
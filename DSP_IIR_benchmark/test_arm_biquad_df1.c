@@ -0,0 +1,165 @@
+#include "main.h"
+
+// DF1 Q15 and Q31 cascades share one stage x block sweep; the per-type pieces (conversion,
+// init and the plain/fast process calls) come from a df1_variant. Q15 runs on the
+// iir_lowpass_q15 stage from iir_stage.c; Q31 keeps the same instance, coefficient and state
+// layout here. Each process call times only the CMSIS biquad call and returns its cycles.
+
+typedef struct {
+    arm_biquad_casd_df1_inst_q31 S;
+    q31_t coeffs[5 * IIR_MAX_STAGES];
+    q31_t state[4 * IIR_MAX_STAGES];
+} df1_q31;
+
+typedef union {
+    iir_lowpass_q15 q15;
+    df1_q31 q31;
+} df1_instance;
+
+typedef struct {
+    const char *name;
+    const char *labels[2];       // plain, fast
+    size_t sample_size;
+    void (*from_f64)(const float64_t *in, void *out, int N);
+    void (*to_f64)(const void *in, float64_t *out, int N);
+    arm_status (*init)(df1_instance *S, int num_stages, float64_t cutoff_norm);
+    uint32_t (*process[2])(const df1_instance *S, const void *in, void *out, uint32_t N);
+} df1_variant;
+
+static void q15_from_f64(const float64_t *in, void *out, int N) {
+    for (int i = 0; i < N; i++)
+        ((q15_t*)out)[i] = (q15_t)round(in[i] * 32768.0);
+}
+
+static void q15_to_f64(const void *in, float64_t *out, int N) {
+    for (int i = 0; i < N; i++)
+        out[i] = (float64_t)((const q15_t*)in)[i] / 32768.0;
+}
+
+static arm_status q15_init(df1_instance *S, int num_stages, float64_t cutoff_norm) {
+    return iir_lowpass_init_q15(&S->q15, num_stages, cutoff_norm);
+}
+
+RAM_FUNC static uint32_t q15_process(const df1_instance *S, const void *in, void *out, uint32_t N) {
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+    arm_biquad_cascade_df1_q15(&S->q15.S, (const q15_t*)in, (q15_t*)out, N);
+    return read_cycle_counter() - start_cycles;
+}
+
+RAM_FUNC static uint32_t q15_process_fast(const df1_instance *S, const void *in, void *out, uint32_t N) {
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+    arm_biquad_cascade_df1_fast_q15(&S->q15.S, (const q15_t*)in, (q15_t*)out, N);
+    return read_cycle_counter() - start_cycles;
+}
+
+static void q31_from_f64(const float64_t *in, void *out, int N) {
+    for (int i = 0; i < N; i++)
+        ((q31_t*)out)[i] = (q31_t)round(in[i] * 2147483648.0);
+}
+
+static void q31_to_f64(const void *in, float64_t *out, int N) {
+    for (int i = 0; i < N; i++)
+        out[i] = (float64_t)((const q31_t*)in)[i] / 2147483648.0;
+}
+
+static arm_status q31_init(df1_instance *S, int num_stages, float64_t cutoff_norm) {
+    float64_t design[5 * IIR_MAX_STAGES];
+
+    if (num_stages < 1 || num_stages > IIR_MAX_STAGES) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    design_butterworth_lowpass_f64(design, num_stages, cutoff_norm);
+    biquad_coeffs_to_q31(design, S->q31.coeffs, num_stages);
+    arm_biquad_cascade_df1_init_q31(&S->q31.S, num_stages, S->q31.coeffs, S->q31.state, IIR_POST_SHIFT);
+    return ARM_MATH_SUCCESS;
+}
+
+RAM_FUNC static uint32_t q31_process(const df1_instance *S, const void *in, void *out, uint32_t N) {
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+    arm_biquad_cascade_df1_q31(&S->q31.S, (const q31_t*)in, (q31_t*)out, N);
+    return read_cycle_counter() - start_cycles;
+}
+
+RAM_FUNC static uint32_t q31_process_fast(const df1_instance *S, const void *in, void *out, uint32_t N) {
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+    arm_biquad_cascade_df1_fast_q31(&S->q31.S, (const q31_t*)in, (q31_t*)out, N);
+    return read_cycle_counter() - start_cycles;
+}
+
+static const df1_variant DF1_Q15 = {
+    "Q15", {"BIQUAD DF1 Q15", "BIQUAD DF1 FAST Q15"}, sizeof(q15_t),
+    q15_from_f64, q15_to_f64, q15_init, {q15_process, q15_process_fast}
+};
+
+static const df1_variant DF1_Q31 = {
+    "Q31", {"BIQUAD DF1 Q31", "BIQUAD DF1 FAST Q31"}, sizeof(q31_t),
+    q31_from_f64, q31_to_f64, q31_init, {q31_process, q31_process_fast}
+};
+
+RAM_FUNC static void benchmark_biquad_df1(const df1_variant *v) {
+    printf("=== Biquad DF1 %s / FAST %s Benchmark (Butterworth low-pass, stage x block sweep) ===\n\r",
+           v->name, v->name);
+
+    float64_t *input_f64 = (float64_t*)malloc(BLOCK_SIZE_MAX * sizeof(float64_t));
+    float64_t *ref_f64 = (float64_t*)malloc(BLOCK_SIZE_MAX * sizeof(float64_t));
+    float64_t *test_f64 = (float64_t*)malloc(BLOCK_SIZE_MAX * sizeof(float64_t));
+    void *input = malloc(BLOCK_SIZE_MAX * v->sample_size);
+    void *output = malloc(BLOCK_SIZE_MAX * v->sample_size);
+    if (!input_f64 || !ref_f64 || !test_f64 || !input || !output) {
+        printf("Memory allocation failed for Biquad DF1 %s\n\r", v->name);
+        free(input_f64); free(ref_f64); free(test_f64); free(input); free(output);
+        return;
+    }
+
+    generate_two_tone_f64(input_f64, BLOCK_SIZE_MAX);
+    v->from_f64(input_f64, input, BLOCK_SIZE_MAX);
+
+    for (int s = 0; s < STAGE_COUNTS_COUNT; s++) {
+        int num_stages = STAGE_COUNTS[s];
+        float64_t design[5 * IIR_MAX_STAGES];
+
+        design_butterworth_lowpass_f64(design, num_stages, IIR_CUTOFF_FREQ / SAMPLING_FREQ);
+
+        for (int idx = 0; idx < BLOCK_SIZES_COUNT; idx++) {
+            int N = BLOCK_SIZES[idx];
+            biquad_reference_f64(design, num_stages, input_f64, ref_f64, N);
+
+            for (int fast = 0; fast <= 1; fast++) {
+                df1_instance S;
+                if (v->init(&S, num_stages, IIR_CUTOFF_FREQ / SAMPLING_FREQ) != ARM_MATH_SUCCESS) {
+                    printf("Biquad DF1 %s init failed for %d stages\n\r", v->name, num_stages);
+                    continue;
+                }
+
+                fill_stack_pattern_to_sp();
+                uint32_t cycle_count = v->process[fast](&S, input, output, N);
+                uint32_t instr_est = cycle_count
+                                   - DWT->CPICNT
+                                   - DWT->EXCCNT
+                                   - DWT->SLEEPCNT
+                                   - DWT->LSUCNT
+                                   + DWT->FOLDCNT;
+                uint32_t stack_used = measure_stack_usage();
+
+                v->to_f64(output, test_f64, N);
+                report_iir_result(v->labels[fast], num_stages, N,
+                                  cycle_count, instr_est, stack_used, compute_snr_f64(ref_f64, test_f64, N));
+            }
+        }
+    }
+
+    free(input_f64); free(ref_f64); free(test_f64); free(input); free(output);
+    printf("\nBenchmark completed for ARM Biquad DF1 %s.\n\r", v->name);
+}
+
+RAM_FUNC void benchmark_biquad_df1_q15(void) {
+    benchmark_biquad_df1(&DF1_Q15);
+}
+
+RAM_FUNC void benchmark_biquad_df1_q31(void) {
+    benchmark_biquad_df1(&DF1_Q31);
+}
@@ -0,0 +1,63 @@
+#include "main.h"
+
+RAM_FUNC void benchmark_biquad_df2T_f32(void) {
+    printf("=== Biquad DF2T F32 Benchmark (Butterworth low-pass, stage x block sweep) ===\n\r");
+
+    float64_t *input_f64 = (float64_t*)malloc(BLOCK_SIZE_MAX * sizeof(float64_t));
+    float64_t *ref_f64 = (float64_t*)malloc(BLOCK_SIZE_MAX * sizeof(float64_t));
+    float64_t *test_f64 = (float64_t*)malloc(BLOCK_SIZE_MAX * sizeof(float64_t));
+    float32_t *input = (float32_t*)malloc(BLOCK_SIZE_MAX * sizeof(float32_t));
+    float32_t *output = (float32_t*)malloc(BLOCK_SIZE_MAX * sizeof(float32_t));
+    if (!input_f64 || !ref_f64 || !test_f64 || !input || !output) {
+        printf("Memory allocation failed for Biquad DF2T F32\n\r");
+        free(input_f64); free(ref_f64); free(test_f64); free(input); free(output);
+        return;
+    }
+
+    generate_two_tone_f64(input_f64, BLOCK_SIZE_MAX);
+    for (int i = 0; i < BLOCK_SIZE_MAX; i++)
+        input[i] = (float32_t)input_f64[i];
+
+    for (int s = 0; s < STAGE_COUNTS_COUNT; s++) {
+        int num_stages = STAGE_COUNTS[s];
+        float64_t design[5 * IIR_MAX_STAGES];
+        float32_t coeffs[5 * IIR_MAX_STAGES];
+        float32_t state[2 * IIR_MAX_STAGES];
+
+        design_butterworth_lowpass_f64(design, num_stages, IIR_CUTOFF_FREQ / SAMPLING_FREQ);
+        for (int i = 0; i < 5 * num_stages; i++)
+            coeffs[i] = (float32_t)design[i];
+
+        for (int idx = 0; idx < BLOCK_SIZES_COUNT; idx++) {
+            int N = BLOCK_SIZES[idx];
+
+            arm_biquad_cascade_df2T_instance_f32 S;
+            arm_biquad_cascade_df2T_init_f32(&S, num_stages, coeffs, state);
+            biquad_reference_f64(design, num_stages, input_f64, ref_f64, N);
+
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            uint32_t start_cycles = read_cycle_counter();
+
+            arm_biquad_cascade_df2T_f32(&S, input, output, N);
+
+            uint32_t end_cycles = read_cycle_counter();
+            uint32_t cycle_count = end_cycles - start_cycles;
+            uint32_t instr_est = cycle_count
+                               - DWT->CPICNT
+                               - DWT->EXCCNT
+                               - DWT->SLEEPCNT
+                               - DWT->LSUCNT
+                               + DWT->FOLDCNT;
+            uint32_t stack_used = measure_stack_usage();
+
+            for (int i = 0; i < N; i++)
+                test_f64[i] = output[i];
+            report_iir_result("BIQUAD DF2T F32", num_stages, N, cycle_count, instr_est, stack_used,
+                              compute_snr_f64(ref_f64, test_f64, N));
+        }
+    }
+
+    free(input_f64); free(ref_f64); free(test_f64); free(input); free(output);
+    printf("\nBenchmark completed for ARM Biquad DF2T F32.\n\r");
+}
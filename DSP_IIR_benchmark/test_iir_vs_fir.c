@@ -0,0 +1,110 @@
+#include "main.h"
+
+// Head-to-head: the 29-tap firCoeffs32 low-pass against the smallest Butterworth cascade with
+// the same cut-off whose attenuation at IIR_STOPBAND_FREQ is at least that of the FIR.
+RAM_FUNC void benchmark_iir_vs_fir(void) {
+    printf("=== IIR (DF2T F32) vs FIR (arm_fir_f32, %d taps) Benchmark ===\n\r", NUM_TAPS);
+
+    float64_t cutoff_norm = IIR_CUTOFF_FREQ / SAMPLING_FREQ;
+    float64_t stop_norm = IIR_STOPBAND_FREQ / SAMPLING_FREQ;
+    float64_t fir_stop_db = 20.0 * log10(fir_magnitude_f64(firCoeffs32, NUM_TAPS, stop_norm));
+    float64_t fir_cut_db = 20.0 * log10(fir_magnitude_f64(firCoeffs32, NUM_TAPS, cutoff_norm));
+
+    int num_stages = IIR_MAX_STAGES;
+    for (int k = 1; k <= IIR_MAX_STAGES; k++) {
+        if (20.0 * log10(butterworth_magnitude_f64(2 * k, cutoff_norm, stop_norm)) <= fir_stop_db) {
+            num_stages = k;
+            break;
+        }
+    }
+    float64_t iir_stop_db = 20.0 * log10(butterworth_magnitude_f64(2 * num_stages, cutoff_norm, stop_norm));
+    float64_t iir_cut_db = 20.0 * log10(butterworth_magnitude_f64(2 * num_stages, cutoff_norm, cutoff_norm));
+
+    printf("FIR: %.2f dB at %.0f Hz, %.2f dB at %.0f Hz\n\r", fir_cut_db, IIR_CUTOFF_FREQ, fir_stop_db, IIR_STOPBAND_FREQ);
+    printf("IIR: %d stages (order %d), %.2f dB at %.0f Hz, %.2f dB at %.0f Hz\n\r",
+           num_stages, 2 * num_stages, iir_cut_db, IIR_CUTOFF_FREQ, iir_stop_db, IIR_STOPBAND_FREQ);
+
+    for (int idx = 0; idx < BLOCK_SIZES_COUNT; idx++) {
+        int N = BLOCK_SIZES[idx];
+
+        float64_t *input_f64 = (float64_t*)malloc(N * sizeof(float64_t));
+        float32_t *input = (float32_t*)malloc(N * sizeof(float32_t));
+        float32_t *output = (float32_t*)malloc(N * sizeof(float32_t));
+        float32_t *firStateF32 = (float32_t*)calloc(NUM_TAPS + N - 1, sizeof(float32_t));
+        iir_lowpass_f32 *iir = (iir_lowpass_f32*)malloc(sizeof(iir_lowpass_f32));
+        if (!input_f64 || !input || !output || !firStateF32 || !iir) {
+            printf("Memory allocation failed for N = %d\n\r", N);
+            free(input_f64); free(input); free(output); free(firStateF32); free(iir);
+            continue;
+        }
+
+        generate_two_tone_f64(input_f64, N);
+        for (int i = 0; i < N; i++)
+            input[i] = (float32_t)input_f64[i];
+
+        arm_fir_instance_f32 S;
+        arm_fir_init_f32(&S, NUM_TAPS, (float32_t*)firCoeffs32, firStateF32, N);
+        if (iir_lowpass_init_f32(iir, num_stages, cutoff_norm) != ARM_MATH_SUCCESS) {
+            printf("IIR init failed for %d stages\n\r", num_stages);
+            free(input_f64); free(input); free(output); free(firStateF32); free(iir);
+            continue;
+        }
+
+        // ---- FIR ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        uint32_t start_cycles = read_cycle_counter();
+
+        arm_fir_f32(&S, input, output, N);
+
+        uint32_t end_cycles = read_cycle_counter();
+        uint32_t cycle_count = end_cycles - start_cycles;
+        uint32_t instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        uint32_t stack_used = measure_stack_usage();
+        uint32_t fir_cycles = cycle_count;
+        float time_sec = (float)cycle_count / clkFastfreq;
+        float time_us = time_sec * 1e6f;
+
+        printf("\nFIR F32 taps = %d, N = %d\n\r", NUM_TAPS, N);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Cycles per Sample: %.2f\n\r", (float)cycle_count / N);
+
+        // ---- IIR ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        start_cycles = read_cycle_counter();
+
+        iir_lowpass_process_f32(iir, input, output, N);
+
+        end_cycles = read_cycle_counter();
+        cycle_count = end_cycles - start_cycles;
+        instr_est = cycle_count
+                  - DWT->CPICNT
+                  - DWT->EXCCNT
+                  - DWT->SLEEPCNT
+                  - DWT->LSUCNT
+                  + DWT->FOLDCNT;
+        stack_used = measure_stack_usage();
+        time_sec = (float)cycle_count / clkFastfreq;
+        time_us = time_sec * 1e6f;
+
+        printf("\nIIR DF2T F32 stages = %d, N = %d\n\r", num_stages, N);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Cycles per Sample: %.2f\n\r", (float)cycle_count / N);
+        printf("FIR / IIR cycle ratio: %.2fx\n\r", (float)fir_cycles / cycle_count);
+
+        free(input_f64); free(input); free(output); free(firStateF32); free(iir);
+    }
+    printf("\nBenchmark completed for IIR vs FIR.\n\r");
+}
@@ -0,0 +1,184 @@
+#include "main.h"
+
+const int BLOCK_SIZES[] = {32, 64, 128, 256, 512, 1024};
+const int STAGE_COUNTS[] = {1, 2, 4, 8};
+
+RAM_FUNC void fill_stack_pattern_to_sp(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp) {
+        *p++ = 0xAAAAAAAA;
+    }
+}
+
+RAM_FUNC void enable_cycle_counter() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;      // Enable trace
+    DWT->CTRL |= (1 << 0);                               // CYCCNTENA
+    DWT->CTRL |= (1 << 16);                              // CPICNT
+    DWT->CTRL |= (1 << 17);                              // EXCCNT
+    DWT->CTRL |= (1 << 18);                              // SLEEPCNT
+    DWT->CTRL |= (1 << 19);                              // LSUCNT
+    DWT->CTRL |= (1 << 20);                              // FOLDCNT
+
+    DWT->CYCCNT = 0;
+    DWT->CPICNT = 0;
+    DWT->EXCCNT = 0;
+    DWT->SLEEPCNT = 0;
+    DWT->LSUCNT = 0;
+    DWT->FOLDCNT = 0;
+}
+
+RAM_FUNC uint32_t read_cycle_counter(void) {
+    return DWT->CYCCNT;
+}
+
+RAM_FUNC uint32_t measure_stack_usage(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp && *p == 0xAAAAAAAA) {
+        p++;
+    }
+    return ((uint32_t)sp - (uint32_t)p);
+}
+
+// Same 29-tap low-pass as DSP_FIR_benchmark (cut-off fs/8), used for the IIR-vs-FIR comparison
+const float32_t firCoeffs32[NUM_TAPS] = {
+    -0.0018225230f, -0.0015879294f, +0.0000000000f, +0.0036977508f,
+    +0.0080754303f, +0.0085302217f, -0.0000000000f, -0.0173976984f,
+    -0.0341458607f, -0.0333591565f, +0.0000000000f, +0.0676308395f,
+    +0.1522061835f, +0.2229246956f, +0.2504960933f, +0.2229246956f,
+    +0.1522061835f, +0.0676308395f, +0.0000000000f, -0.0333591565f,
+    -0.0341458607f, -0.0173976984f, -0.0000000000f, +0.0085302217f,
+    +0.0080754303f, +0.0036977508f, +0.0000000000f, -0.0015879294f,
+    -0.0018225230f
+};
+
+// Input shared by every variant: 0.5 amplitude in-band tone plus 0.25 amplitude stop-band tone
+void generate_two_tone_f64(float64_t *out, int N) {
+    for (int i = 0; i < N; i++) {
+        out[i] = 0.5 * sin(2 * M_PI * SINE_FREQ * i / SAMPLING_FREQ)
+               + 0.25 * sin(2 * M_PI * IIR_STOPBAND_FREQ * i / SAMPLING_FREQ);
+    }
+}
+
+// Butterworth low-pass of order 2 * num_stages via the bilinear transform, one biquad per
+// conjugate pole pair. Output layout is the CMSIS one, {b0, b1, b2, a1, a2} per stage, with
+// the feedback terms negated: y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2].
+void design_butterworth_lowpass_f64(float64_t *coeffs, int num_stages, float64_t cutoff_norm) {
+    int order = 2 * num_stages;
+    float64_t w0 = 2.0 * M_PI * cutoff_norm;
+    float64_t cos_w0 = cos(w0);
+    float64_t sin_w0 = sin(w0);
+
+    for (int k = 0; k < num_stages; k++) {
+        float64_t q = 1.0 / (2.0 * sin((2 * k + 1) * M_PI / (2.0 * order)));
+        float64_t alpha = sin_w0 / (2.0 * q);
+        float64_t a0 = 1.0 + alpha;
+        float64_t *c = &coeffs[5 * k];
+        c[0] = (1.0 - cos_w0) / 2.0 / a0;
+        c[1] = (1.0 - cos_w0) / a0;
+        c[2] = c[0];
+        c[3] = 2.0 * cos_w0 / a0;
+        c[4] = -(1.0 - alpha) / a0;
+    }
+}
+
+static q15_t f64_to_q15_sat(float64_t x) {
+    float64_t v = round(x * 32768.0);
+    if (v > 32767.0) v = 32767.0;
+    if (v < -32768.0) v = -32768.0;
+    return (q15_t)v;
+}
+
+static q31_t f64_to_q31_sat(float64_t x) {
+    float64_t v = round(x * 2147483648.0);
+    if (v > 2147483647.0) v = 2147483647.0;
+    if (v < -2147483648.0) v = -2147483648.0;
+    return (q31_t)v;
+}
+
+// q15 DF1 layout is {b0, 0, b1, b2, a1, a2}; coefficients are scaled down by IIR_POST_SHIFT
+void biquad_coeffs_to_q15(const float64_t *coeffs, q15_t *out, int num_stages) {
+    float64_t scale = 1.0 / (1 << IIR_POST_SHIFT);
+    for (int k = 0; k < num_stages; k++) {
+        const float64_t *c = &coeffs[5 * k];
+        q15_t *o = &out[6 * k];
+        o[0] = f64_to_q15_sat(c[0] * scale);
+        o[1] = 0;
+        o[2] = f64_to_q15_sat(c[1] * scale);
+        o[3] = f64_to_q15_sat(c[2] * scale);
+        o[4] = f64_to_q15_sat(c[3] * scale);
+        o[5] = f64_to_q15_sat(c[4] * scale);
+    }
+}
+
+// q31 DF1 layout is {b0, b1, b2, a1, a2}; coefficients are scaled down by IIR_POST_SHIFT
+void biquad_coeffs_to_q31(const float64_t *coeffs, q31_t *out, int num_stages) {
+    float64_t scale = 1.0 / (1 << IIR_POST_SHIFT);
+    for (int i = 0; i < 5 * num_stages; i++) {
+        out[i] = f64_to_q31_sat(coeffs[i] * scale);
+    }
+}
+
+// Direct-form I cascade in double precision with zero initial state
+void biquad_reference_f64(const float64_t *coeffs, int num_stages, const float64_t *input, float64_t *output, int N) {
+    memcpy(output, input, N * sizeof(float64_t));
+    for (int k = 0; k < num_stages; k++) {
+        const float64_t *c = &coeffs[5 * k];
+        float64_t x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+        for (int n = 0; n < N; n++) {
+            float64_t x0 = output[n];
+            float64_t y0 = c[0] * x0 + c[1] * x1 + c[2] * x2 + c[3] * y1 + c[4] * y2;
+            x2 = x1; x1 = x0;
+            y2 = y1; y1 = y0;
+            output[n] = y0;
+        }
+    }
+}
+
+// Signal-to-noise ratio of test against ref in dB
+float64_t compute_snr_f64(const float64_t *ref, const float64_t *test, int N) {
+    float64_t signal = 0.0, noise = 0.0;
+    for (int i = 0; i < N; i++) {
+        float64_t err = ref[i] - test[i];
+        signal += ref[i] * ref[i];
+        noise += err * err;
+    }
+    if (noise == 0.0) {
+        return INFINITY;
+    }
+    return 10.0 * log10(signal / noise);
+}
+
+// |H(f)| of an FIR at freq_norm = f / fs
+float64_t fir_magnitude_f64(const float32_t *coeffs, int num_taps, float64_t freq_norm) {
+    float64_t re = 0.0, im = 0.0;
+    for (int k = 0; k < num_taps; k++) {
+        re += coeffs[k] * cos(2.0 * M_PI * freq_norm * k);
+        im -= coeffs[k] * sin(2.0 * M_PI * freq_norm * k);
+    }
+    return sqrt(re * re + im * im);
+}
+
+// |H(f)| of the bilinear-transform Butterworth designed above
+float64_t butterworth_magnitude_f64(int order, float64_t cutoff_norm, float64_t freq_norm) {
+    float64_t ratio = tan(M_PI * freq_norm) / tan(M_PI * cutoff_norm);
+    return 1.0 / sqrt(1.0 + pow(ratio, 2.0 * order));
+}
+
+RAM_FUNC void report_iir_result(const char *label, int num_stages, int N, uint32_t cycle_count,
+                                uint32_t instr_est, uint32_t stack_used, float64_t snr_db) {
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n%s stages = %d, N = %d\n\r", label, num_stages, N);
+    printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Cycles per Sample: %.2f\n\r", (float)cycle_count / N);
+    printf("Cycles per Stage-Sample: %.3f\n\r", (float)cycle_count / ((float)num_stages * N));
+    printf("SNR vs f64 reference: %.2f dB\n\r", snr_db);
+}
@@ -2,6 +2,8 @@
 
 void benchmark_cmag_f32(void);
 void benchmark_cmag_q15(void);
+void benchmark_power_spectrum_f32(void);
+void benchmark_power_spectrum_q15(void);
 
 uint32_t clkFastfreq = 0;
 
@@ -42,6 +44,14 @@ RAM_FUNC int main(void)
     benchmark_cmag_q15();
     printf("\n\r");
 
+    printf("*****Benchmarking ARM Power Spectrum Detect F32*****\n\r");
+    benchmark_power_spectrum_f32();
+    printf("\n\r");
+
+    printf("*****Benchmarking ARM Power Spectrum Detect Q15*****\n\r");
+    benchmark_power_spectrum_q15();
+    printf("\n\r");
+
     printf("All tests are completed.\n\r");
     printf("Finish CMSIS Magnitude Benchmark\n\r");
 
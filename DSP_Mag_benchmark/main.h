@@ -17,6 +17,7 @@
 #define FFT_SIZES_COUNT  6
 #define Q15_SCALE        32768
 #define NUM_EXECUTIONS   10
+#define DETECT_THRESHOLD_REL 0.1f   // detection threshold as a fraction of a full-scale tone's bin magnitude
 
 // Attributes
 #define RAM_FUNC __attribute__((section(".cy_ramfunc")))
@@ -30,6 +31,33 @@ extern uint32_t clkFastfreq;
 // FFT sizes to benchmark
 extern const int FFT_SIZES[FFT_SIZES_COUNT];
 
+// Interleaved complex test tones (defined in test_cmag_f32.c / test_cmag_q15.c)
+void generate_sine_wave_f32(float32_t* input, int N, float signal_freq, float sampling_freq);
+void generate_sine_wave_q15(q15_t* input, int N, float signal_freq, float sampling_freq);
+
+// Result of one threshold/peak-pick pass over the positive-frequency bins
+typedef struct {
+    uint32_t num_above;
+    uint32_t peak_bin;
+    float32_t peak;
+} spectrum_detection_f32;
+
+typedef struct {
+    uint32_t num_above;
+    uint32_t peak_bin;
+    q15_t peak;
+} spectrum_detection_q15;
+
+// FFT -> |X|^2 -> threshold/peak-pick, and the FFT -> |X| -> threshold/peak-pick baseline
+void power_spectrum_detect_f32(const arm_cfft_instance_f32 *S, float32_t *buf, float32_t *bins, uint32_t num_bins,
+                               float32_t power_threshold, spectrum_detection_f32 *det);
+void magnitude_spectrum_detect_f32(const arm_cfft_instance_f32 *S, float32_t *buf, float32_t *bins, uint32_t num_bins,
+                                   float32_t mag_threshold, spectrum_detection_f32 *det);
+void power_spectrum_detect_q15(const arm_cfft_instance_q15 *S, q15_t *buf, q15_t *bins, uint32_t num_bins,
+                               q15_t power_threshold, spectrum_detection_q15 *det);
+void magnitude_spectrum_detect_q15(const arm_cfft_instance_q15 *S, q15_t *buf, q15_t *bins, uint32_t num_bins,
+                                   q15_t mag_threshold, spectrum_detection_q15 *det);
+
 // Prototypes for common utilities
 void fill_stack_pattern_to_sp(void);
 void enable_cycle_counter(void);
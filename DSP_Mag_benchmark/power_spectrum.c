@@ -0,0 +1,64 @@
+#include "main.h"
+
+// Threshold/peak-pick detector on the positive-frequency half of a complex FFT. The detector
+// only compares bins against a threshold, so it can run on |X|^2 (arm_cmplx_mag_squared_*)
+// against a squared threshold instead of paying for a square root per bin in arm_cmplx_mag_*.
+// buf holds 2 * fftLen interleaved samples and is transformed in place; bins receives num_bins
+// power (or magnitude) values.
+
+RAM_FUNC static void detect_f32(const float32_t *bins, uint32_t num_bins, float32_t threshold, spectrum_detection_f32 *det)
+{
+    uint32_t count = 0;
+    for (uint32_t k = 0; k < num_bins; k++) {
+        if (bins[k] > threshold) {
+            count++;
+        }
+    }
+    det->num_above = count;
+    arm_max_f32(bins, num_bins, &det->peak, &det->peak_bin);
+}
+
+RAM_FUNC static void detect_q15(const q15_t *bins, uint32_t num_bins, q15_t threshold, spectrum_detection_q15 *det)
+{
+    uint32_t count = 0;
+    for (uint32_t k = 0; k < num_bins; k++) {
+        if (bins[k] > threshold) {
+            count++;
+        }
+    }
+    det->num_above = count;
+    arm_max_q15(bins, num_bins, &det->peak, &det->peak_bin);
+}
+
+RAM_FUNC void power_spectrum_detect_f32(const arm_cfft_instance_f32 *S, float32_t *buf, float32_t *bins, uint32_t num_bins,
+                                        float32_t power_threshold, spectrum_detection_f32 *det)
+{
+    arm_cfft_f32(S, buf, 0, 1);
+    arm_cmplx_mag_squared_f32(buf, bins, num_bins);
+    detect_f32(bins, num_bins, power_threshold, det);
+}
+
+RAM_FUNC void magnitude_spectrum_detect_f32(const arm_cfft_instance_f32 *S, float32_t *buf, float32_t *bins, uint32_t num_bins,
+                                            float32_t mag_threshold, spectrum_detection_f32 *det)
+{
+    arm_cfft_f32(S, buf, 0, 1);
+    arm_cmplx_mag_f32(buf, bins, num_bins);
+    detect_f32(bins, num_bins, mag_threshold, det);
+}
+
+// q15: arm_cmplx_mag_squared_q15 returns 3.13 and arm_cmplx_mag_q15 returns 2.14
+RAM_FUNC void power_spectrum_detect_q15(const arm_cfft_instance_q15 *S, q15_t *buf, q15_t *bins, uint32_t num_bins,
+                                        q15_t power_threshold, spectrum_detection_q15 *det)
+{
+    arm_cfft_q15(S, buf, 0, 1);
+    arm_cmplx_mag_squared_q15(buf, bins, num_bins);
+    detect_q15(bins, num_bins, power_threshold, det);
+}
+
+RAM_FUNC void magnitude_spectrum_detect_q15(const arm_cfft_instance_q15 *S, q15_t *buf, q15_t *bins, uint32_t num_bins,
+                                            q15_t mag_threshold, spectrum_detection_q15 *det)
+{
+    arm_cfft_q15(S, buf, 0, 1);
+    arm_cmplx_mag_q15(buf, bins, num_bins);
+    detect_q15(bins, num_bins, mag_threshold, det);
+}
@@ -0,0 +1,214 @@
+#include "main.h"
+
+// Times one full detector pass (FFT + bins + threshold/peak-pick) for the fused |X|^2 path
+// and for the arm_cmplx_mag baseline on the same input. Only the positive-frequency half
+// (N/2 bins) is analysed, which is all a real input needs.
+
+typedef struct {
+    uint32_t cycle_counts[NUM_EXECUTIONS];
+    uint32_t instr_counts[NUM_EXECUTIONS];
+    uint32_t stack_usages[NUM_EXECUTIONS];
+    float exec_time_us_values[NUM_EXECUTIONS];
+} detect_timings;
+
+RAM_FUNC static void record_timing(detect_timings *t, int execution, uint32_t cycle_count) {
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+
+    t->cycle_counts[execution] = cycle_count;
+    t->instr_counts[execution] = instr_est;
+    t->stack_usages[execution] = stack_used;
+    t->exec_time_us_values[execution] = time_sec * 1e6f;
+}
+
+RAM_FUNC static uint32_t average_cycles(const detect_timings *t) {
+    uint32_t total = 0;
+    for (int i = 0; i < NUM_EXECUTIONS; i++) {
+        total += t->cycle_counts[i];
+    }
+    return total / NUM_EXECUTIONS;
+}
+
+RAM_FUNC static void report_savings(int N, const detect_timings *fused, const detect_timings *baseline) {
+    uint32_t fused_cycles = average_cycles(fused);
+    uint32_t baseline_cycles = average_cycles(baseline);
+    int32_t saved = (int32_t)baseline_cycles - (int32_t)fused_cycles;
+
+    printf("\nSqrt savings for FFT size N = %d:\n\r", N);
+    printf("Cycles Saved = %ld (%.1f%%)\n\r", (long)saved, 100.0f * saved / (float)baseline_cycles);
+    printf("Cycles Saved per Bin = %.2f\n\r", (float)saved / (N / 2));
+}
+
+RAM_FUNC void benchmark_power_spectrum_f32() {
+    for (int size_idx = 0; size_idx < FFT_SIZES_COUNT; size_idx++) {
+        int N = FFT_SIZES[size_idx];
+        uint32_t num_bins = N / 2;
+
+        float32_t* input = (float32_t*)malloc(2 * N * sizeof(float32_t));
+        float32_t* original_input = (float32_t*)malloc(2 * N * sizeof(float32_t));
+        float32_t* bins = (float32_t*)malloc(num_bins * sizeof(float32_t));
+        if (!input || !original_input || !bins) {
+            printf("Memory allocation failed for FFT size N = %d\n\r", N);
+            free(input); free(original_input); free(bins);
+            continue;
+        }
+
+        generate_sine_wave_f32(original_input, N, SINE_FREQ, SAMPLING_FREQ);
+
+        arm_cfft_instance_f32 fft_instance;
+        if (arm_cfft_init_f32(&fft_instance, N) != ARM_MATH_SUCCESS) {
+            printf("FFT init failed for N = %d\n", N);
+            free(input); free(original_input); free(bins);
+            continue;
+        }
+
+        // A full-scale real tone lands at N/2 in the unscaled f32 FFT
+        float32_t mag_threshold = DETECT_THRESHOLD_REL * (N / 2);
+        float32_t power_threshold = mag_threshold * mag_threshold;
+
+        detect_timings fused, baseline;
+        spectrum_detection_f32 fused_det, baseline_det;
+        int detections_match = 1;
+        printf("\nFFT Size: %d\n", N);
+
+        for (int execution = 0; execution < NUM_EXECUTIONS; execution++) {
+            memcpy(input, original_input, 2 * N * sizeof(float32_t));
+
+            fill_stack_pattern_to_sp();
+            enable_cycle_counter();
+            uint32_t start_cycles = read_cycle_counter();
+
+            power_spectrum_detect_f32(&fft_instance, input, bins, num_bins, power_threshold, &fused_det);
+
+            uint32_t end_cycles = read_cycle_counter();
+            record_timing(&fused, execution, end_cycles - start_cycles);
+
+            memcpy(input, original_input, 2 * N * sizeof(float32_t));
+
+            fill_stack_pattern_to_sp();
+            enable_cycle_counter();
+            start_cycles = read_cycle_counter();
+
+            magnitude_spectrum_detect_f32(&fft_instance, input, bins, num_bins, mag_threshold, &baseline_det);
+
+            end_cycles = read_cycle_counter();
+            record_timing(&baseline, execution, end_cycles - start_cycles);
+
+            if (fused_det.peak_bin != baseline_det.peak_bin || fused_det.num_above != baseline_det.num_above) {
+                detections_match = 0;
+            }
+        }
+
+        printf("Peak Bin = %lu, Bins Above Threshold = %lu\n\r",
+               (unsigned long)fused_det.peak_bin, (unsigned long)fused_det.num_above);
+        if (detections_match) {
+            printf("Power and magnitude detections match for FFT size N = %d\n\r", N);
+        } else {
+            printf("Power and magnitude detections differ for FFT size N = %d\n\r", N);
+        }
+
+        printf("\nFFT + Cmag Squared + Detect:");
+        calculate_averages(fused.cycle_counts, fused.instr_counts, fused.exec_time_us_values, fused.stack_usages, NUM_EXECUTIONS);
+        printf("\nFFT + Cmag + Detect:");
+        calculate_averages(baseline.cycle_counts, baseline.instr_counts, baseline.exec_time_us_values, baseline.stack_usages, NUM_EXECUTIONS);
+        report_savings(N, &fused, &baseline);
+
+        free(input);
+        free(original_input);
+        free(bins);
+    }
+
+    printf("\nBenchmark completed for ARM Power Spectrum F32.\n\r");
+}
+
+RAM_FUNC void benchmark_power_spectrum_q15() {
+    for (int size_idx = 0; size_idx < FFT_SIZES_COUNT; size_idx++) {
+        int N = FFT_SIZES[size_idx];
+        uint32_t num_bins = N / 2;
+
+        q15_t* input = (q15_t*)malloc(2 * N * sizeof(q15_t));
+        q15_t* original_input = (q15_t*)malloc(2 * N * sizeof(q15_t));
+        q15_t* bins = (q15_t*)malloc(num_bins * sizeof(q15_t));
+        if (!input || !original_input || !bins) {
+            printf("Memory allocation failed for FFT size N = %d\n\r", N);
+            free(input); free(original_input); free(bins);
+            continue;
+        }
+
+        generate_sine_wave_q15(original_input, N, SINE_FREQ, SAMPLING_FREQ);
+
+        arm_cfft_instance_q15 fft_instance;
+        if (arm_cfft_init_q15(&fft_instance, N) != ARM_MATH_SUCCESS) {
+            printf("FFT init failed for N = %d\n", N);
+            free(input); free(original_input); free(bins);
+            continue;
+        }
+
+        // arm_cfft_q15 scales by 1/N, so a full-scale real tone lands at 0.5. Magnitudes are
+        // 2.14 and squared magnitudes 3.13.
+        float level = DETECT_THRESHOLD_REL * 0.5f;
+        q15_t mag_threshold = (q15_t)(level * 16384.0f);
+        q15_t power_threshold = (q15_t)(level * level * 8192.0f);
+
+        detect_timings fused, baseline;
+        spectrum_detection_q15 fused_det, baseline_det;
+        int detections_match = 1;
+        printf("\nFFT Size: %d\n", N);
+
+        for (int execution = 0; execution < NUM_EXECUTIONS; execution++) {
+            memcpy(input, original_input, 2 * N * sizeof(q15_t));
+
+            fill_stack_pattern_to_sp();
+            enable_cycle_counter();
+            uint32_t start_cycles = read_cycle_counter();
+
+            power_spectrum_detect_q15(&fft_instance, input, bins, num_bins, power_threshold, &fused_det);
+
+            uint32_t end_cycles = read_cycle_counter();
+            record_timing(&fused, execution, end_cycles - start_cycles);
+
+            memcpy(input, original_input, 2 * N * sizeof(q15_t));
+
+            fill_stack_pattern_to_sp();
+            enable_cycle_counter();
+            start_cycles = read_cycle_counter();
+
+            magnitude_spectrum_detect_q15(&fft_instance, input, bins, num_bins, mag_threshold, &baseline_det);
+
+            end_cycles = read_cycle_counter();
+            record_timing(&baseline, execution, end_cycles - start_cycles);
+
+            if (fused_det.peak_bin != baseline_det.peak_bin || fused_det.num_above != baseline_det.num_above) {
+                detections_match = 0;
+            }
+        }
+
+        printf("Peak Bin = %lu, Bins Above Threshold = %lu\n\r",
+               (unsigned long)fused_det.peak_bin, (unsigned long)fused_det.num_above);
+        if (detections_match) {
+            printf("Power and magnitude detections match for FFT size N = %d\n\r", N);
+        } else {
+            // The 3.13 power threshold is coarser than the 2.14 magnitude one, so bins
+            // sitting right on the threshold can flip
+            printf("Power and magnitude detections differ for FFT size N = %d\n\r", N);
+        }
+
+        printf("\nFFT + Cmag Squared + Detect:");
+        calculate_averages(fused.cycle_counts, fused.instr_counts, fused.exec_time_us_values, fused.stack_usages, NUM_EXECUTIONS);
+        printf("\nFFT + Cmag + Detect:");
+        calculate_averages(baseline.cycle_counts, baseline.instr_counts, baseline.exec_time_us_values, baseline.stack_usages, NUM_EXECUTIONS);
+        report_savings(N, &fused, &baseline);
+
+        free(input);
+        free(original_input);
+        free(bins);
+    }
+
+    printf("\nBenchmark completed for ARM Power Spectrum Q15.\n\r");
+}
@@ -3,6 +3,9 @@
 void benchmark_sqrt(void);
 void benchmark_atan2(void);
 void benchmark_sin_cos(void);
+void benchmark_sin_cos_block(void);
+void benchmark_levinson_durbin(void);
+void benchmark_cholesky(void);
 
 uint32_t clkFastfreq = 0;
 
@@ -47,6 +50,18 @@ RAM_FUNC int main(void)
     benchmark_sin_cos();
     printf("\n\r");
 
+    printf("*****Benchmarking Block SIN/COS *****\n\r");
+    benchmark_sin_cos_block();
+    printf("\n\r");
+
+    printf("*****Benchmarking ARM Levinson-Durbin *****\n\r");
+    benchmark_levinson_durbin();
+    printf("\n\r");
+
+    printf("*****Benchmarking ARM Cholesky *****\n\r");
+    benchmark_cholesky();
+    printf("\n\r");
+
     printf("All tests are completed.\n\r");
     printf("Finish CMSIS Math Benchmark\n\r");
 
@@ -30,6 +30,18 @@ extern uint32_t clkFastfreq;
 extern const int FIR_SIZES[];
 #define FIR_SIZES_COUNT 6
 
+// Linear prediction orders and SPD matrix sizes for the solver benchmarks
+extern const int LPC_ORDERS[];
+#define LPC_ORDERS_COUNT 5
+#define LPC_SIGNAL_LEN   1024
+
+extern const int CHOL_SIZES[];
+#define CHOL_SIZES_COUNT 7
+
+// Block sin/cos: fills both outputs in one pass over the angles
+void sin_cos_block_f32(const float32_t *pSrc, float32_t *pSin, float32_t *pCos, uint32_t blockSize);
+void sin_cos_block_q15(const q15_t *pSrc, q15_t *pSin, q15_t *pCos, uint32_t blockSize);
+
 // Prototypes for common utilities
 void fill_stack_pattern_to_sp(void);
 void enable_cycle_counter(void);
@@ -0,0 +1,90 @@
+#include "main.h"
+#include "arm_common_tables.h"
+
+// Block sin/cos built on the same 512-entry tables as arm_sin_f32/arm_cos_f32 and
+// arm_sin_q15/arm_cos_q15. Range reduction, the table index and the interpolation
+// fraction are computed once per angle; cos reads the table a quarter turn further on.
+// Like the CMSIS-DSP functions they are compared against, they run from flash.
+
+// f32: angles in radians, any range
+void sin_cos_block_f32(const float32_t *pSrc, float32_t *pSin, float32_t *pCos, uint32_t blockSize)
+{
+    const float32_t inv_two_pi = 0.159154943092f;
+
+    for (uint32_t i = 0; i < blockSize; i++) {
+        float32_t in = pSrc[i] * inv_two_pi;
+        int32_t n = (int32_t)in;
+        if (in < 0.0f) {
+            n--;
+        }
+        in -= (float32_t)n;
+
+        float32_t findex = (float32_t)FAST_MATH_TABLE_SIZE * in;
+        uint32_t index = (uint32_t)findex;
+        if (index >= FAST_MATH_TABLE_SIZE) {
+            index = 0;
+            findex -= (float32_t)FAST_MATH_TABLE_SIZE;
+        }
+        float32_t fract = findex - (float32_t)index;
+        uint32_t cindex = (index + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+
+        pSin[i] = (1.0f - fract) * sinTable_f32[index] + fract * sinTable_f32[index + 1];
+        pCos[i] = (1.0f - fract) * sinTable_f32[cindex] + fract * sinTable_f32[cindex + 1];
+    }
+}
+
+// A q15 angle is a table index in its upper bits and a FAST_MATH_Q15_SHIFT-bit fraction
+// below it; SIN_COS_Q15_MASK keeps one turn and SIN_COS_Q15_FRACT_TO_Q14 scales the fraction
+// up to the Q14 interpolation weight.
+#define SIN_COS_Q15_MASK          (((uint32_t)FAST_MATH_TABLE_SIZE << FAST_MATH_Q15_SHIFT) - 1U)
+#define SIN_COS_Q15_FRACT_MASK    ((1U << FAST_MATH_Q15_SHIFT) - 1U)
+#define SIN_COS_Q15_FRACT_TO_Q14  (14 - FAST_MATH_Q15_SHIFT)
+
+// Interpolate between the table pair at idx with one SMUAD. The weights are kept in
+// Q14 so that (0x4000 - g, g) both fit in a signed halfword.
+static inline q31_t sin_cos_interp_q15(uint32_t idx, uint32_t weights)
+{
+    uint32_t pair;
+    memcpy(&pair, &sinTable_q15[idx], sizeof(pair));
+    return __SMUAD(pair, weights) >> 14;
+}
+
+// q15: angles in [0, 1) of a turn, as arm_sin_q15; negative inputs wrap by one turn
+void sin_cos_block_q15(const q15_t *pSrc, q15_t *pSin, q15_t *pCos, uint32_t blockSize)
+{
+    uint32_t blkCnt = blockSize >> 1;
+
+    while (blkCnt > 0U) {
+        uint32_t x0 = (uint16_t)pSrc[0] & SIN_COS_Q15_MASK;
+        uint32_t x1 = (uint16_t)pSrc[1] & SIN_COS_Q15_MASK;
+        uint32_t i0 = x0 >> FAST_MATH_Q15_SHIFT;
+        uint32_t i1 = x1 >> FAST_MATH_Q15_SHIFT;
+        uint32_t g0 = (x0 & SIN_COS_Q15_FRACT_MASK) << SIN_COS_Q15_FRACT_TO_Q14;
+        uint32_t g1 = (x1 & SIN_COS_Q15_FRACT_MASK) << SIN_COS_Q15_FRACT_TO_Q14;
+        uint32_t w0 = __PKHBT(0x4000 - g0, g0, 16);
+        uint32_t w1 = __PKHBT(0x4000 - g1, g1, 16);
+        uint32_t c0 = (i0 + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+        uint32_t c1 = (i1 + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+
+        uint32_t s01 = __PKHBT(sin_cos_interp_q15(i0, w0), sin_cos_interp_q15(i1, w1), 16);
+        uint32_t c01 = __PKHBT(sin_cos_interp_q15(c0, w0), sin_cos_interp_q15(c1, w1), 16);
+        memcpy(pSin, &s01, sizeof(s01));
+        memcpy(pCos, &c01, sizeof(c01));
+
+        pSrc += 2;
+        pSin += 2;
+        pCos += 2;
+        blkCnt--;
+    }
+
+    if (blockSize & 1U) {
+        uint32_t x = (uint16_t)pSrc[0] & SIN_COS_Q15_MASK;
+        uint32_t i = x >> FAST_MATH_Q15_SHIFT;
+        uint32_t g = (x & SIN_COS_Q15_FRACT_MASK) << SIN_COS_Q15_FRACT_TO_Q14;
+        uint32_t w = __PKHBT(0x4000 - g, g, 16);
+        uint32_t c = (i + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+
+        *pSin = (q15_t)sin_cos_interp_q15(i, w);
+        *pCos = (q15_t)sin_cos_interp_q15(c, w);
+    }
+}
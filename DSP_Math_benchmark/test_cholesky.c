@@ -0,0 +1,158 @@
+#include "main.h"
+
+// Cholesky decomposition of the SPD matrices a least-squares calibration builds: A = B B^T / n + I
+// with B uniform in [-1, 1). Errors are against an f64 decomposition of the same A, plus the
+// residual max |L L^T - A| of the result itself.
+
+static void cholesky_f64(const float64_t *A, float64_t *L, int n) {
+    memset(L, 0, n * n * sizeof(float64_t));
+    for (int j = 0; j < n; j++) {
+        float64_t d = A[j * n + j];
+        for (int k = 0; k < j; k++) {
+            d -= L[j * n + k] * L[j * n + k];
+        }
+        L[j * n + j] = sqrt(d);
+        for (int i = j + 1; i < n; i++) {
+            float64_t acc = A[i * n + j];
+            for (int k = 0; k < j; k++) {
+                acc -= L[i * n + k] * L[j * n + k];
+            }
+            L[i * n + j] = acc / L[j * n + j];
+        }
+    }
+}
+
+// Only the lower triangle of the result is compared; CMSIS leaves the upper part untouched
+static void cholesky_errors(const float64_t *A, const float64_t *L_ref, const float64_t *L, int n,
+                            float64_t *max_err, float64_t *residual) {
+    *max_err = 0.0;
+    *residual = 0.0;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            float64_t acc = 0.0;
+            for (int k = 0; k <= j; k++) {
+                acc += L[i * n + k] * L[j * n + k];
+            }
+            *residual = fmax(*residual, fabs(acc - A[i * n + j]));
+            *max_err = fmax(*max_err, fabs(L[i * n + j] - L_ref[i * n + j]));
+        }
+    }
+}
+
+RAM_FUNC void benchmark_cholesky(void) {
+    printf("=== Cholesky Benchmark ===\n\r");
+    for (int i = 0; i < CHOL_SIZES_COUNT; i++) {
+        int n = CHOL_SIZES[i];
+
+        float64_t *B     = malloc(n * n * sizeof(float64_t));
+        float64_t *A_f64 = malloc(n * n * sizeof(float64_t));
+        float64_t *L_ref = malloc(n * n * sizeof(float64_t));
+        float64_t *L_f64 = malloc(n * n * sizeof(float64_t));
+        float64_t *L_chk = malloc(n * n * sizeof(float64_t));
+        float32_t *A_f32 = malloc(n * n * sizeof(float32_t));
+        float32_t *L_f32 = malloc(n * n * sizeof(float32_t));
+        if (!B||!A_f64||!L_ref||!L_f64||!L_chk||!A_f32||!L_f32) {
+            printf("Mem alloc failed for Cholesky N=%d\n\r", n);
+            free(B); free(A_f64); free(L_ref); free(L_f64);
+            free(L_chk); free(A_f32); free(L_f32);
+            continue;
+        }
+
+        // Inputs: A = B B^T / n + I, symmetric positive definite
+        uint32_t seed = 0x5678u + n;
+        for (int j = 0; j < n * n; j++) {
+            seed = seed * 1664525u + 1013904223u;
+            B[j] = (float64_t)(seed >> 8) / 8388608.0 - 1.0;
+        }
+        for (int r = 0; r < n; r++) {
+            for (int c = 0; c < n; c++) {
+                float64_t acc = r == c ? 1.0 : 0.0;
+                for (int k = 0; k < n; k++) {
+                    acc += B[r * n + k] * B[c * n + k] / n;
+                }
+                A_f64[r * n + c] = acc;
+                A_f32[r * n + c] = (float32_t)acc;
+            }
+        }
+        cholesky_f64(A_f64, L_ref, n);
+
+        arm_matrix_instance_f32 src_f32, dst_f32;
+        arm_matrix_instance_f64 src_f64, dst_f64;
+        arm_mat_init_f32(&src_f32, n, n, A_f32);
+        arm_mat_init_f32(&dst_f32, n, n, L_f32);
+        arm_mat_init_f64(&src_f64, n, n, A_f64);
+        arm_mat_init_f64(&dst_f64, n, n, L_f64);
+        memset(L_f32, 0, n * n * sizeof(float32_t));
+        memset(L_f64, 0, n * n * sizeof(float64_t));
+
+        // ---- f32 Cholesky ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        uint32_t start_cycles = read_cycle_counter();
+
+        arm_status status = arm_mat_cholesky_f32(&src_f32, &dst_f32);
+
+        uint32_t end_cycles = read_cycle_counter();
+        uint32_t cycle_count = end_cycles - start_cycles;
+        uint32_t instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        uint32_t stack_used = measure_stack_usage();
+        float time_sec = (float)cycle_count / clkFastfreq;
+        float time_us = time_sec * 1e6f;
+
+        float64_t max_err, residual;
+        for (int j = 0; j < n * n; j++) {
+            L_chk[j] = L_f32[j];
+        }
+        cholesky_errors(A_f64, L_ref, L_chk, n, &max_err, &residual);
+
+        printf("\nCHOLESKY f32 N = %d\n\r", n);
+        if (status != ARM_MATH_SUCCESS) {
+            printf("Status: %d\n\r", (int)status);
+        }
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Max Error vs f64: %.3e, Residual max|LL^T - A|: %.3e\n\r", max_err, residual);
+
+        // ---- f64 Cholesky ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        start_cycles = read_cycle_counter();
+
+        status = arm_mat_cholesky_f64(&src_f64, &dst_f64);
+
+        end_cycles = read_cycle_counter();
+        cycle_count = end_cycles - start_cycles;
+        instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        stack_used = measure_stack_usage();
+        time_sec = (float)cycle_count / clkFastfreq;
+        time_us = time_sec * 1e6f;
+
+        cholesky_errors(A_f64, L_ref, L_f64, n, &max_err, &residual);
+
+        printf("\nCHOLESKY f64 N = %d\n\r", n);
+        if (status != ARM_MATH_SUCCESS) {
+            printf("Status: %d\n\r", (int)status);
+        }
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Max Error vs f64: %.3e, Residual max|LL^T - A|: %.3e\n\r", max_err, residual);
+
+        free(B); free(A_f64); free(L_ref); free(L_f64);
+        free(L_chk); free(A_f32); free(L_f32);
+    }
+    printf("=== Cholesky Benchmark Done ===\n\r");
+}
@@ -0,0 +1,144 @@
+#include "main.h"
+
+// Levinson-Durbin on the autocorrelation of a colored noise sequence, the way an LPC
+// front end uses it. The sequence is AR(2) (x[n] = 0.5 x[n-1] - 0.25 x[n-2] + w[n]), so
+// every prediction coefficient stays inside (-1, 1) and the Q31 version can represent it.
+// Coefficients follow CMSIS: x[n] is predicted as sum a[i] x[n-1-i].
+
+static void levinson_durbin_f64(const float64_t *phi, float64_t *a, float64_t *err, int order) {
+    float64_t e = phi[0];
+
+    for (int p = 0; p < order; p++) {
+        float64_t acc = phi[p + 1];
+        for (int i = 0; i < p; i++) {
+            acc -= a[i] * phi[p - i];
+        }
+        float64_t k = acc / e;
+
+        for (int i = 0; i < p / 2; i++) {
+            float64_t lo = a[i], hi = a[p - 1 - i];
+            a[i] = lo - k * hi;
+            a[p - 1 - i] = hi - k * lo;
+        }
+        if (p & 1) {
+            a[p / 2] -= k * a[p / 2];
+        }
+        a[p] = k;
+        e *= 1.0 - k * k;
+    }
+    *err = e;
+}
+
+RAM_FUNC void benchmark_levinson_durbin(void) {
+    printf("=== Levinson-Durbin Benchmark ===\n\r");
+    for (int i = 0; i < LPC_ORDERS_COUNT; i++) {
+        int order = LPC_ORDERS[i];
+
+        float64_t *x       = malloc(LPC_SIGNAL_LEN * sizeof(float64_t));
+        float64_t *phi_f64 = malloc((order + 1) * sizeof(float64_t));
+        float64_t *a_f64   = malloc(order * sizeof(float64_t));
+        float32_t *phi_f32 = malloc((order + 1) * sizeof(float32_t));
+        float32_t *a_f32   = malloc(order * sizeof(float32_t));
+        q31_t     *phi_q31 = malloc((order + 1) * sizeof(q31_t));
+        q31_t     *a_q31   = malloc(order * sizeof(q31_t));
+        if (!x||!phi_f64||!a_f64||!phi_f32||!a_f32||!phi_q31||!a_q31) {
+            printf("Mem alloc failed for Levinson-Durbin order=%d\n\r", order);
+            free(x); free(phi_f64); free(a_f64);
+            free(phi_f32); free(a_f32); free(phi_q31); free(a_q31);
+            continue;
+        }
+
+        // Inputs: biased autocorrelation of the AR(2) sequence, scaled so phi[0] = 0.99
+        uint32_t seed = 0x1234u;
+        for (int n = 0; n < LPC_SIGNAL_LEN; n++) {
+            seed = seed * 1664525u + 1013904223u;
+            float64_t w = (float64_t)(seed >> 8) / 8388608.0 - 1.0;
+            x[n] = w + (n > 0 ? 0.5 * x[n - 1] : 0.0) - (n > 1 ? 0.25 * x[n - 2] : 0.0);
+        }
+        for (int lag = 0; lag <= order; lag++) {
+            float64_t acc = 0.0;
+            for (int n = lag; n < LPC_SIGNAL_LEN; n++) {
+                acc += x[n] * x[n - lag];
+            }
+            phi_f64[lag] = acc;
+        }
+        for (int lag = order; lag >= 0; lag--) {
+            phi_f64[lag] *= 0.99 / phi_f64[0];
+            phi_f32[lag] = (float32_t)phi_f64[lag];
+            phi_q31[lag] = (q31_t)round(phi_f64[lag] * 2147483648.0);
+        }
+
+        float64_t err_f64;
+        levinson_durbin_f64(phi_f64, a_f64, &err_f64, order);
+
+        // ---- f32 Levinson-Durbin ----
+        float32_t err_f32;
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        uint32_t start_cycles = read_cycle_counter();
+
+        arm_levinson_durbin_f32(phi_f32, a_f32, &err_f32, order);
+
+        uint32_t end_cycles = read_cycle_counter();
+        uint32_t cycle_count = end_cycles - start_cycles;
+        uint32_t instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        uint32_t stack_used = measure_stack_usage();
+        float time_sec = (float)cycle_count / clkFastfreq;
+        float time_us = time_sec * 1e6f;
+
+        float64_t max_err = 0.0;
+        for (int j = 0; j < order; j++) {
+            max_err = fmax(max_err, fabs((float64_t)a_f32[j] - a_f64[j]));
+        }
+
+        printf("\nLEVINSON-DURBIN f32 order = %d\n\r", order);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Max Coefficient Error vs f64: %.3e\n\r", max_err);
+        printf("Prediction Error: %.6f (f64 %.6f)\n\r", err_f32, err_f64);
+
+        // ---- Q31 Levinson-Durbin ----
+        q31_t err_q31;
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        start_cycles = read_cycle_counter();
+
+        arm_levinson_durbin_q31(phi_q31, a_q31, &err_q31, order);
+
+        end_cycles = read_cycle_counter();
+        cycle_count = end_cycles - start_cycles;
+        instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        stack_used = measure_stack_usage();
+        time_sec = (float)cycle_count / clkFastfreq;
+        time_us = time_sec * 1e6f;
+
+        max_err = 0.0;
+        for (int j = 0; j < order; j++) {
+            max_err = fmax(max_err, fabs((float64_t)a_q31[j] / 2147483648.0 - a_f64[j]));
+        }
+
+        printf("\nLEVINSON-DURBIN Q31 order = %d\n\r", order);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Max Coefficient Error vs f64: %.3e\n\r", max_err);
+        printf("Prediction Error: %.6f (f64 %.6f)\n\r", (float64_t)err_q31 / 2147483648.0, err_f64);
+
+        free(x); free(phi_f64); free(a_f64);
+        free(phi_f32); free(a_f32); free(phi_q31); free(a_q31);
+    }
+    printf("=== Levinson-Durbin Benchmark Done ===\n\r");
+}
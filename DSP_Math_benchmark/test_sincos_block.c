@@ -0,0 +1,181 @@
+#include "main.h"
+
+// Per-element sin + cos loops against the block API at every FIR_SIZES length. Each
+// timed region produces both the sin and the cos array, so the cycle counts compare
+// like for like. Errors are the max abs difference from the per-element results.
+
+RAM_FUNC static void report_sincos_result(const char *variant, int N, uint32_t cycle_count, uint32_t instr_est,
+                                          uint32_t stack_used, float max_diff) {
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n%s N = %d\n\r", variant, N);
+    printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Cycles per Angle: %.2f\n\r", (float)cycle_count / N);
+    printf("Max Abs Diff vs per-element: %.3e\n\r", max_diff);
+}
+
+RAM_FUNC static float max_diff_f32(const float32_t *a, const float32_t *b, const float32_t *c, const float32_t *d, int N) {
+    float m = 0.0f;
+    for (int j = 0; j < N; j++) {
+        float e = fmaxf(fabsf(a[j] - b[j]), fabsf(c[j] - d[j]));
+        if (e > m) m = e;
+    }
+    return m;
+}
+
+RAM_FUNC static float max_diff_q15(const q15_t *a, const q15_t *b, const q15_t *c, const q15_t *d, int N) {
+    int m = 0;
+    for (int j = 0; j < N; j++) {
+        int e = abs(a[j] - b[j]);
+        if (abs(c[j] - d[j]) > e) e = abs(c[j] - d[j]);
+        if (e > m) m = e;
+    }
+    return (float)m / Q15_SCALE;
+}
+
+RAM_FUNC void benchmark_sin_cos_block(void) {
+    printf("=== Block SIN/COS Benchmark ===\n\r");
+    for (int i = 0; i < FIR_SIZES_COUNT; i++) {
+        int N = FIR_SIZES[i];
+
+        float32_t *ang_f32   = malloc(N*sizeof(float32_t));
+        float32_t *ang_deg   = malloc(N*sizeof(float32_t));
+        float32_t *s_ref_f32 = malloc(N*sizeof(float32_t));
+        float32_t *c_ref_f32 = malloc(N*sizeof(float32_t));
+        float32_t *s_f32     = malloc(N*sizeof(float32_t));
+        float32_t *c_f32     = malloc(N*sizeof(float32_t));
+        q15_t     *ang_q15   = malloc(N*sizeof(q15_t));
+        q15_t     *s_ref_q15 = malloc(N*sizeof(q15_t));
+        q15_t     *c_ref_q15 = malloc(N*sizeof(q15_t));
+        q15_t     *s_q15     = malloc(N*sizeof(q15_t));
+        q15_t     *c_q15     = malloc(N*sizeof(q15_t));
+        if (!ang_f32||!ang_deg||!s_ref_f32||!c_ref_f32||!s_f32||!c_f32||
+            !ang_q15||!s_ref_q15||!c_ref_q15||!s_q15||!c_q15) {
+            printf("Mem alloc failed for block SIN/COS N=%d\n\r", N);
+            free(ang_f32); free(ang_deg); free(s_ref_f32); free(c_ref_f32); free(s_f32); free(c_f32);
+            free(ang_q15); free(s_ref_q15); free(c_ref_q15); free(s_q15); free(c_q15);
+            continue;
+        }
+
+        // Inputs: angles [0..2π), same as benchmark_sin_cos; arm_sin_cos_f32 takes degrees
+        for (int j = 0; j < N; j++) {
+            float32_t a    = 2*M_PI * j / N;
+            ang_f32[j]     = a;
+            ang_deg[j]     = 360.0f * j / N;
+            ang_q15[j]     = (q15_t)((a/(2*M_PI))*0x7FFF);
+        }
+
+        // ---- f32 per-element sin + cos ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        uint32_t start_cycles = read_cycle_counter();
+
+        for (int j = 0; j < N; j++) {
+            s_ref_f32[j] = arm_sin_f32(ang_f32[j]);
+        }
+        for (int j = 0; j < N; j++) {
+            c_ref_f32[j] = arm_cos_f32(ang_f32[j]);
+        }
+
+        uint32_t end_cycles = read_cycle_counter();
+        uint32_t cycle_count = end_cycles - start_cycles;
+        uint32_t instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        uint32_t stack_used = measure_stack_usage();
+        report_sincos_result("SIN+COS f32 per-element", N, cycle_count, instr_est, stack_used, 0.0f);
+
+        // ---- f32 arm_sin_cos_f32 per element ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        start_cycles = read_cycle_counter();
+
+        for (int j = 0; j < N; j++) {
+            arm_sin_cos_f32(ang_deg[j], &s_f32[j], &c_f32[j]);
+        }
+
+        end_cycles = read_cycle_counter();
+        cycle_count = end_cycles - start_cycles;
+        instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        stack_used = measure_stack_usage();
+        report_sincos_result("SIN_COS f32 arm_sin_cos_f32", N, cycle_count, instr_est, stack_used,
+                             max_diff_f32(s_f32, s_ref_f32, c_f32, c_ref_f32, N));
+
+        // ---- f32 block ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        start_cycles = read_cycle_counter();
+
+        sin_cos_block_f32(ang_f32, s_f32, c_f32, N);
+
+        end_cycles = read_cycle_counter();
+        cycle_count = end_cycles - start_cycles;
+        instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        stack_used = measure_stack_usage();
+        report_sincos_result("SIN_COS f32 block", N, cycle_count, instr_est, stack_used,
+                             max_diff_f32(s_f32, s_ref_f32, c_f32, c_ref_f32, N));
+
+        // ---- Q15 per-element sin + cos ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        start_cycles = read_cycle_counter();
+
+        for (int j = 0; j < N; j++) {
+            s_ref_q15[j] = arm_sin_q15(ang_q15[j]);
+        }
+        for (int j = 0; j < N; j++) {
+            c_ref_q15[j] = arm_cos_q15(ang_q15[j]);
+        }
+
+        end_cycles = read_cycle_counter();
+        cycle_count = end_cycles - start_cycles;
+        instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        stack_used = measure_stack_usage();
+        report_sincos_result("SIN+COS Q15 per-element", N, cycle_count, instr_est, stack_used, 0.0f);
+
+        // ---- Q15 block (SMUAD interpolation) ----
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        start_cycles = read_cycle_counter();
+
+        sin_cos_block_q15(ang_q15, s_q15, c_q15, N);
+
+        end_cycles = read_cycle_counter();
+        cycle_count = end_cycles - start_cycles;
+        instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        stack_used = measure_stack_usage();
+        report_sincos_result("SIN_COS Q15 block", N, cycle_count, instr_est, stack_used,
+                             max_diff_q15(s_q15, s_ref_q15, c_q15, c_ref_q15, N));
+
+        free(ang_f32); free(ang_deg); free(s_ref_f32); free(c_ref_f32); free(s_f32); free(c_f32);
+        free(ang_q15); free(s_ref_q15); free(c_ref_q15); free(s_q15); free(c_q15);
+    }
+    printf("=== Block SIN/COS Benchmark Done ===\n\r");
+}
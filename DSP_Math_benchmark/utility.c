@@ -1,6 +1,8 @@
 #include "main.h"
 
 const int FIR_SIZES[] = {32, 64, 128, 256, 512, 1024};
+const int LPC_ORDERS[] = {8, 12, 16, 24, 32};
+const int CHOL_SIZES[] = {4, 6, 8, 12, 16, 24, 32};
 
 RAM_FUNC void fill_stack_pattern_to_sp(void) {
     register uint32_t *sp;
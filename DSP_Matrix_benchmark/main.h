@@ -0,0 +1,54 @@
+#ifndef MAIN_H
+#define MAIN_H
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cyhal_clock.h"
+#include "cy_retarget_io.h"
+#include "arm_math.h"
+#include "core_cm4.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Constants
+#define MATRIX_DIM_MAX       64
+#define MATRIX_SHAPES_COUNT  14
+
+// Attributes
+#define RAM_FUNC __attribute__((section(".cy_ramfunc")))
+
+// Stack Limit
+extern uint32_t __StackLimit;
+
+// Clock Frequency
+extern uint32_t clkFastfreq;
+
+// C (rows_a x cols_b) = A (rows_a x cols_a) * B (cols_a x cols_b)
+typedef struct {
+    uint16_t rows_a;
+    uint16_t cols_a;
+    uint16_t cols_b;
+} matrix_shape;
+
+extern const matrix_shape MATRIX_SHAPES[MATRIX_SHAPES_COUNT];
+
+// Prototypes for common utilities
+void fill_stack_pattern_to_sp(void);
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+uint32_t measure_stack_usage(void);
+void prepare_matrix_case(const matrix_shape *shape, float64_t *a, float64_t *b, float64_t *ref);
+void f64_to_f32(const float64_t *in, float32_t *out, int n);
+void f64_to_q31(const float64_t *in, q31_t *out, int n);
+void f64_to_q15(const float64_t *in, q15_t *out, int n);
+void f64_to_q7(const float64_t *in, q7_t *out, int n);
+void f32_to_f64(const float32_t *in, float64_t *out, int n);
+void q31_to_f64(const q31_t *in, float64_t *out, int n);
+void q15_to_f64(const q15_t *in, float64_t *out, int n);
+void q7_to_f64(const q7_t *in, float64_t *out, int n);
+float64_t compute_snr_f64(const float64_t *ref, const float64_t *test, int n);
+void report_matrix_result(const char *label, const matrix_shape *shape, uint32_t cycle_count,
+                          uint32_t instr_est, uint32_t stack_used, arm_status status, float64_t snr_db);
+
+#endif // MAIN_H
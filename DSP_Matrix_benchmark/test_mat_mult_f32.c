@@ -0,0 +1,68 @@
+#include "main.h"
+
+RAM_FUNC void benchmark_mat_mult_f32(void) {
+    printf("=== Matrix Multiply F32 / F64 Benchmark (square and rectangular shapes) ===\n\r");
+
+    const int max_elems = MATRIX_DIM_MAX * MATRIX_DIM_MAX;
+    float64_t *a_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    float64_t *b_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    float64_t *ref_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    float64_t *dst_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    float32_t *a = (float32_t*)malloc(max_elems * sizeof(float32_t));
+    float32_t *b = (float32_t*)malloc(max_elems * sizeof(float32_t));
+    float32_t *dst = (float32_t*)malloc(max_elems * sizeof(float32_t));
+    if (!a_f64 || !b_f64 || !ref_f64 || !dst_f64 || !a || !b || !dst) {
+        printf("Memory allocation failed for Matrix Multiply F32\n\r");
+        free(a_f64); free(b_f64); free(ref_f64); free(dst_f64); free(a); free(b); free(dst);
+        return;
+    }
+
+    for (int s = 0; s < MATRIX_SHAPES_COUNT; s++) {
+        const matrix_shape *shape = &MATRIX_SHAPES[s];
+        const int M = shape->rows_a, K = shape->cols_a, N = shape->cols_b;
+
+        prepare_matrix_case(shape, a_f64, b_f64, ref_f64);
+        f64_to_f32(a_f64, a, M * K);
+        f64_to_f32(b_f64, b, K * N);
+
+        for (int f64 = 0; f64 <= 1; f64++) {
+            arm_matrix_instance_f32 A, B, C;
+            arm_matrix_instance_f64 A64, B64, C64;
+            arm_status status;
+
+            arm_mat_init_f32(&A, M, K, a);
+            arm_mat_init_f32(&B, K, N, b);
+            arm_mat_init_f32(&C, M, N, dst);
+            arm_mat_init_f64(&A64, M, K, a_f64);
+            arm_mat_init_f64(&B64, K, N, b_f64);
+            arm_mat_init_f64(&C64, M, N, dst_f64);
+
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            uint32_t start_cycles = read_cycle_counter();
+
+            if (f64)
+                status = arm_mat_mult_f64(&A64, &B64, &C64);
+            else
+                status = arm_mat_mult_f32(&A, &B, &C);
+
+            uint32_t end_cycles = read_cycle_counter();
+            uint32_t cycle_count = end_cycles - start_cycles;
+            uint32_t instr_est = cycle_count
+                               - DWT->CPICNT
+                               - DWT->EXCCNT
+                               - DWT->SLEEPCNT
+                               - DWT->LSUCNT
+                               + DWT->FOLDCNT;
+            uint32_t stack_used = measure_stack_usage();
+
+            if (!f64)
+                f32_to_f64(dst, dst_f64, M * N);
+            report_matrix_result(f64 ? "MAT MULT F64" : "MAT MULT F32", shape, cycle_count, instr_est,
+                                 stack_used, status, compute_snr_f64(ref_f64, dst_f64, M * N));
+        }
+    }
+
+    free(a_f64); free(b_f64); free(ref_f64); free(dst_f64); free(a); free(b); free(dst);
+    printf("\nBenchmark completed for ARM Matrix Multiply F32 / F64.\n\r");
+}
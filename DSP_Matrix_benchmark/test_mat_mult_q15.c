@@ -0,0 +1,74 @@
+#include "main.h"
+
+RAM_FUNC void benchmark_mat_mult_q15(void) {
+    printf("=== Matrix Multiply Q15 / FAST Q15 Benchmark (square and rectangular shapes) ===\n\r");
+
+    const int max_elems = MATRIX_DIM_MAX * MATRIX_DIM_MAX;
+    float64_t *a_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    float64_t *b_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    float64_t *ref_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    q15_t *a = (q15_t*)malloc(max_elems * sizeof(q15_t));
+    q15_t *b = (q15_t*)malloc(max_elems * sizeof(q15_t));
+    q15_t *dst = (q15_t*)malloc(max_elems * sizeof(q15_t));
+    q15_t *dst_base = (q15_t*)malloc(max_elems * sizeof(q15_t));
+    q15_t *state = (q15_t*)malloc(max_elems * sizeof(q15_t));   // transposed B
+    if (!a_f64 || !b_f64 || !ref_f64 || !a || !b || !dst || !dst_base || !state) {
+        printf("Memory allocation failed for Matrix Multiply Q15\n\r");
+        free(a_f64); free(b_f64); free(ref_f64); free(a); free(b); free(dst); free(dst_base); free(state);
+        return;
+    }
+
+    for (int s = 0; s < MATRIX_SHAPES_COUNT; s++) {
+        const matrix_shape *shape = &MATRIX_SHAPES[s];
+        const int M = shape->rows_a, K = shape->cols_a, N = shape->cols_b;
+
+        prepare_matrix_case(shape, a_f64, b_f64, ref_f64);
+        f64_to_q15(a_f64, a, M * K);
+        f64_to_q15(b_f64, b, K * N);
+
+        for (int fast = 0; fast <= 1; fast++) {
+            arm_matrix_instance_q15 A, B, C;
+            arm_status status;
+
+            arm_mat_init_q15(&A, M, K, a);
+            arm_mat_init_q15(&B, K, N, b);
+            arm_mat_init_q15(&C, M, N, fast ? dst : dst_base);
+
+            enable_cycle_counter();
+            fill_stack_pattern_to_sp();
+            uint32_t start_cycles = read_cycle_counter();
+
+            if (fast)
+                status = arm_mat_mult_fast_q15(&A, &B, &C, state);
+            else
+                status = arm_mat_mult_q15(&A, &B, &C, state);
+
+            uint32_t end_cycles = read_cycle_counter();
+            uint32_t cycle_count = end_cycles - start_cycles;
+            uint32_t instr_est = cycle_count
+                               - DWT->CPICNT
+                               - DWT->EXCCNT
+                               - DWT->SLEEPCNT
+                               - DWT->LSUCNT
+                               + DWT->FOLDCNT;
+            uint32_t stack_used = measure_stack_usage();
+
+            // a_f64 is free once the inputs are quantized; reuse it for the output
+            q15_to_f64(fast ? dst : dst_base, a_f64, M * N);
+            report_matrix_result(fast ? "MAT MULT FAST Q15" : "MAT MULT Q15", shape, cycle_count, instr_est,
+                                 stack_used, status, compute_snr_f64(ref_f64, a_f64, M * N));
+
+            if (fast) {
+                int max_diff = 0;
+                for (int i = 0; i < M * N; i++) {
+                    int diff = abs(dst[i] - dst_base[i]);
+                    if (diff > max_diff) max_diff = diff;
+                }
+                printf("Max Diff vs arm_mat_mult_q15: %d LSB\n\r", max_diff);
+            }
+        }
+    }
+
+    free(a_f64); free(b_f64); free(ref_f64); free(a); free(b); free(dst); free(dst_base); free(state);
+    printf("\nBenchmark completed for ARM Matrix Multiply Q15.\n\r");
+}
@@ -0,0 +1,55 @@
+#include "main.h"
+
+RAM_FUNC void benchmark_mat_mult_q7(void) {
+    printf("=== Matrix Multiply Q7 Benchmark (square and rectangular shapes) ===\n\r");
+
+    const int max_elems = MATRIX_DIM_MAX * MATRIX_DIM_MAX;
+    float64_t *a_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    float64_t *b_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    float64_t *ref_f64 = (float64_t*)malloc(max_elems * sizeof(float64_t));
+    q7_t *a = (q7_t*)malloc(max_elems * sizeof(q7_t));
+    q7_t *b = (q7_t*)malloc(max_elems * sizeof(q7_t));
+    q7_t *dst = (q7_t*)malloc(max_elems * sizeof(q7_t));
+    q7_t *state = (q7_t*)malloc(max_elems * sizeof(q7_t));   // transposed B
+    if (!a_f64 || !b_f64 || !ref_f64 || !a || !b || !dst || !state) {
+        printf("Memory allocation failed for Matrix Multiply Q7\n\r");
+        free(a_f64); free(b_f64); free(ref_f64); free(a); free(b); free(dst); free(state);
+        return;
+    }
+
+    for (int s = 0; s < MATRIX_SHAPES_COUNT; s++) {
+        const matrix_shape *shape = &MATRIX_SHAPES[s];
+        const int M = shape->rows_a, K = shape->cols_a, N = shape->cols_b;
+        arm_matrix_instance_q7 A, B, C;
+
+        prepare_matrix_case(shape, a_f64, b_f64, ref_f64);
+        f64_to_q7(a_f64, a, M * K);
+        f64_to_q7(b_f64, b, K * N);
+        arm_mat_init_q7(&A, M, K, a);
+        arm_mat_init_q7(&B, K, N, b);
+        arm_mat_init_q7(&C, M, N, dst);
+
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        uint32_t start_cycles = read_cycle_counter();
+
+        arm_status status = arm_mat_mult_q7(&A, &B, &C, state);
+
+        uint32_t end_cycles = read_cycle_counter();
+        uint32_t cycle_count = end_cycles - start_cycles;
+        uint32_t instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        uint32_t stack_used = measure_stack_usage();
+
+        q7_to_f64(dst, a_f64, M * N);
+        report_matrix_result("MAT MULT Q7", shape, cycle_count, instr_est,
+                             stack_used, status, compute_snr_f64(ref_f64, a_f64, M * N));
+    }
+
+    free(a_f64); free(b_f64); free(ref_f64); free(a); free(b); free(dst); free(state);
+    printf("\nBenchmark completed for ARM Matrix Multiply Q7.\n\r");
+}
@@ -0,0 +1,165 @@
+#include "main.h"
+
+// Square sizes first, then the rectangular products of a 6-state / 3-measurement Kalman
+// update, 3-axis calibration over a block of samples, and larger layer-sized operands
+const matrix_shape MATRIX_SHAPES[MATRIX_SHAPES_COUNT] = {
+    {3, 3, 3}, {4, 4, 4}, {6, 6, 6}, {8, 8, 8}, {16, 16, 16}, {32, 32, 32}, {64, 64, 64},
+    {6, 6, 3}, {3, 6, 6}, {3, 3, 64}, {64, 3, 3}, {16, 64, 16}, {64, 16, 64}, {64, 64, 1}
+};
+
+RAM_FUNC void fill_stack_pattern_to_sp(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp) {
+        *p++ = 0xAAAAAAAA;
+    }
+}
+
+RAM_FUNC void enable_cycle_counter() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;      // Enable trace
+    DWT->CTRL |= (1 << 0);                               // CYCCNTENA
+    DWT->CTRL |= (1 << 16);                              // CPICNT
+    DWT->CTRL |= (1 << 17);                              // EXCCNT
+    DWT->CTRL |= (1 << 18);                              // SLEEPCNT
+    DWT->CTRL |= (1 << 19);                              // LSUCNT
+    DWT->CTRL |= (1 << 20);                              // FOLDCNT
+
+    DWT->CYCCNT = 0;
+    DWT->CPICNT = 0;
+    DWT->EXCCNT = 0;
+    DWT->SLEEPCNT = 0;
+    DWT->LSUCNT = 0;
+    DWT->FOLDCNT = 0;
+}
+
+RAM_FUNC uint32_t read_cycle_counter(void) {
+    return DWT->CYCCNT;
+}
+
+RAM_FUNC uint32_t measure_stack_usage(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp && *p == 0xAAAAAAAA) {
+        p++;
+    }
+    return ((uint32_t)sp - (uint32_t)p);
+}
+
+// Uniform values in [-amplitude, amplitude) from a fixed LCG, so every run sees the same data
+static void generate_matrix_f64(float64_t *out, int n, float64_t amplitude, uint32_t seed) {
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        out[i] = amplitude * ((float64_t)(seed >> 8) / 8388608.0 - 1.0);
+    }
+}
+
+// Inputs are scaled to 0.99 / sqrt(cols_a) so that no dot product can reach 1.0 and the
+// fixed-point variants never saturate; the reference is the product of these f64 inputs.
+void prepare_matrix_case(const matrix_shape *shape, float64_t *a, float64_t *b, float64_t *ref) {
+    const int M = shape->rows_a, K = shape->cols_a, N = shape->cols_b;
+    const float64_t amplitude = 0.99 / sqrt((float64_t)K);
+
+    generate_matrix_f64(a, M * K, amplitude, 0x1234u + M * 64 + K);
+    generate_matrix_f64(b, K * N, amplitude, 0x5678u + K * 64 + N);
+
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            float64_t acc = 0.0;
+            for (int k = 0; k < K; k++) {
+                acc += a[i * K + k] * b[k * N + j];
+            }
+            ref[i * N + j] = acc;
+        }
+    }
+}
+
+void f64_to_f32(const float64_t *in, float32_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = (float32_t)in[i];
+    }
+}
+
+void f64_to_q31(const float64_t *in, q31_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        float64_t v = round(in[i] * 2147483648.0);
+        if (v > 2147483647.0) v = 2147483647.0;
+        if (v < -2147483648.0) v = -2147483648.0;
+        out[i] = (q31_t)v;
+    }
+}
+
+void f64_to_q15(const float64_t *in, q15_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        float64_t v = round(in[i] * 32768.0);
+        if (v > 32767.0) v = 32767.0;
+        if (v < -32768.0) v = -32768.0;
+        out[i] = (q15_t)v;
+    }
+}
+
+void f64_to_q7(const float64_t *in, q7_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        float64_t v = round(in[i] * 128.0);
+        if (v > 127.0) v = 127.0;
+        if (v < -128.0) v = -128.0;
+        out[i] = (q7_t)v;
+    }
+}
+
+void f32_to_f64(const float32_t *in, float64_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = (float64_t)in[i];
+    }
+}
+
+void q31_to_f64(const q31_t *in, float64_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = (float64_t)in[i] / 2147483648.0;
+    }
+}
+
+void q15_to_f64(const q15_t *in, float64_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = (float64_t)in[i] / 32768.0;
+    }
+}
+
+void q7_to_f64(const q7_t *in, float64_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = (float64_t)in[i] / 128.0;
+    }
+}
+
+// Signal-to-noise ratio of test against ref in dB
+float64_t compute_snr_f64(const float64_t *ref, const float64_t *test, int n) {
+    float64_t signal = 0.0, noise = 0.0;
+    for (int i = 0; i < n; i++) {
+        float64_t err = ref[i] - test[i];
+        signal += ref[i] * ref[i];
+        noise += err * err;
+    }
+    if (noise == 0.0) {
+        return INFINITY;
+    }
+    return 10.0 * log10(signal / noise);
+}
+
+RAM_FUNC void report_matrix_result(const char *label, const matrix_shape *shape, uint32_t cycle_count,
+                                   uint32_t instr_est, uint32_t stack_used, arm_status status, float64_t snr_db) {
+    const uint32_t macs = (uint32_t)shape->rows_a * shape->cols_a * shape->cols_b;
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n%s %ux%u * %ux%u\n\r", label, shape->rows_a, shape->cols_a, shape->cols_a, shape->cols_b);
+    if (status != ARM_MATH_SUCCESS) {
+        printf("Status: %d\n\r", (int)status);
+    }
+    printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("MACs: %lu, MACs per Cycle: %.3f\n\r", (unsigned long)macs, (float)macs / cycle_count);
+    printf("SNR vs f64 reference: %.2f dB\n\r", snr_db);
+}
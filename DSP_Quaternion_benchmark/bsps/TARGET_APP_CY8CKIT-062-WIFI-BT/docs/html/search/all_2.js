@@ -0,0 +1,125 @@
+var searchData=
+[
+  ['capsense_0',['Capsense',['../group__group__bsp__pins__capsense.html',1,'']]],
+  ['communication_20pins_1',['Communication Pins',['../group__group__bsp__pins__comm.html',1,'']]],
+  ['cy8ckit_2d062_2dwifi_2dbt_20bsp_2',['CY8CKIT-062-WIFI-BT BSP',['../index.html',1,'']]],
+  ['cybsp_5fa0_3',['CYBSP_A0',['../group__group__bsp__pins__arduino.html#gae4c804044ed1e8745433efc32f1e3de5',1,'cybsp_doc.h']]],
+  ['cybsp_5fa1_4',['CYBSP_A1',['../group__group__bsp__pins__arduino.html#gaeb5533ea084a75773bd3f2aaf3363ac9',1,'cybsp_doc.h']]],
+  ['cybsp_5fa2_5',['CYBSP_A2',['../group__group__bsp__pins__arduino.html#ga3e497e03e8e9d8bd597f01426bc4b70a',1,'cybsp_doc.h']]],
+  ['cybsp_5fa3_6',['CYBSP_A3',['../group__group__bsp__pins__arduino.html#ga53d1f02f664bd82f42989ffa5d34912e',1,'cybsp_doc.h']]],
+  ['cybsp_5fa4_7',['CYBSP_A4',['../group__group__bsp__pins__arduino.html#ga7d1263cd4a6e3a4225e69496f200519a',1,'cybsp_doc.h']]],
+  ['cybsp_5fa5_8',['CYBSP_A5',['../group__group__bsp__pins__arduino.html#ga82f65194bfe335814d88649a2033b2f4',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fdevice_5fwake_9',['CYBSP_BT_DEVICE_WAKE',['../group__group__bsp__pins__comm.html#ga157d988297cf9f6e736a6b2568393b57',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fdevice_5fwake_5fgpio_5fdm_10',['CYBSP_BT_DEVICE_WAKE_GPIO_DM',['../group__group__bsp__pins__comm.html#ga2e4aea75f92232352bef06af68df7fbe',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fdevice_5fwake_5fpolarity_11',['CYBSP_BT_DEVICE_WAKE_POLARITY',['../group__group__bsp__pins__comm.html#ga819696334214ae0d912c381c7fb574f9',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fhost_5fwake_12',['CYBSP_BT_HOST_WAKE',['../group__group__bsp__pins__comm.html#ga49990e2184614916af625ad60c670cc9',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fhost_5fwake_5fgpio_5fdm_13',['CYBSP_BT_HOST_WAKE_GPIO_DM',['../group__group__bsp__pins__comm.html#ga640c8f2a95b8947b809fa42cd1bd6602',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fhost_5fwake_5firq_5fevent_14',['CYBSP_BT_HOST_WAKE_IRQ_EVENT',['../group__group__bsp__pins__comm.html#gab480375f418ada758be1e7f32e42b232',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fplatform_5fcfg_15',['cybsp_bt_platform_cfg',['../group__group__bsp__bt.html#gad2a1cd8a260feac884c816510f34c23e',1,'cybsp_bt_platform_cfg():&#160;cybsp_bt_config.c'],['../group__group__bsp__bt.html#gad2a1cd8a260feac884c816510f34c23e',1,'cybsp_bt_platform_cfg():&#160;cybsp_bt_config.c']]],
+  ['cybsp_5fbt_5fplatform_5fcfg_5fbaud_5fdownload_16',['CYBSP_BT_PLATFORM_CFG_BAUD_DOWNLOAD',['../group__group__bsp__bt.html#gae6fcfdb93cc3e51a046b0cacbc49b4c2',1,'cybsp_bt_config.h']]],
+  ['cybsp_5fbt_5fplatform_5fcfg_5fbaud_5ffeature_17',['CYBSP_BT_PLATFORM_CFG_BAUD_FEATURE',['../group__group__bsp__bt.html#ga58d129cbeb845f8547f2140b8656ef88',1,'cybsp_bt_config.h']]],
+  ['cybsp_5fbt_5fplatform_5fcfg_5fbits_5fdata_18',['CYBSP_BT_PLATFORM_CFG_BITS_DATA',['../group__group__bsp__bt.html#ga874350ee5d9bfcafa5ddbb771f0770f9',1,'cybsp_bt_config.h']]],
+  ['cybsp_5fbt_5fplatform_5fcfg_5fbits_5fstop_19',['CYBSP_BT_PLATFORM_CFG_BITS_STOP',['../group__group__bsp__bt.html#gab7d4fad6bdee9bdff173acbbf1fbacee',1,'cybsp_bt_config.h']]],
+  ['cybsp_5fbt_5fplatform_5fcfg_5fmem_5fpool_5fbytes_20',['CYBSP_BT_PLATFORM_CFG_MEM_POOL_BYTES',['../group__group__bsp__bt.html#ga668864091ac3c80319d2051f04b1bddf',1,'cybsp_bt_config.h']]],
+  ['cybsp_5fbt_5fplatform_5fcfg_5fsleep_5fmode_5flp_5fenabled_21',['CYBSP_BT_PLATFORM_CFG_SLEEP_MODE_LP_ENABLED',['../group__group__bsp__bt.html#ga9090c8f19b0abb9792e62f2649044a7e',1,'cybsp_bt_config.h']]],
+  ['cybsp_5fbt_5fpower_22',['CYBSP_BT_POWER',['../group__group__bsp__pins__comm.html#ga07bdba5ea596bd4136de8a8b98c660e5',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fuart_5fcts_23',['CYBSP_BT_UART_CTS',['../group__group__bsp__pins__comm.html#ga62f968c28d6dd878d706411644df3b04',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fuart_5frts_24',['CYBSP_BT_UART_RTS',['../group__group__bsp__pins__comm.html#gad8655e49bd423b566bee1346c63c252b',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fuart_5frx_25',['CYBSP_BT_UART_RX',['../group__group__bsp__pins__comm.html#gaedb2fc7c65fd4765368a9fc8acf16b44',1,'cybsp_doc.h']]],
+  ['cybsp_5fbt_5fuart_5ftx_26',['CYBSP_BT_UART_TX',['../group__group__bsp__pins__comm.html#ga598aa3824261cb9f6828c45bc93ce1bc',1,'cybsp_doc.h']]],
+  ['cybsp_5fbtn_5foff_27',['CYBSP_BTN_OFF',['../group__group__bsp__pin__state.html#gafb9176679302bc5b2e002ad7caa56b09',1,'cybsp_types.h']]],
+  ['cybsp_5fbtn_5fpressed_28',['CYBSP_BTN_PRESSED',['../group__group__bsp__pin__state.html#ga7778aac7809929e1032f406b59cbad90',1,'cybsp_types.h']]],
+  ['cybsp_5fcina_29',['CYBSP_CINA',['../group__group__bsp__pins__capsense.html#gadd4324b6eaf10be0bbd26b9598372060',1,'cybsp_doc.h']]],
+  ['cybsp_5fcinb_30',['CYBSP_CINB',['../group__group__bsp__pins__capsense.html#ga7dbe2bacd470aab43b4476d382db91c1',1,'cybsp_doc.h']]],
+  ['cybsp_5fcmod_31',['CYBSP_CMOD',['../group__group__bsp__pins__capsense.html#ga759e657681f3fefc466e0bd23287ab7a',1,'cybsp_doc.h']]],
+  ['cybsp_5fcsd_5fbtn0_32',['CYBSP_CSD_BTN0',['../group__group__bsp__pins__capsense.html#gadb772f7b52e92ec5a13c192cf878b010',1,'cybsp_doc.h']]],
+  ['cybsp_5fcsd_5fbtn1_33',['CYBSP_CSD_BTN1',['../group__group__bsp__pins__capsense.html#ga2f22955f575e9b43b380bc1c713e4184',1,'cybsp_doc.h']]],
+  ['cybsp_5fcsd_5fsld0_34',['CYBSP_CSD_SLD0',['../group__group__bsp__pins__capsense.html#ga36e321396e39f0173bcc05314b63f72b',1,'cybsp_doc.h']]],
+  ['cybsp_5fcsd_5fsld1_35',['CYBSP_CSD_SLD1',['../group__group__bsp__pins__capsense.html#gaf7f9017ffd06ebcf8ba709d858ba5411',1,'cybsp_doc.h']]],
+  ['cybsp_5fcsd_5fsld2_36',['CYBSP_CSD_SLD2',['../group__group__bsp__pins__capsense.html#ga2ab777c7d3a69627e91a5c7efed6d320',1,'cybsp_doc.h']]],
+  ['cybsp_5fcsd_5fsld3_37',['CYBSP_CSD_SLD3',['../group__group__bsp__pins__capsense.html#gaeb41a9ba4c9ae8316bebe53f348cc2ed',1,'cybsp_doc.h']]],
+  ['cybsp_5fcsd_5fsld4_38',['CYBSP_CSD_SLD4',['../group__group__bsp__pins__capsense.html#ga0cfdc4c8461ae89960e23dfc9bc51d14',1,'cybsp_doc.h']]],
+  ['cybsp_5fcsd_5ftx_39',['CYBSP_CSD_TX',['../group__group__bsp__pins__capsense.html#gab8f05c019bc0eb120ca25fead2b538de',1,'cybsp_doc.h']]],
+  ['cybsp_5fd0_40',['CYBSP_D0',['../group__group__bsp__pins__arduino.html#gaf3f59a1b7b94013adedd43cf3598af0a',1,'cybsp_doc.h']]],
+  ['cybsp_5fd1_41',['CYBSP_D1',['../group__group__bsp__pins__arduino.html#ga815d622465be76739d8e71d75725b7a5',1,'cybsp_doc.h']]],
+  ['cybsp_5fd10_42',['CYBSP_D10',['../group__group__bsp__pins__arduino.html#ga1246432b2f280267d3b9fd90028f6244',1,'cybsp_doc.h']]],
+  ['cybsp_5fd11_43',['CYBSP_D11',['../group__group__bsp__pins__arduino.html#gac7cddcd52b382156d8cb1af96d7988b8',1,'cybsp_doc.h']]],
+  ['cybsp_5fd12_44',['CYBSP_D12',['../group__group__bsp__pins__arduino.html#gaf9602a0824b644e2c54716c328b659e8',1,'cybsp_doc.h']]],
+  ['cybsp_5fd13_45',['CYBSP_D13',['../group__group__bsp__pins__arduino.html#gabe652026d9d18fa2c626f744e260e36e',1,'cybsp_doc.h']]],
+  ['cybsp_5fd14_46',['CYBSP_D14',['../group__group__bsp__pins__arduino.html#ga7831843f5ca6c713a7adcb01291640f9',1,'cybsp_doc.h']]],
+  ['cybsp_5fd15_47',['CYBSP_D15',['../group__group__bsp__pins__arduino.html#ga5234f3a9694175eb70c5e20b9c1d30aa',1,'cybsp_doc.h']]],
+  ['cybsp_5fd2_48',['CYBSP_D2',['../group__group__bsp__pins__arduino.html#ga87244e296d0eefe46f1bb9a579b435fa',1,'cybsp_doc.h']]],
+  ['cybsp_5fd3_49',['CYBSP_D3',['../group__group__bsp__pins__arduino.html#ga77222cbe7f9f94826b9970c6bc4843aa',1,'cybsp_doc.h']]],
+  ['cybsp_5fd4_50',['CYBSP_D4',['../group__group__bsp__pins__arduino.html#ga909572ea000d856223c6298cfd4fd067',1,'cybsp_doc.h']]],
+  ['cybsp_5fd5_51',['CYBSP_D5',['../group__group__bsp__pins__arduino.html#gae918eeaea45fa81576613eebef34335b',1,'cybsp_doc.h']]],
+  ['cybsp_5fd6_52',['CYBSP_D6',['../group__group__bsp__pins__arduino.html#gaa436fdcdd1417ce4db7d0d8d4615d60b',1,'cybsp_doc.h']]],
+  ['cybsp_5fd7_53',['CYBSP_D7',['../group__group__bsp__pins__arduino.html#ga0875edb9e551c5eb01ac66dd27faf33a',1,'cybsp_doc.h']]],
+  ['cybsp_5fd8_54',['CYBSP_D8',['../group__group__bsp__pins__arduino.html#ga403c81e9f770b42e8a77668c9695b2dd',1,'cybsp_doc.h']]],
+  ['cybsp_5fd9_55',['CYBSP_D9',['../group__group__bsp__pins__arduino.html#gab89ecd0381439ac9c927af7538f2afc4',1,'cybsp_doc.h']]],
+  ['cybsp_5fdebug_5fuart_5frx_56',['CYBSP_DEBUG_UART_RX',['../group__group__bsp__pins__comm.html#gae1daa9ae5985d8f4002347eee1362c76',1,'cybsp_doc.h']]],
+  ['cybsp_5fdebug_5fuart_5ftx_57',['CYBSP_DEBUG_UART_TX',['../group__group__bsp__pins__comm.html#gaea8cd882c067c13b1411796d5235286d',1,'cybsp_doc.h']]],
+  ['cybsp_5fi2c_5fscl_58',['CYBSP_I2C_SCL',['../group__group__bsp__pins__comm.html#ga034bfe0f68224dd376a9a79e07ab3451',1,'cybsp_doc.h']]],
+  ['cybsp_5fi2c_5fsda_59',['CYBSP_I2C_SDA',['../group__group__bsp__pins__comm.html#gad178ee7378678fe5829a826f9a4ed0b8',1,'cybsp_doc.h']]],
+  ['cybsp_5finit_60',['cybsp_init',['../group__group__bsp__functions.html#gab989986b285e127f78f61c29f6ccbbfa',1,'cybsp_init(void):&#160;cybsp.c'],['../group__group__bsp__functions.html#gab989986b285e127f78f61c29f6ccbbfa',1,'cybsp_init(void):&#160;cybsp.c']]],
+  ['cybsp_5fj2_5f1_61',['CYBSP_J2_1',['../group__group__bsp__pins__j2.html#ga2928c0efaf596b9a1a2739be34d30afa',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f10_62',['CYBSP_J2_10',['../group__group__bsp__pins__j2.html#ga720c63483ba499f759c07d878894c816',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f11_63',['CYBSP_J2_11',['../group__group__bsp__pins__j2.html#gacd997157d0fe86fbea789eac342ec458',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f12_64',['CYBSP_J2_12',['../group__group__bsp__pins__j2.html#gacfd14b254b5a18710b786ec15f43759c',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f13_65',['CYBSP_J2_13',['../group__group__bsp__pins__j2.html#ga234dcb185b3018eef4e63f99fa6ae432',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f15_66',['CYBSP_J2_15',['../group__group__bsp__pins__j2.html#ga5192402f5a9902f68c95dc873a6d7737',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f16_67',['CYBSP_J2_16',['../group__group__bsp__pins__j2.html#ga6163fd86d72d8841a5f3426ab8b9a0a3',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f17_68',['CYBSP_J2_17',['../group__group__bsp__pins__j2.html#ga489d3c35d22a7902ec7fbdd6bac3e96d',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f18_69',['CYBSP_J2_18',['../group__group__bsp__pins__j2.html#gac784bc4514ae8d3dcb3d519176acb55c',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f19_70',['CYBSP_J2_19',['../group__group__bsp__pins__j2.html#ga351b9a72317c7505803fbdb5bada4611',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f2_71',['CYBSP_J2_2',['../group__group__bsp__pins__j2.html#gab60587a5479714795602b0bbfaef85a4',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f20_72',['CYBSP_J2_20',['../group__group__bsp__pins__j2.html#ga577ca258727a78c08c13c80317fadebf',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f3_73',['CYBSP_J2_3',['../group__group__bsp__pins__j2.html#ga48ff7a9d2f79351cd745bf00ebe1d6ea',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f4_74',['CYBSP_J2_4',['../group__group__bsp__pins__j2.html#ga84ef9b47650cc51e597bee8359de6ae2',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f5_75',['CYBSP_J2_5',['../group__group__bsp__pins__j2.html#ga3da7a7ac8f0659e9a5cc2a397cf4aeb0',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f6_76',['CYBSP_J2_6',['../group__group__bsp__pins__j2.html#gaca9046114145221ee2c371e71cce7133',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f7_77',['CYBSP_J2_7',['../group__group__bsp__pins__j2.html#ga582997c2fc8247293d7931cbb840798a',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f8_78',['CYBSP_J2_8',['../group__group__bsp__pins__j2.html#ga3db3544314aaadb183474c2b08f90ac6',1,'cybsp_doc.h']]],
+  ['cybsp_5fj2_5f9_79',['CYBSP_J2_9',['../group__group__bsp__pins__j2.html#ga37bc159883dafce4a540940658d38101',1,'cybsp_doc.h']]],
+  ['cybsp_5fled8_80',['CYBSP_LED8',['../group__group__bsp__pins__led.html#gae7dcc47d4d611d3511c279de6992647a',1,'cybsp_doc.h']]],
+  ['cybsp_5fled9_81',['CYBSP_LED9',['../group__group__bsp__pins__led.html#gad0f804ddeb67eb76f649fcdcb633e9c7',1,'cybsp_doc.h']]],
+  ['cybsp_5fled_5frgb_5fblue_82',['CYBSP_LED_RGB_BLUE',['../group__group__bsp__pins__led.html#gaeee5786a7d2dbb36b7a0c7433a76a038',1,'cybsp_doc.h']]],
+  ['cybsp_5fled_5frgb_5fgreen_83',['CYBSP_LED_RGB_GREEN',['../group__group__bsp__pins__led.html#ga2291710e025db3914eb6414f3b444cb1',1,'cybsp_doc.h']]],
+  ['cybsp_5fled_5frgb_5fred_84',['CYBSP_LED_RGB_RED',['../group__group__bsp__pins__led.html#ga0d77bed8995ff0662adb3f7b2603af88',1,'cybsp_doc.h']]],
+  ['cybsp_5fled_5fstate_5foff_85',['CYBSP_LED_STATE_OFF',['../group__group__bsp__pin__state.html#ga31577fad7e20fcb174e2ecbea2dd063e',1,'cybsp_types.h']]],
+  ['cybsp_5fled_5fstate_5fon_86',['CYBSP_LED_STATE_ON',['../group__group__bsp__pin__state.html#gaedfd071923034a335d143b7b64579169',1,'cybsp_types.h']]],
+  ['cybsp_5fqspi_5fd0_87',['CYBSP_QSPI_D0',['../group__group__bsp__pins__comm.html#gaaea1a4ddc9aa57c45c4d6695b78ee878',1,'cybsp_doc.h']]],
+  ['cybsp_5fqspi_5fd1_88',['CYBSP_QSPI_D1',['../group__group__bsp__pins__comm.html#ga432faefd95828b8d45709aa8302a9433',1,'cybsp_doc.h']]],
+  ['cybsp_5fqspi_5fd2_89',['CYBSP_QSPI_D2',['../group__group__bsp__pins__comm.html#gada7037ba6e38219866f2892f87886b62',1,'cybsp_doc.h']]],
+  ['cybsp_5fqspi_5fd3_90',['CYBSP_QSPI_D3',['../group__group__bsp__pins__comm.html#ga2ad55ac5a5ea027d72c8f702c7f9bbde',1,'cybsp_doc.h']]],
+  ['cybsp_5fqspi_5fsck_91',['CYBSP_QSPI_SCK',['../group__group__bsp__pins__comm.html#ga2bae07a55adc9f31e828312bc8fbdd82',1,'cybsp_doc.h']]],
+  ['cybsp_5fqspi_5fss_92',['CYBSP_QSPI_SS',['../group__group__bsp__pins__comm.html#ga020ca7a044acda4b35e451513e5830df',1,'cybsp_doc.h']]],
+  ['cybsp_5frslt_5ferr_5fsysclk_5fpm_5fcallback_93',['CYBSP_RSLT_ERR_SYSCLK_PM_CALLBACK',['../group__group__bsp__errors.html#gaee745bd3fccec6eb2df1e83fc4c9f775',1,'cybsp.h']]],
+  ['cybsp_5fspi_5fclk_94',['CYBSP_SPI_CLK',['../group__group__bsp__pins__comm.html#gabeb93b3f9b953934666f83a1a97c4367',1,'cybsp_doc.h']]],
+  ['cybsp_5fspi_5fcs_95',['CYBSP_SPI_CS',['../group__group__bsp__pins__comm.html#gad8d3655d655bb752363587ea521c8856',1,'cybsp_doc.h']]],
+  ['cybsp_5fspi_5fmiso_96',['CYBSP_SPI_MISO',['../group__group__bsp__pins__comm.html#gaf6282da9ac2be0fe7a4ac84735a24bb0',1,'cybsp_doc.h']]],
+  ['cybsp_5fspi_5fmosi_97',['CYBSP_SPI_MOSI',['../group__group__bsp__pins__comm.html#ga07b4c8b6a15a1e614ff9be2ebe8088fd',1,'cybsp_doc.h']]],
+  ['cybsp_5fsw2_98',['CYBSP_SW2',['../group__group__bsp__pins__btn.html#ga66053f56ad1d1992e7059a8734d8de14',1,'cybsp_doc.h']]],
+  ['cybsp_5fswdck_99',['CYBSP_SWDCK',['../group__group__bsp__pins__comm.html#ga8f50aad29445466679abdcc75dcd9796',1,'cybsp_doc.h']]],
+  ['cybsp_5fswdio_100',['CYBSP_SWDIO',['../group__group__bsp__pins__comm.html#ga9fba070d4040d6aa4f3e429bdfc38946',1,'cybsp_doc.h']]],
+  ['cybsp_5fswo_101',['CYBSP_SWO',['../group__group__bsp__pins__comm.html#ga83425838dc05860473aebf66214ed9d3',1,'cybsp_doc.h']]],
+  ['cybsp_5fuser_5fbtn_102',['CYBSP_USER_BTN',['../group__group__bsp__pins__btn.html#ga72717d2a6e1a64352274dfb2e5649ee9',1,'cybsp_doc.h']]],
+  ['cybsp_5fuser_5fbtn1_103',['CYBSP_USER_BTN1',['../group__group__bsp__pins__btn.html#ga719bfb6bb0a640a38d94febf75e45341',1,'cybsp_doc.h']]],
+  ['cybsp_5fuser_5fled_104',['CYBSP_USER_LED',['../group__group__bsp__pins__led.html#gacc2bba8588b183ec1d448eda9a039d7c',1,'cybsp_doc.h']]],
+  ['cybsp_5fuser_5fled1_105',['CYBSP_USER_LED1',['../group__group__bsp__pins__led.html#gaabc3ce31f840a85f1063ff3029ab79eb',1,'cybsp_doc.h']]],
+  ['cybsp_5fuser_5fled2_106',['CYBSP_USER_LED2',['../group__group__bsp__pins__led.html#ga5e8df86514516cce06b41a40f749c898',1,'cybsp_doc.h']]],
+  ['cybsp_5fuser_5fled3_107',['CYBSP_USER_LED3',['../group__group__bsp__pins__led.html#ga765a10242952bc96a34adc577fee8a20',1,'cybsp_doc.h']]],
+  ['cybsp_5fuser_5fled4_108',['CYBSP_USER_LED4',['../group__group__bsp__pins__led.html#gacfc93533aad62754acf05cdf9c376125',1,'cybsp_doc.h']]],
+  ['cybsp_5fuser_5fled5_109',['CYBSP_USER_LED5',['../group__group__bsp__pins__led.html#ga7a84bfbd7c6bf0109422638747d2f0a8',1,'cybsp_doc.h']]],
+  ['cybsp_5fwco_5fin_110',['CYBSP_WCO_IN',['../group__group__bsp__pins__wco.html#gac07a2f3b38920ceba85a621a2196d18f',1,'cybsp_doc.h']]],
+  ['cybsp_5fwco_5fout_111',['CYBSP_WCO_OUT',['../group__group__bsp__pins__wco.html#ga6f2a01a38771377b6fe57eb673f21380',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fhost_5fwake_112',['CYBSP_WIFI_HOST_WAKE',['../group__group__bsp__pins__comm.html#gad03531a5a7bdd646e29d417d45f089a8',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fhost_5fwake_5fgpio_5fdm_113',['CYBSP_WIFI_HOST_WAKE_GPIO_DM',['../group__group__bsp__pins__comm.html#ga8643a26f39112d7f87aa8b6ebcdcd1b0',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fhost_5fwake_5firq_5fevent_114',['CYBSP_WIFI_HOST_WAKE_IRQ_EVENT',['../group__group__bsp__pins__comm.html#gae4668c08493082ab2d7dca34eb8a9777',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fsdio_5fclk_115',['CYBSP_WIFI_SDIO_CLK',['../group__group__bsp__pins__comm.html#gad9cac48112cc5b44a707ab741956cd92',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fsdio_5fcmd_116',['CYBSP_WIFI_SDIO_CMD',['../group__group__bsp__pins__comm.html#ga84aaee84fd3639ebe802f835c02d364a',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fsdio_5fd0_117',['CYBSP_WIFI_SDIO_D0',['../group__group__bsp__pins__comm.html#ga87d62aff3ed8c03d1ce66e2a7fa90f4b',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fsdio_5fd1_118',['CYBSP_WIFI_SDIO_D1',['../group__group__bsp__pins__comm.html#ga6b1476fd26d05e548b39e3eac8ca067d',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fsdio_5fd2_119',['CYBSP_WIFI_SDIO_D2',['../group__group__bsp__pins__comm.html#ga3ea3b59f511082e6616882dc64cadbb9',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fsdio_5fd3_120',['CYBSP_WIFI_SDIO_D3',['../group__group__bsp__pins__comm.html#gae0984157f595e2626f420c2f504602b0',1,'cybsp_doc.h']]],
+  ['cybsp_5fwifi_5fwl_5freg_5fon_121',['CYBSP_WIFI_WL_REG_ON',['../group__group__bsp__pins__comm.html#gad1f1366c88d967f6856c6b89154d9403',1,'cybsp_doc.h']]]
+];
@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['arduino_20header_20pins_0',['Arduino Header Pins',['../group__group__bsp__pins__arduino.html',1,'']]]
+];
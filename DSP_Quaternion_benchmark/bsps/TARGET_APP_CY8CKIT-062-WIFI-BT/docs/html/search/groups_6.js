@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['led_20pins_0',['LED Pins',['../group__group__bsp__pins__led.html',1,'']]]
+];
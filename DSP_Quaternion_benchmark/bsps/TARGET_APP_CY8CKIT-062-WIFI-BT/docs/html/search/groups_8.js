@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['wco_0',['WCO',['../group__group__bsp__pins__wco.html',1,'']]]
+];
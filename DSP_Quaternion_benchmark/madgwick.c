@@ -0,0 +1,58 @@
+#include "main.h"
+
+// Madgwick gradient-descent IMU filter (gyro + accelerometer, no magnetometer), written
+// with CMSIS-DSP quaternion, matrix and basic-math calls only. The rotation matrix of the
+// estimate is the filter output; its last row is also the predicted gravity direction in
+// the sensor frame, so the next update reuses it for the objective function.
+
+void madgwick_init(madgwick_state *s, float32_t beta, float32_t dt) {
+    s->q[0] = 1.0f;
+    s->q[1] = 0.0f;
+    s->q[2] = 0.0f;
+    s->q[3] = 0.0f;
+    s->beta = beta;
+    s->dt = dt;
+    arm_quaternion2rotation_f32(s->q, s->rot, 1);
+}
+
+RAM_FUNC void madgwick_update_imu(madgwick_state *s, const float32_t gyro[3], const float32_t accel[3]) {
+    const float32_t *q = s->q;
+    float32_t omega[4] = {0.0f, gyro[0], gyro[1], gyro[2]};
+    float32_t q_dot[4], acc[3], f[3], step[4], power, norm;
+
+    // Rate of change of orientation from the gyroscope: 0.5 * q x (0, w)
+    arm_quaternion_product_single_f32(q, omega, q_dot);
+    arm_scale_f32(q_dot, 0.5f, q_dot, 4);
+
+    arm_power_f32(accel, 3, &power);
+    if (power > 0.0f) {
+        arm_sqrt_f32(power, &norm);
+        arm_scale_f32(accel, 1.0f / norm, acc, 3);
+
+        // Objective: predicted minus measured gravity, both in the sensor frame
+        arm_sub_f32(&s->rot[6], acc, f, 3);
+
+        // Gradient J^T f, with the Jacobian laid out transposed (4x3)
+        float32_t jt_data[12] = {
+            -2.0f * q[2],  2.0f * q[1],  0.0f,
+             2.0f * q[3],  2.0f * q[0], -4.0f * q[1],
+            -2.0f * q[0],  2.0f * q[3], -4.0f * q[2],
+             2.0f * q[1],  2.0f * q[2],  0.0f
+        };
+        arm_matrix_instance_f32 jt;
+        arm_mat_init_f32(&jt, 4, 3, jt_data);
+        arm_mat_vec_mult_f32(&jt, f, step);
+
+        // Normalized gradient step; zero when the estimate already matches the measurement
+        arm_quaternion_norm_f32(step, &norm, 1);
+        if (norm > 1e-9f) {
+            arm_scale_f32(step, s->beta / norm, step, 4);
+            arm_sub_f32(q_dot, step, q_dot, 4);
+        }
+    }
+
+    arm_scale_f32(q_dot, s->dt, q_dot, 4);
+    arm_add_f32(s->q, q_dot, s->q, 4);
+    arm_quaternion_normalize_f32(s->q, s->q, 1);
+    arm_quaternion2rotation_f32(s->q, s->rot, 1);
+}
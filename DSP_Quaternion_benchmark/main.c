@@ -0,0 +1,49 @@
+#include "main.h"
+
+void benchmark_quaternion(void);
+void benchmark_madgwick(void);
+
+uint32_t clkFastfreq = 0;
+
+RAM_FUNC int main(void)
+{
+    __disable_irq();  // Disable all interrupts
+    cy_rslt_t result;
+
+    // Initialize the device and board peripherals
+    result = cybsp_init();
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Initialize retarget-io to use the debug UART port
+    result = cy_retarget_io_init_fc(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                    CYBSP_DEBUG_UART_CTS, CYBSP_DEBUG_UART_RTS, CY_RETARGET_IO_BAUDRATE);
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Get the clock frequency
+    clkFastfreq = Cy_SysClk_ClkFastGetFrequency();
+
+    // Print system details
+    printf("\n\r");
+    printf("-----Starting CMSIS Quaternion Benchmark-----\n\r");
+    printf("\n\r");
+    printf("CPU Clock Frequency: %lu Hz\n\r", clkFastfreq);
+    printf("\n\r");
+
+    // Perform benchmarks
+    printf("*****Benchmarking ARM Quaternion F32 (batched and single calls)*****\n\r");
+    benchmark_quaternion();
+    printf("\n\r");
+
+    printf("*****Benchmarking Madgwick IMU Update F32 (fusion headroom)*****\n\r");
+    benchmark_madgwick();
+    printf("\n\r");
+
+    printf("All tests are completed.\n\r");
+    printf("Finish CMSIS Quaternion Benchmark\n\r");
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#ifndef MAIN_H
+#define MAIN_H
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cyhal_clock.h"
+#include "cy_retarget_io.h"
+#include "arm_math.h"
+#include "core_cm4.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Constants
+#define QUAT_BATCH_SIZES_COUNT 4
+#define QUAT_BATCH_MAX         64
+
+// IMU fusion loop: 1 kHz gyro + accelerometer update, simulated for FUSION_STEPS samples
+#define FUSION_RATE_HZ       1000
+#define FUSION_STEPS         1000
+#define MADGWICK_BETA        0.1f
+#define GYRO_BIAS_RAD_S      0.02f
+
+// Attributes
+#define RAM_FUNC __attribute__((section(".cy_ramfunc")))
+
+// Stack Limit
+extern uint32_t __StackLimit;
+
+// Clock Frequency
+extern uint32_t clkFastfreq;
+
+// Quaternions are (w, x, y, z); rotation matrices are 3x3 row-major
+typedef enum {
+    QUAT_OP_NORM = 0,
+    QUAT_OP_CONJUGATE,
+    QUAT_OP_INVERSE,
+    QUAT_OP_NORMALIZE,
+    QUAT_OP_PRODUCT,
+    QUAT_OP_TO_ROTATION,
+    QUAT_OP_FROM_ROTATION,
+    QUAT_OPS_COUNT
+} quat_op;
+
+// Madgwick IMU filter state; rot is the rotation matrix of q, kept for the next update
+typedef struct {
+    float32_t q[4];
+    float32_t rot[9];
+    float32_t beta;
+    float32_t dt;
+} madgwick_state;
+
+extern const int QUAT_BATCH_SIZES[QUAT_BATCH_SIZES_COUNT];
+
+// Prototypes for common utilities
+void fill_stack_pattern_to_sp(void);
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+uint32_t measure_stack_usage(void);
+void generate_quaternions_f32(float32_t *out, int n, int unit, uint32_t seed);
+int quat_op_out_len(quat_op op);
+void quat_op_reference_f64(quat_op op, const float32_t *a, const float32_t *b, float64_t *out, int n);
+float64_t max_abs_error_f32(const float32_t *test, const float64_t *ref, int n);
+void report_quat_result(const char *label, int n, uint32_t batch_cycles, uint32_t single_cycles,
+                        uint32_t instr_est, uint32_t stack_used, float64_t max_err);
+
+// Madgwick update built from CMSIS-DSP primitives
+void madgwick_init(madgwick_state *s, float32_t beta, float32_t dt);
+void madgwick_update_imu(madgwick_state *s, const float32_t gyro[3], const float32_t accel[3]);
+
+#endif // MAIN_H
@@ -0,0 +1,110 @@
+#include "main.h"
+
+// Each operation runs once over N quaternions (batched) and as N calls of one quaternion,
+// which is how a per-sample fusion loop uses it; product uses arm_quaternion_product_single_f32.
+
+static const char *const QUAT_OP_LABELS[QUAT_OPS_COUNT] = {
+    "QUATERNION NORM F32", "QUATERNION CONJUGATE F32", "QUATERNION INVERSE F32",
+    "QUATERNION NORMALIZE F32", "QUATERNION PRODUCT F32", "QUATERNION2ROTATION F32",
+    "ROTATION2QUATERNION F32"
+};
+
+RAM_FUNC static void quat_op_f32(quat_op op, const float32_t *a, const float32_t *b, float32_t *out, int n) {
+    switch (op) {
+    case QUAT_OP_NORM:          arm_quaternion_norm_f32(a, out, n); break;
+    case QUAT_OP_CONJUGATE:     arm_quaternion_conjugate_f32(a, out, n); break;
+    case QUAT_OP_INVERSE:       arm_quaternion_inverse_f32(a, out, n); break;
+    case QUAT_OP_NORMALIZE:     arm_quaternion_normalize_f32(a, out, n); break;
+    case QUAT_OP_PRODUCT:       arm_quaternion_product_f32(a, b, out, n); break;
+    case QUAT_OP_TO_ROTATION:   arm_quaternion2rotation_f32(a, out, n); break;
+    case QUAT_OP_FROM_ROTATION: arm_rotation2quaternion_f32(a, out, n); break;
+    default: break;
+    }
+}
+
+RAM_FUNC static void quaternion_f32(quat_op op, const float32_t *a, const float32_t *b, float32_t *out,
+                                    float64_t *ref, int n) {
+    const int in_len = op == QUAT_OP_FROM_ROTATION ? 9 : 4;
+    const int out_len = quat_op_out_len(op);
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    quat_op_f32(op, a, b, out, n);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    // Per-sample form: same work as N separate calls
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    for (int i = 0; i < n; i++) {
+        if (op == QUAT_OP_PRODUCT)
+            arm_quaternion_product_single_f32(&a[4 * i], &b[4 * i], &out[4 * i]);
+        else
+            quat_op_f32(op, &a[in_len * i], b, &out[out_len * i], 1);
+    }
+    uint32_t single_cycles = read_cycle_counter() - start_cycles;
+
+    quat_op_reference_f64(op, a, b, ref, n);
+
+    // q and -q are the same rotation; align the sign before comparing
+    if (op == QUAT_OP_FROM_ROTATION) {
+        for (int i = 0; i < n; i++) {
+            float64_t dot = 0.0;
+            for (int k = 0; k < 4; k++)
+                dot += out[4 * i + k] * ref[4 * i + k];
+            if (dot < 0.0) {
+                for (int k = 0; k < 4; k++)
+                    ref[4 * i + k] = -ref[4 * i + k];
+            }
+        }
+    }
+
+    report_quat_result(QUAT_OP_LABELS[op], n, cycle_count, single_cycles, instr_est, stack_used,
+                       max_abs_error_f32(out, ref, n * out_len));
+}
+
+RAM_FUNC void benchmark_quaternion(void) {
+    printf("=== Quaternion Benchmark F32 (batched vs single calls) ===\n\r");
+
+    float32_t *a = (float32_t*)malloc(9 * QUAT_BATCH_MAX * sizeof(float32_t));
+    float32_t *b = (float32_t*)malloc(4 * QUAT_BATCH_MAX * sizeof(float32_t));
+    float32_t *out = (float32_t*)malloc(9 * QUAT_BATCH_MAX * sizeof(float32_t));
+    float64_t *ref = (float64_t*)malloc(9 * QUAT_BATCH_MAX * sizeof(float64_t));
+    if (!a || !b || !out || !ref) {
+        printf("Memory allocation failed for quaternion buffers\n\r");
+        free(a); free(b); free(out); free(ref);
+        return;
+    }
+
+    for (int s = 0; s < QUAT_BATCH_SIZES_COUNT; s++) {
+        const int n = QUAT_BATCH_SIZES[s];
+
+        printf("\n--- N = %d ---\n\r", n);
+        for (int op = 0; op < QUAT_OPS_COUNT; op++) {
+            // Rotation conversions take unit quaternions, the rest get arbitrary norms
+            if (op == QUAT_OP_FROM_ROTATION) {
+                generate_quaternions_f32(b, n, 1, 0xA5A5u + n);
+                quat_op_reference_f64(QUAT_OP_TO_ROTATION, b, NULL, ref, n);
+                for (int i = 0; i < 9 * n; i++)
+                    a[i] = (float32_t)ref[i];
+            } else {
+                generate_quaternions_f32(a, n, op == QUAT_OP_TO_ROTATION, 0x1234u + n);
+                generate_quaternions_f32(b, n, 0, 0x5678u + n);
+            }
+            quaternion_f32((quat_op)op, a, b, out, ref, n);
+        }
+    }
+
+    free(a); free(b); free(out); free(ref);
+    printf("\nBenchmark completed for ARM Quaternion.\n\r");
+}
@@ -0,0 +1,146 @@
+#include "main.h"
+
+// One quaternion (a single fusion step) up to a batch of sensor-frame orientations
+const int QUAT_BATCH_SIZES[QUAT_BATCH_SIZES_COUNT] = {1, 4, 16, 64};
+
+RAM_FUNC void fill_stack_pattern_to_sp(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp) {
+        *p++ = 0xAAAAAAAA;
+    }
+}
+
+RAM_FUNC void enable_cycle_counter() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;      // Enable trace
+    DWT->CTRL |= (1 << 0);                               // CYCCNTENA
+    DWT->CTRL |= (1 << 16);                              // CPICNT
+    DWT->CTRL |= (1 << 17);                              // EXCCNT
+    DWT->CTRL |= (1 << 18);                              // SLEEPCNT
+    DWT->CTRL |= (1 << 19);                              // LSUCNT
+    DWT->CTRL |= (1 << 20);                              // FOLDCNT
+
+    DWT->CYCCNT = 0;
+    DWT->CPICNT = 0;
+    DWT->EXCCNT = 0;
+    DWT->SLEEPCNT = 0;
+    DWT->LSUCNT = 0;
+    DWT->FOLDCNT = 0;
+}
+
+RAM_FUNC uint32_t read_cycle_counter(void) {
+    return DWT->CYCCNT;
+}
+
+RAM_FUNC uint32_t measure_stack_usage(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp && *p == 0xAAAAAAAA) {
+        p++;
+    }
+    return ((uint32_t)sp - (uint32_t)p);
+}
+
+// Random orientations from a fixed LCG. With unit = 0 each quaternion is scaled by a
+// factor in [0.5, 2) so that norm, inverse and normalize have real work to do.
+void generate_quaternions_f32(float32_t *out, int n, int unit, uint32_t seed) {
+    for (int i = 0; i < n; i++) {
+        float64_t q[4], sum = 0.0;
+        for (int k = 0; k < 4; k++) {
+            seed = seed * 1664525u + 1013904223u;
+            q[k] = (float64_t)(seed >> 8) / 8388608.0 - 1.0;
+            sum += q[k] * q[k];
+        }
+        seed = seed * 1664525u + 1013904223u;
+        float64_t scale = unit ? 1.0 : 0.5 + 1.5 * (float64_t)(seed >> 8) / 16777216.0;
+        for (int k = 0; k < 4; k++) {
+            out[4 * i + k] = (float32_t)(scale * q[k] / sqrt(sum));
+        }
+    }
+}
+
+// Output values per quaternion
+int quat_op_out_len(quat_op op) {
+    if (op == QUAT_OP_NORM) {
+        return 1;
+    }
+    return op == QUAT_OP_TO_ROTATION ? 9 : 4;
+}
+
+// f64 reference for each operation. For QUAT_OP_FROM_ROTATION, a holds the rotation
+// matrices and b the quaternions they were built from; the reference is b normalized.
+void quat_op_reference_f64(quat_op op, const float32_t *a, const float32_t *b, float64_t *out, int n) {
+    for (int i = 0; i < n; i++) {
+        const float32_t *p = op == QUAT_OP_FROM_ROTATION ? &b[4 * i] : &a[4 * i];
+        const float64_t q0 = p[0], q1 = p[1], q2 = p[2], q3 = p[3];
+        const float64_t norm2 = q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3;
+        float64_t *o = &out[quat_op_out_len(op) * i];
+
+        switch (op) {
+        case QUAT_OP_NORM:
+            o[0] = sqrt(norm2);
+            break;
+        case QUAT_OP_CONJUGATE:
+            o[0] = q0; o[1] = -q1; o[2] = -q2; o[3] = -q3;
+            break;
+        case QUAT_OP_INVERSE:
+            o[0] = q0 / norm2; o[1] = -q1 / norm2; o[2] = -q2 / norm2; o[3] = -q3 / norm2;
+            break;
+        case QUAT_OP_NORMALIZE:
+        case QUAT_OP_FROM_ROTATION:
+            for (int k = 0; k < 4; k++) {
+                o[k] = p[k] / sqrt(norm2);
+            }
+            break;
+        case QUAT_OP_PRODUCT: {
+            const float64_t r0 = b[4 * i], r1 = b[4 * i + 1], r2 = b[4 * i + 2], r3 = b[4 * i + 3];
+            o[0] = q0 * r0 - q1 * r1 - q2 * r2 - q3 * r3;
+            o[1] = q0 * r1 + q1 * r0 + q2 * r3 - q3 * r2;
+            o[2] = q0 * r2 - q1 * r3 + q2 * r0 + q3 * r1;
+            o[3] = q0 * r3 + q1 * r2 - q2 * r1 + q3 * r0;
+            break;
+        }
+        case QUAT_OP_TO_ROTATION:
+            o[0] = q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3;
+            o[1] = 2.0 * (q1 * q2 - q0 * q3);
+            o[2] = 2.0 * (q1 * q3 + q0 * q2);
+            o[3] = 2.0 * (q1 * q2 + q0 * q3);
+            o[4] = q0 * q0 - q1 * q1 + q2 * q2 - q3 * q3;
+            o[5] = 2.0 * (q2 * q3 - q0 * q1);
+            o[6] = 2.0 * (q1 * q3 - q0 * q2);
+            o[7] = 2.0 * (q2 * q3 + q0 * q1);
+            o[8] = q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+float64_t max_abs_error_f32(const float32_t *test, const float64_t *ref, int n) {
+    float64_t max_err = 0.0;
+    for (int i = 0; i < n; i++) {
+        float64_t err = fabs((float64_t)test[i] - ref[i]);
+        if (err > max_err) {
+            max_err = err;
+        }
+    }
+    return max_err;
+}
+
+RAM_FUNC void report_quat_result(const char *label, int n, uint32_t batch_cycles, uint32_t single_cycles,
+                                 uint32_t instr_est, uint32_t stack_used, float64_t max_err) {
+    float time_sec = (float)batch_cycles / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n%s N = %d\n\r", label, n);
+    printf("Cycle Count (batched): %lu\n\r", (unsigned long)batch_cycles);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Cycles per Quaternion: %.1f batched, %.1f single calls\n\r",
+           (float)batch_cycles / n, (float)single_cycles / n);
+    printf("Max Abs Error vs f64: %.3e\n\r", max_err);
+}
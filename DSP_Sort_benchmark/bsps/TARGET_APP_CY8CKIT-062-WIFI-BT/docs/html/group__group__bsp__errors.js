@@ -0,0 +1,4 @@
+var group__group__bsp__errors =
+[
+    [ "CYBSP_RSLT_ERR_SYSCLK_PM_CALLBACK", "group__group__bsp__errors.html#gaee745bd3fccec6eb2df1e83fc4c9f775", null ]
+];
\ No newline at end of file
@@ -0,0 +1,4 @@
+var group__group__bsp__functions =
+[
+    [ "cybsp_init", "group__group__bsp__functions.html#gab989986b285e127f78f61c29f6ccbbfa", null ]
+];
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef MAIN_H
+#define MAIN_H
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cyhal_clock.h"
+#include "cy_retarget_io.h"
+#include "arm_math.h"
+#include "core_cm4.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Constants
+#define SORT_SIZES_COUNT     6
+#define SORT_SIZE_MAX        1024
+#define SORT_FEW_UNIQUE      4        // distinct values in the few-unique input
+
+// arm_quick_sort_f32 pivots on the first element, so presorted input recurses once per
+// element; beyond this size it would overrun the 4 KB stack and is skipped
+#define QUICK_SORT_PRESORTED_MAX 64
+
+// Attributes
+#define RAM_FUNC __attribute__((section(".cy_ramfunc")))
+
+// Stack Limit
+extern uint32_t __StackLimit;
+
+// Clock Frequency
+extern uint32_t clkFastfreq;
+
+typedef enum {
+    SORT_INPUT_SORTED = 0,
+    SORT_INPUT_REVERSE,
+    SORT_INPUT_RANDOM,
+    SORT_INPUT_FEW_UNIQUE,
+    SORT_INPUTS_COUNT
+} sort_input;
+
+extern const int SORT_SIZES[SORT_SIZES_COUNT];
+extern const char *const SORT_INPUT_LABELS[SORT_INPUTS_COUNT];
+
+// Prototypes for common utilities
+void fill_stack_pattern_to_sp(void);
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+uint32_t measure_stack_usage(void);
+void generate_sort_input(float32_t *out, int N, sort_input kind);
+int is_sorted_ascending(const float32_t *in, const float32_t *out, int N);
+void report_sort_result(const char *label, int N, sort_input kind, uint32_t cycle_count, uint32_t instr_est,
+                        uint32_t stack_used, uint32_t extra_bytes, int sorted_ok);
+
+#endif // MAIN_H
@@ -0,0 +1,108 @@
+#include "main.h"
+
+// Every algorithm sorts ascending in place: the input is copied into dst before the timed
+// call, so the memcpy that arm_sort_f32 does for pSrc != pDst is not part of the count.
+// Merge sort goes through its own instance and needs an N-element buffer on top.
+
+#define SORT_ALGS_COUNT 7    // six arm_sort_alg values plus merge sort
+
+static const char *const SORT_LABELS[SORT_ALGS_COUNT] = {
+    "BITONIC SORT F32", "BUBBLE SORT F32", "HEAP SORT F32", "INSERTION SORT F32",
+    "QUICK SORT F32", "SELECTION SORT F32", "MERGE SORT F32"
+};
+
+static const arm_sort_alg SORT_ALGS[SORT_ALGS_COUNT - 1] = {
+    ARM_SORT_BITONIC, ARM_SORT_BUBBLE, ARM_SORT_HEAP, ARM_SORT_INSERTION, ARM_SORT_QUICK, ARM_SORT_SELECTION
+};
+
+// Returns the cycle count, or 0 when the run is skipped
+RAM_FUNC static uint32_t sort_f32(int alg, const float32_t *in, float32_t *dst, float32_t *merge_buffer,
+                                  int N, sort_input kind) {
+    const int merge = alg == SORT_ALGS_COUNT - 1;
+    const uint32_t extra_bytes = merge ? N * sizeof(float32_t) : 0;
+    arm_sort_instance_f32 S;
+    arm_merge_sort_instance_f32 S_merge;
+
+    if (!merge && SORT_ALGS[alg] == ARM_SORT_QUICK && N > QUICK_SORT_PRESORTED_MAX &&
+        (kind == SORT_INPUT_SORTED || kind == SORT_INPUT_REVERSE)) {
+        printf("\n%s N = %d (%s input): skipped, recursion depth N exceeds the stack\n\r",
+               SORT_LABELS[alg], N, SORT_INPUT_LABELS[kind]);
+        return 0;
+    }
+
+    if (merge)
+        arm_merge_sort_init_f32(&S_merge, ARM_SORT_ASCENDING, merge_buffer);
+    else
+        arm_sort_init_f32(&S, SORT_ALGS[alg], ARM_SORT_ASCENDING);
+    memcpy(dst, in, N * sizeof(float32_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    if (merge)
+        arm_merge_sort_f32(&S_merge, dst, dst, N);
+    else
+        arm_sort_f32(&S, dst, dst, N);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    report_sort_result(SORT_LABELS[alg], N, kind, cycle_count, instr_est, stack_used, extra_bytes,
+                       is_sorted_ascending(in, dst, N));
+    return cycle_count;
+}
+
+RAM_FUNC void benchmark_sort(void) {
+    printf("=== Sort Benchmark F32 (bitonic, bubble, heap, insertion, quick, selection, merge) ===\n\r");
+
+    float32_t *in = (float32_t*)malloc(SORT_SIZE_MAX * sizeof(float32_t));
+    float32_t *dst = (float32_t*)malloc(SORT_SIZE_MAX * sizeof(float32_t));
+    float32_t *merge_buffer = (float32_t*)malloc(SORT_SIZE_MAX * sizeof(float32_t));
+    uint32_t (*cycles)[SORT_SIZES_COUNT][SORT_ALGS_COUNT] =
+        malloc(SORT_INPUTS_COUNT * sizeof(*cycles));
+    if (!in || !dst || !merge_buffer || !cycles) {
+        printf("Memory allocation failed for sort buffers\n\r");
+        free(in); free(dst); free(merge_buffer); free(cycles);
+        return;
+    }
+
+    for (int k = 0; k < SORT_INPUTS_COUNT; k++) {
+        for (int s = 0; s < SORT_SIZES_COUNT; s++) {
+            const int N = SORT_SIZES[s];
+            generate_sort_input(in, N, (sort_input)k);
+
+            printf("\n--- N = %d, %s input ---\n\r", N, SORT_INPUT_LABELS[k]);
+            for (int alg = 0; alg < SORT_ALGS_COUNT; alg++)
+                cycles[k][s][alg] = sort_f32(alg, in, dst, merge_buffer, N, (sort_input)k);
+        }
+    }
+
+    // Cycles per element side by side, "-" where the run was skipped
+    printf("\n--- Summary: cycles per element ---\n\r");
+    for (int k = 0; k < SORT_INPUTS_COUNT; k++) {
+        printf("\n%s input\n\r", SORT_INPUT_LABELS[k]);
+        printf("%6s%10s%10s%10s%10s%10s%10s%10s\n\r", "N", "bitonic", "bubble", "heap", "insertion",
+               "quick", "selection", "merge");
+        for (int s = 0; s < SORT_SIZES_COUNT; s++) {
+            printf("%6d", SORT_SIZES[s]);
+            for (int alg = 0; alg < SORT_ALGS_COUNT; alg++) {
+                if (cycles[k][s][alg])
+                    printf("%10.1f", (float)cycles[k][s][alg] / SORT_SIZES[s]);
+                else
+                    printf("%10s", "-");
+            }
+            printf("\n\r");
+        }
+    }
+
+    free(in); free(dst); free(merge_buffer); free(cycles);
+    printf("\nBenchmark completed for ARM Sort.\n\r");
+}
@@ -0,0 +1,97 @@
+#include "main.h"
+
+// Short median-filter windows up to block sizes; powers of two so bitonic sort applies everywhere
+const int SORT_SIZES[SORT_SIZES_COUNT] = {8, 16, 32, 128, 512, 1024};
+
+const char *const SORT_INPUT_LABELS[SORT_INPUTS_COUNT] = {
+    "sorted", "reverse", "random", "few-unique"
+};
+
+RAM_FUNC void fill_stack_pattern_to_sp(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp) {
+        *p++ = 0xAAAAAAAA;
+    }
+}
+
+RAM_FUNC void enable_cycle_counter() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;      // Enable trace
+    DWT->CTRL |= (1 << 0);                               // CYCCNTENA
+    DWT->CTRL |= (1 << 16);                              // CPICNT
+    DWT->CTRL |= (1 << 17);                              // EXCCNT
+    DWT->CTRL |= (1 << 18);                              // SLEEPCNT
+    DWT->CTRL |= (1 << 19);                              // LSUCNT
+    DWT->CTRL |= (1 << 20);                              // FOLDCNT
+
+    DWT->CYCCNT = 0;
+    DWT->CPICNT = 0;
+    DWT->EXCCNT = 0;
+    DWT->SLEEPCNT = 0;
+    DWT->LSUCNT = 0;
+    DWT->FOLDCNT = 0;
+}
+
+RAM_FUNC uint32_t read_cycle_counter(void) {
+    return DWT->CYCCNT;
+}
+
+RAM_FUNC uint32_t measure_stack_usage(void) {
+    register uint32_t *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    uint32_t *p = (uint32_t*)&__StackLimit;
+    while (p < sp && *p == 0xAAAAAAAA) {
+        p++;
+    }
+    return ((uint32_t)sp - (uint32_t)p);
+}
+
+void generate_sort_input(float32_t *out, int N, sort_input kind) {
+    uint32_t seed = 0x2545F491u + N;
+
+    for (int i = 0; i < N; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        switch (kind) {
+        case SORT_INPUT_SORTED:
+            out[i] = (float32_t)i / N;
+            break;
+        case SORT_INPUT_REVERSE:
+            out[i] = (float32_t)(N - i) / N;
+            break;
+        case SORT_INPUT_FEW_UNIQUE:
+            out[i] = (float32_t)((seed >> 16) % SORT_FEW_UNIQUE);
+            break;
+        default:
+            out[i] = (float32_t)(seed >> 8) / 16777216.0f;
+            break;
+        }
+    }
+}
+
+// Output must be ascending and hold the same values as the input (checked by sum)
+int is_sorted_ascending(const float32_t *in, const float32_t *out, int N) {
+    float64_t sum_in = 0.0, sum_out = 0.0;
+    for (int i = 0; i < N; i++) {
+        sum_in += in[i];
+        sum_out += out[i];
+        if (i > 0 && out[i - 1] > out[i])
+            return 0;
+    }
+    return fabs(sum_in - sum_out) <= 1e-6 * N;
+}
+
+RAM_FUNC void report_sort_result(const char *label, int N, sort_input kind, uint32_t cycle_count, uint32_t instr_est,
+                                 uint32_t stack_used, uint32_t extra_bytes, int sorted_ok) {
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n%s N = %d (%s input)\n\r", label, N, SORT_INPUT_LABELS[kind]);
+    printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+    printf("Estimated Instruction Count: %lu\n\r", instr_est);
+    printf("Execution Time (approx): %.3f us\n\r", time_us);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    printf("Extra Memory: %lu bytes\n\r", (unsigned long)extra_bytes);
+    printf("Cycles per Element: %.3f\n\r", (float)cycle_count / N);
+    printf("Output: %s\n\r", sorted_ok ? "sorted" : "NOT SORTED");
+}
@@ -0,0 +1,22 @@
+// Generated by generate_batch_matmul_test_data.py (seed 2).
+#pragma once
+#define BATCH_MATMUL_BROADCAST_S8_LHS_BATCH 2
+#define BATCH_MATMUL_BROADCAST_S8_LHS_HEIGHT 3
+#define BATCH_MATMUL_BROADCAST_S8_LHS_ROWS 5
+#define BATCH_MATMUL_BROADCAST_S8_LHS_COLS 12
+#define BATCH_MATMUL_BROADCAST_S8_RHS_BATCH 1
+#define BATCH_MATMUL_BROADCAST_S8_RHS_HEIGHT 1
+#define BATCH_MATMUL_BROADCAST_S8_RHS_ROWS 8
+#define BATCH_MATMUL_BROADCAST_S8_RHS_COLS 12
+#define BATCH_MATMUL_BROADCAST_S8_OUTPUT_BATCH 2
+#define BATCH_MATMUL_BROADCAST_S8_OUTPUT_HEIGHT 3
+#define BATCH_MATMUL_BROADCAST_S8_OUTPUT_ROWS 5
+#define BATCH_MATMUL_BROADCAST_S8_OUTPUT_COLS 8
+#define BATCH_MATMUL_BROADCAST_S8_DST_SIZE 240
+#define BATCH_MATMUL_BROADCAST_S8_LHS_OFFSET -11
+#define BATCH_MATMUL_BROADCAST_S8_RHS_OFFSET 0
+#define BATCH_MATMUL_BROADCAST_S8_OUTPUT_OFFSET 4
+#define BATCH_MATMUL_BROADCAST_S8_OUTPUT_MULTIPLIER 1774210584
+#define BATCH_MATMUL_BROADCAST_S8_OUTPUT_SHIFT -9
+#define BATCH_MATMUL_BROADCAST_S8_OUT_ACTIVATION_MIN -128
+#define BATCH_MATMUL_BROADCAST_S8_OUT_ACTIVATION_MAX 127
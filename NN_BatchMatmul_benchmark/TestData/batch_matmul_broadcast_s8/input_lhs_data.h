@@ -0,0 +1,28 @@
+// Generated by generate_batch_matmul_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int8_t batch_matmul_broadcast_s8_input_lhs[360] = {
+    -100, -82, -85, 56, -42, 29, 0, -20, -110, -47, 92, 73, 62, 99, 9, -110,
+    -114, 58, 110, 35, 66, 88, -44, -38, -8, -10, -116, -38, 38, -40, -59, 56,
+    -35, 100, 84, 58, 53, 57, 100, -46, 76, 108, -1, 122, 14, 127, 53, 104,
+    108, 51, 105, 121, -15, 38, -43, 9, 117, 30, 27, 80, 31, -22, 122, 59,
+    -90, 46, -124, -31, -74, -98, -103, 11, -12, -74, -59, 8, -3, -21, -98, 88,
+    -112, -99, 57, 56, -40, -1, -116, -86, -70, -94, -116, -108, -118, 63, 2, -63,
+    -48, -34, -128, 69, -106, -2, -51, -110, -126, 48, -71, 18, 44, 122, -113, 29,
+    101, -105, 7, 77, -50, 114, -13, -81, 33, -76, -116, 101, -63, 73, 121, 39,
+    -55, 46, 4, 6, 86, -119, -57, -99, 1, -111, -61, -46, -41, -79, 104, -10,
+    -112, -2, -9, 99, -91, 0, -87, -12, 56, 3, 88, 14, -126, -51, -110, 68,
+    81, -46, -72, -84, -5, -76, -77, -118, -35, -10, -75, -17, -116, 109, 104, 30,
+    66, -20, -21, 94, 89, -118, -102, 86, -36, -80, 117, 59, -119, -68, 59, 20,
+    62, 29, -119, 83, -77, -75, 28, -27, -120, 103, -98, 82, 120, 109, -22, -91,
+    -126, 17, -116, 62, 28, -89, -16, 123, -30, -69, 63, 72, 109, -57, 48, 74,
+    -66, 2, -66, -66, -87, 43, 72, -20, -75, -116, 112, -106, 126, 20, 55, 106,
+    -56, 63, 9, 119, 116, 86, 123, 23, 74, -10, -48, 122, 4, 90, -85, -79,
+    -92, 54, -38, -53, 85, -94, -84, -109, -63, 23, 71, -10, 40, 96, -40, 18,
+    -71, -49, 88, -79, 40, -1, 3, -42, -48, 108, -8, 78, 55, -54, 110, 97,
+    -113, 68, -36, 73, -101, 119, 12, 79, 1, 83, 113, 56, 41, -87, -13, -32,
+    78, 67, -123, 32, 109, 110, -38, -80, -120, 78, -18, 69, -18, -77, 71, -26,
+    12, -30, 122, -58, -124, 94, 118, 1, -40, 111, -24, -91, 51, -127, 120, -95,
+    120, 43, 107, 8, 107, -114, -88, 49, -40, 79, 2, -59, -101, -45, 127, 67,
+    109, 22, -49, -123, 16, 111, -128, 59};
@@ -0,0 +1,11 @@
+// Generated by generate_batch_matmul_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int8_t batch_matmul_broadcast_s8_input_rhs[96] = {
+    -111, 67, 98, -24, 29, 127, -60, 119, 26, -89, 4, 32, 27, 42, 31, 73,
+    -81, -21, 72, -52, -83, 29, -108, -9, 106, -10, 14, -97, -71, -71, 66, 58,
+    -19, 35, 54, -89, 43, 106, 57, -43, 126, 98, 21, 108, -60, 98, -18, 11,
+    39, -47, -78, -7, 112, -31, 63, -34, 54, -57, -59, -9, 9, 65, 76, 47,
+    15, 36, 76, 21, -91, 60, 29, 74, 119, -39, 4, 53, 97, 116, -84, -33,
+    33, 66, -63, -114, -75, 51, -43, 55, -89, 95, -124, 36, -7, 71, 17, 112};
@@ -0,0 +1,20 @@
+// Generated by generate_batch_matmul_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int8_t batch_matmul_broadcast_s8_output_ref[240] = {
+    0, -1, -24, -44, -8, 5, -42, 39, -4, 29, 57, 28, -10, 8, -2, -1,
+    -19, -27, 11, 11, -1, -3, -11, 35, 52, -19, 9, 93, -24, 49, 20, 37,
+    16, 8, -12, 9, -12, 19, 32, 31, 31, 40, -21, -26, -25, -4, 21, 25,
+    19, -20, -4, -23, -4, -12, -25, 26, -57, 15, 21, -45, -11, -34, -10, 17,
+    -51, 51, -22, -52, -7, -9, -3, 47, -39, 14, 30, 45, 20, 6, 21, -12,
+    -37, 33, 12, -12, 12, 15, 6, 14, -49, -29, 44, -58, 24, -43, -13, -38,
+    20, -8, -26, -52, -31, -14, -22, 59, -14, 1, -43, -57, 44, -56, 25, -14,
+    17, 11, -4, -20, 4, 0, -34, 37, -60, 25, 39, -41, 28, 6, -30, -32,
+    -73, 69, 6, -12, 3, 21, -11, 30, 31, -3, 18, -5, -20, -13, -24, 49,
+    1, 20, 3, 16, 24, 9, 18, -40, -18, 14, 4, -53, -1, 7, -79, -5,
+    40, 12, -57, 34, 32, 37, -2, 16, 10, 9, 10, -36, 15, -54, 16, 0,
+    55, -15, -3, 21, -21, 9, 13, 7, 46, -33, 8, 5, -14, 4, -17, 37,
+    45, -1, -15, 13, -50, 32, -31, 88, 2, -34, 2, 18, 17, -41, 88, 10,
+    -1, 5, 4, -36, -5, 3, -51, -5, 73, -14, -20, -25, -29, -7, -11, 10,
+    -17, 5, 36, 44, -1, 10, 45, -29, 9, 26, -65, 10, 8, 14, 40, 18};
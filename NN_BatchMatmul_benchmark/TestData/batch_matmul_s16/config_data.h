@@ -0,0 +1,22 @@
+// Generated by generate_batch_matmul_test_data.py (seed 3).
+#pragma once
+#define BATCH_MATMUL_S16_LHS_BATCH 2
+#define BATCH_MATMUL_S16_LHS_HEIGHT 1
+#define BATCH_MATMUL_S16_LHS_ROWS 3
+#define BATCH_MATMUL_S16_LHS_COLS 16
+#define BATCH_MATMUL_S16_RHS_BATCH 2
+#define BATCH_MATMUL_S16_RHS_HEIGHT 1
+#define BATCH_MATMUL_S16_RHS_ROWS 5
+#define BATCH_MATMUL_S16_RHS_COLS 16
+#define BATCH_MATMUL_S16_OUTPUT_BATCH 2
+#define BATCH_MATMUL_S16_OUTPUT_HEIGHT 1
+#define BATCH_MATMUL_S16_OUTPUT_ROWS 3
+#define BATCH_MATMUL_S16_OUTPUT_COLS 5
+#define BATCH_MATMUL_S16_DST_SIZE 30
+#define BATCH_MATMUL_S16_LHS_OFFSET 0
+#define BATCH_MATMUL_S16_RHS_OFFSET 0
+#define BATCH_MATMUL_S16_OUTPUT_OFFSET 0
+#define BATCH_MATMUL_S16_OUTPUT_MULTIPLIER 1714130628
+#define BATCH_MATMUL_S16_OUTPUT_SHIFT -17
+#define BATCH_MATMUL_S16_OUT_ACTIVATION_MIN -32768
+#define BATCH_MATMUL_S16_OUT_ACTIVATION_MAX 32767
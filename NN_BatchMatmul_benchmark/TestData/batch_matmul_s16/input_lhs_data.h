@@ -0,0 +1,11 @@
+// Generated by generate_batch_matmul_test_data.py (seed 3).
+#pragma once
+#include <stdint.h>
+
+const int16_t batch_matmul_s16_input_lhs[96] = {
+    -1578, -15674, 15722, 29367, -24180, -31043, 28735, 1226, -2054, -7636, 28870, 29668, 19285, -13027, -2370, -12895,
+    18341, -30783, -24376, -11876, -27160, 6719, -28704, 2546, 29196, 18036, 23191, 19000, 25509, -15185, 15141, -19995,
+    -28065, -14947, 32097, -4328, 1046, 24400, 6688, 22432, 17808, 13226, 20653, -2309, 11372, -29012, 3890, -11391,
+    10012, -19127, -5096, 2239, 4581, -16459, -24451, 30408, 30606, -21166, 12331, -24038, 21032, -13007, -30131, 5752,
+    23218, 21652, -17182, -26976, -26878, 16751, 10610, 3810, -1842, -28048, 7821, -31820, -22680, -18597, -28656, -6897,
+    20701, 5454, 1752, -12295, -27206, 11772, 8366, 14443, -14638, 16749, 16613, 27578, 17851, -19324, 2791, 23749};
@@ -0,0 +1,15 @@
+// Generated by generate_batch_matmul_test_data.py (seed 3).
+#pragma once
+#include <stdint.h>
+
+const int16_t batch_matmul_s16_input_rhs[160] = {
+    -1621, 6696, 24568, 1079, 6945, 11653, -31267, 21654, 8503, -30140, 16582, -15301, -24894, 10806, 28344, 13489,
+    13444, 3791, 31392, -29861, -24829, -29983, 15619, 147, 27041, 6374, 9178, -9514, 14936, -8488, 8214, 15617,
+    1852, 6606, 16667, -19023, -29240, -15543, 7866, -3600, 2539, -1482, 10195, -8206, 24279, -20052, -19420, 9432,
+    10977, -3348, 24697, -10580, -22290, 11365, -4192, 26358, 2700, -3274, -16919, -28324, -7759, 8538, -8705, 3747,
+    11810, -21557, 12488, -15770, 22449, 5497, 2775, 28143, 12629, 21876, 5295, 22252, 20908, -28110, 21399, -12322,
+    -6610, -32157, 29799, 24163, -3659, -28532, 27088, 5117, 11936, -2954, -23847, 4851, -17040, -717, -26860, -28162,
+    -6755, 23578, -26299, -31046, 30283, -16933, -10248, 6538, -1436, -30167, 21463, -25789, -17880, 11973, -16331, 324,
+    29779, -24725, 13348, -3827, -6904, -16749, -17143, -10316, -1382, 3114, -15928, -31785, 31129, 19697, -26224, 2804,
+    -229, 2436, 22673, -26087, 29215, 9583, -32531, -25581, -16140, -26715, -16433, -26237, -23801, 30515, -28442, -21480,
+    31456, 8637, -12185, 8464, -23361, 13276, 17799, 18302, 7093, 14527, 1956, -7723, 10325, 23422, -16548, -16042};
@@ -0,0 +1,7 @@
+// Generated by generate_batch_matmul_test_data.py (seed 3).
+#pragma once
+#include <stdint.h>
+
+const int16_t batch_matmul_s16_output_ref[30] = {
+    -10417, 9576, 10468, -8447, 5791, -5155, 6107, 4105, -4554, 18402, 4800, 6703, 5838, 4299, 18979, 4340,
+    11291, 16493, 647, 2831, -6105, 17950, 1070, 10445, 10736, -12263, -12895, -3959, -22937, 6343};
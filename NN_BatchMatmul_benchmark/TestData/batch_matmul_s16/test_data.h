@@ -0,0 +1,5 @@
+// Generated by generate_batch_matmul_test_data.py (seed 3).
+#include "../../TestData/batch_matmul_s16/config_data.h"
+#include "../../TestData/batch_matmul_s16/input_lhs_data.h"
+#include "../../TestData/batch_matmul_s16/input_rhs_data.h"
+#include "../../TestData/batch_matmul_s16/output_ref_data.h"
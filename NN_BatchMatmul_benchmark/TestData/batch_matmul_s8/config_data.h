@@ -0,0 +1,22 @@
+// Generated by generate_batch_matmul_test_data.py (seed 1).
+#pragma once
+#define BATCH_MATMUL_S8_LHS_BATCH 1
+#define BATCH_MATMUL_S8_LHS_HEIGHT 2
+#define BATCH_MATMUL_S8_LHS_ROWS 4
+#define BATCH_MATMUL_S8_LHS_COLS 20
+#define BATCH_MATMUL_S8_RHS_BATCH 1
+#define BATCH_MATMUL_S8_RHS_HEIGHT 2
+#define BATCH_MATMUL_S8_RHS_ROWS 6
+#define BATCH_MATMUL_S8_RHS_COLS 20
+#define BATCH_MATMUL_S8_OUTPUT_BATCH 1
+#define BATCH_MATMUL_S8_OUTPUT_HEIGHT 2
+#define BATCH_MATMUL_S8_OUTPUT_ROWS 4
+#define BATCH_MATMUL_S8_OUTPUT_COLS 6
+#define BATCH_MATMUL_S8_DST_SIZE 48
+#define BATCH_MATMUL_S8_LHS_OFFSET 7
+#define BATCH_MATMUL_S8_RHS_OFFSET 0
+#define BATCH_MATMUL_S8_OUTPUT_OFFSET -3
+#define BATCH_MATMUL_S8_OUTPUT_MULTIPLIER 1196730866
+#define BATCH_MATMUL_S8_OUTPUT_SHIFT -9
+#define BATCH_MATMUL_S8_OUT_ACTIVATION_MIN -128
+#define BATCH_MATMUL_S8_OUT_ACTIVATION_MAX 127
@@ -0,0 +1,15 @@
+// Generated by generate_batch_matmul_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t batch_matmul_s8_input_lhs[160] = {
+    -60, -96, 2, -68, 125, 102, 113, 66, -21, -80, 121, -114, 71, 93, -127, 100,
+    8, -11, -76, 34, -113, -117, -115, -124, 67, -18, 88, -114, -15, 96, 125, -9,
+    48, -10, -16, 107, 20, -117, 85, -77, -33, 23, -67, 42, 88, -31, 27, 17,
+    127, 73, -111, 117, -4, 78, 84, -40, 59, 63, -84, 96, -73, -45, 73, 61,
+    122, -113, 112, -106, 29, 73, -41, -42, -12, -122, -26, -10, 79, 48, 52, 107,
+    9, -126, 68, -62, -23, 90, -100, 118, 58, -26, 83, 120, 54, 84, 49, -128,
+    41, 106, -114, -11, -38, -36, -82, 2, -112, -92, -86, -120, 103, -121, 15, -1,
+    9, -72, -34, 48, 20, -93, -43, -47, 2, -42, 11, 22, 104, 36, 126, 114,
+    -70, -116, 31, 69, 47, 87, -32, 4, -73, 1, -21, 93, -118, -13, -119, 75,
+    -54, -110, -46, 100, 90, -16, 102, -14, -113, 74, 36, 90, -98, 24, -64, -20};
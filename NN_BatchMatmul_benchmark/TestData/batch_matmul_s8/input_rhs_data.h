@@ -0,0 +1,20 @@
+// Generated by generate_batch_matmul_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t batch_matmul_s8_input_rhs[240] = {
+    -104, 28, -92, -89, 30, 24, -47, 85, 1, -62, -124, -109, -17, 107, -41, -109,
+    65, -26, 49, -78, -23, 93, -29, 124, -75, 71, 23, 127, -120, 38, 77, 16,
+    -119, -48, -26, 39, -59, 45, 91, -19, 8, -79, 66, 48, 120, -8, -95, -108,
+    -85, -60, -42, -43, -19, 9, 42, 2, 60, 45, 46, -70, 21, -8, 122, -59,
+    -75, 36, -108, 80, -91, 66, -53, -64, 46, -70, 65, -89, -14, -87, 8, 58,
+    23, -70, 106, 13, -73, -105, 23, -122, -121, -82, 83, -70, -108, -32, -6, 87,
+    -46, -69, 102, -43, -5, -47, -76, 94, 65, 22, 1, 116, 33, -77, -22, 34,
+    -108, -115, -123, 23, 35, 102, 72, 32, 76, -96, -96, 34, 105, -71, 0, -18,
+    112, 54, 4, -35, -22, 29, -27, -2, 56, -87, 15, -83, 101, -82, 45, -12,
+    71, 29, -107, 39, -33, 34, 27, -3, 43, -77, -81, -3, -16, -118, -4, 77,
+    -91, 9, -92, -90, -117, -123, 20, 55, 124, 112, -50, -77, 39, -89, -40, -37,
+    -52, -56, 35, 28, -74, 22, -64, -23, -56, -112, 33, -23, -37, 25, 93, -48,
+    -104, -2, 1, -96, 100, 92, 0, 96, 104, -123, 74, 45, -41, 4, 120, -116,
+    85, -119, -97, 53, -58, -64, -58, 4, 13, 75, 77, -40, -83, -9, 120, -125,
+    -38, 34, 96, -13, -6, 32, 125, 117, -13, 83, 44, 12, -16, -104, -92, 60};
@@ -0,0 +1,8 @@
+// Generated by generate_batch_matmul_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t batch_matmul_s8_output_ref[48] = {
+    10, -17, -10, -37, -11, 8, -8, -25, -3, -40, 29, -29, -1, -36, -19, -34,
+    -92, 4, -36, -25, 21, -20, 11, 23, -18, 6, -40, -7, -16, 39, 20, -6,
+    29, -2, 21, -14, -21, 6, -49, -21, -3, 30, 11, -39, 26, 24, -43, 2};
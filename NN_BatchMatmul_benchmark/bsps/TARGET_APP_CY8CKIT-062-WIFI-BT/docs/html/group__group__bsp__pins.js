@@ -0,0 +1,10 @@
+var group__group__bsp__pins =
+[
+    [ "LED Pins", "group__group__bsp__pins__led.html", "group__group__bsp__pins__led" ],
+    [ "Button Pins", "group__group__bsp__pins__btn.html", "group__group__bsp__pins__btn" ],
+    [ "Communication Pins", "group__group__bsp__pins__comm.html", "group__group__bsp__pins__comm" ],
+    [ "Arduino Header Pins", "group__group__bsp__pins__arduino.html", "group__group__bsp__pins__arduino" ],
+    [ "J2 Header Pins", "group__group__bsp__pins__j2.html", "group__group__bsp__pins__j2" ],
+    [ "Capsense", "group__group__bsp__pins__capsense.html", "group__group__bsp__pins__capsense" ],
+    [ "WCO", "group__group__bsp__pins__wco.html", "group__group__bsp__pins__wco" ]
+];
\ No newline at end of file
@@ -0,0 +1,41 @@
+var group__group__bsp__pins__comm =
+[
+    [ "CYBSP_DEBUG_UART_RX", "group__group__bsp__pins__comm.html#gae1daa9ae5985d8f4002347eee1362c76", null ],
+    [ "CYBSP_DEBUG_UART_TX", "group__group__bsp__pins__comm.html#gaea8cd882c067c13b1411796d5235286d", null ],
+    [ "CYBSP_I2C_SCL", "group__group__bsp__pins__comm.html#ga034bfe0f68224dd376a9a79e07ab3451", null ],
+    [ "CYBSP_I2C_SDA", "group__group__bsp__pins__comm.html#gad178ee7378678fe5829a826f9a4ed0b8", null ],
+    [ "CYBSP_SWDIO", "group__group__bsp__pins__comm.html#ga9fba070d4040d6aa4f3e429bdfc38946", null ],
+    [ "CYBSP_SWDCK", "group__group__bsp__pins__comm.html#ga8f50aad29445466679abdcc75dcd9796", null ],
+    [ "CYBSP_SPI_MOSI", "group__group__bsp__pins__comm.html#ga07b4c8b6a15a1e614ff9be2ebe8088fd", null ],
+    [ "CYBSP_SPI_MISO", "group__group__bsp__pins__comm.html#gaf6282da9ac2be0fe7a4ac84735a24bb0", null ],
+    [ "CYBSP_SPI_CLK", "group__group__bsp__pins__comm.html#gabeb93b3f9b953934666f83a1a97c4367", null ],
+    [ "CYBSP_SPI_CS", "group__group__bsp__pins__comm.html#gad8d3655d655bb752363587ea521c8856", null ],
+    [ "CYBSP_SWO", "group__group__bsp__pins__comm.html#ga83425838dc05860473aebf66214ed9d3", null ],
+    [ "CYBSP_QSPI_SS", "group__group__bsp__pins__comm.html#ga020ca7a044acda4b35e451513e5830df", null ],
+    [ "CYBSP_QSPI_D3", "group__group__bsp__pins__comm.html#ga2ad55ac5a5ea027d72c8f702c7f9bbde", null ],
+    [ "CYBSP_QSPI_D2", "group__group__bsp__pins__comm.html#gada7037ba6e38219866f2892f87886b62", null ],
+    [ "CYBSP_QSPI_D1", "group__group__bsp__pins__comm.html#ga432faefd95828b8d45709aa8302a9433", null ],
+    [ "CYBSP_QSPI_D0", "group__group__bsp__pins__comm.html#gaaea1a4ddc9aa57c45c4d6695b78ee878", null ],
+    [ "CYBSP_QSPI_SCK", "group__group__bsp__pins__comm.html#ga2bae07a55adc9f31e828312bc8fbdd82", null ],
+    [ "CYBSP_WIFI_SDIO_D0", "group__group__bsp__pins__comm.html#ga87d62aff3ed8c03d1ce66e2a7fa90f4b", null ],
+    [ "CYBSP_WIFI_SDIO_D1", "group__group__bsp__pins__comm.html#ga6b1476fd26d05e548b39e3eac8ca067d", null ],
+    [ "CYBSP_WIFI_SDIO_D2", "group__group__bsp__pins__comm.html#ga3ea3b59f511082e6616882dc64cadbb9", null ],
+    [ "CYBSP_WIFI_SDIO_D3", "group__group__bsp__pins__comm.html#gae0984157f595e2626f420c2f504602b0", null ],
+    [ "CYBSP_WIFI_SDIO_CMD", "group__group__bsp__pins__comm.html#ga84aaee84fd3639ebe802f835c02d364a", null ],
+    [ "CYBSP_WIFI_SDIO_CLK", "group__group__bsp__pins__comm.html#gad9cac48112cc5b44a707ab741956cd92", null ],
+    [ "CYBSP_WIFI_WL_REG_ON", "group__group__bsp__pins__comm.html#gad1f1366c88d967f6856c6b89154d9403", null ],
+    [ "CYBSP_WIFI_HOST_WAKE", "group__group__bsp__pins__comm.html#gad03531a5a7bdd646e29d417d45f089a8", null ],
+    [ "CYBSP_WIFI_HOST_WAKE_GPIO_DM", "group__group__bsp__pins__comm.html#ga8643a26f39112d7f87aa8b6ebcdcd1b0", null ],
+    [ "CYBSP_WIFI_HOST_WAKE_IRQ_EVENT", "group__group__bsp__pins__comm.html#gae4668c08493082ab2d7dca34eb8a9777", null ],
+    [ "CYBSP_BT_UART_RX", "group__group__bsp__pins__comm.html#gaedb2fc7c65fd4765368a9fc8acf16b44", null ],
+    [ "CYBSP_BT_UART_TX", "group__group__bsp__pins__comm.html#ga598aa3824261cb9f6828c45bc93ce1bc", null ],
+    [ "CYBSP_BT_UART_RTS", "group__group__bsp__pins__comm.html#gad8655e49bd423b566bee1346c63c252b", null ],
+    [ "CYBSP_BT_UART_CTS", "group__group__bsp__pins__comm.html#ga62f968c28d6dd878d706411644df3b04", null ],
+    [ "CYBSP_BT_POWER", "group__group__bsp__pins__comm.html#ga07bdba5ea596bd4136de8a8b98c660e5", null ],
+    [ "CYBSP_BT_HOST_WAKE", "group__group__bsp__pins__comm.html#ga49990e2184614916af625ad60c670cc9", null ],
+    [ "CYBSP_BT_HOST_WAKE_GPIO_DM", "group__group__bsp__pins__comm.html#ga640c8f2a95b8947b809fa42cd1bd6602", null ],
+    [ "CYBSP_BT_HOST_WAKE_IRQ_EVENT", "group__group__bsp__pins__comm.html#gab480375f418ada758be1e7f32e42b232", null ],
+    [ "CYBSP_BT_DEVICE_WAKE", "group__group__bsp__pins__comm.html#ga157d988297cf9f6e736a6b2568393b57", null ],
+    [ "CYBSP_BT_DEVICE_WAKE_GPIO_DM", "group__group__bsp__pins__comm.html#ga2e4aea75f92232352bef06af68df7fbe", null ],
+    [ "CYBSP_BT_DEVICE_WAKE_POLARITY", "group__group__bsp__pins__comm.html#ga819696334214ae0d912c381c7fb574f9", null ]
+];
\ No newline at end of file
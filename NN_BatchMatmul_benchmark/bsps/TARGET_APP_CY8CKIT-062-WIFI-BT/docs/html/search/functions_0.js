@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['cybsp_5finit_0',['cybsp_init',['../group__group__bsp__functions.html#gab989986b285e127f78f61c29f6ccbbfa',1,'cybsp_init(void):&#160;cybsp.c'],['../group__group__bsp__functions.html#gab989986b285e127f78f61c29f6ccbbfa',1,'cybsp_init(void):&#160;cybsp.c']]]
+];
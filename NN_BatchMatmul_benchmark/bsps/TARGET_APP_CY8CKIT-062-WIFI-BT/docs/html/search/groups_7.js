@@ -0,0 +1,5 @@
+var searchData=
+[
+  ['pin_20mappings_0',['Pin Mappings',['../group__group__bsp__pins.html',1,'']]],
+  ['pin_20states_1',['Pin States',['../group__group__bsp__pin__state.html',1,'']]]
+];
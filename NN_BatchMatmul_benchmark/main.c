@@ -0,0 +1,53 @@
+#include "main.h"
+
+void batch_matmul_s8_arm_batch_matmul_s8(void);
+void batch_matmul_broadcast_s8_arm_batch_matmul_s8(void);
+void batch_matmul_s16_arm_batch_matmul_s16(void);
+void benchmark_batch_matmul_sweep(void);
+
+uint32_t clkFastfreq = 0;
+
+RAM_FUNC int main(void)
+{
+	__disable_irq();  // Disable all interrupts
+    cy_rslt_t result;
+
+    // Initialize the device and board peripherals
+    result = cybsp_init();
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Initialize retarget-io to use the debug UART port
+    result = cy_retarget_io_init_fc(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                    CYBSP_DEBUG_UART_CTS, CYBSP_DEBUG_UART_RTS, CY_RETARGET_IO_BAUDRATE);
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Get the clock frequency
+    clkFastfreq = Cy_SysClk_ClkFastGetFrequency();
+
+    // Print system details
+    printf("\n\r");
+    printf("-----Starting CMSIS-NN Batch Matmul Functions Benchmark-----\n\r");
+    printf("\n\r");
+    printf("CPU Clock Frequency: %lu Hz\n\r", clkFastfreq);
+    printf("\n\r");
+
+    // Perform benchmarks
+    printf("*****ARM BATCH MATMUL S8*****\n\r");
+    batch_matmul_s8_arm_batch_matmul_s8();
+    batch_matmul_broadcast_s8_arm_batch_matmul_s8();
+    printf("\n\r");
+
+    printf("*****ARM BATCH MATMUL S16*****\n\r");
+    batch_matmul_s16_arm_batch_matmul_s16();
+    printf("\n\r");
+
+    printf("*****Batch Matmul Shape Sweep*****\n\r");
+    benchmark_batch_matmul_sweep();
+
+    printf("Finish Batch Matmul Functions Benchmark\n\r");
+    return 0;
+}
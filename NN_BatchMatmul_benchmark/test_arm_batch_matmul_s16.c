@@ -0,0 +1,85 @@
+#include "main.h"
+#include "../TestData/batch_matmul_s16/test_data.h"
+
+RAM_FUNC void batch_matmul_s16_arm_batch_matmul_s16(void)
+{
+    int16_t output[BATCH_MATMUL_S16_DST_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_bmm_params bmm_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims lhs_dims;
+    cmsis_nn_dims rhs_dims;
+    cmsis_nn_dims output_dims;
+
+    const int16_t *lhs = batch_matmul_s16_input_lhs;
+    const int16_t *rhs = batch_matmul_s16_input_rhs;
+    const int16_t *output_ref = batch_matmul_s16_output_ref;
+    const int32_t output_ref_size = BATCH_MATMUL_S16_DST_SIZE;
+
+    lhs_dims.n = BATCH_MATMUL_S16_LHS_BATCH;
+    lhs_dims.h = BATCH_MATMUL_S16_LHS_HEIGHT;
+    lhs_dims.w = BATCH_MATMUL_S16_LHS_ROWS;
+    lhs_dims.c = BATCH_MATMUL_S16_LHS_COLS;
+    rhs_dims.n = BATCH_MATMUL_S16_RHS_BATCH;
+    rhs_dims.h = BATCH_MATMUL_S16_RHS_HEIGHT;
+    rhs_dims.w = BATCH_MATMUL_S16_RHS_ROWS;
+    rhs_dims.c = BATCH_MATMUL_S16_RHS_COLS;
+    output_dims.n = BATCH_MATMUL_S16_OUTPUT_BATCH;
+    output_dims.h = BATCH_MATMUL_S16_OUTPUT_HEIGHT;
+    output_dims.w = BATCH_MATMUL_S16_OUTPUT_ROWS;
+    output_dims.c = BATCH_MATMUL_S16_OUTPUT_COLS;
+
+    // RHS is stored transposed; int16 is symmetric so all offsets are zero
+    bmm_params.adj_x = false;
+    bmm_params.adj_y = true;
+    bmm_params.fc_params.input_offset = BATCH_MATMUL_S16_LHS_OFFSET;
+    bmm_params.fc_params.filter_offset = BATCH_MATMUL_S16_RHS_OFFSET;
+    bmm_params.fc_params.output_offset = BATCH_MATMUL_S16_OUTPUT_OFFSET;
+    bmm_params.fc_params.activation.min = BATCH_MATMUL_S16_OUT_ACTIVATION_MIN;
+    bmm_params.fc_params.activation.max = BATCH_MATMUL_S16_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = BATCH_MATMUL_S16_OUTPUT_MULTIPLIER;
+    quant_params.shift = BATCH_MATMUL_S16_OUTPUT_SHIFT;
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_batch_matmul_s16(&ctx,
+                         &bmm_params,
+                         &quant_params,
+                         &lhs_dims,
+                         lhs,
+                         &rhs_dims,
+                         rhs,
+                         &output_dims,
+                         output);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+    uint32_t macs = (uint32_t)output_ref_size * BATCH_MATMUL_S16_LHS_COLS;
+
+    printf("\n\r");
+    if (validate_s16(output, output_ref, output_ref_size)) {
+        printf("batch_matmul_s16_arm_batch_matmul_s16 output validation PASSED\n\r");
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("MACs per Cycle: %.3f\n\r", (float)macs / cycle_count);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("batch_matmul_s16_arm_batch_matmul_s16 output validation FAILED\n\r");
+    }
+}
@@ -0,0 +1,137 @@
+#include "main.h"
+#include "../TestData/batch_matmul_s8/test_data.h"
+#include "../TestData/batch_matmul_broadcast_s8/test_data.h"
+
+typedef struct {
+    cmsis_nn_bmm_params bmm_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims lhs_dims;
+    cmsis_nn_dims rhs_dims;
+    cmsis_nn_dims output_dims;
+    const int8_t *lhs;
+    const int8_t *rhs;
+    const int8_t *output_ref;
+    int32_t output_ref_size;
+} bmm_case;
+
+RAM_FUNC static void run_batch_matmul_s8(const char *name, const bmm_case *c, int8_t *output)
+{
+    // arm_batch_matmul_s8 needs no scratch buffer
+    cmsis_nn_context ctx;
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_batch_matmul_s8(&ctx,
+                        &c->bmm_params,
+                        &c->quant_params,
+                        &c->lhs_dims,
+                        c->lhs,
+                        &c->rhs_dims,
+                        c->rhs,
+                        &c->output_dims,
+                        output);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+    uint32_t macs = (uint32_t)c->output_ref_size * c->lhs_dims.c;
+
+    printf("\n\r");
+    if (validate(output, c->output_ref, c->output_ref_size)) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("MACs per Cycle: %.3f\n\r", (float)macs / cycle_count);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("%s output validation FAILED\n\r", name);
+    }
+}
+
+RAM_FUNC void batch_matmul_s8_arm_batch_matmul_s8(void)
+{
+    int8_t output[BATCH_MATMUL_S8_DST_SIZE] = {0};
+    bmm_case c;
+    memset(&c, 0, sizeof(c));
+
+    c.lhs_dims.n = BATCH_MATMUL_S8_LHS_BATCH;
+    c.lhs_dims.h = BATCH_MATMUL_S8_LHS_HEIGHT;
+    c.lhs_dims.w = BATCH_MATMUL_S8_LHS_ROWS;
+    c.lhs_dims.c = BATCH_MATMUL_S8_LHS_COLS;
+    c.rhs_dims.n = BATCH_MATMUL_S8_RHS_BATCH;
+    c.rhs_dims.h = BATCH_MATMUL_S8_RHS_HEIGHT;
+    c.rhs_dims.w = BATCH_MATMUL_S8_RHS_ROWS;
+    c.rhs_dims.c = BATCH_MATMUL_S8_RHS_COLS;
+    c.output_dims.n = BATCH_MATMUL_S8_OUTPUT_BATCH;
+    c.output_dims.h = BATCH_MATMUL_S8_OUTPUT_HEIGHT;
+    c.output_dims.w = BATCH_MATMUL_S8_OUTPUT_ROWS;
+    c.output_dims.c = BATCH_MATMUL_S8_OUTPUT_COLS;
+
+    // RHS is stored transposed, [rows, cols] = [N, K]
+    c.bmm_params.adj_x = false;
+    c.bmm_params.adj_y = true;
+    c.bmm_params.fc_params.input_offset = BATCH_MATMUL_S8_LHS_OFFSET;
+    c.bmm_params.fc_params.filter_offset = BATCH_MATMUL_S8_RHS_OFFSET;
+    c.bmm_params.fc_params.output_offset = BATCH_MATMUL_S8_OUTPUT_OFFSET;
+    c.bmm_params.fc_params.activation.min = BATCH_MATMUL_S8_OUT_ACTIVATION_MIN;
+    c.bmm_params.fc_params.activation.max = BATCH_MATMUL_S8_OUT_ACTIVATION_MAX;
+    c.quant_params.multiplier = BATCH_MATMUL_S8_OUTPUT_MULTIPLIER;
+    c.quant_params.shift = BATCH_MATMUL_S8_OUTPUT_SHIFT;
+
+    c.lhs = batch_matmul_s8_input_lhs;
+    c.rhs = batch_matmul_s8_input_rhs;
+    c.output_ref = batch_matmul_s8_output_ref;
+    c.output_ref_size = BATCH_MATMUL_S8_DST_SIZE;
+
+    run_batch_matmul_s8("batch_matmul_s8_arm_batch_matmul_s8", &c, output);
+}
+
+RAM_FUNC void batch_matmul_broadcast_s8_arm_batch_matmul_s8(void)
+{
+    int8_t output[BATCH_MATMUL_BROADCAST_S8_DST_SIZE] = {0};
+    bmm_case c;
+    memset(&c, 0, sizeof(c));
+
+    c.lhs_dims.n = BATCH_MATMUL_BROADCAST_S8_LHS_BATCH;
+    c.lhs_dims.h = BATCH_MATMUL_BROADCAST_S8_LHS_HEIGHT;
+    c.lhs_dims.w = BATCH_MATMUL_BROADCAST_S8_LHS_ROWS;
+    c.lhs_dims.c = BATCH_MATMUL_BROADCAST_S8_LHS_COLS;
+    c.rhs_dims.n = BATCH_MATMUL_BROADCAST_S8_RHS_BATCH;
+    c.rhs_dims.h = BATCH_MATMUL_BROADCAST_S8_RHS_HEIGHT;
+    c.rhs_dims.w = BATCH_MATMUL_BROADCAST_S8_RHS_ROWS;
+    c.rhs_dims.c = BATCH_MATMUL_BROADCAST_S8_RHS_COLS;
+    c.output_dims.n = BATCH_MATMUL_BROADCAST_S8_OUTPUT_BATCH;
+    c.output_dims.h = BATCH_MATMUL_BROADCAST_S8_OUTPUT_HEIGHT;
+    c.output_dims.w = BATCH_MATMUL_BROADCAST_S8_OUTPUT_ROWS;
+    c.output_dims.c = BATCH_MATMUL_BROADCAST_S8_OUTPUT_COLS;
+
+    c.bmm_params.adj_x = false;
+    c.bmm_params.adj_y = true;
+    c.bmm_params.fc_params.input_offset = BATCH_MATMUL_BROADCAST_S8_LHS_OFFSET;
+    c.bmm_params.fc_params.filter_offset = BATCH_MATMUL_BROADCAST_S8_RHS_OFFSET;
+    c.bmm_params.fc_params.output_offset = BATCH_MATMUL_BROADCAST_S8_OUTPUT_OFFSET;
+    c.bmm_params.fc_params.activation.min = BATCH_MATMUL_BROADCAST_S8_OUT_ACTIVATION_MIN;
+    c.bmm_params.fc_params.activation.max = BATCH_MATMUL_BROADCAST_S8_OUT_ACTIVATION_MAX;
+    c.quant_params.multiplier = BATCH_MATMUL_BROADCAST_S8_OUTPUT_MULTIPLIER;
+    c.quant_params.shift = BATCH_MATMUL_BROADCAST_S8_OUTPUT_SHIFT;
+
+    c.lhs = batch_matmul_broadcast_s8_input_lhs;
+    c.rhs = batch_matmul_broadcast_s8_input_rhs;
+    c.output_ref = batch_matmul_broadcast_s8_output_ref;
+    c.output_ref_size = BATCH_MATMUL_BROADCAST_S8_DST_SIZE;
+
+    run_batch_matmul_s8("batch_matmul_broadcast_s8_arm_batch_matmul_s8", &c, output);
+}
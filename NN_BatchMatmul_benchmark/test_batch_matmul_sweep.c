@@ -0,0 +1,136 @@
+#include "main.h"
+
+/*
+ * Attention-style batch matmul sweep: out[b] = lhs[b] (M x K) * rhs[b] (K x N).
+ * arm_batch_matmul_* expects the RHS transposed ([N, K], adj_y). When the RHS is stored
+ * as [K, N] it is first transposed into a scratch buffer with arm_transpose_s8, and the
+ * transpose cost and scratch size are reported separately.
+ */
+
+typedef struct {
+    int32_t batch, m, n, k;
+} bmm_shape;
+
+static const bmm_shape sweep_shapes[] = {
+    {1, 16, 16, 16},
+    {1, 16, 16, 64},
+    {4, 16, 16, 16},    // 4 heads, Q*K^T with seq 16, head dim 16
+    {4, 16, 16, 32},    // 4 heads, Q*K^T with seq 16, head dim 32
+    {4, 16, 32, 16},    // 4 heads, scores*V with seq 16, head dim 32
+    {1, 32, 32, 32},
+    {2, 32, 32, 64},
+    {1, 64, 64, 64},
+};
+
+#define NUM_SWEEP_SHAPES ((int)(sizeof(sweep_shapes) / sizeof(sweep_shapes[0])))
+
+static void print_sweep_line(const char *name, const bmm_shape *s, uint32_t cycles, uint32_t scratch)
+{
+    const uint32_t macs = (uint32_t)(s->batch * s->m * s->n * s->k);
+    printf("%-22s b%-2ld M%-3ld N%-3ld K%-3ld: %8lu cycles, %.3f MACs/cycle, scratch %lu bytes\n\r",
+           name, (long)s->batch, (long)s->m, (long)s->n, (long)s->k,
+           (unsigned long)cycles, (float)macs / cycles, (unsigned long)scratch);
+}
+
+RAM_FUNC static void run_bmm_shape(const bmm_shape *s)
+{
+    const int32_t lhs_size = s->batch * s->m * s->k;
+    const int32_t rhs_size = s->batch * s->k * s->n;
+    const int32_t out_size = s->batch * s->m * s->n;
+
+    int16_t *lhs = malloc(lhs_size * sizeof(int16_t));
+    int16_t *rhs = malloc(rhs_size * sizeof(int16_t));
+    int16_t *output = malloc(out_size * sizeof(int16_t));
+    int8_t *rhs_t = malloc(rhs_size);
+
+    if (!lhs || !rhs || !output || !rhs_t) {
+        printf("Failed to allocate batch matmul buffers\n\r");
+        free(lhs);
+        free(rhs);
+        free(output);
+        free(rhs_t);
+        return;
+    }
+
+    // The s8 runs use the same buffers viewed as int8
+    generate_rand_s16(lhs, lhs_size);
+    generate_rand_s16(rhs, rhs_size);
+
+    cmsis_nn_context ctx;
+    cmsis_nn_bmm_params bmm_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims lhs_dims = {1, s->batch, s->m, s->k};
+    cmsis_nn_dims rhs_dims = {1, s->batch, s->n, s->k};
+    cmsis_nn_dims output_dims = {1, s->batch, s->m, s->n};
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+    bmm_params.adj_x = false;
+    bmm_params.adj_y = true;
+    bmm_params.fc_params.input_offset = 0;
+    bmm_params.fc_params.filter_offset = 0;
+    bmm_params.fc_params.output_offset = 0;
+    bmm_params.fc_params.activation.min = -128;
+    bmm_params.fc_params.activation.max = 127;
+    quant_params.multiplier = 0x40000000;
+    quant_params.shift = -8;
+
+    uint32_t start_cycles, cycles, transpose_cycles;
+
+    // s8, RHS already stored as [N, K]
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    arm_batch_matmul_s8(&ctx, &bmm_params, &quant_params,
+                        &lhs_dims, (const int8_t *)lhs,
+                        &rhs_dims, (const int8_t *)rhs,
+                        &output_dims, (int8_t *)output);
+    cycles = read_cycle_counter() - start_cycles;
+    print_sweep_line("s8 rhs [N,K]", s, cycles, 0);
+
+    // s8, RHS stored as [K, N]: transpose the last two dims into scratch first
+    static const uint32_t perm[3] = {0, 2, 1};
+    const cmsis_nn_transpose_params transpose_params = {3, perm};
+    const cmsis_nn_dims t_in_dims = {s->batch, s->k, s->n, 0};
+    const cmsis_nn_dims t_out_dims = {s->batch, s->n, s->k, 0};
+
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    arm_transpose_s8((const int8_t *)rhs, rhs_t, &t_in_dims, &t_out_dims, &transpose_params);
+    transpose_cycles = read_cycle_counter() - start_cycles;
+    arm_batch_matmul_s8(&ctx, &bmm_params, &quant_params,
+                        &lhs_dims, (const int8_t *)lhs,
+                        &rhs_dims, rhs_t,
+                        &output_dims, (int8_t *)output);
+    cycles = read_cycle_counter() - start_cycles;
+    print_sweep_line("s8 rhs [K,N]", s, cycles, (uint32_t)rhs_size);
+    printf("%-22s transpose %lu cycles (%.1f%% of total)\n\r", "",
+           (unsigned long)transpose_cycles, 100.0f * transpose_cycles / cycles);
+
+    // s16, RHS already stored as [N, K]
+    bmm_params.fc_params.activation.min = -32768;
+    bmm_params.fc_params.activation.max = 32767;
+    quant_params.shift = -16;
+
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    arm_batch_matmul_s16(&ctx, &bmm_params, &quant_params,
+                         &lhs_dims, lhs,
+                         &rhs_dims, rhs,
+                         &output_dims, output);
+    cycles = read_cycle_counter() - start_cycles;
+    print_sweep_line("s16 rhs [N,K]", s, cycles, 0);
+    printf("\n\r");
+
+    free(lhs);
+    free(rhs);
+    free(output);
+    free(rhs_t);
+}
+
+RAM_FUNC void benchmark_batch_matmul_sweep(void)
+{
+    printf("\n\r");
+    for (int i = 0; i < NUM_SWEEP_SHAPES; i++) {
+        run_bmm_shape(&sweep_shapes[i]);
+    }
+}
@@ -0,0 +1,145 @@
+"""Generate reference vectors for arm_batch_matmul_s8 and arm_batch_matmul_s16.
+
+Tensors follow the CMSIS-NN layout: LHS [n, h, rows, cols], RHS already transposed
+[n, h, rhs_rows, cols] (adj_y), output [n, h, lhs_rows, rhs_rows]. Batch dimensions of size 1
+broadcast against the other operand.
+
+    out = clamp(requantize(sum_k (lhs + lhs_offset) * rhs) + output_offset)
+
+The s8 kernels accumulate in int32 and use arm_nn_requantize(). The s16 kernels accumulate
+in int64 and use arm_nn_requantize_s64() with the multiplier reduced to 16 bits, which
+rounds differently, so each width has its own requantize function here.
+
+Usage:
+    python generate_batch_matmul_test_data.py [<TestData dir>]
+"""
+
+import math
+import os
+import random
+import sys
+
+
+def to_int32(v):
+    v &= 0xFFFFFFFF
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def requantize(val, multiplier, shift):
+    """arm_nn_requantize() without CMSIS_NN_USE_SINGLE_ROUNDING."""
+    left_shift = shift if shift > 0 else 0
+    right_shift = -shift if shift < 0 else 0
+    result = to_int32((to_int32(val * (1 << left_shift)) * multiplier + (1 << 30)) >> 31)
+    mask = (1 << right_shift) - 1
+    remainder = result & mask
+    result >>= right_shift
+    threshold = (mask >> 1) + (1 if result < 0 else 0)
+    if remainder > threshold:
+        result += 1
+    return result
+
+
+def requantize_s64(val, multiplier, shift):
+    """arm_nn_requantize_s64() with REDUCE_MULTIPLIER() applied to the multiplier."""
+    reduced_multiplier = (multiplier + (1 << 15)) >> 16 if multiplier < 0x7FFF0000 else 0x7FFF
+    result = to_int32((val * reduced_multiplier) >> (14 - shift))
+    return (result + 1) >> 1
+
+
+def quantize_multiplier(real):
+    mantissa, exponent = math.frexp(real)
+    q = int(round(mantissa * (1 << 31)))
+    if q == (1 << 31):
+        q //= 2
+        exponent += 1
+    return q, exponent
+
+
+def c_array(ctype, name, values, per_line=16):
+    lines = []
+    for k in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[k:k + per_line]))
+    return 'const %s %s[%d] = {\n%s};\n' % (ctype, name, len(values), ',\n'.join(lines))
+
+
+def batch_matmul(lhs, rhs, lhs_dims, rhs_dims, lhs_offset):
+    """Returns the accumulators (unbounded; the caller applies the kernel's width) and the output dims."""
+    ln, lh, m, k = lhs_dims
+    rn, rh, n, _ = rhs_dims
+    on, oh = max(ln, rn), max(lh, rh)
+    accs = []
+    for b in range(on):
+        for h in range(oh):
+            lb = ((b if ln > 1 else 0) * lh + (h if lh > 1 else 0)) * m * k
+            rb = ((b if rn > 1 else 0) * rh + (h if rh > 1 else 0)) * n * k
+            for i in range(m):
+                for j in range(n):
+                    accs.append(sum((lhs[lb + i * k + t] + lhs_offset) * rhs[rb + j * k + t] for t in range(k)))
+    return accs, (on, oh, m, n)
+
+
+CASES = [
+    # name,                         bits, lhs dims [n,h,rows,cols], rhs dims,        lhs_offset, output_offset
+    ('batch_matmul_s8',              8,   (1, 2, 4, 20),           (1, 2, 6, 20),   7,          -3),
+    ('batch_matmul_broadcast_s8',    8,   (2, 3, 5, 12),           (1, 1, 8, 12),   -11,        4),
+    ('batch_matmul_s16',             16,  (2, 1, 3, 16),           (2, 1, 5, 16),   0,          0),
+]
+
+
+def generate(out_root, seed, name, bits, lhs_dims, rhs_dims, lhs_offset, output_offset):
+    rng = random.Random(seed)
+    lo, hi = -(1 << (bits - 1)), (1 << (bits - 1)) - 1
+    ctype = 'int8_t' if bits == 8 else 'int16_t'
+    lhs = [rng.randint(lo, hi) for _ in range(math.prod(lhs_dims))]
+    rhs = [rng.randint(lo, hi) for _ in range(math.prod(rhs_dims))]
+    accs, out_dims = batch_matmul(lhs, rhs, lhs_dims, rhs_dims, lhs_offset)
+
+    # Largest accumulator maps to ~70% of the output range
+    real = 0.7 * hi / max(abs(a) for a in accs)
+    mult, shift = quantize_multiplier(real)
+    if bits == 16:
+        scaled = [requantize_s64(a, mult, shift) for a in accs]
+    else:
+        scaled = [requantize(to_int32(a), mult, shift) for a in accs]
+    out = [min(max(v + output_offset, lo), hi) for v in scaled]
+
+    out_dir = os.path.join(out_root, name)
+    os.makedirs(out_dir, exist_ok=True)
+    banner = '// Generated by generate_batch_matmul_test_data.py (seed %d).\n' % seed
+    N = name.upper() + '_'
+    config = []
+    for prefix, dims in (('LHS', lhs_dims), ('RHS', rhs_dims), ('OUTPUT', out_dims)):
+        config += [(prefix + '_BATCH', dims[0]), (prefix + '_HEIGHT', dims[1]),
+                   (prefix + '_ROWS', dims[2]), (prefix + '_COLS', dims[3])]
+    config += [('DST_SIZE', len(out)), ('LHS_OFFSET', lhs_offset), ('RHS_OFFSET', 0),
+               ('OUTPUT_OFFSET', output_offset), ('OUTPUT_MULTIPLIER', mult), ('OUTPUT_SHIFT', shift),
+               ('OUT_ACTIVATION_MIN', lo), ('OUT_ACTIVATION_MAX', hi)]
+    files = {
+        'config_data.h': ''.join('#define %s%s %d\n' % (N, k, v) for k, v in config),
+        'input_lhs_data.h': c_array(ctype, name + '_input_lhs', lhs),
+        'input_rhs_data.h': c_array(ctype, name + '_input_rhs', rhs),
+        'output_ref_data.h': c_array(ctype, name + '_output_ref', out),
+    }
+    for fname, body in files.items():
+        with open(os.path.join(out_dir, fname), 'w') as f:
+            f.write(banner + '#pragma once\n')
+            if fname != 'config_data.h':
+                f.write('#include <stdint.h>\n\n')
+            f.write(body)
+
+    with open(os.path.join(out_dir, 'test_data.h'), 'w') as f:
+        f.write(banner)
+        for fname in sorted(files):
+            f.write('#include "../../TestData/%s/%s"\n' % (name, fname))
+
+    print('[*] %s: out dims %s, max |out| %d' % (name, out_dims, max(abs(v) for v in out)))
+
+
+def main():
+    out_root = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), '..', 'TestData')
+    for seed, case in enumerate(CASES, start=1):
+        generate(out_root, seed, *case)
+
+
+if __name__ == '__main__':
+    main()
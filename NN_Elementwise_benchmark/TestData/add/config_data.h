@@ -0,0 +1,15 @@
+// Generated by generate_elementwise_test_data.py (seed 1).
+#pragma once
+#define ADD_DST_SIZE 80
+#define ADD_INPUT1_OFFSET -4
+#define ADD_INPUT1_MULT 1504265636
+#define ADD_INPUT1_SHIFT -2
+#define ADD_INPUT2_OFFSET -13
+#define ADD_INPUT2_MULT 1073741824
+#define ADD_INPUT2_SHIFT 0
+#define ADD_LEFT_SHIFT 20
+#define ADD_OUTPUT_OFFSET 5
+#define ADD_OUTPUT_MULT 1159646342
+#define ADD_OUTPUT_SHIFT -19
+#define ADD_OUT_ACTIVATION_MIN -128
+#define ADD_OUT_ACTIVATION_MAX 127
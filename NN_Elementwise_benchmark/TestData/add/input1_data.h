@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t add_input1[80] = {
+    102, 113, 66, -21, -80, 121, -114, 71, 93, -127, 100, 8, -11, -76, 34, -113,
+    -117, -115, -124, 67, -18, 88, -114, -15, 96, 125, -9, 48, -10, -16, 107, 20,
+    -117, 85, -77, -33, 23, -67, 42, 88, -31, 27, 17, 127, 73, -111, 117, -4,
+    78, 84, -40, 59, 63, -84, 96, -73, -45, 73, 61, 122, -113, 112, -106, 29,
+    73, -41, -42, -12, -122, -26, -10, 79, 48, 52, 107, 9, -126, 68, -62, -23};
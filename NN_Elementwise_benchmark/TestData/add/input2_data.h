@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t add_input2[80] = {
+    90, -100, 118, 58, -26, 83, 120, 54, 84, 49, -128, 41, 106, -114, -11, -38,
+    -36, -82, 2, -112, -92, -86, -120, 103, -121, 15, -1, 9, -72, -34, 48, 20,
+    -93, -43, -47, 2, -42, 11, 22, 104, 36, 126, 114, -70, -116, 31, 69, 47,
+    87, -32, 4, -73, 1, -21, 93, -118, -13, -119, 75, -54, -110, -46, 100, 90,
+    -16, 102, -14, -113, 74, 36, 90, -98, 24, -64, -20, -104, 28, -92, -89, 30};
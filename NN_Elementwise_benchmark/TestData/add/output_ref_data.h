@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t add_output_ref[80] = {
+    65, -35, 73, 25, -32, 65, 40, 40, 60, 0, -53, 21, 52, -79, -2, -45,
+    -44, -69, -25, -51, -56, -33, -89, 50, -50, 29, -5, 11, -44, -24, 43, 12,
+    -75, -10, -43, -8, -21, -10, 17, 70, 11, 70, 62, -17, -52, -7, 57, 22,
+    59, -4, -8, -31, 10, -30, 66, -80, -18, -53, 49, -9, -84, -6, 31, 51,
+    2, 45, -18, -66, 14, 12, 44, -41, 19, -28, 7, -57, -11, -40, -63, 9};
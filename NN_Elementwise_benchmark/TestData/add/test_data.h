@@ -0,0 +1,5 @@
+// Generated by generate_elementwise_test_data.py (seed 1).
+#include "../../TestData/add/config_data.h"
+#include "../../TestData/add/input1_data.h"
+#include "../../TestData/add/input2_data.h"
+#include "../../TestData/add/output_ref_data.h"
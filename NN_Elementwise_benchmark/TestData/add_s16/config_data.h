@@ -0,0 +1,15 @@
+// Generated by generate_elementwise_test_data.py (seed 2).
+#pragma once
+#define ADD_S16_DST_SIZE 80
+#define ADD_S16_INPUT1_OFFSET 0
+#define ADD_S16_INPUT1_MULT 1073741824
+#define ADD_S16_INPUT1_SHIFT 0
+#define ADD_S16_INPUT2_OFFSET 0
+#define ADD_S16_INPUT2_MULT 2132870517
+#define ADD_S16_INPUT2_SHIFT -1
+#define ADD_S16_LEFT_SHIFT 15
+#define ADD_S16_OUTPUT_OFFSET 0
+#define ADD_S16_OUTPUT_MULT 1113964902
+#define ADD_S16_OUTPUT_SHIFT -15
+#define ADD_S16_OUT_ACTIVATION_MIN -32768
+#define ADD_S16_OUT_ACTIVATION_MAX 32767
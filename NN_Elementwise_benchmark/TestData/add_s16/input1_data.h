@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int16_t add_s16_input1[80] = {
+    -21644, 14556, -10606, 7620, 207, -4953, -28085, -12009, 23680, 18813, 15998, 25539, 2390, -28060, -29171, 14944,
+    28166, 8973, 17041, 22755, -11209, -9512, -1819, -2543, -29641, -9605, 9849, -10016, -14851, 14377, -8934, 25642,
+    21583, 14975, 13603, 14665, 25659, -11642, 19642, 27709, -13, 31459, 3814, 32514, 13621, 26828, 27657, 13208,
+    27073, 31012, -3695, 9786, -11001, 2377, 30115, 7807, 6985, 20535, 8106, -5529, 31313, 15282, -22889, 11987,
+    -31665, -7681, -18854, -25067, -26358, 3027, -3065, -18840, -14877, 2076, -678, -5181, -24854, 22664, -28591, -25324};
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int16_t add_s16_input2[80] = {
+    14726, 14446, -10240, -66, -29696, -21902, -17666, -23926, -29447, -27411, -29997, 16134, 745, -16019, -12175, -8685,
+    -32515, 17768, -27111, -285, -12922, -28015, -32219, 12347, -17942, 4722, 11431, 31294, -28730, 7652, 26037, -26769,
+    1827, 19903, -12655, 29200, -3208, -20519, 8690, -19393, -29596, 25928, -16052, 18737, 31053, 10218, -13916, 11934,
+    1192, 1551, 22250, -30405, -14344, -25326, 388, -28370, -15506, -11644, -10393, -20202, 26658, -2405, -28653, -425,
+    -2298, 25519, -23128, 102, -22226, -2857, 14395, 866, 22677, 3766, -32136, -12961, -28116, 17662, 20804, -11766};
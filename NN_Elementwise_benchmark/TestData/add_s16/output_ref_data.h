@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int16_t add_s16_output_ref[80] = {
+    -1820, 7497, -5389, 1959, -7596, -6927, -11835, -9278, -1444, -2182, -3578, 10780, 812, -11404, -10702, 1639,
+    -1071, 6904, -2564, 5828, -6236, -9684, -8771, 2521, -12310, -1275, 5499, 5464, -11253, 5700, 4390, -245,
+    6069, 9011, 268, 11326, 5829, -8305, 7333, 2191, -7627, 14838, -3146, 13260, 11532, 9590, 3588, 6500,
+    7329, 8443, 4773, -5294, -6548, -5907, 7911, -5283, -2183, 2327, -575, -6638, 14989, 3344, -13318, 3000,
+    -8805, 4582, -10848, -6475, -12562, 49, 2913, -4663, 1983, 1509, -8454, -4683, -13689, 10428, -2056, -9599};
@@ -0,0 +1,5 @@
+// Generated by generate_elementwise_test_data.py (seed 2).
+#include "../../TestData/add_s16/config_data.h"
+#include "../../TestData/add_s16/input1_data.h"
+#include "../../TestData/add_s16/input2_data.h"
+#include "../../TestData/add_s16/output_ref_data.h"
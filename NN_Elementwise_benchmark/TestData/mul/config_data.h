@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 3).
+#pragma once
+#define MUL_DST_SIZE 80
+#define MUL_INPUT1_OFFSET 18
+#define MUL_INPUT2_OFFSET 10
+#define MUL_OUTPUT_OFFSET 10
+#define MUL_OUTPUT_MULT 1765173791
+#define MUL_OUTPUT_SHIFT -8
+#define MUL_OUT_ACTIVATION_MIN -128
+#define MUL_OUT_ACTIVATION_MAX 127
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 3).
+#pragma once
+#include <stdint.h>
+
+const int8_t mul_input1[80] = {
+    -95, -122, 112, 4, -9, -30, 112, 115, 75, -51, -10, -51, 71, -121, -96, -47,
+    -107, 26, -113, 9, 114, 70, 90, 74, 99, -60, 59, -79, -110, -59, 125, -17,
+    4, 95, 26, 87, 69, 51, 80, -10, 44, -114, 15, -45, 39, -75, -20, 8,
+    17, -65, -96, 118, 119, -83, 48, -94, 82, -51, -118, 22, 90, 84, -68, -106,
+    -105, 65, 41, 14, -8, -110, 30, -125, -89, -73, -112, -27, 80, 21, 6, -49};
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 3).
+#pragma once
+#include <stdint.h>
+
+const int8_t mul_input2[80] = {
+    -107, 45, 32, 56, -58, 65, 64, 107, 69, -76, 10, 92, -7, 26, 95, 4,
+    27, 45, -123, 84, 33, -118, 64, -60, -98, 42, 110, 52, 52, 14, 122, -117,
+    -97, -118, 61, 0, 105, 24, 35, -38, 58, -34, 32, 61, 7, 25, 65, -75,
+    -115, -61, 30, -15, 9, -6, 39, -33, 94, -79, -76, 36, 42, -14, 96, -42,
+    -88, 44, -17, 102, 10, -13, -67, -111, -31, 33, -35, 14, 46, -85, 48, -62};
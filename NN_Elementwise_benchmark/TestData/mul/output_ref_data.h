@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 3).
+#pragma once
+#include <stdint.h>
+
+const int8_t mul_output_ref[80] = {
+    34, -8, 28, 15, 9, 7, 41, 60, 34, 17, 11, -1, 11, -2, -16, 9,
+    -1, 18, 44, 18, 28, -21, 36, -5, -23, 3, 40, -2, -8, 7, 71, 10,
+    4, -29, 20, 13, 42, 18, 24, 9, 24, 17, 14, 4, 13, 4, 10, 5,
+    -2, 18, 0, 8, 18, 9, 20, 16, 43, 17, 31, 16, 28, 9, -7, 19,
+    32, 24, 9, 22, 11, 11, 1, 45, 15, 2, 18, 9, 28, 1, 14, 15};
@@ -0,0 +1,5 @@
+// Generated by generate_elementwise_test_data.py (seed 3).
+#include "../../TestData/mul/config_data.h"
+#include "../../TestData/mul/input1_data.h"
+#include "../../TestData/mul/input2_data.h"
+#include "../../TestData/mul/output_ref_data.h"
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 6).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_acc_s16_input1[80] = {
+    1523, -27942, -32709, -13687, 28869, 16142, 9094, -29899, 2975, 31305, -6802, 21496, -20420, -7474, 2034, -21220,
+    22898, 11217, -20561, 14698, 20964, 63, 25586, -20477, -6926, 5398, -19982, -26781, -6440, 14467, 31025, -7377,
+    -29043, 14598, -670, 23552, 7120, 14074, -17094, -21013, -6669, -17456, 2344, 8163, -7049, 17014, 30637, -3574,
+    -14667, -5258, -31127, -8029, -10599, -30533, 10867, 7356, 16335, 16699, 18240, 5131, -16144, 31294, -25714, -8474,
+    22660, 19367, -20188, 25067, -615, -21096, 25704, 25846, 17041, -22745, 23123, 28957, 7007, 20848, -21505, -7584};
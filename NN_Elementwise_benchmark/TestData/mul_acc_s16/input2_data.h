@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 6).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_acc_s16_input2[80] = {
+    2073, 26392, 31151, -10207, -30338, -29902, -16582, 149, 14555, -8185, 827, 26415, 10412, 624, 21046, 22510,
+    30854, 2351, 29453, 29955, 31722, -14132, 16708, 32328, 7297, 28476, 9619, 15266, -11400, 16520, 2071, 9189,
+    19435, 31194, -12035, 5346, -31957, 26130, -25284, -8838, -28822, -18070, 15847, 14681, 32432, -24606, -7520, -12533,
+    2523, -30826, 22559, 31679, -22831, 28691, -2351, -19641, 15848, 14676, -13768, -871, 8955, -13858, -27830, -20012,
+    -18949, -26836, 29868, 27880, -23725, -28725, -16121, -21818, -11658, 1990, 26474, 32727, -30110, -14802, -8023, 25019};
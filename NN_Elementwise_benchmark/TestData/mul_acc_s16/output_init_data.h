@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 6).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_acc_s16_output_init[80] = {
+    15018, 12417, 12915, 1730, 14904, -12212, 2736, 7434, 2363, 7218, -14165, -10900, 1689, 1953, 1580, 14621,
+    11842, 12729, 7959, -14293, -10772, -28, -757, -14241, -5028, 5661, 7896, -14290, -12972, -2676, 11995, 6126,
+    -11299, -6054, -8911, 9807, -7492, 14028, 16025, -11457, -7993, -11537, 6579, -14387, -4216, -6534, -4345, 2077,
+    -6488, 9064, -1765, -1862, -8137, 11084, -5690, 4358, -634, -16072, 8957, -4054, 4932, 8590, 12513, -15750,
+    9667, -7454, -1069, 8010, 1435, -4251, -6593, -5628, -7581, 8827, -11517, -12382, -15581, -13771, 14562, -12503};
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 6).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_acc_s16_output_ref[80] = {
+    15039, 7404, 5988, 2680, 8950, -15493, 1711, 7404, 2657, 5476, -14203, -7040, 244, 1921, 1871, 11374,
+    16645, 12908, 3842, -11300, -6251, -34, 2149, -18741, -5372, 6706, 6589, -17069, -12473, -1051, 12432, 5665,
+    -15136, -2958, -8856, 10663, -9039, 16528, 18963, -10195, -6686, -9393, 6832, -13572, -5770, -9380, -5911, 2382,
+    -6740, 10166, -6538, -3591, -6492, 5129, -5864, 3376, 1126, -14406, 7250, -4084, 3949, 5642, 17378, -14597,
+    6748, -10987, -5168, 12761, 1534, -132, -9410, -9461, -8932, 8519, -7356, -5940, -17015, -15869, 15735, -13793};
@@ -0,0 +1,6 @@
+// Generated by generate_elementwise_test_data.py (seed 6).
+#include "../../TestData/mul_acc_s16/config_data.h"
+#include "../../TestData/mul_acc_s16/input1_data.h"
+#include "../../TestData/mul_acc_s16/input2_data.h"
+#include "../../TestData/mul_acc_s16/output_init_data.h"
+#include "../../TestData/mul_acc_s16/output_ref_data.h"
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 4).
+#pragma once
+#define MUL_S16_DST_SIZE 80
+#define MUL_S16_INPUT1_OFFSET 0
+#define MUL_S16_INPUT2_OFFSET 0
+#define MUL_S16_OUTPUT_OFFSET 0
+#define MUL_S16_OUTPUT_MULT 1798807349
+#define MUL_S16_OUTPUT_SHIFT -16
+#define MUL_S16_OUT_ACTIVATION_MIN -32768
+#define MUL_S16_OUT_ACTIVATION_MAX 32767
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 4).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_s16_input1[80] = {
+    -12456, -20959, -24050, -30171, 19869, 5161, -25055, -3680, 14450, 3497, -10137, -18851, 1536, -4667, -29408, 1344,
+    2850, -7415, -11165, 7844, 5195, 16042, -21402, 11456, 18079, -148, -9465, -351, 29306, 3931, -21058, 6585,
+    -31823, 5497, 8095, -7193, 21488, 22771, 5007, 23729, 26394, -11624, -2199, 7223, 1265, -27101, -22142, -26697,
+    27875, 3988, 28998, 12169, -13755, -7134, -24060, 21337, -6204, 25054, 3447, -8690, 13871, 24369, 9262, -6723,
+    9638, -19533, -24693, -2770, 3601, -1650, -16759, 10625, -9498, 5364, 27396, -29403, -27157, 14035, -21941, 4677};
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 4).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_s16_input2[80] = {
+    10108, -30385, 9543, 5111, 9394, -12726, 21027, -22577, 5689, -7679, 25446, 5504, -14885, 6, 17253, -11941,
+    10657, -31537, 14853, -26897, 26841, -10543, 15098, 14774, 5286, -20041, 24815, -5606, 22800, -5516, -17876, -24991,
+    -24615, -25524, -10661, -13155, -27409, 31544, -124, 9362, -28106, -16742, 5623, 20882, -6520, 29853, -6322, -1067,
+    24748, 21053, 31711, -27936, -4056, 22442, 25362, -186, 23309, -4494, 32581, -8165, -28620, -27944, 575, 443,
+    -998, -5497, -2430, 21906, 1531, -14195, 9832, -26048, 8456, -17452, 20049, -27460, 32019, 18018, -20591, 23607};
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 4).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_s16_output_ref[80] = {
+    -1609, 8140, -2933, -1971, 2386, -839, -6734, 1062, 1051, -343, -3297, -1326, -292, 0, -6485, -205,
+    388, 2989, -2120, -2697, 1782, -2162, -4130, 2163, 1221, 38, -3002, 25, 8540, -277, 4811, -2103,
+    10012, -1793, -1103, 1209, -7528, 9181, -8, 2839, -9482, 2487, -158, 1928, -105, -10341, 1789, 364,
+    8817, 1073, 11753, -4345, 713, -2046, -7799, -51, -1848, -1439, 1435, 907, -5074, -8704, 68, -38,
+    -123, 1372, 767, -776, 70, 299, -2106, -3537, -1027, -1196, 7020, 10320, -11114, 3232, 5774, 1411};
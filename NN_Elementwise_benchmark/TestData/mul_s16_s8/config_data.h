@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 5).
+#pragma once
+#define MUL_S16_S8_DST_SIZE 80
+#define MUL_S16_S8_INPUT1_OFFSET 0
+#define MUL_S16_S8_INPUT2_OFFSET 0
+#define MUL_S16_S8_OUTPUT_OFFSET 0
+#define MUL_S16_S8_OUTPUT_MULT 1156544648
+#define MUL_S16_S8_OUTPUT_SHIFT -23
+#define MUL_S16_S8_OUT_ACTIVATION_MIN -128
+#define MUL_S16_S8_OUT_ACTIVATION_MAX 127
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 5).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_s16_s8_input1[80] = {
+    -28967, 28262, -125, -25972, -12210, -17930, 15963, 28713, -450, 17138, -19403, -88, -31050, -4361, 20729, 3864,
+    -8903, 18276, -11849, -23340, -14580, 25537, -16162, -15435, -32536, -32072, -5315, -4525, -11029, -10947, 5151, 8342,
+    -6700, -5928, -8957, -6963, 17461, 6394, -29941, 14573, 21614, -11016, -13671, 1810, -24231, 10728, 6731, -32325,
+    11520, -24115, 7858, 13808, 7348, 30244, 8623, -8550, 30306, 29168, -9684, -25297, 810, -29771, 14109, 20223,
+    -30400, 22128, 15228, 16562, -31579, 26584, -26644, -9055, -7010, -17168, -513, 27814, 12370, 13735, 117, 27898};
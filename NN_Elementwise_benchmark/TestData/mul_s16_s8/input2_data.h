@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 5).
+#pragma once
+#include <stdint.h>
+
+const int16_t mul_s16_s8_input2[80] = {
+    -18606, 15374, 6011, -27967, 23983, -20817, -5442, 11893, 14762, -13344, 11791, 3365, -20700, 8185, 8755, 7362,
+    -9506, -22519, -13256, 7773, 30643, -11597, -26405, -22157, 20432, -28597, -1660, 12298, 27, 26956, 22512, -13681,
+    -25467, -28480, 31924, 11034, -5629, -15654, -15365, 21472, -18792, -10641, 24190, 16121, -13207, -25065, 22366, 5873,
+    -14261, 26627, -10579, 26678, 31215, 8873, 30021, 3150, 5376, 28846, 20157, -13566, -18015, 16646, -9255, 32679,
+    11597, -9160, -21085, 31701, 2924, 14591, -24497, 13854, -28270, 7300, 14867, 4043, 30891, 1947, 5747, 11806};
@@ -0,0 +1,10 @@
+// Generated by generate_elementwise_test_data.py (seed 5).
+#pragma once
+#include <stdint.h>
+
+const int8_t mul_s16_s8_output_ref[80] = {
+    35, 28, 0, 47, -19, 24, -6, 22, 0, -15, -15, 0, 41, -2, 12, 2,
+    5, -26, 10, -12, -29, -19, 27, 22, -43, 59, 1, -4, 0, -19, 7, -7,
+    11, 11, -18, -5, -6, -6, 30, 20, -26, 8, -21, 2, 21, -17, 10, -12,
+    -11, -41, -5, 24, 15, 17, 17, -2, 10, 54, -13, 22, -1, -32, -8, 42,
+    -23, -13, -21, 34, -6, 25, 42, -8, 13, -8, 0, 7, 25, 2, 0, 21};
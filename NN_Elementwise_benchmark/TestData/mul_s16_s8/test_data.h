@@ -0,0 +1,5 @@
+// Generated by generate_elementwise_test_data.py (seed 5).
+#include "../../TestData/mul_s16_s8/config_data.h"
+#include "../../TestData/mul_s16_s8/input1_data.h"
+#include "../../TestData/mul_s16_s8/input2_data.h"
+#include "../../TestData/mul_s16_s8/output_ref_data.h"
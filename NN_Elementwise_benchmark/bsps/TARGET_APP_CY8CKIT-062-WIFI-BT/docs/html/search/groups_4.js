@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['functions_0',['Functions',['../group__group__bsp__functions.html',1,'']]]
+];
@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['cy8ckit_2d062_2dwifi_2dbt_20bsp_0',['CY8CKIT-062-WIFI-BT BSP',['../index.html',1,'']]]
+];
@@ -0,0 +1,63 @@
+#include "main.h"
+
+void add_arm_elementwise_add_s8(void);
+void add_s16_arm_elementwise_add_s16(void);
+void mul_arm_elementwise_mul_s8(void);
+void mul_s16_arm_elementwise_mul_s16(void);
+void mul_s16_s8_arm_elementwise_mul_s16_s8(void);
+void mul_acc_s16_arm_elementwise_mul_acc_s16(void);
+void benchmark_elementwise_sweep(void);
+void benchmark_residual_block(void);
+
+uint32_t clkFastfreq = 0;
+
+RAM_FUNC int main(void)
+{
+	__disable_irq();  // Disable all interrupts
+    cy_rslt_t result;
+
+    // Initialize the device and board peripherals
+    result = cybsp_init();
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Initialize retarget-io to use the debug UART port
+    result = cy_retarget_io_init_fc(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                    CYBSP_DEBUG_UART_CTS, CYBSP_DEBUG_UART_RTS, CY_RETARGET_IO_BAUDRATE);
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Get the clock frequency
+    clkFastfreq = Cy_SysClk_ClkFastGetFrequency();
+
+    // Print system details
+    printf("\n\r");
+    printf("-----Starting CMSIS-NN Elementwise Functions Benchmark-----\n\r");
+    printf("\n\r");
+    printf("CPU Clock Frequency: %lu Hz\n\r", clkFastfreq);
+    printf("\n\r");
+
+    // Perform benchmarks
+    printf("*****ARM ELEMENTWISE ADD*****\n\r");
+    add_arm_elementwise_add_s8();
+    add_s16_arm_elementwise_add_s16();
+    printf("\n\r");
+
+    printf("*****ARM ELEMENTWISE MUL*****\n\r");
+    mul_arm_elementwise_mul_s8();
+    mul_s16_arm_elementwise_mul_s16();
+    mul_s16_s8_arm_elementwise_mul_s16_s8();
+    mul_acc_s16_arm_elementwise_mul_acc_s16();
+    printf("\n\r");
+
+    printf("*****Elementwise Size Sweep*****\n\r");
+    benchmark_elementwise_sweep();
+
+    printf("*****Residual Block: Two-pass vs Fused Epilogue*****\n\r");
+    benchmark_residual_block();
+
+    printf("Finish Elementwise Functions Benchmark\n\r");
+    return 0;
+}
@@ -0,0 +1,64 @@
+#ifndef MAIN_H_
+#define MAIN_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <arm_nnfunctions.h>
+#include <arm_math.h>
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "core_cm4.h"
+#include "validate.h"
+
+// RAM function attribute
+#define RAM_FUNC __attribute__((section(".cy_ramfunc")))
+
+// Stack Limit
+extern uint32_t __StackLimit;
+
+// Clock Frequency
+extern uint32_t clkFastfreq;
+
+// Function Prototypes
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+void fill_stack_pattern_to_sp(void);
+uint32_t measure_stack_usage(void);
+void generate_rand_s8(int8_t *src, int length);
+void generate_rand_s16(int16_t *src, int length);
+
+// Quantization of arm_elementwise_add_s8, grouped so the fused kernel can take it as one argument
+typedef struct {
+    int32_t input_1_offset;
+    int32_t input_1_mult;
+    int32_t input_1_shift;
+    int32_t input_2_offset;
+    int32_t input_2_mult;
+    int32_t input_2_shift;
+    int32_t left_shift;
+    int32_t out_offset;
+    int32_t out_mult;
+    int32_t out_shift;
+    int32_t out_activation_min;
+    int32_t out_activation_max;
+} elementwise_add_params;
+
+// 1x1 convolution with the residual add applied as an epilogue (input 1 = conv output, input 2 = residual)
+arm_cmsis_nn_status conv_1x1_residual_add_s8(const cmsis_nn_context *ctx,
+                                             const cmsis_nn_conv_params *conv_params,
+                                             const cmsis_nn_per_channel_quant_params *quant_params,
+                                             const cmsis_nn_dims *input_dims,
+                                             const int8_t *input_data,
+                                             const cmsis_nn_dims *filter_dims,
+                                             const int8_t *filter_data,
+                                             const int32_t *bias_data,
+                                             const int8_t *residual_data,
+                                             const elementwise_add_params *add_params,
+                                             const cmsis_nn_dims *output_dims,
+                                             int8_t *output_data);
+int32_t conv_1x1_residual_add_s8_get_buffer_size(const cmsis_nn_dims *output_dims);
+
+#endif /* MAIN_H_ */
@@ -0,0 +1,118 @@
+#include "main.h"
+#include <arm_nnsupportfunctions.h>
+
+/*
+ * Prototype of a 1x1 convolution with a fused residual-add epilogue.
+ *
+ * The unfused block is arm_convolve_1x1_s8_fast writing the full conv output, followed by
+ * arm_elementwise_add_s8 reading it back together with the residual. Here each conv output
+ * value is requantized and added to the residual while it is still in a register, so the
+ * intermediate tensor is never stored or reloaded. The arithmetic is the same as the two
+ * CMSIS-NN kernels, so the output is bit-exact with the two-pass block. It stays in flash,
+ * like the library kernels it is compared against, so the cycle delta is the fusion alone.
+ */
+
+static inline int32_t read_s8x4(const int8_t *p)
+{
+    int32_t val;
+    memcpy(&val, p, 4);
+    return val;
+}
+
+static inline int32_t add_requantize(int32_t val, int32_t offset, int32_t left_shift, int32_t mult, int32_t shift)
+{
+    return arm_nn_requantize((val + offset) * (1 << left_shift), mult, shift);
+}
+
+int32_t conv_1x1_residual_add_s8_get_buffer_size(const cmsis_nn_dims *output_dims)
+{
+    // One folded bias + input-offset term per output channel
+    return output_dims->c * (int32_t)sizeof(int32_t);
+}
+
+arm_cmsis_nn_status conv_1x1_residual_add_s8(const cmsis_nn_context *ctx,
+                                             const cmsis_nn_conv_params *conv_params,
+                                             const cmsis_nn_per_channel_quant_params *quant_params,
+                                             const cmsis_nn_dims *input_dims,
+                                             const int8_t *input_data,
+                                             const cmsis_nn_dims *filter_dims,
+                                             const int8_t *filter_data,
+                                             const int32_t *bias_data,
+                                             const int8_t *residual_data,
+                                             const elementwise_add_params *add_params,
+                                             const cmsis_nn_dims *output_dims,
+                                             int8_t *output_data)
+{
+    if (conv_params->padding.w != 0 || conv_params->padding.h != 0 || conv_params->stride.w != 1 ||
+        conv_params->stride.h != 1 || filter_dims->w != 1 || filter_dims->h != 1 || ctx->buf == NULL)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t in_ch = input_dims->c;
+    const int32_t out_ch = output_dims->c;
+    const int32_t num_pixels = input_dims->n * input_dims->h * input_dims->w;
+    int32_t *kernel_sum = (int32_t *)ctx->buf;
+
+    for (int32_t oc = 0; oc < out_ch; oc++)
+    {
+        const int8_t *w = filter_data + oc * in_ch;
+        int32_t sum = 0;
+        for (int32_t k = 0; k < in_ch; k++)
+        {
+            sum += w[k];
+        }
+        kernel_sum[oc] = (bias_data ? bias_data[oc] : 0) + sum * conv_params->input_offset;
+    }
+
+    for (int32_t px = 0; px < num_pixels; px++)
+    {
+        const int8_t *in = input_data + px * in_ch;
+        const int8_t *residual = residual_data + px * out_ch;
+        int8_t *out = output_data + px * out_ch;
+
+        for (int32_t oc = 0; oc < out_ch; oc++)
+        {
+            const int8_t *w = filter_data + oc * in_ch;
+            int32_t acc = kernel_sum[oc];
+            int32_t k = 0;
+
+            for (; k <= in_ch - 4; k += 4)
+            {
+                const int32_t in4 = read_s8x4(in + k);
+                const int32_t w4 = read_s8x4(w + k);
+                acc = __SMLAD(__SXTB16(in4), __SXTB16(w4), acc);
+                acc = __SMLAD(__SXTB16(__ROR((uint32_t)in4, 8)), __SXTB16(__ROR((uint32_t)w4, 8)), acc);
+            }
+            for (; k < in_ch; k++)
+            {
+                acc += in[k] * w[k];
+            }
+
+            // Conv requantization, as stored by arm_convolve_1x1_s8_fast
+            acc = arm_nn_requantize(acc, quant_params->multiplier[oc], quant_params->shift[oc]);
+            acc += conv_params->output_offset;
+            acc = MAX(acc, conv_params->activation.min);
+            acc = MIN(acc, conv_params->activation.max);
+
+            // Residual add epilogue, as computed by arm_elementwise_add_s8
+            const int32_t a1 = add_requantize(acc,
+                                              add_params->input_1_offset,
+                                              add_params->left_shift,
+                                              add_params->input_1_mult,
+                                              add_params->input_1_shift);
+            const int32_t a2 = add_requantize(residual[oc],
+                                              add_params->input_2_offset,
+                                              add_params->left_shift,
+                                              add_params->input_2_mult,
+                                              add_params->input_2_shift);
+            int32_t sum = arm_nn_requantize(a1 + a2, add_params->out_mult, add_params->out_shift);
+            sum += add_params->out_offset;
+            sum = MAX(sum, add_params->out_activation_min);
+            sum = MIN(sum, add_params->out_activation_max);
+            out[oc] = (int8_t)sum;
+        }
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
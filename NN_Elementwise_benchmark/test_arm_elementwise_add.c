@@ -0,0 +1,111 @@
+#include "main.h"
+#include "../TestData/add/test_data.h"
+#include "../TestData/add_s16/test_data.h"
+
+RAM_FUNC void add_arm_elementwise_add_s8(void)
+{
+    int8_t output[ADD_DST_SIZE] = {0};
+
+    const int8_t *input_data1 = add_input1;
+    const int8_t *input_data2 = add_input2;
+    const int8_t *output_ref = add_output_ref;
+    const int32_t output_ref_size = ADD_DST_SIZE;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_elementwise_add_s8(input_data1,
+                           input_data2,
+                           ADD_INPUT1_OFFSET,
+                           ADD_INPUT1_MULT,
+                           ADD_INPUT1_SHIFT,
+                           ADD_INPUT2_OFFSET,
+                           ADD_INPUT2_MULT,
+                           ADD_INPUT2_SHIFT,
+                           ADD_LEFT_SHIFT,
+                           output,
+                           ADD_OUTPUT_OFFSET,
+                           ADD_OUTPUT_MULT,
+                           ADD_OUTPUT_SHIFT,
+                           ADD_OUT_ACTIVATION_MIN,
+                           ADD_OUT_ACTIVATION_MAX,
+                           ADD_DST_SIZE);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n\r");
+    if (validate(output, output_ref, output_ref_size)) {
+        printf("add_arm_elementwise_add_s8 output validation PASSED\n\r");
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("add_arm_elementwise_add_s8 output validation FAILED\n\r");
+    }
+}
+
+RAM_FUNC void add_s16_arm_elementwise_add_s16(void)
+{
+    int16_t output[ADD_S16_DST_SIZE] = {0};
+
+    const int16_t *input_data1 = add_s16_input1;
+    const int16_t *input_data2 = add_s16_input2;
+    const int16_t *output_ref = add_s16_output_ref;
+    const int32_t output_ref_size = ADD_S16_DST_SIZE;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_elementwise_add_s16(input_data1,
+                            input_data2,
+                            ADD_S16_INPUT1_OFFSET,
+                            ADD_S16_INPUT1_MULT,
+                            ADD_S16_INPUT1_SHIFT,
+                            ADD_S16_INPUT2_OFFSET,
+                            ADD_S16_INPUT2_MULT,
+                            ADD_S16_INPUT2_SHIFT,
+                            ADD_S16_LEFT_SHIFT,
+                            output,
+                            ADD_S16_OUTPUT_OFFSET,
+                            ADD_S16_OUTPUT_MULT,
+                            ADD_S16_OUTPUT_SHIFT,
+                            ADD_S16_OUT_ACTIVATION_MIN,
+                            ADD_S16_OUT_ACTIVATION_MAX,
+                            ADD_S16_DST_SIZE);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n\r");
+    if (validate_s16(output, output_ref, output_ref_size)) {
+        printf("add_s16_arm_elementwise_add_s16 output validation PASSED\n\r");
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("add_s16_arm_elementwise_add_s16 output validation FAILED\n\r");
+    }
+}
@@ -0,0 +1,160 @@
+#include "main.h"
+#include "../TestData/mul/test_data.h"
+#include "../TestData/mul_s16/test_data.h"
+#include "../TestData/mul_s16_s8/test_data.h"
+#include "../TestData/mul_acc_s16/test_data.h"
+
+static void print_result(int passed, const char *name, uint32_t cycle_count, uint32_t instr_est, uint32_t stack_used)
+{
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n\r");
+    if (passed) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("%s output validation FAILED\n\r", name);
+    }
+}
+
+RAM_FUNC void mul_arm_elementwise_mul_s8(void)
+{
+    int8_t output[MUL_DST_SIZE] = {0};
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_elementwise_mul_s8(mul_input1,
+                           mul_input2,
+                           MUL_INPUT1_OFFSET,
+                           MUL_INPUT2_OFFSET,
+                           output,
+                           MUL_OUTPUT_OFFSET,
+                           MUL_OUTPUT_MULT,
+                           MUL_OUTPUT_SHIFT,
+                           MUL_OUT_ACTIVATION_MIN,
+                           MUL_OUT_ACTIVATION_MAX,
+                           MUL_DST_SIZE);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    print_result(validate(output, mul_output_ref, MUL_DST_SIZE),
+                 "mul_arm_elementwise_mul_s8", cycle_count, instr_est, stack_used);
+}
+
+RAM_FUNC void mul_s16_arm_elementwise_mul_s16(void)
+{
+    int16_t output[MUL_S16_DST_SIZE] = {0};
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_elementwise_mul_s16(mul_s16_input1,
+                            mul_s16_input2,
+                            MUL_S16_INPUT1_OFFSET,
+                            MUL_S16_INPUT2_OFFSET,
+                            output,
+                            MUL_S16_OUTPUT_OFFSET,
+                            MUL_S16_OUTPUT_MULT,
+                            MUL_S16_OUTPUT_SHIFT,
+                            MUL_S16_OUT_ACTIVATION_MIN,
+                            MUL_S16_OUT_ACTIVATION_MAX,
+                            MUL_S16_DST_SIZE);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    print_result(validate_s16(output, mul_s16_output_ref, MUL_S16_DST_SIZE),
+                 "mul_s16_arm_elementwise_mul_s16", cycle_count, instr_est, stack_used);
+}
+
+RAM_FUNC void mul_s16_s8_arm_elementwise_mul_s16_s8(void)
+{
+    int8_t output[MUL_S16_S8_DST_SIZE] = {0};
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    // Single batch; this is how the LSTM gates call it
+    arm_elementwise_mul_s16_s8(mul_s16_s8_input1,
+                               mul_s16_s8_input2,
+                               output,
+                               MUL_S16_S8_OUTPUT_OFFSET,
+                               MUL_S16_S8_OUTPUT_MULT,
+                               MUL_S16_S8_OUTPUT_SHIFT,
+                               MUL_S16_S8_DST_SIZE,
+                               1,
+                               1);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    print_result(validate(output, mul_s16_s8_output_ref, MUL_S16_S8_DST_SIZE),
+                 "mul_s16_s8_arm_elementwise_mul_s16_s8", cycle_count, instr_est, stack_used);
+}
+
+RAM_FUNC void mul_acc_s16_arm_elementwise_mul_acc_s16(void)
+{
+    int16_t output[MUL_ACC_S16_DST_SIZE];
+
+    // The kernel accumulates into the output buffer
+    memcpy(output, mul_acc_s16_output_init, sizeof(output));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_elementwise_mul_acc_s16(mul_acc_s16_input1,
+                                mul_acc_s16_input2,
+                                MUL_ACC_S16_INPUT1_OFFSET,
+                                MUL_ACC_S16_INPUT2_OFFSET,
+                                output,
+                                MUL_ACC_S16_OUTPUT_OFFSET,
+                                MUL_ACC_S16_OUTPUT_MULT,
+                                MUL_ACC_S16_OUTPUT_SHIFT,
+                                MUL_ACC_S16_OUT_ACTIVATION_MIN,
+                                MUL_ACC_S16_OUT_ACTIVATION_MAX,
+                                MUL_ACC_S16_DST_SIZE);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    print_result(validate_s16(output, mul_acc_s16_output_ref, MUL_ACC_S16_DST_SIZE),
+                 "mul_acc_s16_arm_elementwise_mul_acc_s16", cycle_count, instr_est, stack_used);
+}
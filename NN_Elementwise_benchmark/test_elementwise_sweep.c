@@ -0,0 +1,89 @@
+#include "main.h"
+#include "../TestData/add/config_data.h"
+#include "../TestData/add_s16/config_data.h"
+#include "../TestData/mul/config_data.h"
+#include "../TestData/mul_s16/config_data.h"
+
+// Tensor sizes (elements) for the add/mul sweep, with the quantization of the reference cases
+static const int32_t sweep_sizes[] = {64, 256, 1024, 4096, 8192};
+
+#define NUM_SWEEP_SIZES ((int)(sizeof(sweep_sizes) / sizeof(sweep_sizes[0])))
+
+static void print_sweep_line(const char *name, int32_t size, uint32_t cycles, int32_t elem_bytes)
+{
+    // Two inputs read, one output written
+    const uint32_t bytes_moved = 3u * (uint32_t)size * (uint32_t)elem_bytes;
+    printf("%-24s %6ld elements: %8lu cycles, %.3f cycles/element, %.3f bytes/cycle\n\r",
+           name, (long)size, (unsigned long)cycles,
+           (float)cycles / size, (float)bytes_moved / cycles);
+}
+
+RAM_FUNC void benchmark_elementwise_sweep(void)
+{
+    const int32_t max_size = sweep_sizes[NUM_SWEEP_SIZES - 1];
+    int16_t *input1 = malloc(max_size * sizeof(int16_t));
+    int16_t *input2 = malloc(max_size * sizeof(int16_t));
+    int16_t *output = malloc(max_size * sizeof(int16_t));
+
+    if (!input1 || !input2 || !output) {
+        printf("Failed to allocate sweep buffers\n\r");
+        free(input1);
+        free(input2);
+        free(output);
+        return;
+    }
+
+    // The s8 kernels use the same buffers viewed as int8
+    generate_rand_s16(input1, max_size);
+    generate_rand_s16(input2, max_size);
+
+    for (int i = 0; i < NUM_SWEEP_SIZES; i++) {
+        const int32_t size = sweep_sizes[i];
+        uint32_t start_cycles, cycles;
+
+        enable_cycle_counter();
+        start_cycles = read_cycle_counter();
+        arm_elementwise_add_s8((const int8_t *)input1, (const int8_t *)input2,
+                               ADD_INPUT1_OFFSET, ADD_INPUT1_MULT, ADD_INPUT1_SHIFT,
+                               ADD_INPUT2_OFFSET, ADD_INPUT2_MULT, ADD_INPUT2_SHIFT,
+                               ADD_LEFT_SHIFT, (int8_t *)output,
+                               ADD_OUTPUT_OFFSET, ADD_OUTPUT_MULT, ADD_OUTPUT_SHIFT,
+                               ADD_OUT_ACTIVATION_MIN, ADD_OUT_ACTIVATION_MAX, size);
+        cycles = read_cycle_counter() - start_cycles;
+        print_sweep_line("arm_elementwise_add_s8", size, cycles, 1);
+
+        enable_cycle_counter();
+        start_cycles = read_cycle_counter();
+        arm_elementwise_add_s16(input1, input2,
+                                ADD_S16_INPUT1_OFFSET, ADD_S16_INPUT1_MULT, ADD_S16_INPUT1_SHIFT,
+                                ADD_S16_INPUT2_OFFSET, ADD_S16_INPUT2_MULT, ADD_S16_INPUT2_SHIFT,
+                                ADD_S16_LEFT_SHIFT, output,
+                                ADD_S16_OUTPUT_OFFSET, ADD_S16_OUTPUT_MULT, ADD_S16_OUTPUT_SHIFT,
+                                ADD_S16_OUT_ACTIVATION_MIN, ADD_S16_OUT_ACTIVATION_MAX, size);
+        cycles = read_cycle_counter() - start_cycles;
+        print_sweep_line("arm_elementwise_add_s16", size, cycles, 2);
+
+        enable_cycle_counter();
+        start_cycles = read_cycle_counter();
+        arm_elementwise_mul_s8((const int8_t *)input1, (const int8_t *)input2,
+                               MUL_INPUT1_OFFSET, MUL_INPUT2_OFFSET, (int8_t *)output,
+                               MUL_OUTPUT_OFFSET, MUL_OUTPUT_MULT, MUL_OUTPUT_SHIFT,
+                               MUL_OUT_ACTIVATION_MIN, MUL_OUT_ACTIVATION_MAX, size);
+        cycles = read_cycle_counter() - start_cycles;
+        print_sweep_line("arm_elementwise_mul_s8", size, cycles, 1);
+
+        enable_cycle_counter();
+        start_cycles = read_cycle_counter();
+        arm_elementwise_mul_s16(input1, input2,
+                                MUL_S16_INPUT1_OFFSET, MUL_S16_INPUT2_OFFSET, output,
+                                MUL_S16_OUTPUT_OFFSET, MUL_S16_OUTPUT_MULT, MUL_S16_OUTPUT_SHIFT,
+                                MUL_S16_OUT_ACTIVATION_MIN, MUL_S16_OUT_ACTIVATION_MAX, size);
+        cycles = read_cycle_counter() - start_cycles;
+        print_sweep_line("arm_elementwise_mul_s16", size, cycles, 2);
+        printf("\n\r");
+    }
+
+    free(input1);
+    free(input2);
+    free(output);
+}
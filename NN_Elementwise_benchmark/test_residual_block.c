@@ -0,0 +1,194 @@
+#include "main.h"
+#include "../TestData/add/config_data.h"
+
+/*
+ * Residual block y = add(conv1x1(x), residual), run as two CMSIS-NN passes
+ * (arm_convolve_1x1_s8_fast + arm_elementwise_add_s8) and as the fused prototype.
+ * The fused output is checked against the two-pass output.
+ */
+
+typedef struct {
+    int32_t h, w, in_ch, out_ch;
+    int32_t out_shift;
+} residual_shape;
+
+static const residual_shape residual_shapes[] = {
+    {8, 8, 16, 16, -8},
+    {16, 16, 32, 32, -9},
+    {32, 32, 16, 16, -8},
+};
+
+#define NUM_RESIDUAL_SHAPES ((int)(sizeof(residual_shapes) / sizeof(residual_shapes[0])))
+
+static const elementwise_add_params residual_add_params = {
+    ADD_INPUT1_OFFSET, ADD_INPUT1_MULT, ADD_INPUT1_SHIFT,
+    ADD_INPUT2_OFFSET, ADD_INPUT2_MULT, ADD_INPUT2_SHIFT,
+    ADD_LEFT_SHIFT,
+    ADD_OUTPUT_OFFSET, ADD_OUTPUT_MULT, ADD_OUTPUT_SHIFT,
+    ADD_OUT_ACTIVATION_MIN, ADD_OUT_ACTIVATION_MAX,
+};
+
+RAM_FUNC static void run_residual_block(const residual_shape *s)
+{
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims = {1, s->h, s->w, s->in_ch};
+    cmsis_nn_dims filter_dims = {s->out_ch, 1, 1, s->in_ch};
+    cmsis_nn_dims bias_dims = {1, 1, 1, s->out_ch};
+    cmsis_nn_dims output_dims = {1, s->h, s->w, s->out_ch};
+
+    const int32_t input_size = s->h * s->w * s->in_ch;
+    const int32_t output_size = s->h * s->w * s->out_ch;
+    const int32_t weight_size = s->out_ch * s->in_ch;
+
+    int8_t *input = malloc(input_size);
+    int8_t *weights = malloc(weight_size);
+    int32_t *bias = malloc(s->out_ch * sizeof(int32_t));
+    int32_t *mult = malloc(s->out_ch * sizeof(int32_t));
+    int32_t *shift = malloc(s->out_ch * sizeof(int32_t));
+    int8_t *residual = malloc(output_size);
+    int8_t *conv_out = malloc(output_size);
+    int8_t *output_two_pass = malloc(output_size);
+    int8_t *output_fused = malloc(output_size);
+
+    if (!input || !weights || !bias || !mult || !shift || !residual || !conv_out || !output_two_pass || !output_fused) {
+        printf("Failed to allocate residual block buffers\n\r");
+        free(input);
+        free(weights);
+        free(bias);
+        free(mult);
+        free(shift);
+        free(residual);
+        free(conv_out);
+        free(output_two_pass);
+        free(output_fused);
+        return;
+    }
+
+    generate_rand_s8(input, input_size);
+    generate_rand_s8(weights, weight_size);
+    generate_rand_s8(residual, output_size);
+    for (int i = 0; i < s->out_ch; i++) {
+        bias[i] = (rand() % 2048) - 1024;
+        mult[i] = 0x40000000;
+        shift[i] = s->out_shift;
+    }
+
+    conv_params.padding.w = 0;
+    conv_params.padding.h = 0;
+    conv_params.stride.w = 1;
+    conv_params.stride.h = 1;
+    conv_params.dilation.w = 1;
+    conv_params.dilation.h = 1;
+    conv_params.input_offset = 3;
+    conv_params.output_offset = -2;
+    conv_params.activation.min = -128;
+    conv_params.activation.max = 127;
+    quant_params.multiplier = mult;
+    quant_params.shift = shift;
+
+    // Two passes: conv writes the full intermediate tensor, add reads it back
+    int32_t buf_size = arm_convolve_1x1_s8_fast_get_buffer_size(&input_dims);
+    ctx.buf = buf_size > 0 ? malloc(buf_size) : NULL;
+    ctx.size = buf_size;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_convolve_1x1_s8_fast(&ctx, &conv_params, &quant_params, &input_dims, input,
+                             &filter_dims, weights, &bias_dims, bias, &output_dims, conv_out);
+
+    uint32_t mid_cycles = read_cycle_counter();
+
+    arm_elementwise_add_s8(conv_out,
+                           residual,
+                           ADD_INPUT1_OFFSET,
+                           ADD_INPUT1_MULT,
+                           ADD_INPUT1_SHIFT,
+                           ADD_INPUT2_OFFSET,
+                           ADD_INPUT2_MULT,
+                           ADD_INPUT2_SHIFT,
+                           ADD_LEFT_SHIFT,
+                           output_two_pass,
+                           ADD_OUTPUT_OFFSET,
+                           ADD_OUTPUT_MULT,
+                           ADD_OUTPUT_SHIFT,
+                           ADD_OUT_ACTIVATION_MIN,
+                           ADD_OUT_ACTIVATION_MAX,
+                           output_size);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t stack_two_pass = measure_stack_usage();
+    uint32_t conv_cycles = mid_cycles - start_cycles;
+    uint32_t add_cycles = end_cycles - mid_cycles;
+
+    if (ctx.buf) {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+
+    // Fused: residual add as the conv epilogue
+    buf_size = conv_1x1_residual_add_s8_get_buffer_size(&output_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    start_cycles = read_cycle_counter();
+
+    conv_1x1_residual_add_s8(&ctx, &conv_params, &quant_params, &input_dims, input,
+                             &filter_dims, weights, bias, residual, &residual_add_params,
+                             &output_dims, output_fused);
+
+    end_cycles = read_cycle_counter();
+    uint32_t stack_fused = measure_stack_usage();
+    uint32_t fused_cycles = end_cycles - start_cycles;
+
+    if (ctx.buf) {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+
+    // Activation traffic in bytes (weights are read the same way by both)
+    const uint32_t traffic_two_pass = input_size + output_size     // conv: read x, write intermediate
+                                    + 3 * output_size;             // add: read intermediate + residual, write y
+    const uint32_t traffic_fused = input_size + 2 * output_size;   // read x + residual, write y
+
+    printf("\n\r");
+    printf("Residual block %ldx%ldx%ld -> %ld (1x1 conv + add)\n\r",
+           (long)s->h, (long)s->w, (long)s->in_ch, (long)s->out_ch);
+    if (validate(output_fused, output_two_pass, output_size)) {
+        printf("conv_1x1_residual_add_s8 output validation PASSED\n\r");
+    } else {
+        printf("conv_1x1_residual_add_s8 output validation FAILED\n\r");
+    }
+    printf("Two-pass Cycle Count: %lu (conv %lu + add %lu)\n\r",
+           (unsigned long)(conv_cycles + add_cycles), (unsigned long)conv_cycles, (unsigned long)add_cycles);
+    printf("Fused Cycle Count: %lu\n\r", (unsigned long)fused_cycles);
+    printf("Two-pass Stack Used: %lu bytes, Fused Stack Used: %lu bytes\n\r",
+           (unsigned long)stack_two_pass, (unsigned long)stack_fused);
+    printf("Activation Traffic: two-pass %lu bytes, fused %lu bytes (saved %lu)\n\r",
+           (unsigned long)traffic_two_pass, (unsigned long)traffic_fused,
+           (unsigned long)(traffic_two_pass - traffic_fused));
+    printf("Intermediate Buffer Avoided: %lu bytes\n\r\n", (unsigned long)output_size);
+
+    // Free allocated memory
+    free(input);
+    free(weights);
+    free(bias);
+    free(mult);
+    free(shift);
+    free(residual);
+    free(conv_out);
+    free(output_two_pass);
+    free(output_fused);
+}
+
+RAM_FUNC void benchmark_residual_block(void)
+{
+    for (int i = 0; i < NUM_RESIDUAL_SHAPES; i++) {
+        run_residual_block(&residual_shapes[i]);
+    }
+}
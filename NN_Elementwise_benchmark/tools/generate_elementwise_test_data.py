@@ -0,0 +1,160 @@
+"""Generate reference vectors for the CMSIS-NN elementwise add/mul kernels.
+
+Quantization parameters are derived from random float scales the way TFLite Micro does it
+(left shift 20 for s8 add, 15 for s16 add), and the reference output is computed with the
+same integer arithmetic as the kernels, using arm_nn_requantize() with double rounding.
+
+Usage:
+    python generate_elementwise_test_data.py [<TestData dir>]
+"""
+
+import math
+import os
+import random
+import sys
+
+
+def to_int32(v):
+    v &= 0xFFFFFFFF
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def requantize(val, multiplier, shift):
+    """arm_nn_requantize() without CMSIS_NN_USE_SINGLE_ROUNDING."""
+    left_shift = shift if shift > 0 else 0
+    right_shift = -shift if shift < 0 else 0
+    result = to_int32((to_int32(val * (1 << left_shift)) * multiplier + (1 << 30)) >> 31)
+    mask = (1 << right_shift) - 1
+    remainder = result & mask
+    result >>= right_shift
+    threshold = (mask >> 1) + (1 if result < 0 else 0)
+    if remainder > threshold:
+        result += 1
+    return result
+
+
+def quantize_multiplier(real):
+    mantissa, exponent = math.frexp(real)
+    q = int(round(mantissa * (1 << 31)))
+    if q == (1 << 31):
+        q //= 2
+        exponent += 1
+    return q, exponent
+
+
+def clamp(v, lo, hi):
+    return min(max(v, lo), hi)
+
+
+def c_array(ctype, name, values, per_line=16):
+    lines = []
+    for k in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[k:k + per_line]))
+    return 'const %s %s[%d] = {\n%s};\n' % (ctype, name, len(values), ',\n'.join(lines))
+
+
+def add_params(rng, left_shift):
+    s1, s2 = rng.uniform(0.01, 0.05), rng.uniform(0.01, 0.05)
+    # Output scale such that the largest sums map to 50-80% of the output range
+    s_out = (s1 + s2) / rng.uniform(0.5, 0.8)
+    twice_max = 2 * max(s1, s2)
+    in1 = quantize_multiplier(s1 / twice_max)
+    in2 = quantize_multiplier(s2 / twice_max)
+    out = quantize_multiplier(twice_max / ((1 << left_shift) * s_out))
+    return in1, in2, out
+
+
+def gen_add(rng, bits, size):
+    lo, hi = -(1 << (bits - 1)), (1 << (bits - 1)) - 1
+    left_shift = 20 if bits == 8 else 15
+    in1_q, in2_q, out_q = add_params(rng, left_shift)
+    off1, off2, out_off = (rng.randint(-20, 20), rng.randint(-20, 20), rng.randint(-10, 10)) if bits == 8 else (0, 0, 0)
+    x1 = [rng.randint(lo, hi) for _ in range(size)]
+    x2 = [rng.randint(lo, hi) for _ in range(size)]
+    out = []
+    for a, b in zip(x1, x2):
+        a1 = requantize((a + off1) << left_shift, *in1_q)
+        a2 = requantize((b + off2) << left_shift, *in2_q)
+        out.append(clamp(requantize(a1 + a2, *out_q) + out_off, lo, hi))
+    config = [('INPUT1_OFFSET', off1), ('INPUT1_MULT', in1_q[0]), ('INPUT1_SHIFT', in1_q[1]),
+              ('INPUT2_OFFSET', off2), ('INPUT2_MULT', in2_q[0]), ('INPUT2_SHIFT', in2_q[1]),
+              ('LEFT_SHIFT', left_shift), ('OUTPUT_OFFSET', out_off),
+              ('OUTPUT_MULT', out_q[0]), ('OUTPUT_SHIFT', out_q[1]),
+              ('OUT_ACTIVATION_MIN', lo), ('OUT_ACTIVATION_MAX', hi)]
+    return config, x1, x2, out, None
+
+
+def gen_mul(rng, bits, out_bits, size, accumulate=False):
+    lo, hi = -(1 << (bits - 1)), (1 << (bits - 1)) - 1
+    out_lo, out_hi = -(1 << (out_bits - 1)), (1 << (out_bits - 1)) - 1
+    s1, s2 = rng.uniform(0.01, 0.05), rng.uniform(0.01, 0.05)
+    # Output scale such that the largest products map to about half the output range
+    s_out = s1 * s2 * (hi + 1) * (hi + 1) / (out_hi + 1) / rng.uniform(0.3, 0.6) * (2 if accumulate else 1)
+    out_q = quantize_multiplier(s1 * s2 / s_out)
+    off1, off2, out_off = (rng.randint(-20, 20), rng.randint(-20, 20), rng.randint(-10, 10)) if bits == 8 else (0, 0, 0)
+    x1 = [rng.randint(lo, hi) for _ in range(size)]
+    x2 = [rng.randint(lo, hi) for _ in range(size)]
+    acc_init = [rng.randint(out_lo // 2, out_hi // 2) for _ in range(size)] if accumulate else None
+    out = []
+    for k, (a, b) in enumerate(zip(x1, x2)):
+        v = requantize((a + off1) * (b + off2), *out_q) + out_off
+        if accumulate:
+            v += acc_init[k]
+        out.append(clamp(v, out_lo, out_hi))
+    config = [('INPUT1_OFFSET', off1), ('INPUT2_OFFSET', off2), ('OUTPUT_OFFSET', out_off),
+              ('OUTPUT_MULT', out_q[0]), ('OUTPUT_SHIFT', out_q[1]),
+              ('OUT_ACTIVATION_MIN', out_lo), ('OUT_ACTIVATION_MAX', out_hi)]
+    return config, x1, x2, out, acc_init
+
+
+CASES = [
+    # name,             generator,                                   input type, output type
+    ('add',             lambda r: gen_add(r, 8, 80),                 'int8_t',  'int8_t'),
+    ('add_s16',         lambda r: gen_add(r, 16, 80),                'int16_t', 'int16_t'),
+    ('mul',             lambda r: gen_mul(r, 8, 8, 80),              'int8_t',  'int8_t'),
+    ('mul_s16',         lambda r: gen_mul(r, 16, 16, 80),            'int16_t', 'int16_t'),
+    ('mul_s16_s8',      lambda r: gen_mul(r, 16, 8, 80),             'int16_t', 'int8_t'),
+    ('mul_acc_s16',     lambda r: gen_mul(r, 16, 16, 80, True),      'int16_t', 'int16_t'),
+]
+
+
+def generate(out_root, seed, name, gen, in_type, out_type):
+    rng = random.Random(seed)
+    config, x1, x2, out, acc_init = gen(rng)
+    config = [('DST_SIZE', len(out))] + config
+
+    out_dir = os.path.join(out_root, name)
+    os.makedirs(out_dir, exist_ok=True)
+    banner = '// Generated by generate_elementwise_test_data.py (seed %d).\n' % seed
+    N = name.upper() + '_'
+    files = {
+        'config_data.h': ''.join('#define %s%s %d\n' % (N, k, v) for k, v in config),
+        'input1_data.h': c_array(in_type, name + '_input1', x1),
+        'input2_data.h': c_array(in_type, name + '_input2', x2),
+        'output_ref_data.h': c_array(out_type, name + '_output_ref', out),
+    }
+    if acc_init is not None:
+        files['output_init_data.h'] = c_array(out_type, name + '_output_init', acc_init)
+    for fname, body in files.items():
+        with open(os.path.join(out_dir, fname), 'w') as f:
+            f.write(banner + '#pragma once\n')
+            if fname != 'config_data.h':
+                f.write('#include <stdint.h>\n\n')
+            f.write(body)
+
+    with open(os.path.join(out_dir, 'test_data.h'), 'w') as f:
+        f.write(banner)
+        for fname in sorted(files):
+            f.write('#include "../../TestData/%s/%s"\n' % (name, fname))
+
+    print('[*] %s: %d elements' % (name, len(out)))
+
+
+def main():
+    out_root = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), '..', 'TestData')
+    for seed, (name, gen, in_type, out_type) in enumerate(CASES, start=1):
+        generate(out_root, seed, name, gen, in_type, out_type)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,317 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "core_cm4.h"
+#include "kws_mfcc.h"
+
+/*
+ * MFCC front end for the DS-CNN KWS network, on top of arm_mfcc_f32/q15/q31.
+ *
+ * Each 40 ms frame (640 samples) is zero-padded to a 1024-point FFT. The Hann window covers
+ * the 640 real samples and is zero over the padding. The 40 triangular mel filters span
+ * 20-4000 Hz and are packed as CMSIS-DSP expects: start bin, length and the non-zero weights.
+ * The DCT keeps the first 10 coefficients. Tables are built in float once and converted to
+ * q15/q31, so all three formats run the same front end.
+ */
+
+// Defined in kws_medium.c
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+void fill_stack_pattern_to_sp(void);
+uint32_t measure_stack_usage(void);
+
+static float32_t hz_to_mel(float32_t hz) {
+    return 1127.0f * logf(1.0f + hz / 700.0f);
+}
+
+// Triangle n of the filter bank at mel value mel
+static float32_t mel_weight(const float32_t *mel_points, int n, float32_t mel) {
+    const float32_t upper = (mel - mel_points[n]) / (mel_points[n + 1] - mel_points[n]);
+    const float32_t lower = (mel_points[n + 2] - mel) / (mel_points[n + 2] - mel_points[n + 1]);
+    const float32_t w = upper < lower ? upper : lower;
+    return w > 0.0f ? w : 0.0f;
+}
+
+arm_status kws_mfcc_init(kws_mfcc *m) {
+    const int num_bins = KWS_FFT_LEN / 2 + 1;
+    float32_t mel_points[KWS_NUM_MEL + 2];
+    const float32_t mel_low = hz_to_mel(KWS_MEL_LOW_HZ);
+    const float32_t mel_high = hz_to_mel(KWS_MEL_HIGH_HZ);
+
+    memset(m, 0, sizeof(*m));
+    for (int i = 0; i < KWS_NUM_MEL + 2; i++) {
+        mel_points[i] = mel_low + (mel_high - mel_low) * i / (KWS_NUM_MEL + 1);
+    }
+
+    // First pass sizes the packed filter bank
+    for (int n = 0; n < KWS_NUM_MEL; n++) {
+        m->filter_pos[n] = 0;
+        m->filter_len[n] = 0;
+        for (int k = 0; k < num_bins; k++) {
+            const float32_t mel = hz_to_mel((float32_t)k * KWS_SAMPLE_RATE / KWS_FFT_LEN);
+            if (mel_weight(mel_points, n, mel) != 0.0f) {
+                if (m->filter_len[n] == 0) {
+                    m->filter_pos[n] = k;
+                }
+                m->filter_len[n]++;
+            }
+        }
+        m->num_filter_coefs += m->filter_len[n];
+    }
+
+    m->window_f32 = malloc(KWS_FFT_LEN * sizeof(float32_t));
+    m->filter_f32 = malloc(m->num_filter_coefs * sizeof(float32_t));
+    m->dct_f32 = malloc(KWS_NUM_MFCC * KWS_NUM_MEL * sizeof(float32_t));
+    m->window_q15 = malloc(KWS_FFT_LEN * sizeof(q15_t));
+    m->filter_q15 = malloc(m->num_filter_coefs * sizeof(q15_t));
+    m->dct_q15 = malloc(KWS_NUM_MFCC * KWS_NUM_MEL * sizeof(q15_t));
+    m->window_q31 = malloc(KWS_FFT_LEN * sizeof(q31_t));
+    m->filter_q31 = malloc(m->num_filter_coefs * sizeof(q31_t));
+    m->dct_q31 = malloc(KWS_NUM_MFCC * KWS_NUM_MEL * sizeof(q31_t));
+
+    if (!m->window_f32 || !m->filter_f32 || !m->dct_f32 || !m->window_q15 || !m->filter_q15 ||
+        !m->dct_q15 || !m->window_q31 || !m->filter_q31 || !m->dct_q31) {
+        kws_mfcc_free(m);
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    // Hann window over the real samples, zero over the padding
+    for (int i = 0; i < KWS_FFT_LEN; i++) {
+        m->window_f32[i] = i < KWS_FRAME_LEN ? 0.5f - 0.5f * cosf(2.0f * PI * i / KWS_FRAME_LEN) : 0.0f;
+    }
+
+    float32_t *coef = m->filter_f32;
+    for (int n = 0; n < KWS_NUM_MEL; n++) {
+        for (uint32_t k = m->filter_pos[n]; k < m->filter_pos[n] + m->filter_len[n]; k++) {
+            *coef++ = mel_weight(mel_points, n, hz_to_mel((float32_t)k * KWS_SAMPLE_RATE / KWS_FFT_LEN));
+        }
+    }
+
+    // Orthonormal DCT-II rows
+    for (int i = 0; i < KWS_NUM_MFCC; i++) {
+        for (int j = 0; j < KWS_NUM_MEL; j++) {
+            m->dct_f32[i * KWS_NUM_MEL + j] =
+                cosf(PI * i * (j + 0.5f) / KWS_NUM_MEL) * sqrtf(2.0f / KWS_NUM_MEL);
+        }
+    }
+
+    arm_float_to_q15(m->window_f32, m->window_q15, KWS_FFT_LEN);
+    arm_float_to_q15(m->filter_f32, m->filter_q15, m->num_filter_coefs);
+    arm_float_to_q15(m->dct_f32, m->dct_q15, KWS_NUM_MFCC * KWS_NUM_MEL);
+    arm_float_to_q31(m->window_f32, m->window_q31, KWS_FFT_LEN);
+    arm_float_to_q31(m->filter_f32, m->filter_q31, m->num_filter_coefs);
+    arm_float_to_q31(m->dct_f32, m->dct_q31, KWS_NUM_MFCC * KWS_NUM_MEL);
+
+    // Size-specific init only links the 1024-point FFT tables
+    arm_status status = arm_mfcc_init_1024_f32(&m->f32, KWS_NUM_MEL, KWS_NUM_MFCC, m->dct_f32,
+                                               m->filter_pos, m->filter_len, m->filter_f32, m->window_f32);
+    if (status == ARM_MATH_SUCCESS) {
+        status = arm_mfcc_init_1024_q15(&m->q15, KWS_NUM_MEL, KWS_NUM_MFCC, m->dct_q15,
+                                        m->filter_pos, m->filter_len, m->filter_q15, m->window_q15);
+    }
+    if (status == ARM_MATH_SUCCESS) {
+        status = arm_mfcc_init_1024_q31(&m->q31, KWS_NUM_MEL, KWS_NUM_MFCC, m->dct_q31,
+                                        m->filter_pos, m->filter_len, m->filter_q31, m->window_q31);
+    }
+    if (status != ARM_MATH_SUCCESS) {
+        kws_mfcc_free(m);
+    }
+    return status;
+}
+
+void kws_mfcc_free(kws_mfcc *m) {
+    free(m->window_f32);
+    free(m->filter_f32);
+    free(m->dct_f32);
+    free(m->window_q15);
+    free(m->filter_q15);
+    free(m->dct_q15);
+    free(m->window_q31);
+    free(m->filter_q31);
+    free(m->dct_q31);
+    memset(m, 0, sizeof(*m));
+}
+
+uint32_t kws_mfcc_table_bytes(const kws_mfcc *m) {
+    const uint32_t words = KWS_FFT_LEN + m->num_filter_coefs + KWS_NUM_MFCC * KWS_NUM_MEL;
+    return words * (sizeof(float32_t) + sizeof(q15_t) + sizeof(q31_t)) + sizeof(m->filter_pos) +
+           sizeof(m->filter_len);
+}
+
+static int8_t saturate_s8(int32_t v) {
+    return (int8_t)(v > 127 ? 127 : (v < -128 ? -128 : v));
+}
+
+void kws_mfcc_frame_f32(const kws_mfcc *m, const int16_t *pcm, int8_t *features, uint32_t *scratch) {
+    float32_t *frame = (float32_t *)scratch;
+    float32_t *tmp = frame + KWS_FFT_LEN;
+    float32_t mfcc[KWS_NUM_MFCC];
+
+    arm_q15_to_float(pcm, frame, KWS_FRAME_LEN);
+    memset(frame + KWS_FRAME_LEN, 0, (KWS_FFT_LEN - KWS_FRAME_LEN) * sizeof(float32_t));
+    arm_mfcc_f32(&m->f32, frame, mfcc, tmp);
+
+    for (int i = 0; i < KWS_NUM_MFCC; i++) {
+        features[i] = saturate_s8((int32_t)lrintf(mfcc[i] * (1 << KWS_MFCC_FRAC_BITS)));
+    }
+}
+
+arm_status kws_mfcc_frame_q15(const kws_mfcc *m, const int16_t *pcm, int8_t *features, uint32_t *scratch) {
+    q15_t *frame = (q15_t *)scratch;
+    q31_t *tmp = (q31_t *)scratch + KWS_FFT_LEN;
+    q15_t mfcc[KWS_NUM_MFCC];
+    // arm_mfcc_q15 output is Q8.7
+    const int shift = 7 - KWS_MFCC_FRAC_BITS;
+
+    memcpy(frame, pcm, KWS_FRAME_LEN * sizeof(q15_t));
+    memset(frame + KWS_FRAME_LEN, 0, (KWS_FFT_LEN - KWS_FRAME_LEN) * sizeof(q15_t));
+    arm_status status = arm_mfcc_q15(&m->q15, frame, mfcc, tmp);
+
+    for (int i = 0; i < KWS_NUM_MFCC; i++) {
+        features[i] = saturate_s8((mfcc[i] + (1 << (shift - 1))) >> shift);
+    }
+    return status;
+}
+
+arm_status kws_mfcc_frame_q31(const kws_mfcc *m, const int16_t *pcm, int8_t *features, uint32_t *scratch) {
+    q31_t *frame = (q31_t *)scratch;
+    q31_t *tmp = frame + KWS_FFT_LEN;
+    q31_t mfcc[KWS_NUM_MFCC];
+    // arm_mfcc_q31 output is Q8.23
+    const int shift = 23 - KWS_MFCC_FRAC_BITS;
+
+    arm_q15_to_q31(pcm, frame, KWS_FRAME_LEN);
+    memset(frame + KWS_FRAME_LEN, 0, (KWS_FFT_LEN - KWS_FRAME_LEN) * sizeof(q31_t));
+    arm_status status = arm_mfcc_q31(&m->q31, frame, mfcc, tmp);
+
+    for (int i = 0; i < KWS_NUM_MFCC; i++) {
+        features[i] = saturate_s8((int32_t)(((int64_t)mfcc[i] + (1 << (shift - 1))) >> shift));
+    }
+    return status;
+}
+
+// Test utterance: a 200 Hz -> 3.8 kHz chirp over the whole buffer with a slow envelope plus noise
+void kws_mfcc_test_audio(int16_t *pcm, int num_samples) {
+    const float32_t f0 = 200.0f, f1 = 3800.0f;
+    const float32_t duration = (float32_t)num_samples / KWS_SAMPLE_RATE;
+    for (int i = 0; i < num_samples; i++) {
+        const float32_t t = (float32_t)i / KWS_SAMPLE_RATE;
+        const float32_t phase = 2.0f * PI * (f0 * t + 0.5f * (f1 - f0) / duration * t * t);
+        const float32_t envelope = 0.2f + 0.6f * sinf(PI * t / duration);
+        const float32_t noise = ((rand() % 2001) - 1000) / 1000.0f * 0.02f;
+        pcm[i] = (int16_t)(32767.0f * (envelope * sinf(phase) * 0.9f + noise));
+    }
+}
+
+typedef enum {
+    KWS_MFCC_F32,
+    KWS_MFCC_Q15,
+    KWS_MFCC_Q31
+} kws_mfcc_format;
+
+static const char *const kws_mfcc_names[] = {"arm_mfcc_f32", "arm_mfcc_q15", "arm_mfcc_q31"};
+
+static void run_kws_mfcc(const kws_mfcc *m, kws_mfcc_format format, const int16_t *pcm, int8_t *features,
+                         const int8_t *features_ref, uint32_t *scratch, uint32_t network_cycles) {
+    uint32_t total_cycles = 0;
+    uint32_t max_frame_cycles = 0;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    fill_stack_pattern_to_sp();
+    for (int f = 0; f < KWS_NUM_FRAMES; f++) {
+        const int16_t *frame_pcm = pcm + f * KWS_FRAME_STRIDE;
+        int8_t *frame_features = features + f * KWS_NUM_MFCC;
+
+        enable_cycle_counter();
+        uint32_t start_cycles = read_cycle_counter();
+        arm_status frame_status = ARM_MATH_SUCCESS;
+        switch (format) {
+        case KWS_MFCC_F32:
+            kws_mfcc_frame_f32(m, frame_pcm, frame_features, scratch);
+            break;
+        case KWS_MFCC_Q15:
+            frame_status = kws_mfcc_frame_q15(m, frame_pcm, frame_features, scratch);
+            break;
+        default:
+            frame_status = kws_mfcc_frame_q31(m, frame_pcm, frame_features, scratch);
+            break;
+        }
+        uint32_t cycle_count = read_cycle_counter() - start_cycles;
+
+        if (frame_status != ARM_MATH_SUCCESS) {
+            status = frame_status;
+        }
+
+        total_cycles += cycle_count;
+        if (cycle_count > max_frame_cycles) {
+            max_frame_cycles = cycle_count;
+        }
+    }
+    uint32_t stack_used = measure_stack_usage();
+
+    printf("%s\n\r", kws_mfcc_names[format]);
+    if (status != ARM_MATH_SUCCESS) {
+        printf("Status: %d (overflow in fixed-point MFCC)\n\r", (int)status);
+    }
+    printf("Cycle Count per Frame: %lu (max %lu)\n\r",
+           (unsigned long)(total_cycles / KWS_NUM_FRAMES), (unsigned long)max_frame_cycles);
+    printf("Cycle Count per %d-frame Window: %lu\n\r", KWS_NUM_FRAMES, (unsigned long)total_cycles);
+    printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+    if (network_cycles) {
+        printf("Front End vs Network: %.1f%% of the network cycles\n\r",
+               100.0f * total_cycles / network_cycles);
+    }
+
+    if (features_ref) {
+        int mismatches = 0;
+        int max_diff = 0;
+        for (int i = 0; i < KWS_NUM_FEATURES; i++) {
+            const int diff = abs(features[i] - features_ref[i]);
+            mismatches += diff != 0;
+            max_diff = diff > max_diff ? diff : max_diff;
+        }
+        printf("Features vs arm_mfcc_f32: %d of %d differ, max difference %d LSB\n\r",
+               mismatches, KWS_NUM_FEATURES, max_diff);
+    }
+    printf("\n\r");
+}
+
+void frontend_arm_mfcc(uint32_t network_cycles) {
+    kws_mfcc *m = malloc(sizeof(kws_mfcc));
+    int16_t *pcm = malloc(KWS_NUM_SAMPLES * sizeof(int16_t));
+    uint32_t *scratch = malloc(KWS_MFCC_SCRATCH_WORDS * sizeof(uint32_t));
+    int8_t *features_f32 = malloc(KWS_NUM_FEATURES);
+    int8_t *features = malloc(KWS_NUM_FEATURES);
+
+    if (!m || !pcm || !scratch || !features_f32 || !features || kws_mfcc_init(m) != ARM_MATH_SUCCESS) {
+        printf("Failed to set up the MFCC front end\n\r");
+        free(m);
+        free(pcm);
+        free(scratch);
+        free(features_f32);
+        free(features);
+        return;
+    }
+
+    kws_mfcc_test_audio(pcm, KWS_NUM_SAMPLES);
+
+    printf("%d frames of %d samples (FFT %d), %d mel filters, %d MFCCs -> %dx%d int8 features\n\r",
+           KWS_NUM_FRAMES, KWS_FRAME_LEN, KWS_FFT_LEN, KWS_NUM_MEL, KWS_NUM_MFCC, KWS_NUM_FRAMES, KWS_NUM_MFCC);
+    printf("Table Size (f32 + q15 + q31): %lu bytes, Scratch: %lu bytes\n\r\n",
+           (unsigned long)kws_mfcc_table_bytes(m), (unsigned long)(KWS_MFCC_SCRATCH_WORDS * sizeof(uint32_t)));
+
+    run_kws_mfcc(m, KWS_MFCC_F32, pcm, features_f32, NULL, scratch, network_cycles);
+    run_kws_mfcc(m, KWS_MFCC_Q15, pcm, features, features_f32, scratch, network_cycles);
+    run_kws_mfcc(m, KWS_MFCC_Q31, pcm, features, features_f32, scratch, network_cycles);
+
+    kws_mfcc_free(m);
+    free(m);
+    free(pcm);
+    free(scratch);
+    free(features_f32);
+    free(features);
+}
@@ -0,0 +1,462 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <arm_nnfunctions.h>
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "core_cm4.h"
+#include "kws_stream.h"
+
+/*
+ * Streaming DS-CNN Small: consecutive 49-frame windows share all but one feature frame, so
+ * each layer keeps its recent output rows (time is the H axis) and computes one new row per
+ * hop instead of the whole window.
+ *
+ * The network follows DS-CNN Small (10x4 stride-2 first layer with 64 channels, four 3x3
+ * depthwise + 1x1 pointwise blocks, average pool, 12-way fully connected), with no padding
+ * along time so that a row only depends on the frames under it and can be cached. Along
+ * frequency the padding is unchanged.
+ *
+ * The stride-2 first layer puts even and odd windows on two different row grids, so the
+ * cache is kept per phase. A new frame completes one first-layer row, which belongs to one
+ * phase; that phase's pipeline advances by one row per layer. The last frame of a window is
+ * not under any first-layer row ((49 - 10) is odd), so the result for the window ending at
+ * frame e is complete one hop early, when frame e - 1 arrives.
+ *
+ * Dropping the time padding makes this a modified network (20 first-layer rows instead of
+ * 25), so its full-window count is reported as the valid-padding variant, next to the layer
+ * total of the unmodified SAME-padded baseline measured by kws_small.c.
+ *
+ * DS-CNN Medium is not streamed yet: its stride-2 3x3 depthwise layer splits each phase
+ * again, which this cache layout does not handle.
+ */
+
+// Defined in kws_small.c
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+void fill_stack_pattern_to_sp(void);
+uint32_t measure_stack_usage(void);
+
+#define DSCNN_CH            64
+#define DSCNN_BLOCKS        4
+#define DSCNN_CLASSES       12
+#define DSCNN_CONV1_KH      10
+#define DSCNN_CONV1_KW      4
+#define DSCNN_W             5       // 10 MFCCs, stride 2, one column of padding
+#define DSCNN_ROW           (DSCNN_W * DSCNN_CH)
+#define DSCNN_CONV1_ROWS    ((KWS_NUM_FRAMES - DSCNN_CONV1_KH) / 2 + 1)
+#define DSCNN_POOL_ROWS     (DSCNN_CONV1_ROWS - 2 * DSCNN_BLOCKS)
+#define DSCNN_PHASES        2
+
+// Hops timed after the first full window
+#define DSCNN_STREAM_HOPS   25
+#define DSCNN_STREAM_SAMPLES (KWS_NUM_SAMPLES + DSCNN_STREAM_HOPS * KWS_FRAME_STRIDE)
+
+typedef struct {
+    int8_t conv1_w[DSCNN_CONV1_KH * DSCNN_CONV1_KW * DSCNN_CH];
+    int32_t conv1_b[DSCNN_CH];
+    int8_t dw_w[DSCNN_BLOCKS][3 * 3 * DSCNN_CH];
+    int32_t dw_b[DSCNN_BLOCKS][DSCNN_CH];
+    int8_t pw_w[DSCNN_BLOCKS][DSCNN_CH * DSCNN_CH];
+    int32_t pw_b[DSCNN_BLOCKS][DSCNN_CH];
+    int8_t fc_w[DSCNN_CLASSES * DSCNN_CH];
+    int32_t fc_b[DSCNN_CLASSES];
+    int32_t mult[DSCNN_CH];
+    int32_t conv1_shift[DSCNN_CH];
+    int32_t dw_shift[DSCNN_CH];
+    int32_t pw_shift[DSCNN_CH];
+    cmsis_nn_context ctx;
+} dscnn_model;
+
+// Rows stored twice, back to back, so the newest n rows are always contiguous
+typedef struct {
+    int8_t *buf;
+    int32_t capacity;
+    int32_t next;
+    int32_t count;
+} row_ring;
+
+typedef struct {
+    row_ring ring[DSCNN_BLOCKS + 1];    // first layer output, then the output of each block
+    int8_t logits[DSCNN_CLASSES];
+    int32_t ready;
+} dscnn_phase;
+
+typedef struct {
+    dscnn_phase phase[DSCNN_PHASES];
+    int8_t dw_row[DSCNN_ROW];
+    uint32_t frames;
+} dscnn_stream;
+
+static int8_t *ring_slot(row_ring *r) {
+    return r->buf + r->next * DSCNN_ROW;
+}
+
+static void ring_commit(row_ring *r) {
+    memcpy(r->buf + (r->next + r->capacity) * DSCNN_ROW, r->buf + r->next * DSCNN_ROW, DSCNN_ROW);
+    r->next = (r->next + 1) % r->capacity;
+    r->count++;
+}
+
+static const int8_t *ring_last(const row_ring *r, int32_t n) {
+    return r->buf + ((r->next - n + r->capacity) % r->capacity) * DSCNN_ROW;
+}
+
+static void fill_random_s8(int8_t *dst, int32_t size) {
+    for (int32_t i = 0; i < size; i++) {
+        dst[i] = (rand() % 255) - 128;
+    }
+}
+
+static void fill_random_bias(int32_t *dst, int32_t size) {
+    for (int32_t i = 0; i < size; i++) {
+        dst[i] = (rand() % 2048) - 1024;
+    }
+}
+
+static void set_dims(cmsis_nn_dims *d, int32_t n, int32_t h, int32_t w, int32_t c) {
+    d->n = n;
+    d->h = h;
+    d->w = w;
+    d->c = c;
+}
+
+static void dscnn_conv1_params(cmsis_nn_dw_conv_params *p) {
+    p->stride.h = 2;
+    p->stride.w = 2;
+    p->dilation.h = 1;
+    p->dilation.w = 1;
+    p->padding.h = 0;
+    p->padding.w = 1;
+    p->ch_mult = DSCNN_CH;
+    p->input_offset = 0;
+    p->output_offset = 0;
+    p->activation.min = -128;
+    p->activation.max = 127;
+}
+
+static void dscnn_dw_params(cmsis_nn_dw_conv_params *p) {
+    dscnn_conv1_params(p);
+    p->stride.h = 1;
+    p->stride.w = 1;
+    p->ch_mult = 1;
+}
+
+static void dscnn_pw_params(cmsis_nn_conv_params *p) {
+    p->stride.h = 1;
+    p->stride.w = 1;
+    p->dilation.h = 1;
+    p->dilation.w = 1;
+    p->padding.h = 0;
+    p->padding.w = 0;
+    p->input_offset = 0;
+    p->output_offset = 0;
+    p->activation.min = -128;
+    p->activation.max = 127;
+}
+
+// Scratch for the largest call, full window or single row
+static int32_t dscnn_buffer_size(void) {
+    cmsis_nn_dw_conv_params dw_params;
+    cmsis_nn_conv_params pw_params;
+    cmsis_nn_dims input_dims, filter_dims, output_dims;
+    int32_t size = 0;
+    int32_t s;
+
+    for (int32_t rows = 1; rows <= DSCNN_CONV1_ROWS; rows += DSCNN_CONV1_ROWS - 1) {
+        dscnn_conv1_params(&dw_params);
+        set_dims(&input_dims, 1, 2 * (rows - 1) + DSCNN_CONV1_KH, KWS_NUM_MFCC, 1);
+        set_dims(&filter_dims, 1, DSCNN_CONV1_KH, DSCNN_CONV1_KW, DSCNN_CH);
+        set_dims(&output_dims, 1, rows, DSCNN_W, DSCNN_CH);
+        s = arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_params, &input_dims, &filter_dims, &output_dims);
+        size = s > size ? s : size;
+
+        dscnn_dw_params(&dw_params);
+        set_dims(&input_dims, 1, rows + 2, DSCNN_W, DSCNN_CH);
+        set_dims(&filter_dims, 1, 3, 3, DSCNN_CH);
+        s = arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_params, &input_dims, &filter_dims, &output_dims);
+        size = s > size ? s : size;
+
+        dscnn_pw_params(&pw_params);
+        set_dims(&input_dims, 1, rows, DSCNN_W, DSCNN_CH);
+        set_dims(&filter_dims, DSCNN_CH, 1, 1, DSCNN_CH);
+        s = arm_convolve_wrapper_s8_get_buffer_size(&pw_params, &input_dims, &filter_dims, &output_dims);
+        size = s > size ? s : size;
+    }
+
+    s = arm_avgpool_s8_get_buffer_size(1, DSCNN_CH);
+    size = s > size ? s : size;
+    set_dims(&filter_dims, DSCNN_CH, 1, 1, DSCNN_CLASSES);
+    s = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+    return s > size ? s : size;
+}
+
+static int dscnn_model_init(dscnn_model *m) {
+    fill_random_s8(m->conv1_w, sizeof(m->conv1_w));
+    fill_random_bias(m->conv1_b, DSCNN_CH);
+    for (int b = 0; b < DSCNN_BLOCKS; b++) {
+        fill_random_s8(m->dw_w[b], sizeof(m->dw_w[b]));
+        fill_random_bias(m->dw_b[b], DSCNN_CH);
+        fill_random_s8(m->pw_w[b], sizeof(m->pw_w[b]));
+        fill_random_bias(m->pw_b[b], DSCNN_CH);
+    }
+    fill_random_s8(m->fc_w, sizeof(m->fc_w));
+    fill_random_bias(m->fc_b, DSCNN_CLASSES);
+
+    // 0.5 * 2^shift, sized to the number of taps so activations stay in range
+    for (int i = 0; i < DSCNN_CH; i++) {
+        m->mult[i] = 0x40000000;
+        m->conv1_shift[i] = -6;
+        m->dw_shift[i] = -7;
+        m->pw_shift[i] = -9;
+    }
+
+    m->ctx.size = dscnn_buffer_size();
+    m->ctx.buf = m->ctx.size > 0 ? malloc(m->ctx.size) : NULL;
+    return m->ctx.size == 0 || m->ctx.buf != NULL;
+}
+
+// First layer over 2 * (rows - 1) + 10 feature frames
+static void dscnn_conv1(dscnn_model *m, const int8_t *features, int32_t rows, int8_t *output) {
+    cmsis_nn_dw_conv_params dw_params;
+    cmsis_nn_per_channel_quant_params quant_params = {m->mult, m->conv1_shift};
+    cmsis_nn_dims input_dims, filter_dims, bias_dims = {0}, output_dims;
+
+    dscnn_conv1_params(&dw_params);
+    set_dims(&input_dims, 1, 2 * (rows - 1) + DSCNN_CONV1_KH, KWS_NUM_MFCC, 1);
+    set_dims(&filter_dims, 1, DSCNN_CONV1_KH, DSCNN_CONV1_KW, DSCNN_CH);
+    set_dims(&output_dims, 1, rows, DSCNN_W, DSCNN_CH);
+    arm_depthwise_conv_wrapper_s8(&m->ctx, &dw_params, &quant_params, &input_dims, features, &filter_dims,
+                                  m->conv1_w, &bias_dims, m->conv1_b, &output_dims, output);
+}
+
+// 3x3 depthwise over rows + 2 input rows
+static void dscnn_dw(dscnn_model *m, int b, const int8_t *input, int32_t rows, int8_t *output) {
+    cmsis_nn_dw_conv_params dw_params;
+    cmsis_nn_per_channel_quant_params quant_params = {m->mult, m->dw_shift};
+    cmsis_nn_dims input_dims, filter_dims, bias_dims = {0}, output_dims;
+
+    dscnn_dw_params(&dw_params);
+    set_dims(&input_dims, 1, rows + 2, DSCNN_W, DSCNN_CH);
+    set_dims(&filter_dims, 1, 3, 3, DSCNN_CH);
+    set_dims(&output_dims, 1, rows, DSCNN_W, DSCNN_CH);
+    arm_depthwise_conv_wrapper_s8(&m->ctx, &dw_params, &quant_params, &input_dims, input, &filter_dims,
+                                  m->dw_w[b], &bias_dims, m->dw_b[b], &output_dims, output);
+}
+
+static void dscnn_pw(dscnn_model *m, int b, const int8_t *input, int32_t rows, int8_t *output) {
+    cmsis_nn_conv_params pw_params;
+    cmsis_nn_per_channel_quant_params quant_params = {m->mult, m->pw_shift};
+    cmsis_nn_dims input_dims, filter_dims, bias_dims = {0}, output_dims;
+
+    dscnn_pw_params(&pw_params);
+    set_dims(&input_dims, 1, rows, DSCNN_W, DSCNN_CH);
+    set_dims(&filter_dims, DSCNN_CH, 1, 1, DSCNN_CH);
+    set_dims(&output_dims, 1, rows, DSCNN_W, DSCNN_CH);
+    arm_convolve_wrapper_s8(&m->ctx, &pw_params, &quant_params, &input_dims, input, &filter_dims,
+                            m->pw_w[b], &bias_dims, m->pw_b[b], &output_dims, output);
+}
+
+// Average pool over the last DSCNN_POOL_ROWS rows, then the classifier
+static void dscnn_head(dscnn_model *m, const int8_t *input, int8_t *logits) {
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_fc_params fc_params;
+    cmsis_nn_per_tensor_quant_params fc_quant = {0x40000000, -9};
+    cmsis_nn_dims input_dims, filter_dims, bias_dims = {0}, output_dims;
+    int8_t pooled[DSCNN_CH];
+
+    pool_params.stride.h = DSCNN_POOL_ROWS;
+    pool_params.stride.w = DSCNN_W;
+    pool_params.padding.h = 0;
+    pool_params.padding.w = 0;
+    pool_params.activation.min = -128;
+    pool_params.activation.max = 127;
+    set_dims(&input_dims, 1, DSCNN_POOL_ROWS, DSCNN_W, DSCNN_CH);
+    set_dims(&filter_dims, 1, DSCNN_POOL_ROWS, DSCNN_W, 1);
+    set_dims(&output_dims, 1, 1, 1, DSCNN_CH);
+    arm_avgpool_s8(&m->ctx, &pool_params, &input_dims, input, &filter_dims, &output_dims, pooled);
+
+    fc_params.input_offset = 0;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = 0;
+    fc_params.activation.min = -128;
+    fc_params.activation.max = 127;
+    set_dims(&input_dims, 1, 1, 1, DSCNN_CH);
+    set_dims(&filter_dims, DSCNN_CH, 1, 1, DSCNN_CLASSES);
+    set_dims(&output_dims, 1, 1, 1, DSCNN_CLASSES);
+    arm_fully_connected_s8(&m->ctx, &fc_params, &fc_quant, &input_dims, pooled, &filter_dims, m->fc_w,
+                           &bias_dims, m->fc_b, &output_dims, logits);
+}
+
+// Whole window; the last block output is left in buf_a
+static void dscnn_full(dscnn_model *m, const int8_t *features, int8_t *buf_a, int8_t *buf_b, int8_t *logits) {
+    int32_t rows = DSCNN_CONV1_ROWS;
+
+    dscnn_conv1(m, features, rows, buf_a);
+    for (int b = 0; b < DSCNN_BLOCKS; b++) {
+        rows -= 2;
+        dscnn_dw(m, b, buf_a, rows, buf_b);
+        dscnn_pw(m, b, buf_b, rows, buf_a);
+    }
+    dscnn_head(m, buf_a, logits);
+}
+
+static int dscnn_stream_init(dscnn_stream *s) {
+    memset(s, 0, sizeof(*s));
+    for (int p = 0; p < DSCNN_PHASES; p++) {
+        for (int l = 0; l <= DSCNN_BLOCKS; l++) {
+            row_ring *r = &s->phase[p].ring[l];
+            r->capacity = l < DSCNN_BLOCKS ? 3 : DSCNN_POOL_ROWS;
+            r->buf = malloc(2 * r->capacity * DSCNN_ROW);
+            if (!r->buf) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static void dscnn_stream_free(dscnn_stream *s) {
+    for (int p = 0; p < DSCNN_PHASES; p++) {
+        for (int l = 0; l <= DSCNN_BLOCKS; l++) {
+            free(s->phase[p].ring[l].buf);
+        }
+    }
+}
+
+// Called once per new feature frame with the current 49-frame window, newest frame last
+static void dscnn_stream_step(dscnn_model *m, dscnn_stream *s, const int8_t *window) {
+    dscnn_phase *ph = &s->phase[s->frames & 1];
+    s->frames++;
+
+    // The newest 10 frames complete one first-layer row of this phase
+    dscnn_conv1(m, window + (KWS_NUM_FRAMES - DSCNN_CONV1_KH) * KWS_NUM_MFCC, 1, ring_slot(&ph->ring[0]));
+    ring_commit(&ph->ring[0]);
+
+    for (int b = 0; b < DSCNN_BLOCKS; b++) {
+        if (ph->ring[b].count < 3) {
+            return;
+        }
+        dscnn_dw(m, b, ring_last(&ph->ring[b], 3), 1, s->dw_row);
+        dscnn_pw(m, b, s->dw_row, 1, ring_slot(&ph->ring[b + 1]));
+        ring_commit(&ph->ring[b + 1]);
+    }
+
+    if (ph->ring[DSCNN_BLOCKS].count >= DSCNN_POOL_ROWS) {
+        dscnn_head(m, ring_last(&ph->ring[DSCNN_BLOCKS], DSCNN_POOL_ROWS), ph->logits);
+        ph->ready = 1;
+    }
+}
+
+void streaming_arm_dscnn_s8(uint32_t baseline_cycles) {
+    kws_mfcc *tables = malloc(sizeof(kws_mfcc));
+    kws_stream *features = malloc(sizeof(kws_stream));
+    dscnn_model *m = malloc(sizeof(dscnn_model));
+    dscnn_stream *s = malloc(sizeof(dscnn_stream));
+    int16_t *pcm = malloc(DSCNN_STREAM_SAMPLES * sizeof(int16_t));
+    int8_t *buf_a = malloc(DSCNN_CONV1_ROWS * DSCNN_ROW);
+    int8_t *buf_b = malloc(DSCNN_CONV1_ROWS * DSCNN_ROW);
+    int8_t logits[DSCNN_CLASSES];
+
+    if (!tables || !features || !m || !s || !pcm || !buf_a || !buf_b) {
+        printf("Failed to allocate streaming DS-CNN buffers\n\r");
+        free(tables);
+        free(features);
+        free(m);
+        free(s);
+        free(pcm);
+        free(buf_a);
+        free(buf_b);
+        return;
+    }
+    memset(m, 0, sizeof(*m));
+    memset(s, 0, sizeof(*s));
+    if (kws_mfcc_init(tables) != ARM_MATH_SUCCESS || kws_stream_init(features, tables) != ARM_MATH_SUCCESS ||
+        !dscnn_model_init(m) || !dscnn_stream_init(s)) {
+        printf("Failed to set up the streaming DS-CNN\n\r");
+        goto cleanup;
+    }
+    kws_mfcc_test_audio(pcm, DSCNN_STREAM_SAMPLES);
+
+    // First window, untimed
+    const int prime_hops = KWS_NUM_FRAMES + 1;
+    for (int h = 0; h < prime_hops; h++) {
+        kws_stream_push(features, pcm + h * KWS_FRAME_STRIDE);
+        dscnn_stream_step(m, s, kws_stream_features(features));
+    }
+
+    // Steady state: front end and network per hop
+    uint32_t frontend_cycles = 0;
+    uint32_t network_cycles = 0;
+    uint32_t max_network_cycles = 0;
+    fill_stack_pattern_to_sp();
+    for (int h = prime_hops; h < prime_hops + DSCNN_STREAM_HOPS - 1; h++) {
+        enable_cycle_counter();
+        uint32_t start_cycles = read_cycle_counter();
+        kws_stream_push(features, pcm + h * KWS_FRAME_STRIDE);
+        uint32_t mid_cycles = read_cycle_counter();
+        dscnn_stream_step(m, s, kws_stream_features(features));
+        uint32_t end_cycles = read_cycle_counter();
+
+        frontend_cycles += mid_cycles - start_cycles;
+        network_cycles += end_cycles - mid_cycles;
+        if (end_cycles - mid_cycles > max_network_cycles) {
+            max_network_cycles = end_cycles - mid_cycles;
+        }
+    }
+    uint32_t stack_used = measure_stack_usage();
+    frontend_cycles /= DSCNN_STREAM_HOPS - 1;
+    network_cycles /= DSCNN_STREAM_HOPS - 1;
+
+    // Full recomputation of the current window
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+    dscnn_full(m, kws_stream_features(features), buf_a, buf_b, logits);
+    uint32_t full_cycles = read_cycle_counter() - start_cycles;
+
+    // The current window was completed by the previous hop, in the other phase
+    const dscnn_phase *ph = &s->phase[s->frames & 1];
+    const int passed = ph->ready && memcmp(ph->logits, logits, DSCNN_CLASSES) == 0 &&
+                       memcmp(ring_last(&ph->ring[DSCNN_BLOCKS], DSCNN_POOL_ROWS), buf_a,
+                              DSCNN_POOL_ROWS * DSCNN_ROW) == 0;
+
+    uint32_t state_bytes = sizeof(dscnn_stream);
+    for (int p = 0; p < DSCNN_PHASES; p++) {
+        for (int l = 0; l <= DSCNN_BLOCKS; l++) {
+            state_bytes += 2 * s->phase[p].ring[l].capacity * DSCNN_ROW;
+        }
+    }
+
+    printf("\n\r");
+    if (passed) {
+        printf("Streaming DS-CNN output validation PASSED (last block and logits bit-exact)\n\r");
+    } else {
+        printf("Streaming DS-CNN output validation FAILED\n\r");
+    }
+    printf("Network Cycle Count per Hop (streaming): %lu (max %lu)\n\r",
+           (unsigned long)network_cycles, (unsigned long)max_network_cycles);
+    printf("Network Cycle Count (full window, valid time padding): %lu (%.1fx)\n\r",
+           (unsigned long)full_cycles, (float)full_cycles / network_cycles);
+    printf("Network Cycle Count (baseline, SAME padding): %lu (%.1fx)\n\r",
+           (unsigned long)baseline_cycles, (float)baseline_cycles / network_cycles);
+    printf("Rows per Hop: 1 per layer (full window: %d first layer, %d after the last block)\n\r",
+           DSCNN_CONV1_ROWS, DSCNN_POOL_ROWS);
+    printf("Front End + Network per Hop: %lu cycles\n\r", (unsigned long)(frontend_cycles + network_cycles));
+    printf("Stack Used: %lu bytes, Activation Cache: %lu bytes, Scratch: %lu bytes\n\r",
+           (unsigned long)stack_used, (unsigned long)state_bytes, (unsigned long)m->ctx.size);
+
+cleanup:
+    dscnn_stream_free(s);
+    if (m->ctx.buf) {
+        free(m->ctx.buf);
+    }
+    kws_mfcc_free(tables);
+    free(tables);
+    free(features);
+    free(m);
+    free(s);
+    free(pcm);
+    free(buf_a);
+    free(buf_b);
+}
@@ -0,0 +1,56 @@
+#ifndef KWS_MFCC_H_
+#define KWS_MFCC_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+
+// DS-CNN front end: 1 s of 16 kHz audio, 40 ms frames every 20 ms -> 49 frames x 10 MFCCs
+#define KWS_SAMPLE_RATE     16000
+#define KWS_NUM_SAMPLES     16000
+#define KWS_FRAME_LEN       640
+#define KWS_FRAME_STRIDE    320
+#define KWS_NUM_FRAMES      ((KWS_NUM_SAMPLES - KWS_FRAME_LEN) / KWS_FRAME_STRIDE + 1)
+#define KWS_FFT_LEN         1024    // frame zero-padded to the next power of two
+#define KWS_NUM_MEL         40
+#define KWS_NUM_MFCC        10
+#define KWS_MEL_LOW_HZ      20.0f
+#define KWS_MEL_HIGH_HZ     4000.0f
+#define KWS_MFCC_FRAC_BITS  1       // network input is MFCC * 2^1 in int8
+#define KWS_NUM_FEATURES    (KWS_NUM_FRAMES * KWS_NUM_MFCC)
+
+// Working memory of one frame in words: frame buffer + complex FFT buffer
+#define KWS_MFCC_SCRATCH_WORDS (3 * KWS_FFT_LEN)
+
+// Window, mel filter bank and DCT tables in each format, built once by kws_mfcc_init
+typedef struct {
+    arm_mfcc_instance_f32 f32;
+    arm_mfcc_instance_q15 q15;
+    arm_mfcc_instance_q31 q31;
+
+    uint32_t filter_pos[KWS_NUM_MEL];
+    uint32_t filter_len[KWS_NUM_MEL];
+    uint32_t num_filter_coefs;
+
+    float32_t *window_f32;
+    float32_t *filter_f32;
+    float32_t *dct_f32;
+    q15_t *window_q15;
+    q15_t *filter_q15;
+    q15_t *dct_q15;
+    q31_t *window_q31;
+    q31_t *filter_q31;
+    q31_t *dct_q31;
+} kws_mfcc;
+
+arm_status kws_mfcc_init(kws_mfcc *m);
+void kws_mfcc_free(kws_mfcc *m);
+uint32_t kws_mfcc_table_bytes(const kws_mfcc *m);
+
+// One frame of KWS_FRAME_LEN PCM samples -> KWS_NUM_MFCC int8 network inputs
+void kws_mfcc_frame_f32(const kws_mfcc *m, const int16_t *pcm, int8_t *features, uint32_t *scratch);
+arm_status kws_mfcc_frame_q15(const kws_mfcc *m, const int16_t *pcm, int8_t *features, uint32_t *scratch);
+arm_status kws_mfcc_frame_q31(const kws_mfcc *m, const int16_t *pcm, int8_t *features, uint32_t *scratch);
+
+void kws_mfcc_test_audio(int16_t *pcm, int num_samples);
+
+#endif /* KWS_MFCC_H_ */
@@ -25,19 +25,19 @@ void fill_dummy_data(int8_t *input, int8_t *weights, int32_t *biases, int32_t *o
 }
 
 // Enable DWT cycle counter
-static void enable_cycle_counter() {
+void enable_cycle_counter() {
     CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // Enable DWT
     DWT->CYCCNT = 0;                                // Reset cycle counter
     DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;            // Enable cycle counter
 }
 
 // Read DWT cycle counter
-static uint32_t read_cycle_counter() {
+uint32_t read_cycle_counter() {
     return DWT->CYCCNT;
 }
 
 // Fill stack with known pattern for usage measurement
-static void fill_stack_pattern_to_sp() {
+void fill_stack_pattern_to_sp() {
     register uint32_t *sp;
     __asm volatile ("mov %0, sp" : "=r" (sp));
 
@@ -49,7 +49,7 @@ static void fill_stack_pattern_to_sp() {
 }
 
 // Measure stack usage by identifying overwritten bytes
-static uint32_t measure_stack_usage() {
+uint32_t measure_stack_usage() {
     register uint32_t *sp;
     __asm volatile ("mov %0, sp" : "=r" (sp));
 
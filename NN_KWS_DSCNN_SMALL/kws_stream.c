@@ -0,0 +1,203 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "core_cm4.h"
+#include "kws_stream.h"
+
+/*
+ * Streaming MFCC on arm_rfft_fast_f32.
+ *
+ * A 1 s window with a 20 ms hop shares 48 of its 49 frames with the previous window, so each
+ * hop only computes the newest frame from the 320 new samples and the 320 kept from the last
+ * hop. The frame pipeline is the one of arm_mfcc_f32 with two steps dropped: the max
+ * normalization (not needed in float) and the magnitude of the upper half of the spectrum,
+ * which no mel filter reads.
+ */
+
+// Defined in kws_small.c
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+void fill_stack_pattern_to_sp(void);
+uint32_t measure_stack_usage(void);
+
+// Hops streamed after the first full window
+#define KWS_STREAM_HOPS 25
+#define KWS_STREAM_SAMPLES (KWS_NUM_SAMPLES + KWS_STREAM_HOPS * KWS_FRAME_STRIDE)
+
+// arm_mfcc_f32 normalizes the frame by its maximum and scales back after the mel filters, so
+// its float results round differently; allowed difference after int8 quantization
+#define KWS_STREAM_MAX_DIFF 1
+
+arm_status kws_stream_init(kws_stream *s, const kws_mfcc *tables) {
+    memset(s, 0, sizeof(*s));
+    s->tables = tables;
+    return arm_rfft_fast_init_1024_f32(&s->rfft);
+}
+
+void kws_stream_frame(kws_stream *s, const int16_t *pcm, int8_t *features) {
+    const kws_mfcc *t = s->tables;
+    const float32_t *coefs = t->filter_f32;
+    float32_t mel[KWS_NUM_MEL];
+    float32_t mfcc[KWS_NUM_MFCC];
+    arm_matrix_instance_f32 dct;
+
+    arm_q15_to_float(pcm, s->frame, KWS_FRAME_LEN);
+    arm_mult_f32(s->frame, t->window_f32, s->frame, KWS_FRAME_LEN);
+    memset(s->frame + KWS_FRAME_LEN, 0, (KWS_FFT_LEN - KWS_FRAME_LEN) * sizeof(float32_t));
+
+    // Packed output: spectrum[1] holds the real Nyquist bin
+    arm_rfft_fast_f32(&s->rfft, s->frame, s->spectrum, 0);
+    s->spectrum[KWS_FFT_LEN] = s->spectrum[1];
+    s->spectrum[KWS_FFT_LEN + 1] = 0.0f;
+    s->spectrum[1] = 0.0f;
+    arm_cmplx_mag_f32(s->spectrum, s->frame, KWS_FFT_LEN / 2 + 1);
+
+    for (int i = 0; i < KWS_NUM_MEL; i++) {
+        arm_dot_prod_f32(s->frame + t->filter_pos[i], coefs, t->filter_len[i], &mel[i]);
+        coefs += t->filter_len[i];
+    }
+    arm_offset_f32(mel, 1.0e-6f, mel, KWS_NUM_MEL);
+    arm_vlog_f32(mel, mel, KWS_NUM_MEL);
+
+    dct.numRows = KWS_NUM_MFCC;
+    dct.numCols = KWS_NUM_MEL;
+    dct.pData = t->dct_f32;
+    arm_mat_vec_mult_f32(&dct, mel, mfcc);
+
+    for (int i = 0; i < KWS_NUM_MFCC; i++) {
+        const int32_t v = (int32_t)lrintf(mfcc[i] * (1 << KWS_MFCC_FRAC_BITS));
+        features[i] = (int8_t)(v > 127 ? 127 : (v < -128 ? -128 : v));
+    }
+}
+
+void kws_stream_push(kws_stream *s, const int16_t *pcm) {
+    int16_t frame_pcm[KWS_FRAME_LEN];
+    int8_t *slot = &s->features[s->head * KWS_NUM_MFCC];
+
+    memcpy(frame_pcm, s->history, sizeof(s->history));
+    memcpy(frame_pcm + KWS_HISTORY_LEN, pcm, KWS_FRAME_STRIDE * sizeof(int16_t));
+    memcpy(s->history, frame_pcm + KWS_FRAME_LEN - KWS_HISTORY_LEN, sizeof(s->history));
+
+    // The oldest slot becomes the newest frame, in both copies of the ring
+    kws_stream_frame(s, frame_pcm, slot);
+    memcpy(slot + KWS_NUM_FEATURES, slot, KWS_NUM_MFCC);
+    s->head = (s->head + 1) % KWS_NUM_FRAMES;
+}
+
+void frontend_streaming_mfcc(uint32_t network_cycles) {
+    kws_mfcc *tables = malloc(sizeof(kws_mfcc));
+    kws_stream *s = malloc(sizeof(kws_stream));
+    int16_t *pcm = malloc(KWS_STREAM_SAMPLES * sizeof(int16_t));
+    uint32_t *scratch = malloc(KWS_MFCC_SCRATCH_WORDS * sizeof(uint32_t));
+    int8_t *features_full = malloc(KWS_NUM_FEATURES);
+    int8_t *features_mfcc = malloc(KWS_NUM_FEATURES);
+
+    if (!tables || !s || !pcm || !scratch || !features_full || !features_mfcc ||
+        kws_mfcc_init(tables) != ARM_MATH_SUCCESS) {
+        printf("Failed to set up the streaming front end\n\r");
+        free(tables);
+        free(s);
+        free(pcm);
+        free(scratch);
+        free(features_full);
+        free(features_mfcc);
+        return;
+    }
+    if (kws_stream_init(s, tables) != ARM_MATH_SUCCESS) {
+        printf("Failed to set up the streaming RFFT\n\r");
+        kws_mfcc_free(tables);
+        free(tables);
+        free(s);
+        free(pcm);
+        free(scratch);
+        free(features_full);
+        free(features_mfcc);
+        return;
+    }
+    kws_mfcc_test_audio(pcm, KWS_STREAM_SAMPLES);
+
+    // Fill the first window: one hop per frame plus the hop that only seeds the history
+    const int prime_hops = KWS_NUM_FRAMES + 1;
+    for (int h = 0; h < prime_hops; h++) {
+        kws_stream_push(s, pcm + h * KWS_FRAME_STRIDE);
+    }
+
+    // Steady state
+    uint32_t hop_cycles = 0;
+    uint32_t max_hop_cycles = 0;
+    fill_stack_pattern_to_sp();
+    for (int h = prime_hops; h < prime_hops + KWS_STREAM_HOPS; h++) {
+        enable_cycle_counter();
+        uint32_t start_cycles = read_cycle_counter();
+        kws_stream_push(s, pcm + h * KWS_FRAME_STRIDE);
+        uint32_t cycle_count = read_cycle_counter() - start_cycles;
+
+        hop_cycles += cycle_count;
+        if (cycle_count > max_hop_cycles) {
+            max_hop_cycles = cycle_count;
+        }
+    }
+    uint32_t stack_used = measure_stack_usage();
+    hop_cycles /= KWS_STREAM_HOPS;
+
+    // Full recomputation of the last window, with the same frame pipeline and with arm_mfcc_f32
+    const int16_t *window_pcm = pcm + KWS_STREAM_HOPS * KWS_FRAME_STRIDE;
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+    for (int f = 0; f < KWS_NUM_FRAMES; f++) {
+        kws_stream_frame(s, window_pcm + f * KWS_FRAME_STRIDE, features_full + f * KWS_NUM_MFCC);
+    }
+    uint32_t full_cycles = read_cycle_counter() - start_cycles;
+
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    for (int f = 0; f < KWS_NUM_FRAMES; f++) {
+        kws_mfcc_frame_f32(tables, window_pcm + f * KWS_FRAME_STRIDE, features_mfcc + f * KWS_NUM_MFCC, scratch);
+    }
+    uint32_t full_mfcc_cycles = read_cycle_counter() - start_cycles;
+
+    // The streamed window must match the batch front end over the same samples: bit-exact
+    // against the same frame pipeline, and within KWS_STREAM_MAX_DIFF of arm_mfcc_f32
+    const int8_t *view = kws_stream_features(s);
+    int mfcc_mismatches = 0;
+    int mfcc_max_diff = 0;
+    for (int i = 0; i < KWS_NUM_FEATURES; i++) {
+        const int diff = abs(view[i] - features_mfcc[i]);
+        mfcc_mismatches += diff != 0;
+        mfcc_max_diff = diff > mfcc_max_diff ? diff : mfcc_max_diff;
+    }
+
+    printf("\n\r");
+    if (memcmp(view, features_full, KWS_NUM_FEATURES) == 0 && mfcc_max_diff <= KWS_STREAM_MAX_DIFF) {
+        printf("Streaming window validation PASSED (%d hops, bit-exact vs same pipeline, max diff %d vs arm_mfcc_f32)\n\r",
+               prime_hops + KWS_STREAM_HOPS, mfcc_max_diff);
+    } else {
+        printf("Streaming window validation FAILED\n\r");
+    }
+    printf("Cycle Count per Hop (steady state): %lu (max %lu)\n\r",
+           (unsigned long)hop_cycles, (unsigned long)max_hop_cycles);
+    printf("Full Recompute Cycle Count (same pipeline): %lu (%.1fx)\n\r",
+           (unsigned long)full_cycles, (float)full_cycles / hop_cycles);
+    printf("Full Recompute Cycle Count (arm_mfcc_f32): %lu (%.1fx)\n\r",
+           (unsigned long)full_mfcc_cycles, (float)full_mfcc_cycles / hop_cycles);
+    printf("Streamed Features vs arm_mfcc_f32: %d of %d differ (max diff %d)\n\r",
+           mfcc_mismatches, KWS_NUM_FEATURES, mfcc_max_diff);
+    printf("Stack Used: %lu bytes, State: %lu bytes\n\r",
+           (unsigned long)stack_used, (unsigned long)sizeof(kws_stream));
+    if (network_cycles) {
+        printf("Front End per Hop vs Network: %.1f%% of the network cycles\n\r",
+               100.0f * hop_cycles / network_cycles);
+    }
+
+    kws_mfcc_free(tables);
+    free(tables);
+    free(s);
+    free(pcm);
+    free(scratch);
+    free(features_full);
+    free(features_mfcc);
+}
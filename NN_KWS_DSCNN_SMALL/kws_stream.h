@@ -0,0 +1,39 @@
+#ifndef KWS_STREAM_H_
+#define KWS_STREAM_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+#include "kws_mfcc.h"
+
+#define KWS_HISTORY_LEN (KWS_FRAME_LEN - KWS_FRAME_STRIDE)
+
+/*
+ * Sliding MFCC window: one new frame per KWS_FRAME_STRIDE samples.
+ *
+ * Feature frames live in a ring of KWS_NUM_FRAMES slots that is stored twice, back to back,
+ * so the current window (oldest frame first) is always one contiguous KWS_NUM_FRAMES x
+ * KWS_NUM_MFCC block that the network can read in place.
+ */
+typedef struct {
+    const kws_mfcc *tables;                     // window, mel filter bank and DCT from kws_mfcc_init
+    arm_rfft_fast_instance_f32 rfft;
+    int16_t history[KWS_HISTORY_LEN];           // tail of the previous hop
+    int8_t features[2 * KWS_NUM_FEATURES];
+    uint32_t head;                              // slot of the oldest frame in the window
+    float32_t frame[KWS_FFT_LEN];
+    float32_t spectrum[KWS_FFT_LEN + 2];
+} kws_stream;
+
+arm_status kws_stream_init(kws_stream *s, const kws_mfcc *tables);
+
+// One frame of KWS_FRAME_LEN PCM samples -> KWS_NUM_MFCC int8 network inputs
+void kws_stream_frame(kws_stream *s, const int16_t *pcm, int8_t *features);
+
+// Appends KWS_FRAME_STRIDE new samples and computes only the newest frame
+void kws_stream_push(kws_stream *s, const int16_t *pcm);
+
+static inline const int8_t *kws_stream_features(const kws_stream *s) {
+    return &s->features[s->head * KWS_NUM_MFCC];
+}
+
+#endif /* KWS_STREAM_H_ */
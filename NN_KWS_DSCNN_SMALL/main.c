@@ -9,6 +9,9 @@ void layer2_arm_depthwise_conv_s8(uint32_t *total_cycles, uint32_t *total_stack)
 void layer3_arm_conv_s8(uint32_t *total_cycles, uint32_t *total_stack);
 void layer12_arm_avgpool_s8(uint32_t *total_cycles, uint32_t *total_stack);
 void layer13_arm_fully_connected_s8(uint32_t *total_cycles, uint32_t *total_stack);
+void frontend_arm_mfcc(uint32_t network_cycles);
+void frontend_streaming_mfcc(uint32_t network_cycles);
+void streaming_arm_dscnn_s8(uint32_t baseline_cycles);
 
 
 
@@ -58,6 +61,13 @@ int main(void)
     printf("-----KWS-DSCNN_SMALL benchmark complete-----\n\r");
     printf("Total Cycle Count: %lu\n\r", (unsigned long)total_cycles);
     printf("Total Stack Usage: %lu bytes\n\r", (unsigned long)total_stack);
+    printf("\n\r");
+    printf("*****Front end: MFCC (49x10 features from 16 kHz PCM)*****\n\r");
+    frontend_arm_mfcc(total_cycles);
+    printf("*****Front end: streaming MFCC (one new frame per 20 ms hop)*****\n\r");
+    frontend_streaming_mfcc(total_cycles);
+    printf("*****Streaming DS-CNN (one new row per layer per hop)*****\n\r");
+    streaming_arm_dscnn_s8(total_cycles);
 	return 0;
 
 }
@@ -0,0 +1,51 @@
+/*
+ @licstart  The following is the entire license notice for the JavaScript code in this file.
+
+ The MIT License (MIT)
+
+ Copyright (C) 1997-2020 by Dimitri van Heesch
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ and associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ @licend  The above is the entire license notice for the JavaScript code in this file
+*/
+var NAVTREE =
+[
+  [ "CY8CKIT-062-WIFI-BT BSP", "index.html", [
+    [ "Overview", "index.html#autotoc_md1", null ],
+    [ "Features", "index.html#autotoc_md2", [
+      [ "Kit Features:", "index.html#autotoc_md3", null ],
+      [ "Kit Contents:", "index.html#autotoc_md4", null ]
+    ] ],
+    [ "BSP Configuration", "index.html#autotoc_md5", [
+      [ "Clock Configuration", "index.html#autotoc_md6", null ],
+      [ "Power Configuration", "index.html#autotoc_md7", null ]
+    ] ],
+    [ "API Reference Manual", "index.html#autotoc_md8", null ],
+    [ "More information", "index.html#autotoc_md9", null ],
+    [ "BSP Overview", "md_source_bsps_mt_bsp_user_guide.html", null ],
+    [ "BSP Settings", "md_bsp_settings.html", null ],
+    [ "BSP API Reference", "modules.html", "modules" ]
+  ] ]
+];
+
+var NAVTREEINDEX =
+[
+"group__group__bsp__bt.html"
+];
+
+var SYNCONMSG = 'click to disable panel synchronisation';
+var SYNCOFFMSG = 'click to enable panel synchronisation';
\ No newline at end of file
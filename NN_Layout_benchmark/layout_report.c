@@ -0,0 +1,23 @@
+#include "main.h"
+
+// Common report for the data-movement ops: bytes moved per cycle shows how close an op is to
+// the load/store bound of the core (bytes read + bytes written).
+void print_layout_result(const char *name, int passed, uint32_t cycle_count, uint32_t instr_est,
+                         uint32_t bytes_moved, uint32_t stack_used)
+{
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n\r");
+    if (passed) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", (unsigned long)instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Bytes Moved: %lu (%.3f bytes/cycle)\n\r", (unsigned long)bytes_moved,
+               (float)bytes_moved / cycle_count);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("%s output validation FAILED\n\r", name);
+    }
+}
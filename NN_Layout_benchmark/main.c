@@ -0,0 +1,63 @@
+#include "main.h"
+
+void benchmark_arm_pad_s8(void);
+void benchmark_arm_concatenation_s8(void);
+void benchmark_arm_reshape_s8(void);
+void benchmark_arm_maximum_s8(void);
+void benchmark_arm_minimum_s8(void);
+void benchmark_concat_zero_copy(void);
+
+uint32_t clkFastfreq = 0;
+
+RAM_FUNC int main(void)
+{
+	__disable_irq();  // Disable all interrupts
+    cy_rslt_t result;
+
+    // Initialize the device and board peripherals
+    result = cybsp_init();
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Initialize retarget-io to use the debug UART port
+    result = cy_retarget_io_init_fc(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                    CYBSP_DEBUG_UART_CTS, CYBSP_DEBUG_UART_RTS, CY_RETARGET_IO_BAUDRATE);
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Get the clock frequency
+    clkFastfreq = Cy_SysClk_ClkFastGetFrequency();
+
+    // Print system details
+    printf("\n\r");
+    printf("-----Starting CMSIS-NN Layout Functions Benchmark-----\n\r");
+    printf("\n\r");
+    printf("CPU Clock Frequency: %lu Hz\n\r", clkFastfreq);
+    printf("\n\r");
+
+    // Perform benchmarks
+    printf("*****ARM PAD S8*****\n\r");
+    benchmark_arm_pad_s8();
+    printf("\n\r");
+
+    printf("*****ARM CONCATENATION S8 (X/Y/Z/W)*****\n\r");
+    benchmark_arm_concatenation_s8();
+    printf("\n\r");
+
+    printf("*****ARM RESHAPE S8*****\n\r");
+    benchmark_arm_reshape_s8();
+    printf("\n\r");
+
+    printf("*****ARM MAXIMUM / MINIMUM S8*****\n\r");
+    benchmark_arm_maximum_s8();
+    benchmark_arm_minimum_s8();
+    printf("\n\r");
+
+    printf("*****Concatenation: Copy vs Zero-copy*****\n\r");
+    benchmark_concat_zero_copy();
+
+    printf("Finish Layout Functions Benchmark\n\r");
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "main.h"
+
+/*
+ * arm_concatenation_s8_{x,y,z,w} name the axes innermost first, so for an NHWC tensor
+ * x = C, y = W, z = H and w = N. Each case concatenates two inputs that differ only
+ * along the concatenation axis.
+ */
+
+typedef struct {
+    const char *name;
+    int axis;               // 0 = x, 1 = y, 2 = z, 3 = w
+    uint16_t dims[4];       // x, y, z, w of the first input
+    uint16_t axis_size_2;   // size of the second input along the axis
+} concat_case;
+
+static const concat_case concat_cases[] = {
+    {"concatenation_x_s8", 0, {16, 16, 16, 1}, 32},    // channels, inception-style branch merge
+    {"concatenation_y_s8", 1, {32, 8, 16, 1}, 8},      // width
+    {"concatenation_z_s8", 2, {32, 16, 8, 1}, 8},      // height
+    {"concatenation_w_s8", 3, {32, 8, 8, 2}, 2},       // batch
+};
+
+#define NUM_CONCAT_CASES ((int)(sizeof(concat_cases) / sizeof(concat_cases[0])))
+
+static void concat_ref_s8(const int8_t *input, const uint16_t *in_dims, int axis,
+                          int8_t *output, const uint16_t *out_dims, int offset)
+{
+    for (int w = 0; w < in_dims[3]; w++) {
+        for (int z = 0; z < in_dims[2]; z++) {
+            for (int y = 0; y < in_dims[1]; y++) {
+                for (int x = 0; x < in_dims[0]; x++) {
+                    int pos[4] = {x, y, z, w};
+                    pos[axis] += offset;
+                    const int dst = ((pos[3] * out_dims[2] + pos[2]) * out_dims[1] + pos[1]) * out_dims[0] + pos[0];
+                    output[dst] = *input++;
+                }
+            }
+        }
+    }
+}
+
+static void concat_s8(int axis, const int8_t *input, const uint16_t *in_dims,
+                      int8_t *output, const uint16_t *out_dims, uint32_t offset)
+{
+    switch (axis) {
+    case 0:
+        arm_concatenation_s8_x(input, in_dims[0], in_dims[1], in_dims[2], in_dims[3], output, out_dims[0], offset);
+        break;
+    case 1:
+        arm_concatenation_s8_y(input, in_dims[0], in_dims[1], in_dims[2], in_dims[3], output, out_dims[1], offset);
+        break;
+    case 2:
+        arm_concatenation_s8_z(input, in_dims[0], in_dims[1], in_dims[2], in_dims[3], output, out_dims[2], offset);
+        break;
+    default:
+        arm_concatenation_s8_w(input, in_dims[0], in_dims[1], in_dims[2], in_dims[3], output, offset);
+        break;
+    }
+}
+
+RAM_FUNC static void run_concat_case(const concat_case *c)
+{
+    uint16_t dims_2[4];
+    uint16_t out_dims[4];
+    memcpy(dims_2, c->dims, sizeof(dims_2));
+    memcpy(out_dims, c->dims, sizeof(out_dims));
+    dims_2[c->axis] = c->axis_size_2;
+    out_dims[c->axis] = c->dims[c->axis] + c->axis_size_2;
+
+    const int32_t size_1 = c->dims[0] * c->dims[1] * c->dims[2] * c->dims[3];
+    const int32_t size_2 = dims_2[0] * dims_2[1] * dims_2[2] * dims_2[3];
+    const int32_t output_size = size_1 + size_2;
+
+    int8_t *input_1 = malloc(size_1);
+    int8_t *input_2 = malloc(size_2);
+    int8_t *output = malloc(output_size);
+    int8_t *output_ref = malloc(output_size);
+
+    if (!input_1 || !input_2 || !output || !output_ref) {
+        printf("Failed to allocate concatenation buffers\n\r");
+        free(input_1);
+        free(input_2);
+        free(output);
+        free(output_ref);
+        return;
+    }
+
+    generate_rand_s8(input_1, size_1);
+    generate_rand_s8(input_2, size_2);
+    concat_ref_s8(input_1, c->dims, c->axis, output_ref, out_dims, 0);
+    concat_ref_s8(input_2, dims_2, c->axis, output_ref, out_dims, c->dims[c->axis]);
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    concat_s8(c->axis, input_1, c->dims, output, out_dims, 0);
+    concat_s8(c->axis, input_2, dims_2, output, out_dims, c->dims[c->axis]);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    // Both inputs read once, output written once
+    print_layout_result(c->name, validate(output, output_ref, output_size),
+                        cycle_count, instr_est, (uint32_t)(2 * output_size), stack_used);
+
+    free(input_1);
+    free(input_2);
+    free(output);
+    free(output_ref);
+}
+
+RAM_FUNC void benchmark_arm_concatenation_s8(void)
+{
+    for (int i = 0; i < NUM_CONCAT_CASES; i++) {
+        run_concat_case(&concat_cases[i]);
+    }
+}
@@ -0,0 +1,121 @@
+#include "main.h"
+#include <arm_nnsupportfunctions.h>
+
+typedef struct {
+    const char *name;
+    cmsis_nn_dims input_1;
+    cmsis_nn_dims input_2;
+} max_min_case;
+
+static const max_min_case max_min_cases[] = {
+    {"same_shape", {1, 16, 16, 32}, {1, 16, 16, 32}},
+    {"broadcast_scalar", {1, 16, 16, 32}, {1, 1, 1, 1}},    // e.g. ReLU with a quantized zero point
+    {"broadcast_channel", {1, 16, 16, 32}, {1, 1, 1, 32}},
+    {"broadcast_row", {1, 8, 64, 16}, {1, 8, 1, 16}},
+};
+
+#define NUM_MAX_MIN_CASES ((int)(sizeof(max_min_cases) / sizeof(max_min_cases[0])))
+
+static int32_t dims_size(const cmsis_nn_dims *d)
+{
+    return d->n * d->h * d->w * d->c;
+}
+
+static void max_min_ref_s8(const int8_t *in_1, const cmsis_nn_dims *d1,
+                           const int8_t *in_2, const cmsis_nn_dims *d2,
+                           int8_t *output, const cmsis_nn_dims *out, int is_max)
+{
+    int idx = 0;
+    for (int n = 0; n < out->n; n++) {
+        for (int y = 0; y < out->h; y++) {
+            for (int x = 0; x < out->w; x++) {
+                for (int c = 0; c < out->c; c++) {
+                    // Size-1 dimensions broadcast
+                    const int i1 = (((d1->n > 1 ? n : 0) * d1->h + (d1->h > 1 ? y : 0)) * d1->w +
+                                    (d1->w > 1 ? x : 0)) * d1->c + (d1->c > 1 ? c : 0);
+                    const int i2 = (((d2->n > 1 ? n : 0) * d2->h + (d2->h > 1 ? y : 0)) * d2->w +
+                                    (d2->w > 1 ? x : 0)) * d2->c + (d2->c > 1 ? c : 0);
+                    output[idx++] = is_max ? MAX(in_1[i1], in_2[i2]) : MIN(in_1[i1], in_2[i2]);
+                }
+            }
+        }
+    }
+}
+
+RAM_FUNC static void run_max_min_case(const max_min_case *m, int is_max)
+{
+    const cmsis_nn_dims out = {MAX(m->input_1.n, m->input_2.n), MAX(m->input_1.h, m->input_2.h),
+                               MAX(m->input_1.w, m->input_2.w), MAX(m->input_1.c, m->input_2.c)};
+    const int32_t size_1 = dims_size(&m->input_1);
+    const int32_t size_2 = dims_size(&m->input_2);
+    const int32_t output_size = dims_size(&out);
+
+    int8_t *input_1 = malloc(size_1);
+    int8_t *input_2 = malloc(size_2);
+    int8_t *output = malloc(output_size);
+    int8_t *output_ref = malloc(output_size);
+
+    if (!input_1 || !input_2 || !output || !output_ref) {
+        printf("Failed to allocate maximum/minimum buffers\n\r");
+        free(input_1);
+        free(input_2);
+        free(output);
+        free(output_ref);
+        return;
+    }
+
+    generate_rand_s8(input_1, size_1);
+    generate_rand_s8(input_2, size_2);
+    max_min_ref_s8(input_1, &m->input_1, input_2, &m->input_2, output_ref, &out, is_max);
+
+    // Neither kernel uses a scratch buffer
+    cmsis_nn_context ctx;
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_cmsis_nn_status result;
+    if (is_max) {
+        result = arm_maximum_s8(&ctx, input_1, &m->input_1, input_2, &m->input_2, output, &out);
+    } else {
+        result = arm_minimum_s8(&ctx, input_1, &m->input_1, input_2, &m->input_2, output, &out);
+    }
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    char name[48];
+    snprintf(name, sizeof(name), "%s_%s_s8", is_max ? "maximum" : "minimum", m->name);
+    print_layout_result(name,
+                        result == ARM_CMSIS_NN_SUCCESS && validate(output, output_ref, output_size),
+                        cycle_count, instr_est, (uint32_t)(size_1 + size_2 + output_size), stack_used);
+
+    free(input_1);
+    free(input_2);
+    free(output);
+    free(output_ref);
+}
+
+RAM_FUNC void benchmark_arm_maximum_s8(void)
+{
+    for (int i = 0; i < NUM_MAX_MIN_CASES; i++) {
+        run_max_min_case(&max_min_cases[i], 1);
+    }
+}
+
+RAM_FUNC void benchmark_arm_minimum_s8(void)
+{
+    for (int i = 0; i < NUM_MAX_MIN_CASES; i++) {
+        run_max_min_case(&max_min_cases[i], 0);
+    }
+}
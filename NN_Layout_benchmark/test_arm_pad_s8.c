@@ -0,0 +1,96 @@
+#include "main.h"
+
+typedef struct {
+    const char *name;
+    cmsis_nn_dims input;
+    cmsis_nn_dims pre_pad;
+    cmsis_nn_dims post_pad;
+    int8_t pad_value;
+} pad_case;
+
+static const pad_case pad_cases[] = {
+    // CIFAR-10 input ahead of a 5x5 conv (SAME)
+    {"pad_cifar_input_s8", {1, 32, 32, 3}, {0, 2, 2, 0}, {0, 2, 2, 0}, -128},
+    // 3x3 conv SAME on a mid-network activation
+    {"pad_16x16x32_s8", {1, 16, 16, 32}, {0, 1, 1, 0}, {0, 1, 1, 0}, 0},
+    // DS-CNN first layer (10x4 kernel), asymmetric padding
+    {"pad_dscnn_s8", {1, 49, 10, 1}, {0, 4, 1, 0}, {0, 5, 2, 0}, 0},
+    // Channel padding 3 -> 4 so the next kernel sees word-aligned pixels
+    {"pad_channels_s8", {1, 32, 32, 3}, {0, 0, 0, 0}, {0, 0, 0, 1}, 0},
+};
+
+#define NUM_PAD_CASES ((int)(sizeof(pad_cases) / sizeof(pad_cases[0])))
+
+static void pad_ref_s8(const int8_t *input, int8_t *output, int8_t pad_value,
+                       const cmsis_nn_dims *in, const cmsis_nn_dims *pre, const cmsis_nn_dims *out)
+{
+    memset(output, pad_value, out->n * out->h * out->w * out->c);
+    for (int n = 0; n < in->n; n++) {
+        for (int y = 0; y < in->h; y++) {
+            for (int x = 0; x < in->w; x++) {
+                for (int c = 0; c < in->c; c++) {
+                    const int src = ((n * in->h + y) * in->w + x) * in->c + c;
+                    const int dst = (((n + pre->n) * out->h + y + pre->h) * out->w + x + pre->w) * out->c + c + pre->c;
+                    output[dst] = input[src];
+                }
+            }
+        }
+    }
+}
+
+RAM_FUNC static void run_pad_case(const pad_case *p)
+{
+    const cmsis_nn_dims out = {p->input.n + p->pre_pad.n + p->post_pad.n,
+                               p->input.h + p->pre_pad.h + p->post_pad.h,
+                               p->input.w + p->pre_pad.w + p->post_pad.w,
+                               p->input.c + p->pre_pad.c + p->post_pad.c};
+    const int32_t input_size = p->input.n * p->input.h * p->input.w * p->input.c;
+    const int32_t output_size = out.n * out.h * out.w * out.c;
+
+    int8_t *input = malloc(input_size);
+    int8_t *output = malloc(output_size);
+    int8_t *output_ref = malloc(output_size);
+
+    if (!input || !output || !output_ref) {
+        printf("Failed to allocate pad buffers\n\r");
+        free(input);
+        free(output);
+        free(output_ref);
+        return;
+    }
+
+    generate_rand_s8(input, input_size);
+    pad_ref_s8(input, output_ref, p->pad_value, &p->input, &p->pre_pad, &out);
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_cmsis_nn_status result = arm_pad_s8(input, output, p->pad_value, &p->input, &p->pre_pad, &p->post_pad);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    // Input read once, every output byte written once
+    print_layout_result(p->name,
+                        result == ARM_CMSIS_NN_SUCCESS && validate(output, output_ref, output_size),
+                        cycle_count, instr_est, (uint32_t)(input_size + output_size), stack_used);
+
+    free(input);
+    free(output);
+    free(output_ref);
+}
+
+RAM_FUNC void benchmark_arm_pad_s8(void)
+{
+    for (int i = 0; i < NUM_PAD_CASES; i++) {
+        run_pad_case(&pad_cases[i]);
+    }
+}
@@ -0,0 +1,58 @@
+#include "main.h"
+
+// arm_reshape_s8 is a plain copy of the tensor; memcpy over the same buffers is the bound to compare against
+static const int32_t reshape_sizes[] = {256, 1024, 4096, 16384};
+
+#define NUM_RESHAPE_SIZES ((int)(sizeof(reshape_sizes) / sizeof(reshape_sizes[0])))
+
+RAM_FUNC void benchmark_arm_reshape_s8(void)
+{
+    const int32_t max_size = reshape_sizes[NUM_RESHAPE_SIZES - 1];
+    int8_t *input = malloc(max_size);
+    int8_t *output = malloc(max_size);
+
+    if (!input || !output) {
+        printf("Failed to allocate reshape buffers\n\r");
+        free(input);
+        free(output);
+        return;
+    }
+
+    generate_rand_s8(input, max_size);
+
+    for (int i = 0; i < NUM_RESHAPE_SIZES; i++) {
+        const int32_t size = reshape_sizes[i];
+        char name[40];
+        snprintf(name, sizeof(name), "reshape_%ld_s8", (long)size);
+        memset(output, 0, size);
+
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        uint32_t start_cycles = read_cycle_counter();
+
+        arm_reshape_s8(input, output, (uint32_t)size);
+
+        uint32_t end_cycles = read_cycle_counter();
+        uint32_t cycle_count = end_cycles - start_cycles;
+        uint32_t instr_est = cycle_count
+                           - DWT->CPICNT
+                           - DWT->EXCCNT
+                           - DWT->SLEEPCNT
+                           - DWT->LSUCNT
+                           + DWT->FOLDCNT;
+        uint32_t stack_used = measure_stack_usage();
+
+        print_layout_result(name, validate(output, input, size),
+                            cycle_count, instr_est, (uint32_t)(2 * size), stack_used);
+
+        enable_cycle_counter();
+        start_cycles = read_cycle_counter();
+        memcpy(output, input, size);
+        cycle_count = read_cycle_counter() - start_cycles;
+        printf("memcpy reference: %lu cycles (%.3f bytes/cycle)\n\r\n",
+               (unsigned long)cycle_count, (float)(2 * size) / cycle_count);
+    }
+
+    free(input);
+    free(output);
+}
@@ -0,0 +1,196 @@
+#include "main.h"
+
+/*
+ * Two branches, each a ReLU (arm_maximum_s8 against the quantized zero point), feeding a
+ * concatenation. In copy mode each branch writes its own tensor and arm_concatenation_s8_*
+ * copies both into the output. In zero-copy mode each branch writes straight into its slice
+ * of the concatenated buffer.
+ *
+ * Zero-copy only works when a slice is one contiguous block, i.e. every dimension outside
+ * the concatenation axis is 1. Concatenating NHWC tensors along C interleaves the branches
+ * per pixel, so that case always needs the copy.
+ */
+
+#define RELU_ZERO_POINT (-20)
+
+typedef struct {
+    const char *name;
+    int axis;                   // 0 = x (C), 1 = y (W), 2 = z (H), 3 = w (N)
+    cmsis_nn_dims branch;       // NHWC shape produced by each branch
+} zero_copy_case;
+
+static const zero_copy_case zero_copy_cases[] = {
+    {"concat_h_zero_copy", 2, {1, 8, 16, 32}},
+    {"concat_n_zero_copy", 3, {2, 8, 8, 32}},
+    {"concat_c_zero_copy", 0, {1, 16, 16, 16}},
+};
+
+#define NUM_ZERO_COPY_CASES ((int)(sizeof(zero_copy_cases) / sizeof(zero_copy_cases[0])))
+
+static int concat_slice_is_contiguous(int axis, const uint16_t *dims)
+{
+    for (int i = axis + 1; i < 4; i++) {
+        if (dims[i] != 1) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// ReLU of one branch written at `offset` along `axis` of the concatenated output
+static void concat_relu_ref_s8(const int8_t *input, const uint16_t *in_dims, int axis,
+                               int8_t *output, const uint16_t *out_dims, int offset)
+{
+    for (int w = 0; w < in_dims[3]; w++) {
+        for (int z = 0; z < in_dims[2]; z++) {
+            for (int y = 0; y < in_dims[1]; y++) {
+                for (int x = 0; x < in_dims[0]; x++) {
+                    int pos[4] = {x, y, z, w};
+                    pos[axis] += offset;
+                    const int dst = ((pos[3] * out_dims[2] + pos[2]) * out_dims[1] + pos[1]) * out_dims[0] + pos[0];
+                    const int8_t v = *input++;
+                    output[dst] = v > RELU_ZERO_POINT ? v : RELU_ZERO_POINT;
+                }
+            }
+        }
+    }
+}
+
+static void relu_s8(const int8_t *input, const cmsis_nn_dims *dims, int8_t *output)
+{
+    static const int8_t zero_point = RELU_ZERO_POINT;
+    const cmsis_nn_dims scalar_dims = {1, 1, 1, 1};
+    cmsis_nn_context ctx;
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    arm_maximum_s8(&ctx, input, dims, &zero_point, &scalar_dims, output, dims);
+}
+
+static void concat_branch_s8(int axis, const int8_t *input, const uint16_t *dims,
+                             int8_t *output, const uint16_t *out_dims, uint32_t offset)
+{
+    switch (axis) {
+    case 0:
+        arm_concatenation_s8_x(input, dims[0], dims[1], dims[2], dims[3], output, out_dims[0], offset);
+        break;
+    case 1:
+        arm_concatenation_s8_y(input, dims[0], dims[1], dims[2], dims[3], output, out_dims[1], offset);
+        break;
+    case 2:
+        arm_concatenation_s8_z(input, dims[0], dims[1], dims[2], dims[3], output, out_dims[2], offset);
+        break;
+    default:
+        arm_concatenation_s8_w(input, dims[0], dims[1], dims[2], dims[3], output, offset);
+        break;
+    }
+}
+
+RAM_FUNC static void run_zero_copy_case(const zero_copy_case *z)
+{
+    // CMSIS concatenation order, innermost first
+    const uint16_t dims[4] = {z->branch.c, z->branch.w, z->branch.h, z->branch.n};
+    uint16_t out_dims[4];
+    memcpy(out_dims, dims, sizeof(out_dims));
+    out_dims[z->axis] = 2 * dims[z->axis];
+
+    const int32_t branch_size = z->branch.n * z->branch.h * z->branch.w * z->branch.c;
+    const int32_t output_size = 2 * branch_size;
+
+    int8_t *input_1 = malloc(branch_size);
+    int8_t *input_2 = malloc(branch_size);
+    int8_t *branch_1 = malloc(branch_size);
+    int8_t *branch_2 = malloc(branch_size);
+    int8_t *output_copy = malloc(output_size);
+    int8_t *output_zero_copy = malloc(output_size);
+    int8_t *output_ref = malloc(output_size);
+
+    if (!input_1 || !input_2 || !branch_1 || !branch_2 || !output_copy || !output_zero_copy || !output_ref) {
+        printf("Failed to allocate concatenation buffers\n\r");
+        free(input_1);
+        free(input_2);
+        free(branch_1);
+        free(branch_2);
+        free(output_copy);
+        free(output_zero_copy);
+        free(output_ref);
+        return;
+    }
+
+    generate_rand_s8(input_1, branch_size);
+    generate_rand_s8(input_2, branch_size);
+    concat_relu_ref_s8(input_1, dims, z->axis, output_ref, out_dims, 0);
+    concat_relu_ref_s8(input_2, dims, z->axis, output_ref, out_dims, dims[z->axis]);
+
+    // Copy mode: branches write their own tensors, concatenation copies them
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    relu_s8(input_1, &z->branch, branch_1);
+    relu_s8(input_2, &z->branch, branch_2);
+
+    uint32_t mid_cycles = read_cycle_counter();
+
+    concat_branch_s8(z->axis, branch_1, dims, output_copy, out_dims, 0);
+    concat_branch_s8(z->axis, branch_2, dims, output_copy, out_dims, dims[z->axis]);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t stack_copy = measure_stack_usage();
+    uint32_t branch_cycles = mid_cycles - start_cycles;
+    uint32_t concat_cycles = end_cycles - mid_cycles;
+
+    printf("\n\r");
+    printf("%s: 2 x %ldx%ldx%ldx%ld\n\r", z->name,
+           (long)z->branch.n, (long)z->branch.h, (long)z->branch.w, (long)z->branch.c);
+    if (validate(output_copy, output_ref, output_size)) {
+        printf("%s copy mode output validation PASSED\n\r", z->name);
+    } else {
+        printf("%s copy mode output validation FAILED\n\r", z->name);
+    }
+    printf("Copy Mode Cycle Count: %lu (branches %lu + concatenation %lu)\n\r",
+           (unsigned long)(branch_cycles + concat_cycles), (unsigned long)branch_cycles,
+           (unsigned long)concat_cycles);
+    printf("Copy Mode Stack Used: %lu bytes\n\r", (unsigned long)stack_copy);
+
+    if (!concat_slice_is_contiguous(z->axis, dims)) {
+        printf("Zero-copy not possible: slices along this axis are interleaved\n\r\n");
+    } else {
+        // Zero-copy mode: slice i of the output is a contiguous block at i * branch_size
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        start_cycles = read_cycle_counter();
+
+        relu_s8(input_1, &z->branch, output_zero_copy);
+        relu_s8(input_2, &z->branch, output_zero_copy + branch_size);
+
+        end_cycles = read_cycle_counter();
+        uint32_t stack_zero_copy = measure_stack_usage();
+        uint32_t zero_copy_cycles = end_cycles - start_cycles;
+
+        if (validate(output_zero_copy, output_ref, output_size)) {
+            printf("%s zero-copy mode output validation PASSED\n\r", z->name);
+        } else {
+            printf("%s zero-copy mode output validation FAILED\n\r", z->name);
+        }
+        printf("Zero-copy Mode Cycle Count: %lu\n\r", (unsigned long)zero_copy_cycles);
+        printf("Zero-copy Mode Stack Used: %lu bytes\n\r", (unsigned long)stack_zero_copy);
+        printf("Bytes Not Moved: %lu, Branch Buffers Avoided: %lu bytes\n\r\n",
+               (unsigned long)(2 * output_size), (unsigned long)output_size);
+    }
+
+    free(input_1);
+    free(input_2);
+    free(branch_1);
+    free(branch_2);
+    free(output_copy);
+    free(output_zero_copy);
+    free(output_ref);
+}
+
+RAM_FUNC void benchmark_concat_zero_copy(void)
+{
+    for (int i = 0; i < NUM_ZERO_COPY_CASES; i++) {
+        run_zero_copy_case(&zero_copy_cases[i]);
+    }
+}
@@ -0,0 +1,19 @@
+// Generated by generate_maxpool_test_data.py (seed 1).
+#pragma once
+#define MAXPOOLING_BATCH_SIZE 1
+#define MAXPOOLING_INPUT_N 1
+#define MAXPOOLING_INPUT_W 22
+#define MAXPOOLING_INPUT_H 12
+#define MAXPOOLING_INPUT_C 20
+#define MAXPOOLING_FILTER_W 6
+#define MAXPOOLING_FILTER_H 5
+#define MAXPOOLING_STRIDE_W 9
+#define MAXPOOLING_STRIDE_H 5
+#define MAXPOOLING_PAD SAME
+#define MAXPOOLING_ACTIVATION_MAX 127
+#define MAXPOOLING_ACTIVATION_MIN -128
+#define MAXPOOLING_OUTPUT_C 20
+#define MAXPOOLING_OUTPUT_W 3
+#define MAXPOOLING_OUTPUT_H 3
+#define MAXPOOLING_PADDING_H 1
+#define MAXPOOLING_PADDING_W 1
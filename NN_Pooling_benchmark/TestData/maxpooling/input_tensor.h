@@ -0,0 +1,335 @@
+// Generated by generate_maxpool_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t maxpooling_input_tensor[5280] = {
+    -60, -96, 2, -68, 125, 102, 113, 66, -21, -80, 121, -114, 71, 93, -127, 100,
+    8, -11, -76, 34, -113, -117, -115, -124, 67, -18, 88, -114, -15, 96, 125, -9,
+    48, -10, -16, 107, 20, -117, 85, -77, -33, 23, -67, 42, 88, -31, 27, 17,
+    127, 73, -111, 117, -4, 78, 84, -40, 59, 63, -84, 96, -73, -45, 73, 61,
+    122, -113, 112, -106, 29, 73, -41, -42, -12, -122, -26, -10, 79, 48, 52, 107,
+    9, -126, 68, -62, -23, 90, -100, 118, 58, -26, 83, 120, 54, 84, 49, -128,
+    41, 106, -114, -11, -38, -36, -82, 2, -112, -92, -86, -120, 103, -121, 15, -1,
+    9, -72, -34, 48, 20, -93, -43, -47, 2, -42, 11, 22, 104, 36, 126, 114,
+    -70, -116, 31, 69, 47, 87, -32, 4, -73, 1, -21, 93, -118, -13, -119, 75,
+    -54, -110, -46, 100, 90, -16, 102, -14, -113, 74, 36, 90, -98, 24, -64, -20,
+    -104, 28, -92, -89, 30, 24, -47, 85, 1, -62, -124, -109, -17, 107, -41, -109,
+    65, -26, 49, -78, -23, 93, -29, 124, -75, 71, 23, 127, -120, 38, 77, 16,
+    -119, -48, -26, 39, -59, 45, 91, -19, 8, -79, 66, 48, 120, -8, -95, -108,
+    -85, -60, -42, -43, -19, 9, 42, 2, 60, 45, 46, -70, 21, -8, 122, -59,
+    -75, 36, -108, 80, -91, 66, -53, -64, 46, -70, 65, -89, -14, -87, 8, 58,
+    23, -70, 106, 13, -73, -105, 23, -122, -121, -82, 83, -70, -108, -32, -6, 87,
+    -46, -69, 102, -43, -5, -47, -76, 94, 65, 22, 1, 116, 33, -77, -22, 34,
+    -108, -115, -123, 23, 35, 102, 72, 32, 76, -96, -96, 34, 105, -71, 0, -18,
+    112, 54, 4, -35, -22, 29, -27, -2, 56, -87, 15, -83, 101, -82, 45, -12,
+    71, 29, -107, 39, -33, 34, 27, -3, 43, -77, -81, -3, -16, -118, -4, 77,
+    -91, 9, -92, -90, -117, -123, 20, 55, 124, 112, -50, -77, 39, -89, -40, -37,
+    -52, -56, 35, 28, -74, 22, -64, -23, -56, -112, 33, -23, -37, 25, 93, -48,
+    -104, -2, 1, -96, 100, 92, 0, 96, 104, -123, 74, 45, -41, 4, 120, -116,
+    85, -119, -97, 53, -58, -64, -58, 4, 13, 75, 77, -40, -83, -9, 120, -125,
+    -38, 34, 96, -13, -6, 32, 125, 117, -13, 83, 44, 12, -16, -104, -92, 60,
+    -47, -24, 31, 24, 25, 62, -44, 109, -85, -65, 65, -38, -49, 0, 90, -17,
+    -102, 125, 73, 50, 68, -44, -108, -82, 2, -77, 8, -86, -57, -87, 99, -5,
+    67, 93, 75, -44, 38, 96, -64, 121, -20, -67, 92, 81, -68, 23, 14, -1,
+    65, -126, -31, 96, -118, -113, -4, 5, -23, -40, 17, -53, -26, 11, 31, 0,
+    100, -42, 54, 123, 87, -66, -22, 68, -24, 17, -73, -116, -68, -122, 23, -59,
+    -90, 63, 31, 95, 54, 37, -128, -65, 98, 102, 51, 28, 76, 45, 124, -71,
+    65, 67, -24, -127, 14, -27, 108, 81, 28, -41, 102, -27, 56, -127, 71, 90,
+    79, 44, -94, 124, -2, 20, -118, 80, -49, 75, 10, -37, -91, -123, 50, 7,
+    82, 27, -51, 108, 4, 120, -42, 111, -105, 10, -78, 88, -93, 53, -94, 98,
+    -118, -44, -46, -81, 77, 13, 27, -22, -22, -7, 42, 9, -93, -90, 60, 111,
+    -103, -42, 24, 10, 54, -10, 72, 76, -40, 119, 4, 40, -15, 4, -3, -113,
+    78, 34, 93, -1, 9, -31, -91, -44, 99, -53, 6, 107, -45, -58, -58, 97,
+    56, 30, 77, -5, -69, -23, 28, -94, -74, -12, 75, 36, 124, -77, -33, -105,
+    -100, -117, -18, -111, 125, 98, 47, 12, -68, -40, -80, -15, 76, -9, 125, 102,
+    65, -42, -10, -8, 17, 108, 71, -20, 103, 4, 41, 126, -72, -19, -88, -105,
+    -121, -126, 117, 35, 68, 19, -28, 76, -47, -51, -113, -121, 70, -54, -99, 66,
+    2, -62, -88, 108, 27, -121, -110, -97, -62, -107, 12, -68, 93, -82, -31, -114,
+    127, -62, 14, -30, 101, 71, 40, 9, 5, -4, -3, -98, -39, 51, 91, -97,
+    52, 83, -26, 89, -93, 8, -91, 0, -38, -79, -51, -98, -24, 91, -106, -101,
+    -82, 112, 61, -78, 32, -108, -64, -112, 98, -63, 74, 100, -116, 10, -82, 0,
+    38, -85, 26, -111, 68, -99, 5, 32, -62, 5, 66, -69, 27, -80, 89, -3,
+    -23, 41, 45, 72, 118, -75, -62, 101, -113, 21, -48, -26, 61, 71, 38, -79,
+    81, 48, -64, -95, -106, 25, 32, 85, 24, 35, 52, 11, 38, -124, -66, -52,
+    34, 38, 39, -93, 103, 15, 117, 104, 58, 66, -88, -100, -60, -104, 123, 0,
+    -3, 45, 57, 61, 78, 29, 109, 46, -43, -114, -53, 0, -15, -60, -71, -34,
+    82, -103, -78, 8, -74, -24, 5, -94, -88, -91, -17, -40, 93, -117, 60, 121,
+    17, -16, -26, 124, -8, 89, 103, 59, -32, 118, -91, 3, 80, -25, -124, 66,
+    121, -89, 78, 89, -108, 52, 106, -125, -31, 25, -126, -67, 26, 33, 16, 82,
+    81, 29, 103, 26, -61, 99, -57, -45, 1, -124, 89, -110, 60, 87, 77, 16,
+    -119, -82, -82, -126, 68, 9, 109, 11, 62, 118, 44, 70, 105, -69, 119, 53,
+    -54, 84, -53, -119, -40, 5, 60, -63, 19, 83, 4, 19, 87, 12, 93, 43,
+    120, -18, 123, 77, 89, -82, -96, -62, -23, -52, -11, -115, -76, 1, -49, 117,
+    -78, 76, -33, -127, -83, 90, -102, -17, 88, 49, -104, -76, 86, -68, 7, 14,
+    -37, 117, -104, -19, -84, 71, -65, 101, 22, 126, 73, -69, 117, -74, -52, 69,
+    -25, -43, 3, 85, 19, 124, -19, 44, 120, -76, -124, 49, 8, -100, 97, 25,
+    -77, -11, 12, 10, -2, 82, -53, -62, 3, -29, 80, -99, -52, 83, 10, 15,
+    117, 28, 8, 123, -19, 127, 60, 112, -5, 45, -38, -36, 102, -52, -99, 38,
+    -59, -19, 33, 124, 117, 40, -68, -63, -57, 3, -13, -83, -103, -40, -69, -13,
+    -26, 29, 88, 39, -126, -118, 28, -16, -85, -14, 15, 46, 9, 66, -117, -66,
+    40, 49, -57, -70, 0, -55, -107, 49, -89, -81, -76, 25, 34, -1, 9, -103,
+    57, -113, -88, -57, 76, 62, -5, -80, 40, 12, -124, 36, -71, 52, -64, 10,
+    79, -82, 115, 86, 73, 26, -16, 26, -60, -101, -72, -39, -5, -18, 94, 12,
+    -118, 0, 10, 6, 114, -64, 78, -75, 63, -93, 57, -113, 29, 100, -61, -49,
+    -90, -56, -18, 119, 43, 58, 21, -47, -49, 67, 97, 79, -68, -54, 10, 23,
+    -124, -124, -61, 66, -77, 107, -113, 93, 88, 13, 61, 81, 79, 108, -101, -78,
+    113, -109, -128, -107, -72, -57, 54, 10, 54, 114, -3, -6, -74, 55, -47, -69,
+    -108, 32, 88, 49, 1, -100, 94, 84, 64, 55, 22, 46, 97, -7, -55, -100,
+    46, -70, -40, 121, 46, -66, -117, 117, -21, 68, -39, 75, -12, -77, -1, 43,
+    40, -3, 108, 113, 61, 124, -29, 93, 97, 76, -67, 121, 8, -64, -52, -122,
+    64, 84, -73, -115, -90, -35, 106, 65, 19, -49, -50, -74, 2, -119, 109, 75,
+    -12, 72, -126, -1, 88, -47, -37, 47, -6, -90, -46, -39, 64, -117, -17, 90,
+    -8, -108, -31, -89, -2, 75, 110, -68, -104, 70, -83, -80, 117, -105, -6, -122,
+    -118, 31, 110, 14, 84, -43, -60, 34, 101, 85, -43, 74, 71, -26, 125, 14,
+    56, -51, 4, 15, -39, -86, 56, 44, -55, 4, 2, 1, 50, 68, 14, 111,
+    -122, -52, -62, 1, -13, -28, -92, -27, 91, -6, -57, 107, 72, -28, -86, -89,
+    -50, -99, -113, 79, 67, 85, -58, -62, -91, -5, 67, -57, 18, -25, 75, 54,
+    -37, -13, 24, -55, 50, 123, 21, -83, 25, -22, 109, -117, 20, -76, 62, 99,
+    2, -99, -102, 33, -47, -61, -76, -71, 94, -3, -22, 75, -66, -20, 68, -60,
+    2, -127, -67, -25, 65, 118, -10, 9, -109, -43, -9, 82, 12, 87, 76, 11,
+    124, -78, -62, -33, -120, 104, -106, 122, -19, 73, 44, -4, -80, -89, -107, 88,
+    98, -32, -40, -31, 69, 56, -28, -9, 56, -95, 46, -102, 106, -106, -38, -53,
+    18, 112, -106, -95, 74, -81, 76, 26, 73, 9, 52, 112, -103, 116, -120, 90,
+    27, 34, -52, 14, -95, 56, 84, 72, -116, -70, -110, -121, -77, 42, 44, 60,
+    -111, 61, -91, 120, -86, 100, 43, -127, -46, 38, 56, -19, -54, -53, -73, 78,
+    34, 87, 56, 46, 5, 60, -109, -96, -2, 7, 75, 17, -86, -90, -41, 8,
+    83, -86, -64, 16, 6, -8, -21, -78, 13, 117, -104, 26, -24, -90, 33, 45,
+    23, -60, -110, 98, 58, -109, -114, 33, 85, -45, -108, 89, -34, -27, -9, -70,
+    -62, -66, 8, 106, -28, -100, 56, 105, 43, 53, -16, -124, -121, 122, -112, -44,
+    1, -108, -124, -11, -85, -40, -111, -26, -21, 98, 19, -4, 123, 62, 38, 72,
+    -91, -29, -36, -32, 24, 90, 114, 58, -117, 121, -118, -75, 93, 47, 45, -91,
+    87, -29, 125, 116, 102, 113, -44, 9, 26, 74, 4, 2, 30, -121, -105, 106,
+    106, 54, -10, 99, -21, 115, 43, -54, 68, 95, -101, -72, 54, -124, 2, -101,
+    28, 65, -121, 38, 45, 30, -103, -22, -87, 40, -67, -95, -63, 22, 81, 46,
+    -9, -115, -35, 59, 26, 22, 65, 87, 108, -91, -27, 80, -10, -107, -5, -14,
+    -4, 74, 66, -21, -51, 25, 56, -128, 29, 99, 126, -41, -54, -113, 61, 95,
+    47, 122, 34, -71, 21, 13, 91, -123, 31, -84, 123, -70, -16, 7, 95, 62,
+    -10, -101, -76, -45, -62, 21, -104, -94, -17, -127, -97, 88, -118, -95, -100, -124,
+    -111, 45, 42, -119, -124, -20, 112, -26, 8, 23, 0, -9, -35, -21, 72, -98,
+    -6, 103, -110, 41, 39, 80, -67, -120, -34, -81, -34, -17, -13, -38, 27, -78,
+    -98, 32, -54, -96, 98, -52, -10, -106, 18, 48, -99, -83, 98, -26, -12, -34,
+    -67, -99, -25, -101, -69, -84, -16, 18, 1, 88, -1, -112, 0, -29, 38, 51,
+    54, 104, 67, 69, -83, 90, -3, 122, 47, -37, -70, -6, -91, 95, 13, 27,
+    43, 61, 81, 105, 58, 52, 33, 74, 113, -120, 61, -63, 26, -42, 26, -64,
+    -52, -43, 106, -51, -59, -46, -88, 1, -8, 54, 33, -41, 13, 114, 30, -89,
+    91, -50, 52, 102, -73, -49, 33, -93, -33, 117, -111, -105, -30, 54, 59, 53,
+    63, 47, -67, -34, 64, -112, 10, -21, -97, -2, 27, 39, 78, -3, 56, -103,
+    -10, 20, -125, -28, -79, -59, -14, 60, 8, -56, -45, -12, -90, 31, 93, 96,
+    115, -35, 54, -28, 93, -91, 13, -23, -11, -56, -60, -22, -118, -45, 120, 57,
+    -34, -103, 56, -86, -7, -20, -84, 97, -28, 47, -44, -119, -17, 33, 117, -110,
+    -102, 59, 127, 50, -59, 121, -94, 35, 31, 34, -83, 118, 45, 84, -92, 6,
+    -96, 37, -119, -36, 39, -13, 32, 6, 1, 28, 121, 84, -122, 22, -45, 20,
+    -104, -69, 92, 92, -17, 14, 54, 125, 16, 3, -40, 37, -55, 52, -80, 75,
+    54, -30, 74, 102, -52, 118, -4, -109, -2, -88, -92, -109, 113, 119, 39, -41,
+    126, 75, -122, 69, 102, -44, 63, -102, 60, 52, 96, -7, 27, -83, 98, 54,
+    -29, -46, -60, 98, -105, 58, 44, -40, 123, 116, -124, -9, -98, 99, -45, -22,
+    76, 110, -65, 33, 6, -58, -42, 40, -61, -36, 29, -9, 90, 111, 106, 31,
+    -42, 30, -23, 16, -49, -125, 46, -68, 89, 66, -37, 97, 102, 98, 58, -23,
+    -101, -85, -74, -79, 70, -58, 99, 75, -35, 115, 101, -110, -29, 102, 122, 71,
+    20, 50, -40, 11, -36, -114, -97, -95, -11, 100, 35, 98, 43, -76, 70, -101,
+    111, 14, 81, 110, 41, -79, -44, 77, 90, 116, -52, 35, -54, 51, -58, -29,
+    -13, -18, 104, -49, -76, -76, 89, -102, 104, -51, 63, 36, 15, 75, -121, 70,
+    121, 100, 26, 27, 70, 32, 20, -39, -77, 122, -36, 100, -50, 106, -74, -65,
+    35, 33, 125, 46, 35, 108, 37, 120, 73, -17, -43, -5, -26, -3, -102, 36,
+    -97, 40, 86, -113, 48, 56, 57, 81, -21, 19, -14, 32, 75, 68, -39, -124,
+    71, 51, -15, -9, -95, 35, 68, -24, 22, -79, 94, -126, 51, -81, 80, -50,
+    -71, -37, 46, -55, 64, 95, 38, 13, -22, -29, -47, -44, -46, -53, -67, 98,
+    -62, 92, -60, 42, 34, -58, -118, 55, -39, -13, -8, 126, 122, -111, -83, -60,
+    112, -55, -21, 56, -58, 15, 50, -95, 68, 115, -113, 108, -28, -5, -23, -126,
+    27, -107, 8, -32, -92, -74, -72, 76, 41, -75, 100, 119, 15, -55, 92, 62,
+    50, 68, 82, 95, 60, -23, -28, -95, -54, -7, -6, -118, -5, 73, 105, 97,
+    -80, -101, -40, -125, -106, 92, 14, 84, -61, -8, 63, 84, 47, -104, 104, -62,
+    58, -98, 50, -68, -3, -65, 95, -52, -119, 59, -62, -51, 19, -116, 113, -115,
+    119, -94, 92, -81, 112, -79, -63, 73, 81, -5, 66, 116, 34, 96, -69, -94,
+    -21, 61, -75, -79, 53, -74, -28, -72, -84, -127, 93, -8, -82, 29, 121, -97,
+    91, 24, 72, -108, -114, 13, 116, 96, -16, 9, 36, 116, 98, -100, 9, -40,
+    96, 105, 23, -35, 36, 75, 83, 75, 116, -16, 28, -120, -96, -53, 124, -69,
+    56, 4, 30, 27, -58, -74, -58, 105, -109, 100, 112, 38, 62, -64, -121, -25,
+    9, -95, 108, 17, -122, 8, -117, 77, -71, -78, 36, 101, -82, 127, 47, -106,
+    -32, -42, -100, -69, -107, -68, 28, -26, -46, -52, -12, -17, -83, 52, 94, 8,
+    -60, 18, -1, -93, 7, -99, -117, 93, 16, 115, 88, 95, -94, -34, -19, -111,
+    91, 84, 53, 53, -53, -37, -13, -11, -98, 59, -94, 100, 36, -17, -16, 3,
+    -49, 67, -74, 116, -128, 113, 31, 6, 21, -22, -61, 66, -111, 67, 106, -116,
+    -61, -10, 124, -78, 23, 95, -26, 42, -78, -1, -4, 123, -69, -37, 126, 55,
+    93, 76, 87, -116, 76, -56, 89, -63, -97, 21, 70, 92, -80, -25, 10, 117,
+    88, 7, -74, 38, -50, 4, -116, -79, 61, 104, 7, -80, 17, -57, -85, 80,
+    66, -114, 117, -62, 72, 123, -9, -114, 64, -97, 82, -85, -1, -108, 104, -86,
+    22, -108, 49, -107, -94, -91, -105, 29, 53, 29, -82, 112, 55, 39, -41, 53,
+    -1, 39, -9, -1, -17, 31, 28, 37, 26, -126, 118, 1, -11, -53, -5, -46,
+    -85, 4, 76, -25, -58, -44, -91, 33, 69, -20, -47, -109, 100, -18, 77, -71,
+    31, -16, 20, 100, 44, -86, -93, -92, -10, -67, 109, 106, -123, -43, 106, 93,
+    -72, -30, -121, -4, 29, -19, 22, 29, 7, 50, 8, 19, -104, -114, -123, 97,
+    -107, -23, -89, 33, 103, 27, -70, -2, -72, -30, -113, -29, -59, -115, 97, -114,
+    -12, 115, -40, -124, -14, -58, -96, -120, -58, 36, -85, 5, -29, 75, -124, 15,
+    52, 4, 69, 78, 110, 14, -83, -36, 117, 73, -60, -22, -115, -102, 34, -54,
+    -16, 35, 75, -108, 81, 115, -95, -111, -61, 82, 71, 11, -106, -17, -29, 27,
+    66, 25, -117, 8, -31, -45, -11, -83, -21, 117, -44, -102, 78, 16, -121, -51,
+    -78, -108, 92, 115, -39, -17, 111, -73, 79, -14, -96, -63, 45, 115, 124, 60,
+    93, -1, 98, 5, 78, 54, 69, -11, 65, -74, -36, 48, -90, -115, 86, 124,
+    -97, 107, -72, -9, 104, 51, -82, 43, -110, 13, 43, -62, -43, 92, 31, 98,
+    -4, 122, 68, -114, 2, -67, 18, 4, -116, -85, 38, -36, -16, 22, -87, -41,
+    105, 62, 76, 103, 113, -76, 122, -86, -111, -98, -119, 14, -110, 9, 31, -38,
+    116, 44, -120, 104, 47, -7, -13, 49, -99, -117, 97, -27, 73, -50, -37, -10,
+    -87, 74, -108, -39, 35, -126, 104, -45, -109, 88, -15, 3, 96, -32, -108, 65,
+    82, 76, 90, 11, 98, 44, -116, -88, 113, 86, -46, 92, -46, -40, 8, 83,
+    118, 18, 49, 105, 75, 64, 18, -6, 55, -13, 7, -118, -91, 6, 71, -46,
+    7, 1, 123, -120, -47, 119, -72, -16, -51, -71, 68, -99, -40, -94, -80, 111,
+    111, -116, -99, 10, -102, 113, -22, 54, 96, -72, 45, 35, 67, 71, 20, -86,
+    -11, 97, 50, 90, 92, 95, 8, -33, -51, -101, 41, 52, 64, -94, 34, -38,
+    -54, -70, -24, 116, -9, 55, -46, -24, 25, -41, -58, 76, 89, 122, 51, -111,
+    -90, -116, 60, -1, -49, -19, 74, 99, 11, 90, 45, 118, 46, -87, -100, -57,
+    112, -38, -82, -124, -95, -116, -35, 14, -29, 107, 77, 10, 7, 68, -75, 74,
+    109, -5, -92, 32, -60, -115, 65, -100, 20, 48, -120, 96, 34, -123, 33, 72,
+    -102, 100, -79, 88, 79, -65, -120, -123, 81, 50, -39, 79, -108, -55, 18, 82,
+    -43, 112, 22, 3, -111, 72, 82, -54, 37, -41, 104, 73, -64, -88, 73, 5,
+    72, 122, -111, 20, -47, 9, 70, 12, -65, 2, -124, -67, -74, 111, -51, 110,
+    -5, -7, -107, -13, -88, -73, -79, -109, -70, -106, 1, 84, -53, 49, -70, -103,
+    71, -14, -47, 122, -41, 52, 75, -41, 38, -92, -103, -121, 24, -78, 102, -84,
+    -128, -104, 15, 28, 2, 106, 68, -68, -14, 28, -64, -116, 59, 100, -80, 92,
+    -49, 12, -70, 63, 1, -20, 40, -56, -14, -125, -11, 119, 55, -63, 81, 47,
+    90, 97, -71, 0, -101, 23, 35, -27, -22, -11, -5, 64, 49, 3, -128, 123,
+    -57, 90, 119, -82, 13, -77, -16, -73, 90, 79, -56, -70, 97, -18, -46, -18,
+    11, 59, 39, 49, 0, -52, -113, -15, 3, 118, -120, 47, -120, -39, -26, 4,
+    -11, -91, 90, 60, 61, -31, -74, -126, 72, 45, 40, 82, 47, 3, 78, 13,
+    52, -90, 95, -14, 113, 49, 16, -114, -74, -101, -41, -13, 96, 22, 88, 76,
+    -126, -94, 75, -50, -22, 114, 73, 124, -78, 81, -44, 124, -18, 30, -110, 24,
+    22, -57, 0, 27, 115, -60, 95, 42, 36, -21, 14, -108, 31, 22, 126, 25,
+    7, -47, 20, 6, 43, -52, 4, 70, 98, 125, -42, 68, -108, -81, -23, 34,
+    -102, 28, -108, 84, -73, 37, -62, -123, 48, -5, 53, 94, -5, -86, -112, 43,
+    -119, 99, -115, -42, 15, -21, 91, 20, -44, -106, -109, 126, 71, -71, 66, 19,
+    95, -103, -11, 42, 86, 121, -24, -83, 44, 79, -37, -8, 120, -92, 86, 74,
+    -17, 2, -128, 16, -112, 5, -85, -36, 1, 101, 94, 28, -77, 24, -101, 116,
+    -39, 2, -22, -64, -107, 76, -123, 24, -127, 67, 46, -79, 3, -46, -26, -91,
+    -39, 65, -117, -16, 79, -119, -126, 84, -39, -101, 74, 84, -31, -47, -15, -82,
+    103, 43, 0, -30, 2, 70, -2, 21, 3, -53, 8, 57, 13, -16, -32, -117,
+    -75, -17, 13, -42, 36, -16, -45, -112, -16, 70, 6, 3, -20, 5, 64, -107,
+    -112, -50, 126, 95, 26, 59, 79, 54, -27, 18, 15, 7, 119, -50, 54, -56,
+    71, -97, -92, 5, -90, 124, -22, 104, 29, -108, 9, 44, -126, 125, 92, 92,
+    88, 59, 120, -29, 93, 72, 20, -79, -87, -46, 44, 59, 91, 67, -65, 64,
+    -102, 94, -26, -71, -11, 116, 68, -40, -60, -16, -79, 49, 37, 97, -43, 65,
+    119, -34, -109, -27, -1, -61, -67, 12, -122, -126, 62, 18, -19, -101, 31, -53,
+    -63, -94, -48, 86, 9, -62, -91, -30, -46, 85, -18, 73, 122, -40, -96, 127,
+    -4, -24, -91, -51, -3, -32, -53, 4, -95, 62, -88, 54, 14, -37, 112, 93,
+    -15, -64, -68, 94, 91, 60, -14, 99, 72, 42, -35, -102, -104, 60, 109, -46,
+    110, 63, 52, -49, 106, -26, 116, 16, -22, -63, -16, 16, -74, -83, -12, 89,
+    -19, 25, 124, -97, 64, -24, -101, 30, 25, -21, 91, -122, 105, 38, 86, -4,
+    -75, -42, -102, 67, -45, -120, 125, 120, 60, 90, -114, 95, 71, -7, -124, -106,
+    -26, 33, -110, -59, 96, -37, 103, -54, -55, 0, 67, -81, -65, -92, 68, 119,
+    59, -21, -109, 81, -16, 118, -27, -42, -7, -28, 45, 24, 116, -8, -19, 16,
+    -65, -123, -110, 33, -83, -37, 105, -87, 81, -57, -106, -57, 35, 55, 103, -31,
+    76, 109, -85, 73, 59, -123, 17, -20, 54, 63, -125, -80, 100, 79, 29, -40,
+    25, -16, 40, 42, -20, -108, -102, -119, -35, 108, 38, -110, 8, 11, -95, -1,
+    -122, -62, 83, 49, 10, 127, -109, 69, -72, 28, 86, -1, -11, 95, 7, -123,
+    -126, -51, 115, -52, 51, -89, -2, -49, -61, 77, -57, 41, -29, -62, -58, -69,
+    -63, -111, 14, 11, 52, -125, -54, -124, -96, 105, 93, 75, 30, -60, 72, 90,
+    56, 101, 51, 21, 115, -33, 9, -124, 31, -11, -101, 127, -98, -125, -88, 109,
+    -127, -3, -61, 72, 70, -15, 13, -35, -17, -46, -82, 41, 49, -84, -66, -10,
+    -24, 40, 101, -86, 92, 54, -44, -36, -76, 53, -34, 124, -88, 105, 92, -17,
+    -96, -94, 0, 40, 72, 60, 39, 92, -92, -31, 82, 49, 126, 49, -67, 101,
+    40, -124, -13, 27, 82, -57, -30, 14, -105, -45, 30, -99, -72, 8, -71, -36,
+    103, -2, 111, 92, -101, -56, 124, 56, 21, 64, -83, 95, -62, -9, 91, 121,
+    -96, 57, -34, -97, -24, -31, -119, 49, -7, -6, 82, 84, -44, -8, -128, -16,
+    -99, -49, -82, -116, -56, 8, -11, 56, 42, -58, -80, 2, 83, 54, -107, -97,
+    106, -109, 33, 31, 25, 71, 29, 69, 119, 22, -67, -123, -74, 89, -91, -22,
+    -65, -124, -3, 112, -92, -20, 46, -19, 23, 18, 110, 110, -21, 108, 64, -86,
+    -113, -91, 26, 102, -24, 23, 84, -34, 74, 64, 109, -15, -2, 124, -121, 21,
+    9, 114, 124, 52, -72, -67, -19, 100, 70, -18, 87, -97, -38, 69, 89, 63,
+    -56, -94, -47, -105, -20, 110, 30, 26, 115, -60, -118, 103, 94, 48, 95, 58,
+    -17, 10, -24, 108, 114, 10, 84, 17, 13, 99, -95, -72, 38, 101, 19, -12,
+    35, -1, -49, -48, 2, -1, 82, -113, 91, 75, -13, -59, -92, -85, -44, 111,
+    66, -16, 21, 72, 9, -124, 17, -52, -67, 92, 16, 26, 86, -97, -52, -79,
+    -44, 121, 93, -72, -99, 55, 34, 29, -110, 28, 103, -112, 48, 17, -20, 6,
+    12, -42, 18, 45, -83, -110, -63, -61, 68, 37, 45, 113, -43, 21, -115, 7,
+    -119, -117, 87, 109, -116, 71, -74, -65, -120, 68, -83, 127, -19, 53, -112, 81,
+    113, 35, -32, -124, -63, 113, 113, 0, 93, -77, 85, 103, 23, -81, -102, 88,
+    -50, 51, -27, -86, 105, 57, -72, 41, -77, -24, 34, -47, -46, 41, -87, -22,
+    22, -95, 123, 108, 99, 69, 58, 115, -39, -56, -128, -39, 29, -38, -52, -22,
+    -60, -4, 106, -58, -85, 120, 71, 73, 89, 95, 112, 15, 116, -64, -27, 65,
+    -110, 12, -57, 97, -17, -49, 71, 98, -97, 49, -13, -49, 18, 122, 41, -50,
+    -95, 73, -91, -91, -128, -113, -90, -84, -61, 0, -97, -22, 92, 44, 14, 53,
+    -26, -47, 81, -87, 53, -69, 88, 102, 42, -76, -123, -100, -53, 80, -20, -25,
+    -94, -46, 105, -116, 39, 22, 30, -50, 103, -102, -106, 19, -47, -116, 33, -116,
+    -53, 1, -74, -9, 3, 125, 127, -30, -89, -61, 18, -113, -8, -48, -39, -4,
+    107, -73, -127, -28, 59, -41, 10, -80, -87, 25, -10, 64, 24, -59, 26, -57,
+    24, -67, 25, -77, -22, 97, 76, -78, -113, 74, 116, -125, 22, 112, 112, 60,
+    -36, -21, 116, -26, -13, -58, 93, -27, 58, 123, -12, -104, -3, -70, 57, -94,
+    -107, -20, 93, 41, 80, 102, 98, 107, 101, 62, -108, -24, 4, -62, -73, 84,
+    -26, 39, -76, -126, -14, -27, 68, -29, 27, 30, 63, -9, -114, -1, 14, 28,
+    -36, -70, -121, 50, -49, 71, 123, 105, -71, -13, 51, -97, -86, -5, -41, -27,
+    90, -57, 65, 77, 52, -86, -109, 105, 53, 19, 62, 40, 63, -123, -70, 70,
+    26, 11, -99, 117, 13, -102, 123, 34, 91, 105, -16, -41, -107, 77, 3, -30,
+    33, -25, -71, -43, 87, 87, 1, -62, -81, 4, -6, 15, -34, 104, 89, -120,
+    -54, 28, -58, -56, 82, -110, 111, 125, -106, 70, -74, 22, 83, 109, -73, 90,
+    82, -115, 6, -97, 21, 4, 38, -114, -57, -100, -17, 33, -79, -45, 26, 83,
+    -55, -88, 125, -96, 90, 59, -52, 107, 79, 39, 16, 127, -89, -59, -119, -83,
+    -23, 58, 117, -53, -39, -61, 89, -105, -90, 54, 31, 0, 56, 61, 30, 80,
+    76, 115, 96, 60, 38, 83, -51, -61, 116, 0, 1, 90, 113, -104, 22, 124,
+    48, 125, -61, 100, -54, 114, -51, -9, 42, -93, 58, -41, 87, 81, 27, 10,
+    -15, -123, 117, 55, -87, 6, 120, 73, 107, -105, 90, 1, 121, -52, 36, -53,
+    -23, 67, -66, -72, 36, -55, 112, 101, -49, 124, -49, -97, -32, 76, 43, 4,
+    121, 20, -110, 95, -87, -19, -115, 35, 79, 21, -2, 25, 93, 51, 98, 38,
+    14, -67, 62, -111, 19, -24, -73, 4, -120, 4, 43, -72, 76, 107, 22, 15,
+    62, -55, 124, -99, -75, 65, 99, 32, -125, 110, -8, -59, 32, -52, -24, 120,
+    -41, 16, 48, -16, -22, -97, 104, 13, 109, 108, 112, 58, 90, 88, -94, -13,
+    48, -100, 38, -75, 68, 127, 41, -56, -25, -93, 9, 126, 121, 111, 35, 110,
+    -87, 124, 15, -70, -61, 85, -81, -54, 67, -79, 88, -17, -53, -127, -71, -77,
+    -87, 41, -65, 63, 85, 74, -90, 83, 102, 25, 95, 97, 75, -60, 106, 116,
+    70, -74, 42, 14, -56, 7, -106, -80, -43, -110, -126, 39, 45, -107, -46, 87,
+    96, -120, 92, 77, -66, 74, -99, -114, -59, -6, 120, 71, 32, -63, 19, -57,
+    -57, -56, -54, -7, -27, -113, -20, 122, 106, 58, 112, 91, -128, 87, -6, 66,
+    8, -115, 37, -73, -3, 91, 3, -62, 111, 60, 0, -66, -82, 51, 79, 98,
+    58, 87, 96, 127, 64, -114, -104, 121, 37, -10, -76, -118, 51, -89, -37, 115,
+    -66, -10, -54, 107, -90, -43, 14, 114, 58, -33, -9, -106, 21, 99, 104, 16,
+    -3, -123, 27, 112, -52, -27, -28, -36, 28, -92, 3, -42, 72, 26, -36, 104,
+    75, -81, 54, 54, -10, -127, -44, 104, -64, 16, 69, -52, 44, 47, 0, -127,
+    -55, -32, 3, -19, -125, -99, -110, 107, 17, -15, -72, -89, -52, -25, -37, -113,
+    95, -48, -41, 97, 36, -102, 100, 55, 18, -63, -102, -4, -70, 103, 123, -11,
+    34, -71, 28, -51, 8, 86, 7, -70, -119, -126, 61, -34, -99, 39, -47, -107,
+    -111, -113, 5, -2, -113, 21, 118, 127, 44, -83, -26, -39, 51, -83, 61, -55,
+    56, -29, 108, 65, 101, 49, -88, -2, -9, -80, -8, -83, 31, 61, -87, -66,
+    56, -1, 17, 30, -65, -43, 80, -20, 109, -59, -28, -88, 94, -91, 67, -50,
+    -4, 26, 3, 117, 69, -68, -73, 56, 104, 118, 74, -20, 42, -52, 9, 38,
+    -28, -105, 78, 8, 36, -73, -61, -24, 63, 112, 38, -106, -100, 106, -60, 104,
+    127, -19, 14, 3, -49, 17, -68, 34, -14, 46, 32, -28, -66, 84, -20, 87,
+    -60, -83, 70, -114, 69, -57, 73, 49, 75, -54, -81, -10, -26, 121, 114, 65,
+    34, 1, -124, 5, -116, 67, 73, -54, -41, 4, -78, 80, -70, 116, 78, -101,
+    121, -87, -88, -15, 44, 69, 47, 54, 0, -5, 81, -58, -15, 77, -105, -2,
+    -32, -53, 45, -33, -73, -22, 87, -102, 42, 57, 50, 95, -12, 51, 66, -92,
+    -13, 111, -63, 54, 60, -81, 109, 86, 65, 6, -91, 106, 111, -52, 6, -121,
+    57, 88, -7, 51, 110, 41, 97, -123, -54, -5, -78, -13, 11, 58, -14, -34,
+    99, 55, 60, -109, -35, 71, 52, 49, 81, 26, 5, 106, -86, -101, -75, 9,
+    30, -20, 90, -26, -3, 14, -81, 85, 72, 19, 21, 120, -81, 83, -14, -26,
+    118, -66, 55, -86, -112, -87, 37, -3, 98, -82, -30, -112, 97, -61, -85, 113,
+    -95, -103, -55, 125, -64, 125, 95, 117, 22, -123, 0, -68, -82, 59, -111, -9,
+    -51, -117, 67, -107, -61, 42, 68, -91, 102, 29, 39, -23, 90, 119, -96, 66,
+    1, -126, -75, 26, -16, 65, -122, 72, -90, -82, -4, -96, 86, 100, 31, -112,
+    -55, 124, 120, 60, -52, -69, -23, 9, -121, 126, 103, -55, -53, 33, 76, 98,
+    11, 106, 61, 75, -86, -117, -18, -14, -2, 49, 93, -79, -86, -114, -9, 41,
+    -6, -26, -45, -85, -46, -97, 25, 0, 42, 50, 88, 62, -23, -128, 127, -61,
+    -37, 67, -127, -35, -120, 7, 59, -17, 80, -32, -4, 86, -25, 84, 66, -106,
+    -41, -128, -22, -77, -99, 21, -53, 73, 56, -34, -42, -45, -53, 127, -83, 101,
+    -35, 19, 8, 51, 98, -4, -106, -11, -17, 9, -6, 92, 15, -8, 56, 122,
+    82, -25, 106, 33, -105, -9, -15, -49, 88, -65, -91, 85, 90, 67, 106, -80,
+    -25, -98, 72, -22, -20, 93, 113, 63, -75, 64, 22, 60, 32, -38, 87, -2,
+    -31, -90, -12, -85, 2, 87, -14, 124, 3, -111, 73, 48, 77, 109, 85, -24,
+    -101, 18, -10, -51, -55, 44, 23, 103, 89, 26, 63, 32, 4, -12, 104, 73,
+    40, -109, -21, -80, -59, -2, 52, -55, 100, 76, 0, -122, 85, 33, -55, 35,
+    -93, -23, 69, -21, 76, -82, 111, -20, -71, -58, 66, -71, 69, -3, 111, 119,
+    -87, -46, -126, 52, -100, 107, -59, 127, 68, -25, -32, -97, 46, -28, 117, 15,
+    -37, 126, 85, -104, -49, -30, -123, 29, 86, -92, -34, -116, 64, 20, -53, 18,
+    -58, -41, 24, -9, 29, 101, -20, -29, -102, -23, 64, 39, 54, 68, -106, 74,
+    -83, -48, 124, -50, 52, 30, -36, -108, 118, 108, 54, 48, 49, -17, -60, -5,
+    84, -96, -6, 3, 25, 109, 43, 98, -120, 123, 121, -61, -115, 89, 70, -33,
+    18, 65, -31, 76, -115, -4, 119, 46, 57, 99, 30, -88, -99, 33, -48, -59,
+    -101, 57, 113, -5, -107, -111, -121, 116, 106, 111, 91, -4, 79, -38, -75, -4,
+    17, 27, -11, -116, -74, -23, 91, 18, 125, 15, 28, -72, 110, -57, 15, 32,
+    31, 45, -110, 24, -28, 2, 109, -14, -127, 32, 105, -72, -95, 90, 52, 1,
+    -107, -57, 28, 63, 47, 76, -37, -102, 111, 39, -45, -11, 117, -45, 90, 75,
+    -72, 31, -82, 107, -45, 94, 123, -57, -96, -113, 117, -61, -6, -106, 26, 83,
+    109, 3, 50, 42, 59, -111, -36, 90, -15, 126, 62, 1, -4, -95, 4, 21,
+    -111, 22, 116, 118, -45, -81, -27, -103, 45, 18, -95, -13, -42, -54, 93, 32,
+    -26, 110, -34, -128, -25, -103, -120, -89, 70, 57, 95, -32, -46, -126, 90, -112,
+    -3, -97, 73, -71, 61, 63, -60, 66, -80, 34, 122, -127, 111, -8, 78, -88,
+    93, 64, -119, 48, 22, -10, 75, 126, 78, 61, -103, -97, 80, 91, -48, -54,
+    41, -31, -56, 123, 83, 32, -125, 59, 62, 57, -87, 68, -61, -110, -56, -103,
+    30, 7, 42, -108, -88, -63, -58, -6, 34, -21, -48, 99, -27, 81, 62, -61};
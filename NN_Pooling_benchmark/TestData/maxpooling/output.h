@@ -0,0 +1,17 @@
+// Generated by generate_maxpool_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t maxpooling_output[180] = {
+    117, 87, 108, 95, 125, 102, 113, 123, 127, 124, 125, 122, 120, 120, 124, 124,
+    120, 126, 123, 123, 123, 115, 125, 124, 124, 122, 91, 127, 97, 114, 114, 119,
+    127, 121, 126, 126, 114, 108, 115, 117, 113, 123, 123, 122, 91, 118, 125, 109,
+    117, 95, 125, 117, 121, 118, 110, 121, 105, 125, 119, 124, 105, 105, 123, 116,
+    126, 127, 127, 124, 116, 121, 124, 96, 115, 79, 124, 118, 120, 86, 104, 126,
+    112, 121, 124, 123, 119, 123, 126, 113, 110, 112, 112, 93, 122, 116, 125, 127,
+    121, 111, 106, 122, 96, 127, 127, 108, 115, 125, 112, 126, 122, 117, 124, 124,
+    119, 82, 126, 127, 112, 105, 105, 119, 95, 112, 112, 127, 98, 102, 127, 121,
+    101, 99, 106, 107, 58, 123, 123, 124, 82, 127, 123, 107, 121, 121, 124, 117,
+    121, 123, 121, 95, 118, 126, 125, 104, 127, 111, 117, 124, 110, 125, 120, 127,
+    121, 124, 120, 110, 98, 124, 122, 118, 111, 126, 103, 123, 111, 64, 106, 125,
+    106, 125, 112, 126};
@@ -0,0 +1,3 @@
+#include "../../TestData/maxpooling/config_data.h"
+#include "../../TestData/maxpooling/input_tensor.h"
+#include "../../TestData/maxpooling/output.h"
@@ -0,0 +1,19 @@
+// Generated by generate_maxpool_test_data.py (seed 2).
+#pragma once
+#define MAXPOOLING_1_BATCH_SIZE 1
+#define MAXPOOLING_1_INPUT_N 1
+#define MAXPOOLING_1_INPUT_W 9
+#define MAXPOOLING_1_INPUT_H 5
+#define MAXPOOLING_1_INPUT_C 3
+#define MAXPOOLING_1_FILTER_W 9
+#define MAXPOOLING_1_FILTER_H 5
+#define MAXPOOLING_1_STRIDE_W 1
+#define MAXPOOLING_1_STRIDE_H 2
+#define MAXPOOLING_1_PAD VALID
+#define MAXPOOLING_1_ACTIVATION_MAX 127
+#define MAXPOOLING_1_ACTIVATION_MIN -128
+#define MAXPOOLING_1_OUTPUT_C 3
+#define MAXPOOLING_1_OUTPUT_W 1
+#define MAXPOOLING_1_OUTPUT_H 1
+#define MAXPOOLING_1_PADDING_H 0
+#define MAXPOOLING_1_PADDING_W 0
@@ -0,0 +1,14 @@
+// Generated by generate_maxpool_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int8_t maxpooling_1_input_tensor[135] = {
+    -100, -82, -85, 56, -42, 29, 0, -20, -110, -47, 92, 73, 62, 99, 9, -110,
+    -114, 58, 110, 35, 66, 88, -44, -38, -8, -10, -116, -38, 38, -40, -59, 56,
+    -35, 100, 84, 58, 53, 57, 100, -46, 76, 108, -1, 122, 14, 127, 53, 104,
+    108, 51, 105, 121, -15, 38, -43, 9, 117, 30, 27, 80, 31, -22, 122, 59,
+    -90, 46, -124, -31, -74, -98, -103, 11, -12, -74, -59, 8, -3, -21, -98, 88,
+    -112, -99, 57, 56, -40, -1, -116, -86, -70, -94, -116, -108, -118, 63, 2, -63,
+    -48, -34, -128, 69, -106, -2, -51, -110, -126, 48, -71, 18, 44, 122, -113, 29,
+    101, -105, 7, 77, -50, 114, -13, -81, 33, -76, -116, 101, -63, 73, 121, 39,
+    -55, 46, 4, 6, 86, -119, -57};
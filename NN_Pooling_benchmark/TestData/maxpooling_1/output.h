@@ -0,0 +1,6 @@
+// Generated by generate_maxpool_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int8_t maxpooling_1_output[3] = {
+    127, 122, 122};
@@ -0,0 +1,9 @@
+// Generated by generate_maxpool_test_data.py (seed 3).
+#pragma once
+#include <stdint.h>
+
+const int8_t maxpooling_2_output[60] = {
+    -7, 112, 61, 114, -30, 112, 115, 75, 114, -10, 112, 115, 75, -9, -10, 112,
+    115, 75, 9, 114, 70, 90, 74, 99, 114, 70, 90, 74, 99, 125, 70, 90,
+    95, 99, 125, 69, 51, 95, 26, 125, 69, 51, 95, 39, 87, 69, 51, 80,
+    39, 44, 118, 119, 17, 48, -75, 118, 119, 17, 48, -94};
@@ -0,0 +1,3 @@
+#include "../../TestData/maxpooling_2/config_data.h"
+#include "../../TestData/maxpooling_2/input_tensor.h"
+#include "../../TestData/maxpooling_2/output.h"
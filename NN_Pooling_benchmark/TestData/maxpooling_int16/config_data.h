@@ -0,0 +1,19 @@
+// Generated by generate_maxpool_test_data.py (seed 4).
+#pragma once
+#define MAXPOOLING_INT16_BATCH_SIZE 1
+#define MAXPOOLING_INT16_INPUT_N 1
+#define MAXPOOLING_INT16_INPUT_W 6
+#define MAXPOOLING_INT16_INPUT_H 4
+#define MAXPOOLING_INT16_INPUT_C 17
+#define MAXPOOLING_INT16_FILTER_W 2
+#define MAXPOOLING_INT16_FILTER_H 3
+#define MAXPOOLING_INT16_STRIDE_W 2
+#define MAXPOOLING_INT16_STRIDE_H 1
+#define MAXPOOLING_INT16_PAD SAME
+#define MAXPOOLING_INT16_ACTIVATION_MAX 32767
+#define MAXPOOLING_INT16_ACTIVATION_MIN -32768
+#define MAXPOOLING_INT16_OUTPUT_C 17
+#define MAXPOOLING_INT16_OUTPUT_W 3
+#define MAXPOOLING_INT16_OUTPUT_H 4
+#define MAXPOOLING_INT16_PADDING_H 1
+#define MAXPOOLING_INT16_PADDING_W 0
@@ -0,0 +1,31 @@
+// Generated by generate_maxpool_test_data.py (seed 4).
+#pragma once
+#include <stdint.h>
+
+const int16_t maxpooling_int16_input_tensor[408] = {
+    -1829, 6985, -19246, 19144, 29999, -12456, -20959, -24050, -30171, 19869, 5161, -25055, -3680, 14450, 3497, -10137,
+    -18851, 1536, -4667, -29408, 1344, 2850, -7415, -11165, 7844, 5195, 16042, -21402, 11456, 18079, -148, -9465,
+    -351, 29306, 3931, -21058, 6585, -31823, 5497, 8095, -7193, 21488, 22771, 5007, 23729, 26394, -11624, -2199,
+    7223, 1265, -27101, -22142, -26697, 27875, 3988, 28998, 12169, -13755, -7134, -24060, 21337, -6204, 25054, 3447,
+    -8690, 13871, 24369, 9262, -6723, 9638, -19533, -24693, -2770, 3601, -1650, -16759, 10625, -9498, 5364, 27396,
+    -29403, -27157, 14035, -21941, 4677, 10108, -30385, 9543, 5111, 9394, -12726, 21027, -22577, 5689, -7679, 25446,
+    5504, -14885, 6, 17253, -11941, 10657, -31537, 14853, -26897, 26841, -10543, 15098, 14774, 5286, -20041, 24815,
+    -5606, 22800, -5516, -17876, -24991, -24615, -25524, -10661, -13155, -27409, 31544, -124, 9362, -28106, -16742, 5623,
+    20882, -6520, 29853, -6322, -1067, 24748, 21053, 31711, -27936, -4056, 22442, 25362, -186, 23309, -4494, 32581,
+    -8165, -28620, -27944, 575, 443, -998, -5497, -2430, 21906, 1531, -14195, 9832, -26048, 8456, -17452, 20049,
+    -27460, 32019, 18018, -20591, 23607, -5123, -11082, 11349, 6056, 28996, 8524, 22280, -4557, 2398, 11603, 18636,
+    32294, -23019, 3942, -7700, -26930, 18979, -16039, 2548, -24841, -10845, 28124, 29122, 20149, 18408, -4124, -32339,
+    -5087, -12224, -31050, 961, -17579, 19108, 17181, -3627, -25769, -6335, -11548, 10570, 29033, 24856, -29309, -22415,
+    -28288, -17968, 31304, 911, -14581, -27345, 14754, -22323, -31386, 6152, 12702, -22973, -21609, 26708, 17191, -5853,
+    8017, 18170, -2137, 31018, 19668, -20301, -22650, -17767, 15188, 24111, 21743, 25459, -23997, -7098, 6855, 29973,
+    22605, -17279, -10830, 15938, -11427, -9654, -13199, 10034, 32015, 11611, 1128, -32129, -10656, -32039, 8102, -16915,
+    -18241, 30999, 30703, -22848, -598, 21125, 5695, 13997, -2726, -9121, -32547, -25832, 8293, 28446, 7294, 25002,
+    25174, 18586, -14331, 222, 14703, 11802, -15303, 24038, -21947, -13902, -9481, 4635, 15989, -6883, 13164, -20518,
+    -22668, 19994, -9218, 10439, 15976, 10049, -9880, 6629, -29731, -30134, -21141, 14289, -19871, -11998, -8861, 32144,
+    -22689, -17456, -10221, 30032, -3648, 6929, 20461, -1648, 31435, -3786, 7821, 15416, -2574, 10042, 26461, 19689,
+    19747, 8274, 4426, 24679, 21176, -31041, 168, -8665, 27333, 14981, 20210, 18172, -29109, -12314, -23893, 27288,
+    12766, 8157, -20796, 1035, 30599, -3649, 29733, -24080, -13275, -1528, -23714, 6450, -15383, -26623, -11362, 19386,
+    1616, -30340, -605, -12122, -20086, -5835, -28607, 8718, -22028, -16808, 2703, -24739, 5119, -10182, -13213, 21621,
+    -15730, -22111, 14982, -32428, -12350, 21223, -12557, -4581, 6306, 30695, -23882, 16511, -10744, -11349, 795, 18523,
+    6928, 19742, 10278, -10452, 17931, -24652, 22686, -29092, 3748, -30278, 7077, -12778, -21520, -12233, -17569, -30753,
+    -2357, -2455, -31640, 29714, -8508, 26516, 16968, 11302};
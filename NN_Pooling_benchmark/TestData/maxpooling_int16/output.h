@@ -0,0 +1,18 @@
+// Generated by generate_maxpool_test_data.py (seed 4).
+#pragma once
+#include <stdint.h>
+
+const int16_t maxpooling_int16_output[204] = {
+    1536, 14853, -19246, 31544, 29999, 15098, 14774, 7844, 5623, 24815, 5161, 29853, 18079, 14450, 24748, 21053,
+    31711, 3931, -4056, 27875, 25362, 28998, 23309, 20049, 32581, 32019, 21337, 23729, 26394, 3447, -998, 13871,
+    24369, 28996, 29122, 22280, 18408, 5111, 11603, 18636, 32294, -16759, 10625, -7679, 25446, 27396, -3627, 2548,
+    17253, -10845, 28124, 29033, 24856, -5853, 31544, 29999, 15098, 31304, 19668, 5623, 24815, 14754, 29853, 24111,
+    21743, 25459, 21053, 31711, 6855, 29973, 30999, 30703, 28998, 23309, 21125, 32581, 32019, 21337, 32015, 26394,
+    3447, 8293, 28446, 24369, 28996, 29122, 22280, 18408, 15976, 14703, 18636, 32294, 24038, 10625, -7679, 25446,
+    27396, 15989, 2548, 32144, -10845, 28124, 29033, 30032, -3648, 31544, 20461, 27333, 31435, 20210, 18172, 24815,
+    14754, 29853, 27288, 21743, 25459, 21053, 31711, 30599, 29973, 30999, 30703, 8456, 23309, 21125, 32581, 32019,
+    18018, 32015, 23607, 1616, 14982, 28446, 7294, 28996, 29122, 22280, 18408, 30695, 14703, 18636, 32294, 24038,
+    3942, 18523, 19108, 19742, 29714, 2548, 32144, 16968, 28124, 29033, 30032, -3648, 8017, 20461, 27333, 31435,
+    20210, 18172, 15416, 14754, 15188, 27288, 21743, 25459, 8274, 4426, 30599, 29973, 30999, 30703, -10830, 15938,
+    21125, 6450, 13997, 10034, 32015, 19386, 1616, 14982, 28446, 7294, 25002, 25174, 18586, 10439, 30695, 14703,
+    16511, 6629, 24038, 795, 18523, 14289, 19742, 29714, -6883, 32144, 16968, 22686};
@@ -0,0 +1,3 @@
+#include "../../TestData/maxpooling_int16/config_data.h"
+#include "../../TestData/maxpooling_int16/input_tensor.h"
+#include "../../TestData/maxpooling_int16/output.h"
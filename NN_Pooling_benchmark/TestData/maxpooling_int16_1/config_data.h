@@ -0,0 +1,19 @@
+// Generated by generate_maxpool_test_data.py (seed 5).
+#pragma once
+#define MAXPOOLING_INT16_1_BATCH_SIZE 3
+#define MAXPOOLING_INT16_1_INPUT_N 3
+#define MAXPOOLING_INT16_1_INPUT_W 9
+#define MAXPOOLING_INT16_1_INPUT_H 1
+#define MAXPOOLING_INT16_1_INPUT_C 2
+#define MAXPOOLING_INT16_1_FILTER_W 1
+#define MAXPOOLING_INT16_1_FILTER_H 1
+#define MAXPOOLING_INT16_1_STRIDE_W 2
+#define MAXPOOLING_INT16_1_STRIDE_H 1
+#define MAXPOOLING_INT16_1_PAD VALID
+#define MAXPOOLING_INT16_1_ACTIVATION_MAX 32767
+#define MAXPOOLING_INT16_1_ACTIVATION_MIN -32768
+#define MAXPOOLING_INT16_1_OUTPUT_C 2
+#define MAXPOOLING_INT16_1_OUTPUT_W 5
+#define MAXPOOLING_INT16_1_OUTPUT_H 1
+#define MAXPOOLING_INT16_1_PADDING_H 0
+#define MAXPOOLING_INT16_1_PADDING_W 0
@@ -0,0 +1,9 @@
+// Generated by generate_maxpool_test_data.py (seed 5).
+#pragma once
+#include <stdint.h>
+
+const int16_t maxpooling_int16_1_input_tensor[54] = {
+    713, 14225, -28967, 28262, -125, -25972, -12210, -17930, 15963, 28713, -450, 17138, -19403, -88, -31050, -4361,
+    20729, 3864, -8903, 18276, -11849, -23340, -14580, 25537, -16162, -15435, -32536, -32072, -5315, -4525, -11029, -10947,
+    5151, 8342, -6700, -5928, -8957, -6963, 17461, 6394, -29941, 14573, 21614, -11016, -13671, 1810, -24231, 10728,
+    6731, -32325, 11520, -24115, 7858, 13808};
@@ -0,0 +1,7 @@
+// Generated by generate_maxpool_test_data.py (seed 5).
+#pragma once
+#include <stdint.h>
+
+const int16_t maxpooling_int16_1_output[30] = {
+    713, 14225, -125, -25972, 15963, 28713, -19403, -88, 20729, 3864, -8903, 18276, -14580, 25537, -32536, -32072,
+    -11029, -10947, -6700, -5928, -8957, -6963, -29941, 14573, -13671, 1810, 6731, -32325, 7858, 13808};
@@ -0,0 +1,3 @@
+#include "../../TestData/maxpooling_int16_1/config_data.h"
+#include "../../TestData/maxpooling_int16_1/input_tensor.h"
+#include "../../TestData/maxpooling_int16_1/output.h"
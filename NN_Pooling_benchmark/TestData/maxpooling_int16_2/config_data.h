@@ -0,0 +1,19 @@
+// Generated by generate_maxpool_test_data.py (seed 6).
+#pragma once
+#define MAXPOOLING_INT16_2_BATCH_SIZE 1
+#define MAXPOOLING_INT16_2_INPUT_N 1
+#define MAXPOOLING_INT16_2_INPUT_W 9
+#define MAXPOOLING_INT16_2_INPUT_H 1
+#define MAXPOOLING_INT16_2_INPUT_C 20
+#define MAXPOOLING_INT16_2_FILTER_W 1
+#define MAXPOOLING_INT16_2_FILTER_H 1
+#define MAXPOOLING_INT16_2_STRIDE_W 2
+#define MAXPOOLING_INT16_2_STRIDE_H 1
+#define MAXPOOLING_INT16_2_PAD VALID
+#define MAXPOOLING_INT16_2_ACTIVATION_MAX 32767
+#define MAXPOOLING_INT16_2_ACTIVATION_MIN -32768
+#define MAXPOOLING_INT16_2_OUTPUT_C 20
+#define MAXPOOLING_INT16_2_OUTPUT_W 5
+#define MAXPOOLING_INT16_2_OUTPUT_H 1
+#define MAXPOOLING_INT16_2_PADDING_H 0
+#define MAXPOOLING_INT16_2_PADDING_W 0
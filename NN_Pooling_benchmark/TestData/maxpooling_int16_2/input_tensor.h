@@ -0,0 +1,17 @@
+// Generated by generate_maxpool_test_data.py (seed 6).
+#pragma once
+#include <stdint.h>
+
+const int16_t maxpooling_int16_2_input_tensor[180] = {
+    -22208, 30806, 1523, -27942, -32709, -13687, 28869, 16142, 9094, -29899, 2975, 31305, -6802, 21496, -20420, -7474,
+    2034, -21220, 22898, 11217, -20561, 14698, 20964, 63, 25586, -20477, -6926, 5398, -19982, -26781, -6440, 14467,
+    31025, -7377, -29043, 14598, -670, 23552, 7120, 14074, -17094, -21013, -6669, -17456, 2344, 8163, -7049, 17014,
+    30637, -3574, -14667, -5258, -31127, -8029, -10599, -30533, 10867, 7356, 16335, 16699, 18240, 5131, -16144, 31294,
+    -25714, -8474, 22660, 19367, -20188, 25067, -615, -21096, 25704, 25846, 17041, -22745, 23123, 28957, 7007, 20848,
+    -21505, -7584, 2073, 26392, 31151, -10207, -30338, -29902, -16582, 149, 14555, -8185, 827, 26415, 10412, 624,
+    21046, 22510, 30854, 2351, 29453, 29955, 31722, -14132, 16708, 32328, 7297, 28476, 9619, 15266, -11400, 16520,
+    2071, 9189, 19435, 31194, -12035, 5346, -31957, 26130, -25284, -8838, -28822, -18070, 15847, 14681, 32432, -24606,
+    -7520, -12533, 2523, -30826, 22559, 31679, -22831, 28691, -2351, -19641, 15848, 14676, -13768, -871, 8955, -13858,
+    -27830, -20012, -18949, -26836, 29868, 27880, -23725, -28725, -16121, -21818, -11658, 1990, 26474, 32727, -30110, -14802,
+    -8023, 25019, 30036, 24835, 25831, 3461, 29809, -24423, 5473, 14869, 4727, 14436, -28329, -21800, 3379, 3906,
+    3160, 29242, 23684, 25458};
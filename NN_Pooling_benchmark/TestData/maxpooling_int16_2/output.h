@@ -0,0 +1,12 @@
+// Generated by generate_maxpool_test_data.py (seed 6).
+#pragma once
+#include <stdint.h>
+
+const int16_t maxpooling_int16_2_output[100] = {
+    -22208, 30806, 1523, -27942, -32709, -13687, 28869, 16142, 9094, -29899, 2975, 31305, -6802, 21496, -20420, -7474,
+    2034, -21220, 22898, 11217, -17094, -21013, -6669, -17456, 2344, 8163, -7049, 17014, 30637, -3574, -14667, -5258,
+    -31127, -8029, -10599, -30533, 10867, 7356, 16335, 16699, -21505, -7584, 2073, 26392, 31151, -10207, -30338, -29902,
+    -16582, 149, 14555, -8185, 827, 26415, 10412, 624, 21046, 22510, 30854, 2351, -25284, -8838, -28822, -18070,
+    15847, 14681, 32432, -24606, -7520, -12533, 2523, -30826, 22559, 31679, -22831, 28691, -2351, -19641, 15848, 14676,
+    -8023, 25019, 30036, 24835, 25831, 3461, 29809, -24423, 5473, 14869, 4727, 14436, -28329, -21800, 3379, 3906,
+    3160, 29242, 23684, 25458};
@@ -0,0 +1,3 @@
+#include "../../TestData/maxpooling_int16_2/config_data.h"
+#include "../../TestData/maxpooling_int16_2/input_tensor.h"
+#include "../../TestData/maxpooling_int16_2/output.h"
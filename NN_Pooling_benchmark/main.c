@@ -6,6 +6,15 @@ void avgpooling_2_arm_avgpool_s8();
 void avgpooling_int16_arm_avgpool_s16();
 void avgpooling_int16_1_arm_avgpool_s16();
 void avgpooling_int16_2_arm_avgpool_s16();
+void maxpooling_arm_max_pool_s8(void);
+void maxpooling_1_arm_max_pool_s8(void);
+void maxpooling_2_arm_max_pool_s8(void);
+void maxpooling_int16_arm_max_pool_s16(void);
+void maxpooling_int16_1_arm_max_pool_s16(void);
+void maxpooling_int16_2_arm_max_pool_s16(void);
+void maxpooling_arm_max_pool_s8_in_place(void);
+void maxpooling_1_arm_max_pool_s8_in_place(void);
+void maxpooling_int16_2_arm_max_pool_s16_in_place(void);
 
 uint32_t clkFastfreq = 0;
 
@@ -47,6 +56,24 @@ int main(void)
     avgpooling_int16_arm_avgpool_s16();
     avgpooling_int16_1_arm_avgpool_s16();
     avgpooling_int16_2_arm_avgpool_s16();
+    printf("\n\r");
+
+    printf("*****ARM Max Pooling S8*****\n\r");
+    maxpooling_arm_max_pool_s8();
+    maxpooling_1_arm_max_pool_s8();
+    maxpooling_2_arm_max_pool_s8();
+    printf("\n\r");
+
+    printf("*****ARM Max Pooling S16*****\n\r");
+    maxpooling_int16_arm_max_pool_s16();
+    maxpooling_int16_1_arm_max_pool_s16();
+    maxpooling_int16_2_arm_max_pool_s16();
+    printf("\n\r");
+
+    printf("*****ARM Max Pooling In-Place*****\n\r");
+    maxpooling_arm_max_pool_s8_in_place();
+    maxpooling_1_arm_max_pool_s8_in_place();
+    maxpooling_int16_2_arm_max_pool_s16_in_place();
 
     printf("All tests are passed.\n\r");
 	printf("Finish Pooling Functions benchmark\n\r");
@@ -0,0 +1,149 @@
+#include "main.h"
+#include "TestData/maxpooling_int16/test_data.h"
+#include "TestData/maxpooling_int16_1/test_data.h"
+#include "TestData/maxpooling_int16_2/test_data.h"
+
+RAM_FUNC static void run_max_pool_s16(const char *name,
+                                      const cmsis_nn_pool_params *pool_params,
+                                      const cmsis_nn_dims *input_dims,
+                                      const int16_t *input_data,
+                                      const cmsis_nn_dims *filter_dims,
+                                      const cmsis_nn_dims *output_dims,
+                                      int16_t *output,
+                                      const int16_t *output_ref,
+                                      int32_t output_ref_size)
+{
+    // arm_max_pool_s16 does not use a scratch buffer
+    cmsis_nn_context ctx;
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_cmsis_nn_status result = arm_max_pool_s16(&ctx, pool_params, input_dims, input_data,
+                                                  filter_dims, output_dims, output);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n\r");
+    if (result == ARM_CMSIS_NN_SUCCESS && validate_s16(output, output_ref, output_ref_size)) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("%s output validation FAILED\n\r", name);
+    }
+}
+
+RAM_FUNC void maxpooling_int16_arm_max_pool_s16(void)
+{
+    int16_t output[MAXPOOLING_INT16_OUTPUT_W * MAXPOOLING_INT16_OUTPUT_H *
+                   MAXPOOLING_INT16_BATCH_SIZE * MAXPOOLING_INT16_OUTPUT_C] = {0};
+
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = MAXPOOLING_INT16_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_INT16_INPUT_W;
+    input_dims.h = MAXPOOLING_INT16_INPUT_H;
+    input_dims.c = MAXPOOLING_INT16_INPUT_C;
+    filter_dims.w = MAXPOOLING_INT16_FILTER_W;
+    filter_dims.h = MAXPOOLING_INT16_FILTER_H;
+    output_dims.w = MAXPOOLING_INT16_OUTPUT_W;
+    output_dims.h = MAXPOOLING_INT16_OUTPUT_H;
+    output_dims.c = MAXPOOLING_INT16_OUTPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_INT16_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_INT16_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_INT16_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_INT16_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_INT16_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_INT16_ACTIVATION_MAX;
+
+    run_max_pool_s16("maxpooling_int16_arm_max_pool_s16",
+                     &pool_params, &input_dims, maxpooling_int16_input_tensor, &filter_dims, &output_dims,
+                     output, maxpooling_int16_output, sizeof(output) / sizeof(output[0]));
+}
+
+RAM_FUNC void maxpooling_int16_1_arm_max_pool_s16(void)
+{
+    int16_t output[MAXPOOLING_INT16_1_OUTPUT_W * MAXPOOLING_INT16_1_OUTPUT_H *
+                   MAXPOOLING_INT16_1_BATCH_SIZE * MAXPOOLING_INT16_1_OUTPUT_C] = {0};
+
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = MAXPOOLING_INT16_1_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_INT16_1_INPUT_W;
+    input_dims.h = MAXPOOLING_INT16_1_INPUT_H;
+    input_dims.c = MAXPOOLING_INT16_1_INPUT_C;
+    filter_dims.w = MAXPOOLING_INT16_1_FILTER_W;
+    filter_dims.h = MAXPOOLING_INT16_1_FILTER_H;
+    output_dims.w = MAXPOOLING_INT16_1_OUTPUT_W;
+    output_dims.h = MAXPOOLING_INT16_1_OUTPUT_H;
+    output_dims.c = MAXPOOLING_INT16_1_OUTPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_INT16_1_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_INT16_1_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_INT16_1_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_INT16_1_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_INT16_1_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_INT16_1_ACTIVATION_MAX;
+
+    run_max_pool_s16("maxpooling_int16_1_arm_max_pool_s16",
+                     &pool_params, &input_dims, maxpooling_int16_1_input_tensor, &filter_dims, &output_dims,
+                     output, maxpooling_int16_1_output, sizeof(output) / sizeof(output[0]));
+}
+
+RAM_FUNC void maxpooling_int16_2_arm_max_pool_s16(void)
+{
+    int16_t output[MAXPOOLING_INT16_2_OUTPUT_W * MAXPOOLING_INT16_2_OUTPUT_H *
+                   MAXPOOLING_INT16_2_BATCH_SIZE * MAXPOOLING_INT16_2_OUTPUT_C] = {0};
+
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = MAXPOOLING_INT16_2_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_INT16_2_INPUT_W;
+    input_dims.h = MAXPOOLING_INT16_2_INPUT_H;
+    input_dims.c = MAXPOOLING_INT16_2_INPUT_C;
+    filter_dims.w = MAXPOOLING_INT16_2_FILTER_W;
+    filter_dims.h = MAXPOOLING_INT16_2_FILTER_H;
+    output_dims.w = MAXPOOLING_INT16_2_OUTPUT_W;
+    output_dims.h = MAXPOOLING_INT16_2_OUTPUT_H;
+    output_dims.c = MAXPOOLING_INT16_2_OUTPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_INT16_2_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_INT16_2_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_INT16_2_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_INT16_2_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_INT16_2_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_INT16_2_ACTIVATION_MAX;
+
+    run_max_pool_s16("maxpooling_int16_2_arm_max_pool_s16",
+                     &pool_params, &input_dims, maxpooling_int16_2_input_tensor, &filter_dims, &output_dims,
+                     output, maxpooling_int16_2_output, sizeof(output) / sizeof(output[0]));
+}
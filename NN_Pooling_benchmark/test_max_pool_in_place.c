@@ -0,0 +1,222 @@
+#include "main.h"
+#include "TestData/maxpooling/config_data.h"
+#include "TestData/maxpooling_1/config_data.h"
+#include "TestData/maxpooling_int16_2/config_data.h"
+
+// Reference tensors are defined once, in test_arm_max_pool_s8.c / test_arm_max_pool_s16.c
+extern const int8_t maxpooling_input_tensor[];
+extern const int8_t maxpooling_output[];
+extern const int8_t maxpooling_1_input_tensor[];
+extern const int8_t maxpooling_1_output[];
+extern const int16_t maxpooling_int16_2_input_tensor[];
+extern const int16_t maxpooling_int16_2_output[];
+
+/*
+ * Max pooling with the output written over the input activation buffer.
+ *
+ * arm_max_pool_* writes output pixels in raster order and only reads input pixels inside the
+ * current window. Without padding the window of output pixel o starts at input pixel
+ * (y * stride_h * in_w + x * stride_w) >= o, so every input pixel is read before it is
+ * overwritten. With padding the clipped window of a later output can start before o, so
+ * those layers must keep a separate output buffer.
+ */
+static int max_pool_in_place_supported(const cmsis_nn_pool_params *pool_params,
+                                       const cmsis_nn_dims *input_dims,
+                                       const cmsis_nn_dims *output_dims)
+{
+    return pool_params->padding.w == 0 && pool_params->padding.h == 0 &&
+           pool_params->stride.w >= 1 && pool_params->stride.h >= 1 &&
+           input_dims->c == output_dims->c;
+}
+
+static void print_in_place_result(const char *name, int passed, uint32_t cycle_count,
+                                  uint32_t stack_used, uint32_t saved_bytes)
+{
+    float time_us = (float)cycle_count / clkFastfreq * 1e6f;
+
+    printf("\n\r");
+    if (passed) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Output Buffer Saved: %lu bytes\n\r\n", (unsigned long)saved_bytes);
+    } else {
+        printf("%s output validation FAILED\n\r", name);
+    }
+}
+
+RAM_FUNC static void run_max_pool_s8_in_place(const char *name,
+                                              const cmsis_nn_pool_params *pool_params,
+                                              const cmsis_nn_dims *input_dims,
+                                              const int8_t *input_data,
+                                              const cmsis_nn_dims *filter_dims,
+                                              const cmsis_nn_dims *output_dims,
+                                              const int8_t *output_ref)
+{
+    const int32_t input_size = input_dims->n * input_dims->h * input_dims->w * input_dims->c;
+    const int32_t output_size = input_dims->n * output_dims->h * output_dims->w * output_dims->c;
+    cmsis_nn_context ctx;
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    if (!max_pool_in_place_supported(pool_params, input_dims, output_dims)) {
+        printf("\n\r%s: in-place not supported with padding, separate output buffer required\n\r\n", name);
+        return;
+    }
+
+    // Activation buffer holding the input, reused for the output
+    int8_t *activation = malloc(input_size);
+    if (!activation) {
+        printf("Failed to allocate activation buffer\n\r");
+        return;
+    }
+    memcpy(activation, input_data, input_size);
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_cmsis_nn_status result = arm_max_pool_s8(&ctx, pool_params, input_dims, activation,
+                                                 filter_dims, output_dims, activation);
+
+    uint32_t cycle_count = read_cycle_counter() - start_cycles;
+    uint32_t stack_used = measure_stack_usage();
+
+    print_in_place_result(name,
+                          result == ARM_CMSIS_NN_SUCCESS && validate(activation, output_ref, output_size),
+                          cycle_count, stack_used, (uint32_t)output_size);
+    free(activation);
+}
+
+RAM_FUNC static void run_max_pool_s16_in_place(const char *name,
+                                               const cmsis_nn_pool_params *pool_params,
+                                               const cmsis_nn_dims *input_dims,
+                                               const int16_t *input_data,
+                                               const cmsis_nn_dims *filter_dims,
+                                               const cmsis_nn_dims *output_dims,
+                                               const int16_t *output_ref)
+{
+    const int32_t input_size = input_dims->n * input_dims->h * input_dims->w * input_dims->c;
+    const int32_t output_size = input_dims->n * output_dims->h * output_dims->w * output_dims->c;
+    cmsis_nn_context ctx;
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    if (!max_pool_in_place_supported(pool_params, input_dims, output_dims)) {
+        printf("\n\r%s: in-place not supported with padding, separate output buffer required\n\r\n", name);
+        return;
+    }
+
+    int16_t *activation = malloc(input_size * sizeof(int16_t));
+    if (!activation) {
+        printf("Failed to allocate activation buffer\n\r");
+        return;
+    }
+    memcpy(activation, input_data, input_size * sizeof(int16_t));
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_cmsis_nn_status result = arm_max_pool_s16(&ctx, pool_params, input_dims, activation,
+                                                  filter_dims, output_dims, activation);
+
+    uint32_t cycle_count = read_cycle_counter() - start_cycles;
+    uint32_t stack_used = measure_stack_usage();
+
+    print_in_place_result(name,
+                          result == ARM_CMSIS_NN_SUCCESS && validate_s16(activation, output_ref, output_size),
+                          cycle_count, stack_used, (uint32_t)(output_size * sizeof(int16_t)));
+    free(activation);
+}
+
+RAM_FUNC void maxpooling_arm_max_pool_s8_in_place(void)
+{
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = MAXPOOLING_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_INPUT_W;
+    input_dims.h = MAXPOOLING_INPUT_H;
+    input_dims.c = MAXPOOLING_INPUT_C;
+    filter_dims.w = MAXPOOLING_FILTER_W;
+    filter_dims.h = MAXPOOLING_FILTER_H;
+    output_dims.w = MAXPOOLING_OUTPUT_W;
+    output_dims.h = MAXPOOLING_OUTPUT_H;
+    output_dims.c = MAXPOOLING_OUTPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_ACTIVATION_MAX;
+
+    run_max_pool_s8_in_place("maxpooling_arm_max_pool_s8_in_place",
+                             &pool_params, &input_dims, maxpooling_input_tensor, &filter_dims, &output_dims,
+                             maxpooling_output);
+}
+
+RAM_FUNC void maxpooling_1_arm_max_pool_s8_in_place(void)
+{
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = MAXPOOLING_1_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_1_INPUT_W;
+    input_dims.h = MAXPOOLING_1_INPUT_H;
+    input_dims.c = MAXPOOLING_1_INPUT_C;
+    filter_dims.w = MAXPOOLING_1_FILTER_W;
+    filter_dims.h = MAXPOOLING_1_FILTER_H;
+    output_dims.w = MAXPOOLING_1_OUTPUT_W;
+    output_dims.h = MAXPOOLING_1_OUTPUT_H;
+    output_dims.c = MAXPOOLING_1_OUTPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_1_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_1_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_1_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_1_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_1_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_1_ACTIVATION_MAX;
+
+    run_max_pool_s8_in_place("maxpooling_1_arm_max_pool_s8_in_place",
+                             &pool_params, &input_dims, maxpooling_1_input_tensor, &filter_dims, &output_dims,
+                             maxpooling_1_output);
+}
+
+RAM_FUNC void maxpooling_int16_2_arm_max_pool_s16_in_place(void)
+{
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = MAXPOOLING_INT16_2_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_INT16_2_INPUT_W;
+    input_dims.h = MAXPOOLING_INT16_2_INPUT_H;
+    input_dims.c = MAXPOOLING_INT16_2_INPUT_C;
+    filter_dims.w = MAXPOOLING_INT16_2_FILTER_W;
+    filter_dims.h = MAXPOOLING_INT16_2_FILTER_H;
+    output_dims.w = MAXPOOLING_INT16_2_OUTPUT_W;
+    output_dims.h = MAXPOOLING_INT16_2_OUTPUT_H;
+    output_dims.c = MAXPOOLING_INT16_2_OUTPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_INT16_2_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_INT16_2_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_INT16_2_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_INT16_2_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_INT16_2_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_INT16_2_ACTIVATION_MAX;
+
+    run_max_pool_s16_in_place("maxpooling_int16_2_arm_max_pool_s16_in_place",
+                              &pool_params, &input_dims, maxpooling_int16_2_input_tensor, &filter_dims, &output_dims,
+                              maxpooling_int16_2_output);
+}
@@ -0,0 +1,107 @@
+"""Generate reference vectors for arm_max_pool_s8 and arm_max_pool_s16.
+
+The cases mirror the geometry of the avgpooling* TestData (same input, filter, stride and
+padding), so max and average pooling can be compared shape for shape. The reference follows
+TFLite max pooling: padded positions are skipped, and the result is clamped to the
+activation range.
+
+Usage:
+    python generate_maxpool_test_data.py [<TestData dir>]
+"""
+
+import os
+import random
+import sys
+
+
+def out_size(in_size, filt, stride, pad):
+    if pad == 'SAME':
+        return (in_size + stride - 1) // stride
+    return (in_size - filt) // stride + 1
+
+
+def pad_size(in_size, out, filt, stride):
+    return max(0, ((out - 1) * stride + filt - in_size) // 2)
+
+
+def max_pool(inp, n, in_h, in_w, ch, f_h, f_w, s_h, s_w, pad_h, pad_w, out_h, out_w, act_min, act_max):
+    out = []
+    for b in range(n):
+        for y in range(out_h):
+            for x in range(out_w):
+                y0, x0 = y * s_h - pad_h, x * s_w - pad_w
+                for c in range(ch):
+                    best = None
+                    for ky in range(max(0, -y0), min(f_h, in_h - y0)):
+                        for kx in range(max(0, -x0), min(f_w, in_w - x0)):
+                            v = inp[((b * in_h + y0 + ky) * in_w + x0 + kx) * ch + c]
+                            best = v if best is None else max(best, v)
+                    out.append(min(max(best, act_min), act_max))
+    return out
+
+
+def c_array(ctype, name, values, per_line=16):
+    lines = []
+    for k in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[k:k + per_line]))
+    return 'const %s %s[%d] = {\n%s};\n' % (ctype, name, len(values), ',\n'.join(lines))
+
+
+CASES = [
+    # name,                 bits, batch, in_w, in_h, ch, filter_w, filter_h, stride_w, stride_h, pad
+    ('maxpooling',          8,    1,     22,   12,   20, 6,        5,        9,        5,        'SAME'),
+    ('maxpooling_1',        8,    1,     9,    5,    3,  9,        5,        1,        2,        'VALID'),
+    ('maxpooling_2',        8,    1,     12,   1,    5,  3,        1,        1,        2,        'SAME'),
+    ('maxpooling_int16',    16,   1,     6,    4,    17, 2,        3,        2,        1,        'SAME'),
+    ('maxpooling_int16_1',  16,   3,     9,    1,    2,  1,        1,        2,        1,        'VALID'),
+    ('maxpooling_int16_2',  16,   1,     9,    1,    20, 1,        1,        2,        1,        'VALID'),
+]
+
+
+def generate(out_root, seed, name, bits, n, in_w, in_h, ch, f_w, f_h, s_w, s_h, pad):
+    rng = random.Random(seed)
+    lo, hi = -(1 << (bits - 1)), (1 << (bits - 1)) - 1
+    ctype = 'int8_t' if bits == 8 else 'int16_t'
+
+    out_w, out_h = out_size(in_w, f_w, s_w, pad), out_size(in_h, f_h, s_h, pad)
+    pad_w = pad_size(in_w, out_w, f_w, s_w) if pad == 'SAME' else 0
+    pad_h = pad_size(in_h, out_h, f_h, s_h) if pad == 'SAME' else 0
+
+    inp = [rng.randint(lo, hi) for _ in range(n * in_h * in_w * ch)]
+    out = max_pool(inp, n, in_h, in_w, ch, f_h, f_w, s_h, s_w, pad_h, pad_w, out_h, out_w, lo, hi)
+
+    out_dir = os.path.join(out_root, name)
+    os.makedirs(out_dir, exist_ok=True)
+    banner = '// Generated by generate_maxpool_test_data.py (seed %d).\n' % seed
+    N = name.upper() + '_'
+    config = [('BATCH_SIZE', n), ('INPUT_N', n), ('INPUT_W', in_w), ('INPUT_H', in_h), ('INPUT_C', ch),
+              ('FILTER_W', f_w), ('FILTER_H', f_h), ('STRIDE_W', s_w), ('STRIDE_H', s_h), ('PAD', pad),
+              ('ACTIVATION_MAX', hi), ('ACTIVATION_MIN', lo), ('OUTPUT_C', ch), ('OUTPUT_W', out_w),
+              ('OUTPUT_H', out_h), ('PADDING_H', pad_h), ('PADDING_W', pad_w)]
+    files = {
+        'config_data.h': ''.join('#define %s%s %s\n' % (N, k, v) for k, v in config),
+        'input_tensor.h': c_array(ctype, name + '_input_tensor', inp),
+        'output.h': c_array(ctype, name + '_output', out),
+    }
+    for fname, body in files.items():
+        with open(os.path.join(out_dir, fname), 'w') as f:
+            f.write(banner + '#pragma once\n')
+            if fname != 'config_data.h':
+                f.write('#include <stdint.h>\n\n')
+            f.write(body)
+
+    with open(os.path.join(out_dir, 'test_data.h'), 'w') as f:
+        for fname in ('config_data.h', 'input_tensor.h', 'output.h'):
+            f.write('#include "../../TestData/%s/%s"\n' % (name, fname))
+
+    print('[*] %s: output %dx%dx%d, padding h%d w%d' % (name, out_h, out_w, ch, pad_h, pad_w))
+
+
+def main():
+    out_root = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), '..', 'TestData')
+    for seed, case in enumerate(CASES, start=1):
+        generate(out_root, seed, *case)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,6 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int32_t basic_biases[1] = {6388};
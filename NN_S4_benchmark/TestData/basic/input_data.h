@@ -0,0 +1,8 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int8_t basic_input[40] = {73, -88, -95, 57,  106, 13, 34,  -103, 86, 12,  107,  37,  -4,  -22,
+                                16, -87, 4,   -11, -21, 52, 41,  -122, 90, 124, -62,  -23, 103, 66,
+                                68, 94,  -93, 89,  -4,  68, -89, -66,  3,  4,   -108, 63};
@@ -0,0 +1,7 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int8_t basic_output_ref[20] = {-11, 37, 68,  -53, -8,  -47, -1,  -6, 29,  -86,
+                                     -34, 27, -40, 34,  -71, 4,   -72, 21, -14, -35};
@@ -0,0 +1,9 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#include "../../TestData/basic/biases_data.h"
+#include "../../TestData/basic/config_data.h"
+#include "../../TestData/basic/input_data.h"
+#include "../../TestData/basic/output_mult_data.h"
+#include "../../TestData/basic/output_ref_data.h"
+#include "../../TestData/basic/output_shift_data.h"
+#include "../../TestData/basic/weights_data.h"
@@ -0,0 +1,6 @@
+// Generated by pack_s4_test_data.py from the s8 case "basic".
+#pragma once
+#include <stdint.h>
+
+const int32_t basic_s4_biases[1] = {
+    352};
@@ -0,0 +1,24 @@
+// Generated by pack_s4_test_data.py from the s8 case "basic".
+#pragma once
+#define BASIC_S4_OUT_CH 1
+#define BASIC_S4_IN_CH 1
+#define BASIC_S4_INPUT_W 5
+#define BASIC_S4_INPUT_H 8
+#define BASIC_S4_DST_SIZE 20
+#define BASIC_S4_INPUT_SIZE 40
+#define BASIC_S4_OUT_ACTIVATION_MIN -128
+#define BASIC_S4_OUT_ACTIVATION_MAX 127
+#define BASIC_S4_INPUT_BATCHES 1
+#define BASIC_S4_FILTER_X 2
+#define BASIC_S4_FILTER_Y 4
+#define BASIC_S4_STRIDE_X 1
+#define BASIC_S4_STRIDE_Y 1
+#define BASIC_S4_PAD_X 0
+#define BASIC_S4_PAD_Y 0
+#define BASIC_S4_OUTPUT_W 4
+#define BASIC_S4_OUTPUT_H 5
+#define BASIC_S4_INPUT_OFFSET 128
+#define BASIC_S4_OUTPUT_OFFSET 127
+#define BASIC_S4_DILATION_X 1
+#define BASIC_S4_DILATION_Y 1
+#define BASIC_S4_WEIGHTS_SIZE 4
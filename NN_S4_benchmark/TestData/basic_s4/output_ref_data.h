@@ -0,0 +1,7 @@
+// Generated by pack_s4_test_data.py from the s8 case "basic".
+#pragma once
+#include <stdint.h>
+
+const int8_t basic_s4_output_ref[20] = {
+    -17, 36, 68, -51, -5, -50, 3, -2, 26, -79, -32, 25, -37, 34, -73, 6,
+    -72, 19, -12, -42};
@@ -0,0 +1,24 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#define CONV_2X2_DILATION_OUT_CH 2
+#define CONV_2X2_DILATION_IN_CH 2
+#define CONV_2X2_DILATION_INPUT_W 10
+#define CONV_2X2_DILATION_INPUT_H 10
+#define CONV_2X2_DILATION_DST_SIZE 72
+#define CONV_2X2_DILATION_INPUT_SIZE 200
+#define CONV_2X2_DILATION_OUT_ACTIVATION_MIN -61
+#define CONV_2X2_DILATION_OUT_ACTIVATION_MAX 107
+#define CONV_2X2_DILATION_INPUT_BATCHES 1
+#define CONV_2X2_DILATION_FILTER_X 3
+#define CONV_2X2_DILATION_FILTER_Y 3
+#define CONV_2X2_DILATION_STRIDE_X 1
+#define CONV_2X2_DILATION_STRIDE_Y 1
+#define CONV_2X2_DILATION_PAD_X 0
+#define CONV_2X2_DILATION_PAD_Y 0
+#define CONV_2X2_DILATION_OUTPUT_W 6
+#define CONV_2X2_DILATION_OUTPUT_H 6
+#define CONV_2X2_DILATION_INPUT_OFFSET 128
+#define CONV_2X2_DILATION_OUTPUT_OFFSET -128
+#define CONV_2X2_DILATION_DILATION_X 2
+#define CONV_2X2_DILATION_DILATION_Y 2
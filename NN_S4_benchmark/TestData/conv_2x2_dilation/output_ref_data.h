@@ -0,0 +1,10 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int8_t conv_2x2_dilation_output_ref[72] = {
+    -61, -59, -35, 4,   -61, -39, -61, 40,  -61, -47, -61, -34, -61, -8,  61,  -61, -61, 23,
+    -61, 107, -61, -61, -61, -6,  -61, -45, -61, 32,  -20, -31, -61, 71,  -31, 12,  -25, -61,
+    -61, -61, -61, -61, -61, -61, -51, 14,  -61, -61, -61, -61, -61, -45, 0,   107, -61, -29,
+    -61, -11, -61, -14, -61, 29,  -61, -61, -61, -4,  -61, 40,  -14, -37, -61, -54, -61, 37};
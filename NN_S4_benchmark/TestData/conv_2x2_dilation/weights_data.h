@@ -0,0 +1,8 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int8_t conv_2x2_dilation_weights[36] = {103,  55,  -22, 60,   -73, 71,  -52, 49,  104, 9,   68,  -102,
+                                              -112, 80,  127, -82,  -79, -11, -25, 127, 53,  -17, 15,  49,
+                                              108,  -29, 104, -121, -19, 38,  90,  13,  24,  0,   -20, 18};
@@ -0,0 +1,24 @@
+// Generated by pack_s4_test_data.py from the s8 case "conv_2x2_dilation".
+#pragma once
+#define CONV_2X2_DILATION_S4_OUT_CH 2
+#define CONV_2X2_DILATION_S4_IN_CH 2
+#define CONV_2X2_DILATION_S4_INPUT_W 10
+#define CONV_2X2_DILATION_S4_INPUT_H 10
+#define CONV_2X2_DILATION_S4_DST_SIZE 72
+#define CONV_2X2_DILATION_S4_INPUT_SIZE 200
+#define CONV_2X2_DILATION_S4_OUT_ACTIVATION_MIN -61
+#define CONV_2X2_DILATION_S4_OUT_ACTIVATION_MAX 107
+#define CONV_2X2_DILATION_S4_INPUT_BATCHES 1
+#define CONV_2X2_DILATION_S4_FILTER_X 3
+#define CONV_2X2_DILATION_S4_FILTER_Y 3
+#define CONV_2X2_DILATION_S4_STRIDE_X 1
+#define CONV_2X2_DILATION_S4_STRIDE_Y 1
+#define CONV_2X2_DILATION_S4_PAD_X 0
+#define CONV_2X2_DILATION_S4_PAD_Y 0
+#define CONV_2X2_DILATION_S4_OUTPUT_W 6
+#define CONV_2X2_DILATION_S4_OUTPUT_H 6
+#define CONV_2X2_DILATION_S4_INPUT_OFFSET 128
+#define CONV_2X2_DILATION_S4_OUTPUT_OFFSET -128
+#define CONV_2X2_DILATION_S4_DILATION_X 2
+#define CONV_2X2_DILATION_S4_DILATION_Y 2
+#define CONV_2X2_DILATION_S4_WEIGHTS_SIZE 18
@@ -0,0 +1,18 @@
+// Generated by pack_s4_test_data.py from the s8 case "conv_2x2_dilation".
+#pragma once
+#include <stdint.h>
+
+const int8_t conv_2x2_dilation_s4_input[200] = {
+    -92, 4, 103, 112, 95, 91, 113, 64, 68, -23, 78, -25, 102, 17, 53, -82,
+    -2, 16, 4, -75, -96, 45, -14, -118, -23, 23, -16, 125, -23, -79, -11, 68,
+    98, -28, 20, -4, -11, -56, 72, 79, -38, 52, 63, -78, 37, 32, -109, 106,
+    -89, 45, 111, -79, -14, -10, -75, 60, -40, -98, 92, -70, -22, 114, 23, -26,
+    102, -84, 82, 119, 15, -77, 112, -97, -117, -79, 27, 123, 73, -107, 78, -55,
+    -114, -76, 94, 83, -108, -71, 85, -75, 82, -58, 17, 98, 85, 47, 96, -5,
+    124, -102, -24, 8, -78, -115, -90, 94, -96, 92, -13, 30, -127, -49, -53, 76,
+    -42, -96, -118, 31, -111, 118, 122, 21, 13, -95, 89, 28, -40, -89, 116, -48,
+    13, 6, -49, -51, -29, -108, -80, -127, -83, 28, -97, -71, -41, -52, -27, -119,
+    -17, -121, -40, 106, -17, -82, 49, 30, -50, 55, 16, 19, 66, 119, 90, 33,
+    -48, 32, 18, -11, -30, 37, 51, -35, -28, -85, 17, -44, -56, 88, -1, -55,
+    -112, 35, 118, -24, 26, -75, 55, 87, 32, 32, 9, -37, 7, -1, 84, 121,
+    -54, 80, 10, -71, 77, -62, -20, 30};
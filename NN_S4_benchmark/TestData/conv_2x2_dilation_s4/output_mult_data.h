@@ -0,0 +1,6 @@
+// Generated by pack_s4_test_data.py from the s8 case "conv_2x2_dilation".
+#pragma once
+#include <stdint.h>
+
+const int32_t conv_2x2_dilation_s4_output_mult[2] = {
+    1081365260, 1804022527};
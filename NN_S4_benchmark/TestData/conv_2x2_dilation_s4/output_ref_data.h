@@ -0,0 +1,10 @@
+// Generated by pack_s4_test_data.py from the s8 case "conv_2x2_dilation".
+#pragma once
+#include <stdint.h>
+
+const int8_t conv_2x2_dilation_s4_output_ref[72] = {
+    -61, -58, -42, 10, -61, -37, -61, 45, -61, -44, -61, -30, -61, -8, 47, -61,
+    -61, 34, -61, 107, -61, -61, -61, 3, -61, -42, -61, 35, -20, -26, -61, 74,
+    -36, 15, -23, -61, -61, -60, -61, -61, -61, -61, -60, 19, -61, -61, -61, -61,
+    -61, -41, 6, 107, -61, -23, -61, -4, -61, -9, -61, 35, -61, -61, -61, 0,
+    -61, 43, -20, -39, -61, -51, -61, 42};
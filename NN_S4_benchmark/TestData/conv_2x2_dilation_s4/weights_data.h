@@ -0,0 +1,7 @@
+// Generated by pack_s4_test_data.py from the s8 case "conv_2x2_dilation".
+#pragma once
+#include <stdint.h>
+
+const int8_t conv_2x2_dilation_s4_weights[18] = {
+    54, 63, 76, 61, 6, -92, 74, -73, -4, 127, -13, 49, -26, -106, 47, 21,
+    1, 31};
@@ -0,0 +1,25 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#define DEPTHWISE_2_OUT_CH 9
+#define DEPTHWISE_2_IN_CH 3
+#define DEPTHWISE_2_INPUT_W 6
+#define DEPTHWISE_2_INPUT_H 5
+#define DEPTHWISE_2_DST_SIZE 81
+#define DEPTHWISE_2_INPUT_SIZE 90
+#define DEPTHWISE_2_OUT_ACTIVATION_MIN -73
+#define DEPTHWISE_2_OUT_ACTIVATION_MAX 127
+#define DEPTHWISE_2_INPUT_BATCHES 1
+#define DEPTHWISE_2_FILTER_X 3
+#define DEPTHWISE_2_FILTER_Y 4
+#define DEPTHWISE_2_STRIDE_X 2
+#define DEPTHWISE_2_STRIDE_Y 2
+#define DEPTHWISE_2_PAD_X 0
+#define DEPTHWISE_2_PAD_Y 1
+#define DEPTHWISE_2_OUTPUT_W 3
+#define DEPTHWISE_2_OUTPUT_H 3
+#define DEPTHWISE_2_CH_MULT 3
+#define DEPTHWISE_2_INPUT_OFFSET 128
+#define DEPTHWISE_2_OUTPUT_OFFSET 15
+#define DEPTHWISE_2_DILATION_X 1
+#define DEPTHWISE_2_DILATION_Y 1
@@ -0,0 +1,7 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int32_t depthwise_2_output_mult[9] =
+    {1572008639, 1337293408, 1554283222, 1604620748, 1615626866, 1593872862, 1457634357, 1424494178, 1495084089};
@@ -0,0 +1,10 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_2_output_ref[81] = {
+    -73, 3,  -55, 56,  -5, 10,  0,   21,  -10, -71, -5, -73, 48,  20,  -11, 35,  44,  7,   -73, 20,  -29,
+    17,  40, -13, -7,  28, -24, -62, -15, -32, -24, 69, 6,   48,  -45, 15,  -32, 3,   -45, -10, 15,  6,
+    60,  54, -35, -44, 14, -24, -26, -14, 48,  28,  58, -20, -48, 28,  -19, -6,  2,   0,   38,  -40, 10,
+    -36, -4, -30, -5,  -4, 4,   50,  -49, 15,  -50, 15, -43, -31, -1,  27,  18,  -13, 10};
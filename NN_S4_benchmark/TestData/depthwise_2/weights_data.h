@@ -0,0 +1,12 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_2_weights[108] = {
+    108,  107,  -58,  -118, -67, 127, 21,  118, -25, 2,    -92,  43,   -99, 42,  55,  -6,   -115, -37,
+    123,  33,   87,   -44,  -46, -58, 127, -20, -36, -64,  3,    -127, -58, 62,  25,  20,   -127, 92,
+    -127, 116,  0,    86,   67,  -99, -9,  9,   97,  -72,  -114, 4,    127, 25,  -41, -54,  -39,  -6,
+    -3,   127,  21,   -16,  127, -60, -5,  82,  8,   95,   -65,  -103, 63,  20,  8,   49,   83,   -62,
+    21,   36,   -113, -15,  62,  -61, 52,  -12, -38, -81,  -5,   62,   -31, -3,  -23, -118, -35,  -19,
+    37,   -123, 125,  93,   -75, 53,  18,  106, -83, -106, 122,  -110, -74, 117, 72,  52,   73,   127};
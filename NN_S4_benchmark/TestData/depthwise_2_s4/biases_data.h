@@ -0,0 +1,6 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_2".
+#pragma once
+#include <stdint.h>
+
+const int32_t depthwise_2_s4_biases[9] = {
+    -1313, -432, -1545, -622, -1463, -78, -42, -975, -894};
@@ -0,0 +1,11 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_2".
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_2_s4_input[90] = {
+    77, -55, -122, 112, -101, 17, -26, 8, -42, 54, -70, 30, 85, 88, -102, 87,
+    52, -125, -112, -109, -78, 18, 122, 49, -57, -15, 26, 111, -105, -52, -36, -16,
+    107, -75, 61, -60, 70, 99, 105, 96, 97, -39, -6, -75, -31, -20, 26, 115,
+    -33, -109, 43, 43, -128, -17, -103, -38, -100, -47, 3, -100, -40, 7, 67, 13,
+    -91, 125, -127, -21, 90, -68, 3, 68, -79, 22, -6, 89, 40, -16, -84, 36,
+    34, -50, 59, 118, -7, -5, -58, -17, 15, 63};
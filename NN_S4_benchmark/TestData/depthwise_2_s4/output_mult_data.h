@@ -0,0 +1,6 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_2".
+#pragma once
+#include <stdint.h>
+
+const int32_t depthwise_2_s4_output_mult[9] = {
+    1782545510, 1516395204, 1762446154, 1819525312, 1832005464, 1807337977, 1652853244, 1615274648, 1695318565};
@@ -0,0 +1,11 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_2".
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_2_s4_output_ref[81] = {
+    -73, 1, -58, 50, -8, 11, 2, 21, -9, -73, -7, -73, 47, 16, -7, 38,
+    44, 3, -73, 17, -31, 16, 38, -14, -7, 31, -26, -65, -18, -34, -21, 61,
+    10, 50, -44, 15, -34, 2, -49, -12, 12, 11, 65, 58, -36, -45, 12, -26,
+    -29, -16, 49, 31, 65, -21, -48, 27, -20, -2, -3, 2, 39, -40, 10, -36,
+    -4, -32, -3, -9, 6, 54, -47, 15, -52, 14, -43, -29, -3, 27, 21, -11,
+    10};
@@ -0,0 +1,9 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_2".
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_2_s4_weights[54] = {
+    102, -99, 124, 113, 15, 43, 43, 3, -22, 39, -27, -35, -9, -50, -112, 61,
+    17, 89, 105, 80, -76, 0, -59, 10, 23, -34, 14, 112, -15, -41, 80, 80,
+    -84, 19, 48, -43, 33, -6, -45, -13, -50, 48, 14, -97, -2, -110, 87, 60,
+    97, -85, -89, 108, 52, 116};
@@ -0,0 +1,25 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#define DEPTHWISE_MULT_BATCHES_OUT_CH 3
+#define DEPTHWISE_MULT_BATCHES_IN_CH 3
+#define DEPTHWISE_MULT_BATCHES_INPUT_W 3
+#define DEPTHWISE_MULT_BATCHES_INPUT_H 5
+#define DEPTHWISE_MULT_BATCHES_DST_SIZE 36
+#define DEPTHWISE_MULT_BATCHES_INPUT_SIZE 45
+#define DEPTHWISE_MULT_BATCHES_OUT_ACTIVATION_MIN -128
+#define DEPTHWISE_MULT_BATCHES_OUT_ACTIVATION_MAX 127
+#define DEPTHWISE_MULT_BATCHES_INPUT_BATCHES 2
+#define DEPTHWISE_MULT_BATCHES_FILTER_X 2
+#define DEPTHWISE_MULT_BATCHES_FILTER_Y 4
+#define DEPTHWISE_MULT_BATCHES_STRIDE_X 2
+#define DEPTHWISE_MULT_BATCHES_STRIDE_Y 2
+#define DEPTHWISE_MULT_BATCHES_PAD_X 0
+#define DEPTHWISE_MULT_BATCHES_PAD_Y 1
+#define DEPTHWISE_MULT_BATCHES_OUTPUT_W 2
+#define DEPTHWISE_MULT_BATCHES_OUTPUT_H 3
+#define DEPTHWISE_MULT_BATCHES_CH_MULT 1
+#define DEPTHWISE_MULT_BATCHES_INPUT_OFFSET 128
+#define DEPTHWISE_MULT_BATCHES_OUTPUT_OFFSET -41
+#define DEPTHWISE_MULT_BATCHES_DILATION_X 1
+#define DEPTHWISE_MULT_BATCHES_DILATION_Y 1
@@ -0,0 +1,8 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_mult_batches_output_ref[36] = {-82, 70, -25, -47, -29, 2,  -66, 55, -28, -39, -30, 15,
+                                                      -51, 4,  9,   -35, -53, 44, -75, 12, 2,   -19, -24, -7,
+                                                      -91, 83, -32, -48, 1,   8,  -45, 8,  10,  -33, -52, 23};
@@ -0,0 +1,7 @@
+// Generated by generate_test_data.py using tensorflow version 2.10.0 (Keras version 2.10.0).
+// Interpreter from tensorflow version 2.10.0 and revision upstream/v2.10.0-0-g359c3cdfc5f.
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_mult_batches_weights[24] = {2,  80,  63, -89, 69, -41,  -102, -127, 70,  47,   47,  -10,
+                                                   48, 107, 66, -57, 67, -104, -45,  36,   -88, -127, 122, -127};
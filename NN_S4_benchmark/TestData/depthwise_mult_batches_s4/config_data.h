@@ -0,0 +1,25 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_mult_batches".
+#pragma once
+#define DEPTHWISE_MULT_BATCHES_S4_OUT_CH 3
+#define DEPTHWISE_MULT_BATCHES_S4_IN_CH 3
+#define DEPTHWISE_MULT_BATCHES_S4_INPUT_W 3
+#define DEPTHWISE_MULT_BATCHES_S4_INPUT_H 5
+#define DEPTHWISE_MULT_BATCHES_S4_DST_SIZE 36
+#define DEPTHWISE_MULT_BATCHES_S4_INPUT_SIZE 90
+#define DEPTHWISE_MULT_BATCHES_S4_OUT_ACTIVATION_MIN -128
+#define DEPTHWISE_MULT_BATCHES_S4_OUT_ACTIVATION_MAX 127
+#define DEPTHWISE_MULT_BATCHES_S4_INPUT_BATCHES 2
+#define DEPTHWISE_MULT_BATCHES_S4_FILTER_X 2
+#define DEPTHWISE_MULT_BATCHES_S4_FILTER_Y 4
+#define DEPTHWISE_MULT_BATCHES_S4_STRIDE_X 2
+#define DEPTHWISE_MULT_BATCHES_S4_STRIDE_Y 2
+#define DEPTHWISE_MULT_BATCHES_S4_PAD_X 0
+#define DEPTHWISE_MULT_BATCHES_S4_PAD_Y 1
+#define DEPTHWISE_MULT_BATCHES_S4_OUTPUT_W 2
+#define DEPTHWISE_MULT_BATCHES_S4_OUTPUT_H 3
+#define DEPTHWISE_MULT_BATCHES_S4_CH_MULT 1
+#define DEPTHWISE_MULT_BATCHES_S4_INPUT_OFFSET 128
+#define DEPTHWISE_MULT_BATCHES_S4_OUTPUT_OFFSET -41
+#define DEPTHWISE_MULT_BATCHES_S4_DILATION_X 1
+#define DEPTHWISE_MULT_BATCHES_S4_DILATION_Y 1
+#define DEPTHWISE_MULT_BATCHES_S4_WEIGHTS_SIZE 12
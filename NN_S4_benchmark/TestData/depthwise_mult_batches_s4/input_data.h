@@ -0,0 +1,11 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_mult_batches".
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_mult_batches_s4_input[90] = {
+    90, -27, 48, 7, -29, -28, 108, 124, -76, -35, 55, -41, 90, 103, -6, 36,
+    28, -79, -110, 110, 35, 64, 95, -28, 32, 121, -25, -58, 74, -20, -36, 51,
+    25, -15, -86, 113, 93, -22, -68, -24, -97, 43, 12, 84, 82, 59, 103, 49,
+    11, -48, -92, -111, 107, -54, -34, 113, -46, 62, -27, -111, 62, 82, -73, 69,
+    43, -54, -3, -53, -40, 92, -5, 79, -15, 53, -117, -103, 83, 7, -45, -78,
+    -118, 123, 21, 6, 7, 72, -37, -5, 83, 57};
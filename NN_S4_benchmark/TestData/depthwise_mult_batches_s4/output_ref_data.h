@@ -0,0 +1,8 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_mult_batches".
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_mult_batches_s4_output_ref[36] = {
+    -81, 75, -26, -46, -28, 2, -62, 59, -29, -38, -31, 16, -52, 3, 7, -36,
+    -54, 42, -71, 15, 3, -15, -23, -7, -88, 85, -34, -48, -1, 8, -46, 10,
+    10, -34, -53, 23};
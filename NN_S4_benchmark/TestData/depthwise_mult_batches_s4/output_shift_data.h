@@ -0,0 +1,6 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_mult_batches".
+#pragma once
+#include <stdint.h>
+
+const int32_t depthwise_mult_batches_s4_output_shift[3] = {
+    -5, -5, -5};
@@ -0,0 +1,8 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_mult_batches".
+#include "../../TestData/depthwise_mult_batches_s4/biases_data.h"
+#include "../../TestData/depthwise_mult_batches_s4/config_data.h"
+#include "../../TestData/depthwise_mult_batches_s4/input_data.h"
+#include "../../TestData/depthwise_mult_batches_s4/output_mult_data.h"
+#include "../../TestData/depthwise_mult_batches_s4/output_ref_data.h"
+#include "../../TestData/depthwise_mult_batches_s4/output_shift_data.h"
+#include "../../TestData/depthwise_mult_batches_s4/weights_data.h"
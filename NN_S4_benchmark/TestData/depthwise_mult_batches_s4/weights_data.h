@@ -0,0 +1,6 @@
+// Generated by pack_s4_test_data.py from the s8 case "depthwise_mult_batches".
+#pragma once
+#include <stdint.h>
+
+const int8_t depthwise_mult_batches_s4_weights[12] = {
+    64, -77, -28, -102, 52, -13, 99, -44, -92, 46, -101, -105};
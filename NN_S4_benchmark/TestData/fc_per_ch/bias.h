@@ -0,0 +1,9 @@
+// Generated by generate_test_data.py using tensorflow version 2.17.0 (Keras version 3.4.1).
+// Interpreter from tensorflow version 2.17.0 and revision v2.17.0-rc1-2-gad6d8cc177d.
+#pragma once
+#include <stdint.h>
+
+const int32_t fc_per_ch_bias[22] = {-1720,  5761,  -25657, -17236, 16662, -6141,  -31875, 22601, -18163, -30729, -25864,
+                                    -30232, -9596, -15034, -23538, 8194,  -32759, 27796,  13136, -16061, 590,    26513};
+
+const int32_t *const fc_per_ch_biases = fc_per_ch_bias;
@@ -0,0 +1,17 @@
+// Generated by generate_test_data.py using tensorflow version 2.17.0 (Keras version 3.4.1).
+// Interpreter from tensorflow version 2.17.0 and revision v2.17.0-rc1-2-gad6d8cc177d.
+#pragma once
+#define FC_PER_CH_W_TYPE INT8
+#define FC_PER_CH_IN_CH 89
+#define FC_PER_CH_OUT_CH 22
+#define FC_PER_CH_PER_CHANNEL_QUANT true
+#define FC_PER_CH_BATCH_SIZE 1
+#define FC_PER_CH_OUT_ACTIVATION_MIN -128
+#define FC_PER_CH_OUT_ACTIVATION_MAX 127
+#define FC_PER_CH_INPUT_BATCHES 1
+#define FC_PER_CH_INPUT_W 1
+#define FC_PER_CH_INPUT_H 1
+#define FC_PER_CH_DST_SIZE 22
+#define FC_PER_CH_ACCUMULATION_DEPTH 89
+#define FC_PER_CH_INPUT_OFFSET 128
+#define FC_PER_CH_OUTPUT_OFFSET 11
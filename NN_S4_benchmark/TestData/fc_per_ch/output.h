@@ -0,0 +1,9 @@
+// Generated by generate_test_data.py using tensorflow version 2.17.0 (Keras version 3.4.1).
+// Interpreter from tensorflow version 2.17.0 and revision v2.17.0-rc1-2-gad6d8cc177d.
+#pragma once
+#include <stdint.h>
+
+const int8_t fc_per_ch_output[22] = {39,  -61, 52,  27,  44, -86, -89, -104, -69, -100, -47,
+                                     -90, -13, -75, -31, -5, -48, 7,   59,   90,  -63,  -71};
+
+const int8_t *const fc_per_ch_output_ref = fc_per_ch_output;
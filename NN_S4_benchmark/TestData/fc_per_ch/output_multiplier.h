@@ -0,0 +1,11 @@
+// Generated by generate_test_data.py using tensorflow version 2.17.0 (Keras version 3.4.1).
+// Interpreter from tensorflow version 2.17.0 and revision v2.17.0-rc1-2-gad6d8cc177d.
+#pragma once
+#include <stdint.h>
+
+const int32_t fc_per_ch_output_multiplier[22] = {1470742593, 1454348298, 1454354566, 1467664675, 1460704449, 1471555339,
+                                                 1460846871, 1438005713, 1465479244, 1462578222, 1471942734, 1471242986,
+                                                 1470425887, 1460755289, 1450718973, 1443519955, 1401276315, 1413333005,
+                                                 1460858884, 1457164877, 1453714972, 1465539835};
+
+const int32_t *const fc_per_ch_output_mult = fc_per_ch_output_multiplier;
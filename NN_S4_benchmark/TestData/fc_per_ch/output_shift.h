@@ -0,0 +1,7 @@
+// Generated by generate_test_data.py using tensorflow version 2.17.0 (Keras version 3.4.1).
+// Interpreter from tensorflow version 2.17.0 and revision v2.17.0-rc1-2-gad6d8cc177d.
+#pragma once
+#include <stdint.h>
+
+const int32_t fc_per_ch_output_shift[22] = {-10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10,
+                                            -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10};
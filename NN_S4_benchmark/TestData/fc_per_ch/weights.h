@@ -0,0 +1,110 @@
+// Generated by generate_test_data.py using tensorflow version 2.17.0 (Keras version 3.4.1).
+// Interpreter from tensorflow version 2.17.0 and revision v2.17.0-rc1-2-gad6d8cc177d.
+#pragma once
+#include <stdint.h>
+
+const int8_t fc_per_ch_weights[1958] = {
+    80,   14,   -115, 84,   66,   -79,  -36,  -97,  24,   13,   40,   76,   -4,   116,  93,   -109, -102, 73,   38,
+    -103, 64,   125,  -40,  109,  -121, 57,   46,   -45,  -116, -31,  10,   -127, 34,   97,   -11,  -65,  102,  -78,
+    119,  -14,  -26,  -55,  106,  20,   24,   -58,  68,   70,   66,   58,   -5,   -68,  108,  -68,  117,  -111, -53,
+    127,  -41,  7,    -5,   76,   -11,  -12,  71,   16,   25,   -45,  27,   113,  -121, -62,  -62,  32,   61,   -110,
+    -65,  60,   14,   -29,  -55,  83,   -33,  -2,   -118, 83,   -95,  13,   49,   -44,  -127, -28,  -114, -86,  -21,
+    -105, -23,  -68,  -35,  74,   90,   -52,  -109, -69,  -77,  -20,  -30,  -58,  110,  -57,  -3,   73,   3,    -47,
+    35,   -22,  -72,  70,   -91,  -71,  127,  92,   105,  56,   56,   41,   17,   -119, -107, -57,  -24,  -54,  -29,
+    27,   68,   -11,  -24,  -78,  -87,  84,   115,  8,    -36,  -52,  -78,  22,   13,   -70,  31,   35,   76,   65,
+    104,  11,   -7,   -110, -18,  -123, -11,  5,    68,   -15,  60,   -82,  -103, -59,  -97,  48,   -50,  -88,  58,
+    -17,  -82,  72,   -86,  116,  -62,  126,  -36,  40,   64,   57,   -47,  -114, -27,  -82,  -54,  113,  -94,  84,
+    -58,  -1,   5,    -70,  -27,  119,  -13,  -90,  48,   61,   45,   -7,   -6,   -46,  125,  90,   32,   52,   -101,
+    -71,  70,   -12,  47,   97,   127,  -117, 98,   88,   -32,  -29,  -84,  60,   54,   85,   126,  76,   16,   125,
+    -45,  58,   -37,  -3,   3,    8,    -55,  -66,  -37,  -23,  -101, -1,   -26,  26,   -54,  -7,   112,  80,   109,
+    -4,   -102, 107,  2,    70,   89,   50,   34,   21,   -12,  122,  -10,  76,   -90,  -96,  -66,  -11,  65,   101,
+    -92,  -78,  -71,  39,   76,   113,  47,   67,   -48,  -124, 33,   -84,  26,   -6,   23,   -39,  -69,  -108, 78,
+    73,   -41,  100,  93,   -88,  -34,  45,   25,   -88,  -84,  -43,  -125, -88,  -83,  91,   110,  -112, -10,  -51,
+    24,   -80,  -64,  -53,  84,   -80,  75,   85,   -101, 36,   -71,  33,   79,   125,  -19,  91,   120,  -31,  67,
+    14,   12,   28,   -20,  -118, -91,  101,  124,  77,   -91,  84,   19,   77,   -119, -7,   -127, 118,  80,   -21,
+    38,   50,   124,  -125, -116, 28,   -44,  42,   -25,  -98,  19,   55,   120,  -55,  56,   60,   -2,   37,   115,
+    26,   45,   -14,  13,   -15,  28,   -7,   31,   81,   24,   53,   -23,  -100, -62,  -9,   -67,  29,   -9,   -42,
+    112,  19,   105,  -54,  -38,  105,  81,   -55,  93,   93,   -88,  -33,  -108, -99,  -11,  11,   55,   54,   -28,
+    99,   -80,  38,   104,  87,   -105, -86,  -72,  27,   45,   -58,  -115, -65,  59,   -6,   18,   -95,  90,   11,
+    -14,  -68,  94,   -31,  -61,  27,   34,   -2,   -67,  -126, 111,  121,  -1,   55,   -96,  -64,  104,  -115, -39,
+    81,   30,   -10,  125,  127,  -87,  -20,  -85,  5,    -30,  -112, 86,   -59,  -62,  -123, -8,   -97,  -85,  29,
+    107,  31,   -28,  25,   -93,  -5,   35,   -21,  86,   -35,  100,  10,   -36,  -23,  127,  79,   -54,  -122, -46,
+    -2,   -101, 60,   30,   -54,  64,   -118, 60,   -72,  -88,  -103, -41,  -29,  -70,  -4,   55,   8,    96,   -122,
+    20,   -29,  -14,  -58,  -69,  50,   -99,  -82,  109,  -12,  21,   -15,  42,   -16,  -51,  -63,  61,   -81,  -35,
+    -47,  121,  73,   63,   81,   45,   34,   94,   -89,  -33,  -120, -81,  83,   -67,  -30,  45,   -14,  -71,  55,
+    9,    13,   -116, 66,   -35,  -84,  -101, 0,    81,   -96,  59,   27,   113,  28,   56,   86,   95,   64,   -40,
+    3,    -66,  116,  90,   63,   11,   -127, -92,  -45,  74,   -110, 14,   86,   86,   -72,  -104, 37,   -127, 9,
+    47,   3,    87,   37,   -35,  23,   -56,  59,   39,   29,   -52,  -79,  95,   -65,  -17,  103,  9,    -107, 35,
+    -121, 3,    27,   99,   -86,  87,   -105, -74,  -82,  -54,  -61,  -20,  -24,  -59,  124,  -91,  -37,  26,   -51,
+    112,  94,   -20,  83,   -78,  1,    -115, -105, -96,  -36,  -75,  38,   -76,  5,    -80,  -110, -74,  -51,  -59,
+    107,  -75,  -33,  -122, -126, -34,  25,   -49,  107,  -92,  -68,  121,  9,    90,   -106, 4,    -37,  -8,   -23,
+    3,    -49,  81,   -62,  83,   12,   -30,  -54,  -114, 23,   96,   -111, -79,  53,   70,   7,    49,   30,   55,
+    42,   -49,  -3,   -125, -77,  -116, -116, -4,   -62,  87,   -49,  74,   122,  -30,  -18,  -42,  -75,  -118, 21,
+    23,   -3,   92,   32,   -57,  -81,  -68,  107,  84,   127,  -37,  -98,  -70,  -100, 52,   -10,  78,   106,  -70,
+    -99,  105,  -70,  -120, 53,   22,   -6,   40,   36,   -123, 123,  65,   63,   4,    -67,  -45,  70,   127,  5,
+    82,   42,   -109, 125,  -5,   -12,  39,   -117, -25,  -23,  -92,  45,   39,   -105, -111, 29,   -9,   -66,  0,
+    -83,  -5,   61,   116,  74,   -96,  -89,  -58,  -113, -120, 19,   -47,  14,   -41,  11,   -62,  -71,  -71,  20,
+    78,   -126, 120,  108,  -70,  102,  -127, -4,   105,  -121, 53,   -106, -18,  5,    -7,   -94,  -121, -65,  -74,
+    72,   30,   14,   8,    119,  12,   -93,  -3,   -115, -67,  -110, -41,  -84,  -18,  -30,  82,   31,   61,   -110,
+    -1,   83,   87,   83,   -79,  -116, 22,   115,  -43,  52,   41,   -72,  -71,  -94,  -118, -83,  -123, 57,   100,
+    100,  55,   5,    -78,  23,   89,   56,   0,    72,   71,   -126, -89,  64,   20,   76,   -15,  50,   -26,  -29,
+    8,    -96,  -50,  80,   -123, -21,  -119, 35,   -36,  11,   -83,  -60,  -123, 115,  126,  43,   50,   -16,  -104,
+    -81,  34,   -31,  -33,  28,   93,   121,  68,   97,   -37,  -124, 127,  56,   -109, -57,  -114, 92,   -4,   116,
+    -1,   89,   48,   -23,  -52,  60,   -27,  -66,  -37,  -110, -46,  14,   40,   -31,  -44,  -106, 103,  -114, 14,
+    -11,  17,   13,   73,   120,  8,    31,   -10,  -114, 126,  -76,  44,   -11,  -62,  33,   -89,  -4,   -36,  -114,
+    119,  12,   94,   29,   -111, 57,   75,   38,   -65,  89,   -29,  61,   -96,  25,   -118, -106, -26,  16,   -82,
+    -105, -79,  -30,  47,   -64,  127,  0,    -101, 16,   -42,  37,   -30,  -82,  16,   -37,  95,   -29,  -85,  2,
+    -30,  -14,  -89,  -29,  -10,  94,   96,   106,  68,   86,   -106, 92,   -104, -92,  23,   71,   59,   -116, 96,
+    -104, -96,  110,  -112, 83,   -94,  71,   36,   -95,  -60,  21,   109,  -76,  102,  46,   88,   -10,  54,   30,
+    -114, 23,   -3,   -24,  -44,  -36,  56,   107,  -1,   -92,  -5,   77,   -15,  -86,  -98,  -94,  16,   -54,  60,
+    -72,  -111, 118,  -111, 105,  -30,  125,  10,   -21,  -54,  29,   -49,  110,  -102, 9,    -16,  100,  19,   -64,
+    72,   -105, -56,  109,  67,   -64,  91,   -100, -82,  -87,  -57,  -58,  -90,  -54,  -42,  126,  -28,  92,   -12,
+    65,   -20,  119,  114,  87,   85,   72,   -69,  -40,  -62,  20,   98,   -118, -45,  1,    -46,  -77,  -62,  -127,
+    -2,   -48,  69,   -65,  -76,  25,   -96,  -120, -30,  62,   40,   -120, 89,   69,   43,   -24,  -15,  67,   5,
+    -121, -23,  103,  118,  -116, 107,  18,   127,  -20,  56,   -43,  -122, 120,  -125, 0,    -57,  38,   -11,  -2,
+    -117, 8,    -60,  -72,  21,   -8,   46,   -119, 11,   24,   -19,  1,    7,    -86,  42,   49,   -75,  -126, -28,
+    -3,   8,    102,  -104, -26,  38,   -116, 9,    -110, 79,   57,   126,  92,   -86,  -96,  51,   64,   -7,   -94,
+    124,  -79,  78,   85,   -59,  -77,  -16,  70,   -95,  -49,  20,   13,   -65,  -95,  127,  13,   20,   124,  50,
+    50,   -60,  -111, -3,   -70,  113,  -116, -124, -118, 28,   -120, -93,  105,  34,   79,   98,   60,   -33,  47,
+    -49,  -118, -3,   -63,  -6,   68,   -13,  -14,  67,   79,   -127, 39,   -26,  -21,  66,   -108, 91,   -52,  32,
+    47,   -68,  -48,  -127, 25,   -60,  -111, -68,  74,   -57,  -57,  -68,  96,   -113, -25,  -25,  12,   86,   100,
+    77,   11,   110,  -78,  -33,  -25,  86,   76,   5,    39,   -40,  -28,  -99,  106,  -9,   -90,  67,   -103, 38,
+    79,   49,   -29,  -75,  -98,  -89,  -9,   102,  23,   -115, -23,  121,  48,   -41,  -48,  -80,  -83,  109,  -58,
+    -66,  -107, -30,  1,    93,   56,   -110, -70,  -27,  98,   -52,  19,   80,   -115, 9,    96,   77,   25,   -102,
+    -106, 118,  -30,  -15,  -35,  -82,  46,   -23,  -77,  109,  -47,  125,  99,   80,   -94,  -34,  85,   102,  -67,
+    69,   -26,  26,   -74,  -105, -72,  84,   26,   23,   65,   -94,  -80,  30,   -7,   -121, 119,  68,   42,   -13,
+    122,  113,  -67,  42,   -47,  97,   -119, -37,  -64,  -5,   -91,  38,   -118, -127, -65,  110,  82,   -113, -21,
+    80,   -74,  -59,  -48,  -45,  -92,  -108, -77,  -27,  102,  -116, 14,   -79,  -83,  55,   -116, 55,   -36,  53,
+    -82,  70,   83,   24,   -95,  122,  101,  47,   -6,   39,   114,  -118, -67,  87,   -101, 108,  -64,  37,   -83,
+    73,   -86,  21,   98,   62,   31,   80,   -109, 101,  21,   100,  -105, -120, -71,  84,   86,   102,  21,   16,
+    -124, -127, -110, 97,   36,   0,    87,   68,   -51,  -16,  4,    -33,  121,  54,   49,   -99,  17,   63,   -58,
+    100,  10,   -70,  -104, -100, -11,  64,   127,  63,   63,   32,   37,   92,   70,   -63,  92,   -35,  106,  -10,
+    108,  -24,  -67,  -123, -103, 18,   127,  16,   56,   -89,  -103, -9,   -32,  -16,  -17,  -107, -59,  103,  -15,
+    -88,  -14,  -11,  -38,  98,   -22,  21,   107,  23,   -105, 5,    -126, -63,  -109, -26,  -44,  -83,  118,  115,
+    124,  107,  79,   38,   111,  77,   20,   112,  -68,  -33,  7,    12,   -44,  -48,  -49,  55,   105,  -21,  -25,
+    37,   -7,   9,    25,   -49,  -65,  5,    -101, 4,    105,  54,   -80,  108,  34,   -119, 48,   2,    4,    46,
+    40,   65,   114,  3,    49,   -16,  -122, -80,  -89,  92,   -110, -48,  10,   -61,  -63,  -56,  43,   -121, 36,
+    14,   -29,  -118, 51,   -30,  -40,  97,   93,   14,   59,   121,  112,  86,   71,   102,  -114, -91,  120,  8,
+    54,   -2,   119,  7,    68,   71,   44,   48,   -119, -63,  -37,  -27,  -36,  -98,  -2,   -46,  79,   4,    -28,
+    -39,  31,   113,  -127, -46,  -27,  -57,  16,   31,   -118, 95,   -120, -72,  12,   86,   -54,  6,    63,   61,
+    19,   125,  -63,  -34,  16,   -72,  -85,  -80,  -45,  -105, -123, -61,  66,   23,   111,  -104, -79,  -88,  8,
+    24,   -61,  33,   7,    -15,  123,  -27,  60,   72,   91,   -92,  70,   -36,  120,  66,   93,   -68,  -29,  -98,
+    -109, -14,  -90,  19,   -81,  99,   37,   96,   109,  -67,  -126, -61,  -25,  87,   -49,  -110, 89,   99,   73,
+    -30,  38,   -28,  91,   54,   -125, 41,   -126, -102, -58,  17,   -127, -69,  79,   25,   54,   -124, -27,  78,
+    -80,  116,  111,  -67,  -77,  -40,  -108, -32,  -108, -43,  -14,  -91,  -21,  6,    122,  122,  120,  87,   -63,
+    31,   92,   49,   -125, 110,  -124, 32,   52,   -73,  -89,  -55,  75,   -75,  54,   -2,   21,   89,   77,   116,
+    50,   -39,  121,  95,   58,   9,    92,   -106, 73,   115,  -72,  46,   -59,  107,  -34,  18,   27,   -46,  -28,
+    7,    -52,  -40,  -87,  14,   -48,  -17,  -5,   71,   13,   100,  -67,  71,   -18,  53,   79,   -102, 81,   51,
+    89,   9,    -46,  7,    -51,  -33,  114,  15,   6,    115,  -23,  2,    119,  -100, 80,   113,  111,  -43,  64,
+    -32,  -12,  -127, -91,  -96,  51,   80,   -46,  100,  36,   -35,  -6,   -59,  -50,  14,   -74,  -115, 118,  29,
+    -123, -35,  -19,  48,   5,    -84,  126,  114,  -45,  73,   -21,  76,   -1,   -112, -113, 18,   7,    79,   -55,
+    -65,  72,   -48,  -64,  -81,  -18,  59,   12,   -91,  -103, -30,  -71,  -67,  -127, -57,  69,   -44,  84,   34,
+    -127, 70,   -79,  -127, -123, -90,  -86,  53,   83,   57,   18,   -99,  101,  36,   127,  96,   70,   56,   -122,
+    -17,  -43,  19,   27,   46,   -43,  -68,  54,   -12,  31,   82,   87,   -29,  127,  -123, 124,  -97,  -42,  9,
+    -47,  118,  -90,  46,   108,  102,  3,    -123, 100,  71,   1,    -90,  -66,  -114, 19,   -3,   68,   61,   -22,
+    54,   -22,  63,   -76,  -108, 63,   -26,  -86,  -105, 115,  110,  27,   -51,  12,   112,  90,   18,   107,  -79,
+    -69,  -109, 17,   -66,  127,  -119, 58,   -111, -82,  24,   3,    -106, 41,   -117, 120,  -14,  -124, -5,   -35,
+    22,   44,   -88,  -94,  46,   21,   106,  -36,  79,   54,   -15,  91,   69,   103,  -63,  90,   -75,  30,   18,
+    -99,  -95,  -44,  -26,  58,   90,   -75,  -64,  -77,  -3,   -28,  87,   -19,  -80,  81,   -58,  51,   -48,  32,
+    -114, -60,  92,   35,   -110, 22,   -66,  34,   -41,  -50,  -35,  -61,  74,   42,   7,    -103, 28,   53,   100,
+    -94};
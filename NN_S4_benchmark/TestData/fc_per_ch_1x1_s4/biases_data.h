@@ -0,0 +1,7 @@
+// Generated by pack_s4_test_data.py from the s8 case "fc_per_ch".
+#pragma once
+#include <stdint.h>
+
+const int32_t fc_per_ch_1x1_s4_biases[22] = {
+    -95, 318, -1414, -950, 918, -338, -1757, 1246, -1001, -1694, -1426, -1666, -529, -829, -1297, 452,
+    -1806, 1532, 724, -885, 33, 1461};
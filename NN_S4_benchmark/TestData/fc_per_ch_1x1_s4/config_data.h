@@ -0,0 +1,24 @@
+// Generated by pack_s4_test_data.py from the s8 case "fc_per_ch".
+#pragma once
+#define FC_PER_CH_1X1_S4_OUT_CH 22
+#define FC_PER_CH_1X1_S4_IN_CH 89
+#define FC_PER_CH_1X1_S4_INPUT_W 1
+#define FC_PER_CH_1X1_S4_INPUT_H 1
+#define FC_PER_CH_1X1_S4_DST_SIZE 22
+#define FC_PER_CH_1X1_S4_INPUT_SIZE 89
+#define FC_PER_CH_1X1_S4_OUT_ACTIVATION_MIN -128
+#define FC_PER_CH_1X1_S4_OUT_ACTIVATION_MAX 127
+#define FC_PER_CH_1X1_S4_INPUT_BATCHES 1
+#define FC_PER_CH_1X1_S4_FILTER_X 1
+#define FC_PER_CH_1X1_S4_FILTER_Y 1
+#define FC_PER_CH_1X1_S4_STRIDE_X 1
+#define FC_PER_CH_1X1_S4_STRIDE_Y 1
+#define FC_PER_CH_1X1_S4_PAD_X 0
+#define FC_PER_CH_1X1_S4_PAD_Y 0
+#define FC_PER_CH_1X1_S4_OUTPUT_W 1
+#define FC_PER_CH_1X1_S4_OUTPUT_H 1
+#define FC_PER_CH_1X1_S4_INPUT_OFFSET 128
+#define FC_PER_CH_1X1_S4_OUTPUT_OFFSET 11
+#define FC_PER_CH_1X1_S4_DILATION_X 1
+#define FC_PER_CH_1X1_S4_DILATION_Y 1
+#define FC_PER_CH_1X1_S4_WEIGHTS_SIZE 979
@@ -0,0 +1,11 @@
+// Generated by pack_s4_test_data.py from the s8 case "fc_per_ch".
+#pragma once
+#include <stdint.h>
+
+const int8_t fc_per_ch_1x1_s4_input[89] = {
+    -100, 95, -71, -51, -51, 120, 23, -59, 48, -29, 28, -41, -72, 109, 29, -75,
+    27, 77, 116, 0, 113, -125, 29, 104, -114, -87, 89, -112, 31, -93, -50, 115,
+    -20, 126, 75, -43, -44, 14, -54, -16, -110, -66, -62, -103, -98, -56, 106, -78,
+    -97, 23, 41, -119, -57, 85, 33, -60, 45, -52, -61, -24, 18, -15, -52, 91,
+    -55, -67, -4, 117, 22, -64, 16, -109, 31, 87, 85, 19, 88, -77, 32, -1,
+    121, 2, 58, 73, 32, 46, -39, -117, 41};
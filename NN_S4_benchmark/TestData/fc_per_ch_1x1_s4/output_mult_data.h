@@ -0,0 +1,7 @@
+// Generated by pack_s4_test_data.py from the s8 case "fc_per_ch".
+#pragma once
+#include <stdint.h>
+
+const int32_t fc_per_ch_1x1_s4_output_mult[22] = {
+    1667717047, 1649127088, 1649134195, 1664226908, 1656334509, 1668638643, 1656496006, 1630595764, 1661748786, 1658459234, 1669077922, 1668284457, 1667357925, 1656392158, 1645011693, 1636848520,
+    1588947250, 1602618675, 1656509627, 1652320887, 1648408941, 1661817491};
@@ -0,0 +1,7 @@
+// Generated by pack_s4_test_data.py from the s8 case "fc_per_ch".
+#pragma once
+#include <stdint.h>
+
+const int8_t fc_per_ch_1x1_s4_output_ref[22] = {
+    39, -67, 52, 30, 42, -96, -92, -105, -61, -101, -48, -89, -10, -68, -39, -6,
+    -53, 7, 56, 85, -59, -73};
@@ -0,0 +1,7 @@
+// Generated by pack_s4_test_data.py from the s8 case "fc_per_ch".
+#pragma once
+#include <stdint.h>
+
+const int32_t fc_per_ch_1x1_s4_output_shift[22] = {
+    -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6,
+    -6, -6, -6, -6, -6, -6};
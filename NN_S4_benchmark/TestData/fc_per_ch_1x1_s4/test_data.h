@@ -0,0 +1,8 @@
+// Generated by pack_s4_test_data.py from the s8 case "fc_per_ch".
+#include "../../TestData/fc_per_ch_1x1_s4/biases_data.h"
+#include "../../TestData/fc_per_ch_1x1_s4/config_data.h"
+#include "../../TestData/fc_per_ch_1x1_s4/input_data.h"
+#include "../../TestData/fc_per_ch_1x1_s4/output_mult_data.h"
+#include "../../TestData/fc_per_ch_1x1_s4/output_ref_data.h"
+#include "../../TestData/fc_per_ch_1x1_s4/output_shift_data.h"
+#include "../../TestData/fc_per_ch_1x1_s4/weights_data.h"
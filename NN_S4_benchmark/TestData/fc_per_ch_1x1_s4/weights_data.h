@@ -0,0 +1,67 @@
+// Generated by pack_s4_test_data.py from the s8 case "fc_per_ch".
+#pragma once
+#include <stdint.h>
+
+const int8_t fc_per_ch_1x1_s4_weights[979] = {
+    20, 90, -60, -66, 17, 66, 96, -91, 74, -94, 116, 110, 57, -29, -22, -111,
+    82, -49, -58, -9, -33, 22, -47, 68, 52, -64, -58, -90, 125, 14, 64, -1,
+    20, -31, 97, -39, 45, -93, 60, -31, 93, 14, 89, 27, -29, -23, -70, -81,
+    -49, 78, -43, -54, -4, -34, -42, 64, -48, -14, 76, -53, 87, 54, 35, -111,
+    -38, -33, 30, -12, -49, 91, 6, -34, 28, -63, 34, 68, 22, -96, -97, 15,
+    -12, -77, -38, 59, -67, -13, 75, 107, 125, 46, 52, -83, -65, 109, 91, 13,
+    -64, 127, -65, 51, 2, -48, 87, 50, -54, -12, 83, -89, 85, -18, 59, 83,
+    71, 113, 62, 14, 0, -51, -2, 10, 31, 13, 70, 6, 106, 64, 53, 18,
+    127, 79, -69, -4, 100, -53, 44, 100, 67, -99, -78, 1, -31, -84, 68, 110,
+    -75, 46, -79, -21, -71, 91, -90, -33, -63, -36, -59, 84, 42, 44, 116, 95,
+    -25, 20, 33, -97, 107, 71, 91, 65, 9, 121, -12, 50, -105, 42, 46, -65,
+    49, -41, 51, 32, 22, -14, -15, 2, 66, 49, -81, 13, 44, -32, 22, -42,
+    110, -44, 85, -21, -70, 31, 51, 94, 44, 86, -70, 28, -46, -54, 3, -79,
+    21, -49, -27, 29, 2, -100, 118, 48, -53, -90, 78, -14, 119, -5, 11, -82,
+    -43, -99, -80, 43, 38, 30, 11, -14, -27, 22, -2, 71, -99, 13, 58, -46,
+    -108, -61, -85, -18, 12, 3, -107, -31, -33, 60, -69, -10, -15, -14, -35, -61,
+    -34, 71, 67, 34, -75, -98, 92, -20, -14, 60, 16, 74, -66, 10, -76, 19,
+    38, 83, 69, 14, 108, 53, -111, -21, -92, 81, -59, 42, 9, 3, 37, 30,
+    61, 34, -51, -59, 111, -96, -110, 16, -75, -91, -68, -35, -1, 125, -21, -47,
+    86, 95, 12, -86, -21, 44, 12, -84, -36, 109, -20, -103, 30, 109, -53, 7,
+    -91, -32, -16, -48, -44, 21, -34, 26, -91, 60, 4, 35, 35, 13, -55, -86,
+    -48, -43, 116, -2, -50, 25, 1, 37, -51, 108, 117, -66, -84, -13, 100, -68,
+    -58, 57, 1, 34, 121, 52, -64, 78, 7, 37, 122, -16, -94, -1, 43, -94,
+    42, -64, -80, 48, 70, -69, -83, 25, 29, 30, -51, 28, -108, 103, 108, 9,
+    -106, -93, 15, -80, -55, 76, 18, 112, -79, -96, -84, -66, -17, 37, -93, 80,
+    85, -84, 97, 62, -62, -68, -71, 57, 102, 3, 28, 53, 64, -108, 75, 65,
+    63, -17, -80, 77, -7, 41, 30, -37, 105, 39, -13, -54, -30, 46, 117, 84,
+    -98, 55, -38, 90, 96, 80, -13, 61, -49, -82, 29, -30, -82, -90, -15, 17,
+    116, 32, -81, -57, -14, 45, 11, -82, 23, 37, 58, 36, 92, 62, 27, -87,
+    31, -85, -20, -61, 7, 26, 46, -66, -31, -27, 11, -2, -21, 95, 101, 84,
+    90, -70, 65, -93, -91, 107, 90, 75, -78, 29, -58, 54, -11, 35, 26, -16,
+    -18, 99, -80, 64, -65, -69, -47, -61, 122, 106, 126, -15, 45, 109, 10, 111,
+    -63, -92, 109, -60, -91, -69, -35, -37, 126, 94, 79, 127, 86, 69, -20, 29,
+    -107, 14, -51, -99, -48, -60, 28, -101, 62, -110, 69, -14, 79, -112, 111, -89,
+    22, -9, -29, 121, 9, 45, 15, 10, -51, 1, -109, 17, 15, -80, 50, -100,
+    14, 96, -6, -94, -96, 52, 87, -69, 67, -80, -57, 84, -51, 79, -37, 17,
+    -68, 23, 113, 51, -83, -64, -90, -103, -110, 107, 66, 53, 62, -99, -48, 64,
+    -1, 68, 41, -1, -92, -43, 50, -36, 25, -83, 76, -35, 92, -6, 31, 101,
+    20, -58, -2, 69, 32, -18, 107, -80, -92, 66, -29, -68, 11, 22, -6, 55,
+    -34, -68, -42, -84, 14, 53, -54, 95, 29, -92, 80, 20, -86, -25, -17, 59,
+    -49, -42, 87, -76, 94, -58, -12, -63, -54, 21, 65, -53, 2, 121, 36, 127,
+    -58, -46, -107, -50, -80, -110, -55, 86, -6, -60, -35, -66, -54, 111, 26, -68,
+    -93, -29, -77, 84, -79, 103, 3, 98, -55, -91, -58, -78, -76, 81, 35, -92,
+    22, -90, -55, 85, 22, -111, -87, 37, 80, -44, 15, 126, 51, 27, -45, 22,
+    -84, -6, 116, 51, 34, 69, 93, 110, 111, -49, -87, 113, 49, -85, -32, -1,
+    -38, -10, -5, -17, -11, 97, -95, -112, -83, -17, 123, 118, 70, 98, 20, -58,
+    14, -31, -35, 99, -1, 2, 16, -51, -96, 96, -61, 38, 57, 0, 35, 100,
+    48, -97, -68, -91, 29, -35, 45, 41, -31, 57, -18, 85, 49, 103, 69, -90,
+    123, 48, 112, 64, 36, -109, -19, -17, 11, 77, -32, 46, -106, -3, 29, -110,
+    -107, 28, -43, 48, 19, -41, 30, -68, -20, -102, 77, 97, -54, 11, -47, 2,
+    127, 63, 84, 75, 126, 84, -20, -85, -65, -63, 37, 101, -100, -3, -43, 90,
+    69, 46, 94, -109, -110, -38, -111, 76, 49, -7, -60, 102, -52, -82, -82, -2,
+    -5, 112, 119, -43, 82, -109, -106, 50, -68, 77, 60, 16, 69, 54, 126, 53,
+    80, 74, -58, -45, -26, 17, -19, -48, -66, -47, 15, 20, -58, -12, 67, 74,
+    83, -48, -48, 110, 1, -10, 112, 74, 102, 78, -2, -71, 59, -44, 38, 14,
+    -35, -63, 122, -110, -2, 3, 123, -26, -12, 4, -86, 1, -44, 76, -51, -4,
+    19, -85, -50, -100, 77, 94, -110, -60, -103, -69, 83, 19, 107, 114, 69, -109,
+    -17, 17, -29, 60, 47, 85, 126, 121, -21, -48, -73, 99, 6, 105, 4, -53,
+    26, 64, -13, -13, -61, 58, -65, 106, 22, 29, 86, 97, -52, 26, 124, 57,
+    -70, 1, 42, 122, -97, -32, 33, -69, 19, -26, 52, 95, 100, 93, 44, -79,
+    -21, 63, -59, -52, -32, -11, 76, 61, 45, -38, 37, 26, 44, -34, -34, 36,
+    -96, 50, -74};
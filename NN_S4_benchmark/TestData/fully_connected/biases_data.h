@@ -0,0 +1,6 @@
+// Generated by test_settings.py using tensorflow version 2.18.0-dev20240711 (Keras version 3.4.1.dev2024071203).
+// Interpreter from tensorflow version 2.18.0-dev20240711 and revision v1.12.1-112931-gbc6210b35b0.
+#pragma once
+#include <stdint.h>
+
+const int32_t fully_connected_biases[6] = {17061, 30620, -17956, 6604, -30838, -23496};
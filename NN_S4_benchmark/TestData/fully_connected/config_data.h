@@ -0,0 +1,18 @@
+// Generated by test_settings.py using tensorflow version 2.18.0-dev20240711 (Keras version 3.4.1.dev2024071203).
+// Interpreter from tensorflow version 2.18.0-dev20240711 and revision v1.12.1-112931-gbc6210b35b0.
+#pragma once
+#define FULLY_CONNECTED_OUT_CH 6
+#define FULLY_CONNECTED_IN_CH 10
+#define FULLY_CONNECTED_INPUT_W 2
+#define FULLY_CONNECTED_INPUT_H 1
+#define FULLY_CONNECTED_DST_SIZE 18
+#define FULLY_CONNECTED_INPUT_SIZE 20
+#define FULLY_CONNECTED_OUT_ACTIVATION_MIN -128
+#define FULLY_CONNECTED_OUT_ACTIVATION_MAX 127
+#define FULLY_CONNECTED_INPUT_BATCHES 3
+#define FULLY_CONNECTED_OUTPUT_MULTIPLIER 1342580370
+#define FULLY_CONNECTED_OUTPUT_SHIFT -9
+#define FULLY_CONNECTED_ACCUMULATION_DEPTH 20
+#define FULLY_CONNECTED_INPUT_OFFSET 128
+#define FULLY_CONNECTED_FILTER_OFFSET 0
+#define FULLY_CONNECTED_OUTPUT_OFFSET -102
@@ -0,0 +1,9 @@
+// Generated by test_settings.py using tensorflow version 2.18.0-dev20240711 (Keras version 3.4.1.dev2024071203).
+// Interpreter from tensorflow version 2.18.0-dev20240711 and revision v1.12.1-112931-gbc6210b35b0.
+#pragma once
+#include <stdint.h>
+
+const int8_t fully_connected_input[60] = {
+    -79, -90, 26,  -66, -40,  -13, -102, 67,  -112, -92, 40,   113,  69,  -63, -122, -24, 122, -88,  126, 123,
+    -69, 51,  -83, 83,  -127, -73, 93,   114, 52,   -89, -109, -41,  84,  10,  -80,  24,  65,  -122, -65, 121,
+    -55, 59,  -6,  113, -101, -40, 72,   -11, 67,   83,  -70,  -111, -64, 53,  -43,  77,  66,  -54,  42,  5};
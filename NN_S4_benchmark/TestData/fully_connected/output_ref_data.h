@@ -0,0 +1,7 @@
+// Generated by test_settings.py using tensorflow version 2.18.0-dev20240711 (Keras version 3.4.1.dev2024071203).
+// Interpreter from tensorflow version 2.18.0-dev20240711 and revision v1.12.1-112931-gbc6210b35b0.
+#pragma once
+#include <stdint.h>
+
+const int8_t fully_connected_output_ref[18] =
+    {-1, 8, -128, -88, -17, -128, 31, -23, -128, -121, -29, -52, 10, -16, -128, -128, -35, -19};
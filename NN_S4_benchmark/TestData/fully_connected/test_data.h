@@ -0,0 +1,7 @@
+// Generated by test_settings.py using tensorflow version 2.18.0-dev20240711 (Keras version 3.4.1.dev2024071203).
+// Interpreter from tensorflow version 2.18.0-dev20240711 and revision v1.12.1-112931-gbc6210b35b0.
+#include "../../TestData/fully_connected/biases_data.h"
+#include "../../TestData/fully_connected/config_data.h"
+#include "../../TestData/fully_connected/input_data.h"
+#include "../../TestData/fully_connected/output_ref_data.h"
+#include "../../TestData/fully_connected/weights_data.h"
@@ -0,0 +1,12 @@
+// Generated by test_settings.py using tensorflow version 2.18.0-dev20240711 (Keras version 3.4.1.dev2024071203).
+// Interpreter from tensorflow version 2.18.0-dev20240711 and revision v1.12.1-112931-gbc6210b35b0.
+#pragma once
+#include <stdint.h>
+
+const int8_t fully_connected_weights[120] = {
+    -55, 18,  26,   -100, -109, -70, 56,   66,  118, 56,   28,   39,   70,   67,  100, -11, 3,    112, 2,   127,
+    -92, 16,  35,   -87,  51,   2,   45,   -74, 99,  3,    89,   -45,  78,   76,  -47, -83, 60,   3,   92,  65,
+    47,  14,  -65,  7,    11,   70,  -120, 33,  -18, 125,  -27,  6,    40,   -65, 104, -85, -117, 14,  -55, 69,
+    114, -93, -37,  1,    -72,  1,   -63,  -42, 27,  -18,  93,   101,  86,   -77, 46,  80,  -7,   96,  -81, -70,
+    91,  29,  109,  46,   7,    -12, 68,   39,  1,   -103, 56,   94,   58,   126, 70,  12,  -80,  119, 85,  42,
+    22,  99,  -102, 5,    3,    74,  95,   68,  91,  24,   -119, -113, -106, 99,  -62, 4,   101,  67,  51,  -39};
@@ -0,0 +1,6 @@
+// Generated by pack_s4_test_data.py from the s8 case "fully_connected".
+#pragma once
+#include <stdint.h>
+
+const int32_t fully_connected_s4_biases[6] = {
+    940, 1688, -990, 364, -1700, -1295};
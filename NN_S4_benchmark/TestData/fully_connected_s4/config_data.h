@@ -0,0 +1,17 @@
+// Generated by pack_s4_test_data.py from the s8 case "fully_connected".
+#pragma once
+#define FULLY_CONNECTED_S4_OUT_CH 6
+#define FULLY_CONNECTED_S4_IN_CH 20
+#define FULLY_CONNECTED_S4_INPUT_W 1
+#define FULLY_CONNECTED_S4_INPUT_H 1
+#define FULLY_CONNECTED_S4_DST_SIZE 18
+#define FULLY_CONNECTED_S4_INPUT_SIZE 60
+#define FULLY_CONNECTED_S4_OUT_ACTIVATION_MIN -128
+#define FULLY_CONNECTED_S4_OUT_ACTIVATION_MAX 127
+#define FULLY_CONNECTED_S4_INPUT_BATCHES 3
+#define FULLY_CONNECTED_S4_ACCUMULATION_DEPTH 20
+#define FULLY_CONNECTED_S4_OUTPUT_MULTIPLIER 1522390241
+#define FULLY_CONNECTED_S4_OUTPUT_SHIFT -5
+#define FULLY_CONNECTED_S4_INPUT_OFFSET 128
+#define FULLY_CONNECTED_S4_OUTPUT_OFFSET -102
+#define FULLY_CONNECTED_S4_WEIGHTS_SIZE 60
@@ -0,0 +1,9 @@
+// Generated by pack_s4_test_data.py from the s8 case "fully_connected".
+#pragma once
+#include <stdint.h>
+
+const int8_t fully_connected_s4_input[60] = {
+    -79, -90, 26, -66, -40, -13, -102, 67, -112, -92, 40, 113, 69, -63, -122, -24,
+    122, -88, 126, 123, -69, 51, -83, 83, -127, -73, 93, 114, 52, -89, -109, -41,
+    84, 10, -80, 24, 65, -122, -65, 121, -55, 59, -6, 113, -101, -40, 72, -11,
+    67, 83, -70, -111, -64, 53, -43, 77, 66, -54, 42, 5};
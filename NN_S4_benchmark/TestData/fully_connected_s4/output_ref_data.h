@@ -0,0 +1,7 @@
+// Generated by pack_s4_test_data.py from the s8 case "fully_connected".
+#pragma once
+#include <stdint.h>
+
+const int8_t fully_connected_s4_output_ref[18] = {
+    -2, 8, -128, -81, -17, -128, 32, -29, -128, -116, -25, -55, 8, -25, -128, -127,
+    -29, -26};
@@ -0,0 +1,6 @@
+// Generated by pack_s4_test_data.py from the s8 case "fully_connected".
+#include "../../TestData/fully_connected_s4/biases_data.h"
+#include "../../TestData/fully_connected_s4/config_data.h"
+#include "../../TestData/fully_connected_s4/input_data.h"
+#include "../../TestData/fully_connected_s4/output_ref_data.h"
+#include "../../TestData/fully_connected_s4/weights_data.h"
@@ -0,0 +1,9 @@
+// Generated by pack_s4_test_data.py from the s8 case "fully_connected".
+#pragma once
+#include <stdint.h>
+
+const int8_t fully_connected_s4_weights[60] = {
+    29, -95, -54, 67, 55, 34, 68, -10, 96, 112, 27, -78, 3, -62, 5, -27,
+    68, -67, 3, 69, 19, 12, 65, 41, 127, 15, -62, -74, 26, 77, -74, 14,
+    12, -19, -15, 101, -59, 67, 80, -52, 37, 54, -16, 36, -96, 83, 115, 20,
+    124, 37, 81, 10, 64, 69, 21, -87, 90, 13, 70, -29};
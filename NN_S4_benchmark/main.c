@@ -0,0 +1,65 @@
+#include "main.h"
+
+void basic_arm_convolve_s4(void);
+void conv_2x2_dilation_arm_convolve_s4(void);
+void fc_per_ch_1x1_arm_convolve_1x1_s4_fast(void);
+void depthwise_2_arm_depthwise_conv_s4(void);
+void depthwise_mult_batches_arm_depthwise_conv_s4_opt(void);
+void fully_connected_arm_fully_connected_s4(void);
+void dscnn_medium_model_s4_vs_s8(void);
+
+uint32_t clkFastfreq = 0;
+
+RAM_FUNC int main(void)
+{
+	__disable_irq();  // Disable all interrupts
+    cy_rslt_t result;
+
+    // Initialize the device and board peripherals
+    result = cybsp_init();
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Initialize retarget-io to use the debug UART port
+    result = cy_retarget_io_init_fc(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                    CYBSP_DEBUG_UART_CTS, CYBSP_DEBUG_UART_RTS, CY_RETARGET_IO_BAUDRATE);
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Get the clock frequency
+    clkFastfreq = Cy_SysClk_ClkFastGetFrequency();
+
+    // Print system details
+    printf("\n\r");
+    printf("-----Starting CMSIS-NN Int4 (S4) vs S8 Benchmark-----\n\r");
+    printf("\n\r");
+    printf("CPU Clock Frequency: %lu Hz\n\r", clkFastfreq);
+    printf("\n\r");
+
+    // Perform benchmarks
+    printf("*****ARM CONVOLVE WRAPPER S4*****\n\r");
+    basic_arm_convolve_s4();
+    conv_2x2_dilation_arm_convolve_s4();
+    printf("\n\r");
+
+    printf("*****ARM CONVOLVE 1X1 S4 FAST*****\n\r");
+    fc_per_ch_1x1_arm_convolve_1x1_s4_fast();
+    printf("\n\r");
+
+    printf("*****ARM DEPTHWISE CONVOLVE S4*****\n\r");
+    depthwise_2_arm_depthwise_conv_s4();
+    depthwise_mult_batches_arm_depthwise_conv_s4_opt();
+    printf("\n\r");
+
+    printf("*****ARM FULLY CONNECTED S4*****\n\r");
+    fully_connected_arm_fully_connected_s4();
+    printf("\n\r");
+
+    printf("*****DS-CNN MEDIUM MODEL S4 VS S8*****\n\r");
+    dscnn_medium_model_s4_vs_s8();
+
+    printf("Finish Int4 (S4) Benchmark\n\r");
+    return 0;
+}
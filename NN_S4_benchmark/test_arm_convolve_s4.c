@@ -0,0 +1,259 @@
+#include "main.h"
+#include "../TestData/basic/test_data.h"
+#include "../TestData/basic_s4/test_data.h"
+#include "../TestData/conv_2x2_dilation/test_data.h"
+#include "../TestData/conv_2x2_dilation_s4/test_data.h"
+#include "../TestData/fc_per_ch/test_data.h"
+#include "../TestData/fc_per_ch_1x1_s4/test_data.h"
+
+// The s4 cases are generated from the s8 ones by tools/pack_s4_test_data.py: same input,
+// shapes and offsets, requantised weights/bias/multipliers and a recomputed reference.
+
+typedef arm_cmsis_nn_status (*conv_kernel)(const cmsis_nn_context *ctx,
+                                           const cmsis_nn_conv_params *conv_params,
+                                           const cmsis_nn_per_channel_quant_params *quant_params,
+                                           const cmsis_nn_dims *input_dims,
+                                           const int8_t *input_data,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const int8_t *filter_data,
+                                           const cmsis_nn_dims *bias_dims,
+                                           const int32_t *bias_data,
+                                           const cmsis_nn_dims *output_dims,
+                                           int8_t *output_data);
+
+typedef struct {
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+    const int8_t *input_data;
+    const int8_t *kernel_data;
+    const int32_t *bias_data;
+    const int8_t *output_ref;
+    int32_t output_ref_size;
+} conv_case;
+
+// Runs one kernel on one case; returns the cycle count, or 0 if validation failed
+RAM_FUNC static uint32_t run_conv_kernel(const char *name, conv_kernel kernel, int32_t buf_size,
+                                         const conv_case *c, int8_t *output)
+{
+    cmsis_nn_context ctx;
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+    fill_stack_pattern_to_sp();
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+
+    kernel(&ctx,
+           &c->conv_params,
+           &c->quant_params,
+           &c->input_dims,
+           c->input_data,
+           &c->filter_dims,
+           c->kernel_data,
+           &c->bias_dims,
+           c->bias_data,
+           &c->output_dims,
+           output);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);  // Security wipe
+        free(ctx.buf);
+    }
+
+    printf("\n\r");
+    if (validate(output, c->output_ref, c->output_ref_size)) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Scratch Buffer: %ld bytes\n\r\n", (long)buf_size);
+        return cycle_count;
+    }
+    printf("%s output validation FAILED\n\r", name);
+    return 0;
+}
+
+RAM_FUNC void basic_arm_convolve_s4(void)
+{
+    int8_t output_s8[BASIC_DST_SIZE] = {0};
+    int8_t output_s4[BASIC_S4_DST_SIZE] = {0};
+    conv_case s8;
+    memset(&s8, 0, sizeof(s8));
+
+    s8.input_dims.n = BASIC_INPUT_BATCHES;
+    s8.input_dims.w = BASIC_INPUT_W;
+    s8.input_dims.h = BASIC_INPUT_H;
+    s8.input_dims.c = BASIC_IN_CH;
+    s8.filter_dims.w = BASIC_FILTER_X;
+    s8.filter_dims.h = BASIC_FILTER_Y;
+    s8.filter_dims.c = BASIC_IN_CH;
+    s8.output_dims.w = BASIC_OUTPUT_W;
+    s8.output_dims.h = BASIC_OUTPUT_H;
+    s8.output_dims.c = BASIC_OUT_CH;
+
+    s8.conv_params.padding.w = BASIC_PAD_X;
+    s8.conv_params.padding.h = BASIC_PAD_Y;
+    s8.conv_params.stride.w = BASIC_STRIDE_X;
+    s8.conv_params.stride.h = BASIC_STRIDE_Y;
+    s8.conv_params.dilation.w = BASIC_DILATION_X;
+    s8.conv_params.dilation.h = BASIC_DILATION_Y;
+    s8.conv_params.input_offset = BASIC_INPUT_OFFSET;
+    s8.conv_params.output_offset = BASIC_OUTPUT_OFFSET;
+    s8.conv_params.activation.min = BASIC_OUT_ACTIVATION_MIN;
+    s8.conv_params.activation.max = BASIC_OUT_ACTIVATION_MAX;
+
+    s8.quant_params.multiplier = (int32_t *)basic_output_mult;
+    s8.quant_params.shift = (int32_t *)basic_output_shift;
+    s8.input_data = basic_input;
+    s8.kernel_data = basic_weights;
+    s8.bias_data = basic_biases;
+    s8.output_ref = basic_output_ref;
+    s8.output_ref_size = BASIC_DST_SIZE;
+
+    conv_case s4 = s8;
+    s4.quant_params.multiplier = (int32_t *)basic_s4_output_mult;
+    s4.quant_params.shift = (int32_t *)basic_s4_output_shift;
+    s4.kernel_data = basic_s4_weights;
+    s4.bias_data = basic_s4_biases;
+    s4.output_ref = basic_s4_output_ref;
+    s4.output_ref_size = BASIC_S4_DST_SIZE;
+
+    int32_t buf_size_s8 = arm_convolve_wrapper_s8_get_buffer_size(&s8.conv_params, &s8.input_dims, &s8.filter_dims, &s8.output_dims);
+    int32_t buf_size_s4 = arm_convolve_wrapper_s4_get_buffer_size(&s4.conv_params, &s4.input_dims, &s4.filter_dims, &s4.output_dims);
+
+    uint32_t cycles_s8 = run_conv_kernel("basic_arm_convolve_wrapper_s8", arm_convolve_wrapper_s8, buf_size_s8, &s8, output_s8);
+    uint32_t cycles_s4 = run_conv_kernel("basic_arm_convolve_wrapper_s4", arm_convolve_wrapper_s4, buf_size_s4, &s4, output_s4);
+
+    report_s4_vs_s8("basic", cycles_s8, cycles_s4, sizeof(basic_weights), sizeof(basic_s4_weights),
+                    max_abs_diff_s8(output_s4, basic_output_ref, BASIC_DST_SIZE));
+}
+
+RAM_FUNC void conv_2x2_dilation_arm_convolve_s4(void)
+{
+    int8_t output_s8[CONV_2X2_DILATION_DST_SIZE] = {0};
+    int8_t output_s4[CONV_2X2_DILATION_S4_DST_SIZE] = {0};
+    conv_case s8;
+    memset(&s8, 0, sizeof(s8));
+
+    s8.input_dims.n = CONV_2X2_DILATION_INPUT_BATCHES;
+    s8.input_dims.w = CONV_2X2_DILATION_INPUT_W;
+    s8.input_dims.h = CONV_2X2_DILATION_INPUT_H;
+    s8.input_dims.c = CONV_2X2_DILATION_IN_CH;
+    s8.filter_dims.w = CONV_2X2_DILATION_FILTER_X;
+    s8.filter_dims.h = CONV_2X2_DILATION_FILTER_Y;
+    s8.filter_dims.c = CONV_2X2_DILATION_IN_CH;
+    s8.output_dims.w = CONV_2X2_DILATION_OUTPUT_W;
+    s8.output_dims.h = CONV_2X2_DILATION_OUTPUT_H;
+    s8.output_dims.c = CONV_2X2_DILATION_OUT_CH;
+
+    s8.conv_params.padding.w = CONV_2X2_DILATION_PAD_X;
+    s8.conv_params.padding.h = CONV_2X2_DILATION_PAD_Y;
+    s8.conv_params.stride.w = CONV_2X2_DILATION_STRIDE_X;
+    s8.conv_params.stride.h = CONV_2X2_DILATION_STRIDE_Y;
+    s8.conv_params.dilation.w = CONV_2X2_DILATION_DILATION_X;
+    s8.conv_params.dilation.h = CONV_2X2_DILATION_DILATION_Y;
+    s8.conv_params.input_offset = CONV_2X2_DILATION_INPUT_OFFSET;
+    s8.conv_params.output_offset = CONV_2X2_DILATION_OUTPUT_OFFSET;
+    s8.conv_params.activation.min = CONV_2X2_DILATION_OUT_ACTIVATION_MIN;
+    s8.conv_params.activation.max = CONV_2X2_DILATION_OUT_ACTIVATION_MAX;
+
+    s8.quant_params.multiplier = (int32_t *)conv_2x2_dilation_output_mult;
+    s8.quant_params.shift = (int32_t *)conv_2x2_dilation_output_shift;
+    s8.input_data = conv_2x2_dilation_input;
+    s8.kernel_data = conv_2x2_dilation_weights;
+    s8.bias_data = conv_2x2_dilation_biases;
+    s8.output_ref = conv_2x2_dilation_output_ref;
+    s8.output_ref_size = CONV_2X2_DILATION_DST_SIZE;
+
+    conv_case s4 = s8;
+    s4.quant_params.multiplier = (int32_t *)conv_2x2_dilation_s4_output_mult;
+    s4.quant_params.shift = (int32_t *)conv_2x2_dilation_s4_output_shift;
+    s4.kernel_data = conv_2x2_dilation_s4_weights;
+    s4.bias_data = conv_2x2_dilation_s4_biases;
+    s4.output_ref = conv_2x2_dilation_s4_output_ref;
+    s4.output_ref_size = CONV_2X2_DILATION_S4_DST_SIZE;
+
+    int32_t buf_size_s8 = arm_convolve_wrapper_s8_get_buffer_size(&s8.conv_params, &s8.input_dims, &s8.filter_dims, &s8.output_dims);
+    int32_t buf_size_s4 = arm_convolve_wrapper_s4_get_buffer_size(&s4.conv_params, &s4.input_dims, &s4.filter_dims, &s4.output_dims);
+
+    uint32_t cycles_s8 = run_conv_kernel("conv_2x2_dilation_arm_convolve_wrapper_s8", arm_convolve_wrapper_s8, buf_size_s8, &s8, output_s8);
+    uint32_t cycles_s4 = run_conv_kernel("conv_2x2_dilation_arm_convolve_wrapper_s4", arm_convolve_wrapper_s4, buf_size_s4, &s4, output_s4);
+
+    report_s4_vs_s8("conv_2x2_dilation", cycles_s8, cycles_s4,
+                    sizeof(conv_2x2_dilation_weights), sizeof(conv_2x2_dilation_s4_weights),
+                    max_abs_diff_s8(output_s4, conv_2x2_dilation_output_ref, CONV_2X2_DILATION_DST_SIZE));
+}
+
+// fc_per_ch recast as a 1x1 convolution over a single pixel, so both 1x1 fast kernels apply
+RAM_FUNC void fc_per_ch_1x1_arm_convolve_1x1_s4_fast(void)
+{
+    int8_t output_s8[FC_PER_CH_DST_SIZE] = {0};
+    int8_t output_s4[FC_PER_CH_1X1_S4_DST_SIZE] = {0};
+    conv_case s8;
+    memset(&s8, 0, sizeof(s8));
+
+    s8.input_dims.n = FC_PER_CH_1X1_S4_INPUT_BATCHES;
+    s8.input_dims.w = FC_PER_CH_1X1_S4_INPUT_W;
+    s8.input_dims.h = FC_PER_CH_1X1_S4_INPUT_H;
+    s8.input_dims.c = FC_PER_CH_1X1_S4_IN_CH;
+    s8.filter_dims.w = FC_PER_CH_1X1_S4_FILTER_X;
+    s8.filter_dims.h = FC_PER_CH_1X1_S4_FILTER_Y;
+    s8.filter_dims.c = FC_PER_CH_1X1_S4_IN_CH;
+    s8.output_dims.w = FC_PER_CH_1X1_S4_OUTPUT_W;
+    s8.output_dims.h = FC_PER_CH_1X1_S4_OUTPUT_H;
+    s8.output_dims.c = FC_PER_CH_1X1_S4_OUT_CH;
+
+    s8.conv_params.padding.w = FC_PER_CH_1X1_S4_PAD_X;
+    s8.conv_params.padding.h = FC_PER_CH_1X1_S4_PAD_Y;
+    s8.conv_params.stride.w = FC_PER_CH_1X1_S4_STRIDE_X;
+    s8.conv_params.stride.h = FC_PER_CH_1X1_S4_STRIDE_Y;
+    s8.conv_params.dilation.w = FC_PER_CH_1X1_S4_DILATION_X;
+    s8.conv_params.dilation.h = FC_PER_CH_1X1_S4_DILATION_Y;
+    s8.conv_params.input_offset = FC_PER_CH_INPUT_OFFSET;
+    s8.conv_params.output_offset = FC_PER_CH_OUTPUT_OFFSET;
+    s8.conv_params.activation.min = FC_PER_CH_OUT_ACTIVATION_MIN;
+    s8.conv_params.activation.max = FC_PER_CH_OUT_ACTIVATION_MAX;
+
+    s8.quant_params.multiplier = (int32_t *)fc_per_ch_output_multiplier;
+    s8.quant_params.shift = (int32_t *)fc_per_ch_output_shift;
+    s8.input_data = fc_per_ch_input;
+    s8.kernel_data = fc_per_ch_weights;
+    s8.bias_data = fc_per_ch_bias;
+    s8.output_ref = fc_per_ch_output;
+    s8.output_ref_size = FC_PER_CH_DST_SIZE;
+
+    conv_case s4 = s8;
+    s4.quant_params.multiplier = (int32_t *)fc_per_ch_1x1_s4_output_mult;
+    s4.quant_params.shift = (int32_t *)fc_per_ch_1x1_s4_output_shift;
+    s4.kernel_data = fc_per_ch_1x1_s4_weights;
+    s4.bias_data = fc_per_ch_1x1_s4_biases;
+    s4.output_ref = fc_per_ch_1x1_s4_output_ref;
+    s4.output_ref_size = FC_PER_CH_1X1_S4_DST_SIZE;
+
+    int32_t buf_size_s8 = arm_convolve_1x1_s8_fast_get_buffer_size(&s8.input_dims);
+    int32_t buf_size_s4 = arm_convolve_1x1_s4_fast_get_buffer_size(&s4.input_dims);
+
+    uint32_t cycles_s8 = run_conv_kernel("fc_per_ch_1x1_arm_convolve_1x1_s8_fast", arm_convolve_1x1_s8_fast, buf_size_s8, &s8, output_s8);
+    uint32_t cycles_s4 = run_conv_kernel("fc_per_ch_1x1_arm_convolve_1x1_s4_fast", arm_convolve_1x1_s4_fast, buf_size_s4, &s4, output_s4);
+
+    report_s4_vs_s8("fc_per_ch_1x1", cycles_s8, cycles_s4, sizeof(fc_per_ch_weights), sizeof(fc_per_ch_1x1_s4_weights),
+                    max_abs_diff_s8(output_s4, fc_per_ch_output, FC_PER_CH_DST_SIZE));
+}
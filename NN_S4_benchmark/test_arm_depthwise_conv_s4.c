@@ -0,0 +1,224 @@
+#include "main.h"
+#include "../TestData/depthwise_2/test_data.h"
+#include "../TestData/depthwise_2_s4/test_data.h"
+#include "../TestData/depthwise_mult_batches/test_data.h"
+#include "../TestData/depthwise_mult_batches_s4/test_data.h"
+
+typedef arm_cmsis_nn_status (*dw_conv_kernel)(const cmsis_nn_context *ctx,
+                                              const cmsis_nn_dw_conv_params *dw_conv_params,
+                                              const cmsis_nn_per_channel_quant_params *quant_params,
+                                              const cmsis_nn_dims *input_dims,
+                                              const int8_t *input_data,
+                                              const cmsis_nn_dims *filter_dims,
+                                              const int8_t *filter_data,
+                                              const cmsis_nn_dims *bias_dims,
+                                              const int32_t *bias_data,
+                                              const cmsis_nn_dims *output_dims,
+                                              int8_t *output_data);
+
+typedef struct {
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+    const int8_t *input_data;
+    const int8_t *kernel_data;
+    const int32_t *bias_data;
+    const int8_t *output_ref;
+    int32_t output_ref_size;
+} dw_conv_case;
+
+// Runs one kernel on one case; returns the cycle count, or 0 if validation failed.
+// The *_opt kernels take one batch per call, so batches are issued one by one inside
+// the timed region; the wrappers get the full input in a single call.
+RAM_FUNC static uint32_t run_dw_conv_kernel(const char *name, dw_conv_kernel kernel, int32_t buf_size,
+                                            const dw_conv_case *c, int per_batch, int8_t *output)
+{
+    cmsis_nn_context ctx;
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+    cmsis_nn_dims input_dims = c->input_dims;
+    cmsis_nn_dims output_dims = c->output_dims;
+    int32_t batches = 1;
+    if (per_batch) {
+        batches = input_dims.n;
+        input_dims.n = 1;
+        output_dims.n = 1;
+    }
+    const int32_t input_batch_size = input_dims.n * input_dims.h * input_dims.w * input_dims.c;
+    const int32_t output_batch_size = output_dims.n * output_dims.h * output_dims.w * output_dims.c;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    for (int32_t b = 0; b < batches; b++) {
+        kernel(&ctx,
+               &c->dw_conv_params,
+               &c->quant_params,
+               &input_dims,
+               c->input_data + b * input_batch_size,
+               &c->filter_dims,
+               c->kernel_data,
+               &c->bias_dims,
+               c->bias_data,
+               &output_dims,
+               output + b * output_batch_size);
+    }
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);  // Security wipe
+        free(ctx.buf);
+    }
+
+    printf("\n\r");
+    if (validate(output, c->output_ref, c->output_ref_size)) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("Scratch Buffer: %ld bytes\n\r\n", (long)buf_size);
+        return cycle_count;
+    }
+    printf("%s output validation FAILED\n\r", name);
+    return 0;
+}
+
+// ch_mult = 3: both wrappers fall back to the generic depthwise kernels
+RAM_FUNC void depthwise_2_arm_depthwise_conv_s4(void)
+{
+    int8_t output_s8[DEPTHWISE_2_DST_SIZE] = {0};
+    int8_t output_s4[DEPTHWISE_2_S4_DST_SIZE] = {0};
+    dw_conv_case s8;
+    memset(&s8, 0, sizeof(s8));
+
+    s8.input_dims.n = DEPTHWISE_2_INPUT_BATCHES;
+    s8.input_dims.w = DEPTHWISE_2_INPUT_W;
+    s8.input_dims.h = DEPTHWISE_2_INPUT_H;
+    s8.input_dims.c = DEPTHWISE_2_IN_CH;
+    s8.filter_dims.w = DEPTHWISE_2_FILTER_X;
+    s8.filter_dims.h = DEPTHWISE_2_FILTER_Y;
+    s8.output_dims.n = DEPTHWISE_2_INPUT_BATCHES;
+    s8.output_dims.w = DEPTHWISE_2_OUTPUT_W;
+    s8.output_dims.h = DEPTHWISE_2_OUTPUT_H;
+    s8.output_dims.c = DEPTHWISE_2_OUT_CH;
+
+    s8.dw_conv_params.padding.w = DEPTHWISE_2_PAD_X;
+    s8.dw_conv_params.padding.h = DEPTHWISE_2_PAD_Y;
+    s8.dw_conv_params.stride.w = DEPTHWISE_2_STRIDE_X;
+    s8.dw_conv_params.stride.h = DEPTHWISE_2_STRIDE_Y;
+    s8.dw_conv_params.dilation.w = DEPTHWISE_2_DILATION_X;
+    s8.dw_conv_params.dilation.h = DEPTHWISE_2_DILATION_Y;
+    s8.dw_conv_params.ch_mult = DEPTHWISE_2_CH_MULT;
+    s8.dw_conv_params.input_offset = DEPTHWISE_2_INPUT_OFFSET;
+    s8.dw_conv_params.output_offset = DEPTHWISE_2_OUTPUT_OFFSET;
+    s8.dw_conv_params.activation.min = DEPTHWISE_2_OUT_ACTIVATION_MIN;
+    s8.dw_conv_params.activation.max = DEPTHWISE_2_OUT_ACTIVATION_MAX;
+
+    s8.quant_params.multiplier = (int32_t *)depthwise_2_output_mult;
+    s8.quant_params.shift = (int32_t *)depthwise_2_output_shift;
+    s8.input_data = depthwise_2_input;
+    s8.kernel_data = depthwise_2_weights;
+    s8.bias_data = depthwise_2_biases;
+    s8.output_ref = depthwise_2_output_ref;
+    s8.output_ref_size = DEPTHWISE_2_DST_SIZE;
+
+    dw_conv_case s4 = s8;
+    s4.quant_params.multiplier = (int32_t *)depthwise_2_s4_output_mult;
+    s4.quant_params.shift = (int32_t *)depthwise_2_s4_output_shift;
+    s4.kernel_data = depthwise_2_s4_weights;
+    s4.bias_data = depthwise_2_s4_biases;
+    s4.output_ref = depthwise_2_s4_output_ref;
+    s4.output_ref_size = DEPTHWISE_2_S4_DST_SIZE;
+
+    const int32_t buf_size_s8 =
+        arm_depthwise_conv_wrapper_s8_get_buffer_size(&s8.dw_conv_params, &s8.input_dims, &s8.filter_dims, &s8.output_dims);
+    const int32_t buf_size_s4 =
+        arm_depthwise_conv_wrapper_s4_get_buffer_size(&s4.dw_conv_params, &s4.input_dims, &s4.filter_dims, &s4.output_dims);
+
+    uint32_t cycles_s8 = run_dw_conv_kernel("depthwise_2_arm_depthwise_conv_wrapper_s8", arm_depthwise_conv_wrapper_s8,
+                                            buf_size_s8, &s8, 0, output_s8);
+    uint32_t cycles_s4 = run_dw_conv_kernel("depthwise_2_arm_depthwise_conv_wrapper_s4", arm_depthwise_conv_wrapper_s4,
+                                            buf_size_s4, &s4, 0, output_s4);
+
+    report_s4_vs_s8("depthwise_2", cycles_s8, cycles_s4, sizeof(depthwise_2_weights), sizeof(depthwise_2_s4_weights),
+                    max_abs_diff_s8(output_s4, depthwise_2_output_ref, DEPTHWISE_2_DST_SIZE));
+}
+
+// ch_mult = 1, no dilation: the optimised kernels apply, one batch per call
+RAM_FUNC void depthwise_mult_batches_arm_depthwise_conv_s4_opt(void)
+{
+    int8_t output_s8[DEPTHWISE_MULT_BATCHES_DST_SIZE] = {0};
+    int8_t output_s4[DEPTHWISE_MULT_BATCHES_S4_DST_SIZE] = {0};
+    dw_conv_case s8;
+    memset(&s8, 0, sizeof(s8));
+
+    s8.input_dims.n = DEPTHWISE_MULT_BATCHES_INPUT_BATCHES;
+    s8.input_dims.w = DEPTHWISE_MULT_BATCHES_INPUT_W;
+    s8.input_dims.h = DEPTHWISE_MULT_BATCHES_INPUT_H;
+    s8.input_dims.c = DEPTHWISE_MULT_BATCHES_IN_CH;
+    s8.filter_dims.w = DEPTHWISE_MULT_BATCHES_FILTER_X;
+    s8.filter_dims.h = DEPTHWISE_MULT_BATCHES_FILTER_Y;
+    s8.filter_dims.c = DEPTHWISE_MULT_BATCHES_OUT_CH;
+    s8.output_dims.n = DEPTHWISE_MULT_BATCHES_INPUT_BATCHES;
+    s8.output_dims.w = DEPTHWISE_MULT_BATCHES_OUTPUT_W;
+    s8.output_dims.h = DEPTHWISE_MULT_BATCHES_OUTPUT_H;
+    s8.output_dims.c = DEPTHWISE_MULT_BATCHES_OUT_CH;
+
+    s8.dw_conv_params.padding.w = DEPTHWISE_MULT_BATCHES_PAD_X;
+    s8.dw_conv_params.padding.h = DEPTHWISE_MULT_BATCHES_PAD_Y;
+    s8.dw_conv_params.stride.w = DEPTHWISE_MULT_BATCHES_STRIDE_X;
+    s8.dw_conv_params.stride.h = DEPTHWISE_MULT_BATCHES_STRIDE_Y;
+    s8.dw_conv_params.dilation.w = DEPTHWISE_MULT_BATCHES_DILATION_X;
+    s8.dw_conv_params.dilation.h = DEPTHWISE_MULT_BATCHES_DILATION_Y;
+    s8.dw_conv_params.ch_mult = DEPTHWISE_MULT_BATCHES_CH_MULT;
+    s8.dw_conv_params.input_offset = DEPTHWISE_MULT_BATCHES_INPUT_OFFSET;
+    s8.dw_conv_params.output_offset = DEPTHWISE_MULT_BATCHES_OUTPUT_OFFSET;
+    s8.dw_conv_params.activation.min = DEPTHWISE_MULT_BATCHES_OUT_ACTIVATION_MIN;
+    s8.dw_conv_params.activation.max = DEPTHWISE_MULT_BATCHES_OUT_ACTIVATION_MAX;
+
+    s8.quant_params.multiplier = (int32_t *)depthwise_mult_batches_output_mult;
+    s8.quant_params.shift = (int32_t *)depthwise_mult_batches_output_shift;
+    s8.input_data = depthwise_mult_batches_input;
+    s8.kernel_data = depthwise_mult_batches_weights;
+    s8.bias_data = depthwise_mult_batches_biases;
+    s8.output_ref = depthwise_mult_batches_output_ref;
+    s8.output_ref_size = DEPTHWISE_MULT_BATCHES_DST_SIZE;
+
+    dw_conv_case s4 = s8;
+    s4.quant_params.multiplier = (int32_t *)depthwise_mult_batches_s4_output_mult;
+    s4.quant_params.shift = (int32_t *)depthwise_mult_batches_s4_output_shift;
+    s4.kernel_data = depthwise_mult_batches_s4_weights;
+    s4.bias_data = depthwise_mult_batches_s4_biases;
+    s4.output_ref = depthwise_mult_batches_s4_output_ref;
+    s4.output_ref_size = DEPTHWISE_MULT_BATCHES_S4_DST_SIZE;
+
+    const int32_t buf_size_s8 = arm_depthwise_conv_s8_opt_get_buffer_size(&s8.input_dims, &s8.filter_dims);
+    const int32_t buf_size_s4 = arm_depthwise_conv_s4_opt_get_buffer_size(&s4.input_dims, &s4.filter_dims);
+
+    uint32_t cycles_s8 = run_dw_conv_kernel("depthwise_mult_batches_arm_depthwise_conv_s8_opt", arm_depthwise_conv_s8_opt,
+                                            buf_size_s8, &s8, 1, output_s8);
+    uint32_t cycles_s4 = run_dw_conv_kernel("depthwise_mult_batches_arm_depthwise_conv_s4_opt", arm_depthwise_conv_s4_opt,
+                                            buf_size_s4, &s4, 1, output_s4);
+
+    report_s4_vs_s8("depthwise_mult_batches", cycles_s8, cycles_s4,
+                    sizeof(depthwise_mult_batches_weights), sizeof(depthwise_mult_batches_s4_weights),
+                    max_abs_diff_s8(output_s4, depthwise_mult_batches_output_ref, DEPTHWISE_MULT_BATCHES_DST_SIZE));
+}
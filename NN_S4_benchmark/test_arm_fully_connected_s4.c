@@ -0,0 +1,131 @@
+#include "main.h"
+#include "../TestData/fully_connected/test_data.h"
+#include "../TestData/fully_connected_s4/test_data.h"
+
+typedef arm_cmsis_nn_status (*fc_kernel)(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_fc_params *fc_params,
+                                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const int8_t *input_data,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const int8_t *filter_data,
+                                         const cmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const cmsis_nn_dims *output_dims,
+                                         int8_t *output_data);
+
+typedef struct {
+    cmsis_nn_fc_params fc_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+    const int8_t *input_data;
+    const int8_t *kernel_data;
+    const int32_t *bias_data;
+    const int8_t *output_ref;
+    int32_t output_ref_size;
+} fc_case;
+
+// Runs one kernel on one case; returns the cycle count, or 0 if validation failed
+RAM_FUNC static uint32_t run_fc_kernel(const char *name, fc_kernel kernel, const fc_case *c, int8_t *output)
+{
+    cmsis_nn_context ctx;
+    const int32_t buf_size = arm_fully_connected_s8_get_buffer_size(&c->filter_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    kernel(&ctx,
+           &c->fc_params,
+           &c->quant_params,
+           &c->input_dims,
+           c->input_data,
+           &c->filter_dims,
+           c->kernel_data,
+           &c->bias_dims,
+           c->bias_data,
+           &c->output_dims,
+           output);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    if (ctx.buf)
+    {
+        // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+
+    printf("\n\r");
+    if (validate(output, c->output_ref, c->output_ref_size)) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+        return cycle_count;
+    }
+    printf("%s output validation FAILED\n\r", name);
+    return 0;
+}
+
+RAM_FUNC void fully_connected_arm_fully_connected_s4(void)
+{
+    int8_t output_s8[FULLY_CONNECTED_DST_SIZE] = {0};
+    int8_t output_s4[FULLY_CONNECTED_S4_DST_SIZE] = {0};
+    fc_case s8;
+    memset(&s8, 0, sizeof(s8));
+
+    s8.input_dims.n = FULLY_CONNECTED_INPUT_BATCHES;
+    s8.input_dims.w = FULLY_CONNECTED_INPUT_W;
+    s8.input_dims.h = FULLY_CONNECTED_INPUT_H;
+    s8.input_dims.c = FULLY_CONNECTED_IN_CH;
+    s8.filter_dims.n = FULLY_CONNECTED_ACCUMULATION_DEPTH;
+    s8.filter_dims.c = FULLY_CONNECTED_OUT_CH;
+    s8.output_dims.n = FULLY_CONNECTED_INPUT_BATCHES;
+    s8.output_dims.c = FULLY_CONNECTED_OUT_CH;
+
+    s8.fc_params.input_offset = FULLY_CONNECTED_INPUT_OFFSET;
+    s8.fc_params.filter_offset = 0;
+    s8.fc_params.output_offset = FULLY_CONNECTED_OUTPUT_OFFSET;
+    s8.fc_params.activation.min = FULLY_CONNECTED_OUT_ACTIVATION_MIN;
+    s8.fc_params.activation.max = FULLY_CONNECTED_OUT_ACTIVATION_MAX;
+
+    s8.quant_params.multiplier = FULLY_CONNECTED_OUTPUT_MULTIPLIER;
+    s8.quant_params.shift = FULLY_CONNECTED_OUTPUT_SHIFT;
+    s8.input_data = fully_connected_input;
+    s8.kernel_data = fully_connected_weights;
+    s8.bias_data = fully_connected_biases;
+    s8.output_ref = fully_connected_output_ref;
+    s8.output_ref_size = FULLY_CONNECTED_DST_SIZE;
+
+    fc_case s4 = s8;
+    s4.quant_params.multiplier = FULLY_CONNECTED_S4_OUTPUT_MULTIPLIER;
+    s4.quant_params.shift = FULLY_CONNECTED_S4_OUTPUT_SHIFT;
+    s4.kernel_data = fully_connected_s4_weights;
+    s4.bias_data = fully_connected_s4_biases;
+    s4.output_ref = fully_connected_s4_output_ref;
+    s4.output_ref_size = FULLY_CONNECTED_S4_DST_SIZE;
+
+    uint32_t cycles_s8 = run_fc_kernel("fully_connected_arm_fully_connected_s8", arm_fully_connected_s8, &s8, output_s8);
+    uint32_t cycles_s4 = run_fc_kernel("fully_connected_arm_fully_connected_s4", arm_fully_connected_s4, &s4, output_s4);
+
+    report_s4_vs_s8("fully_connected", cycles_s8, cycles_s4,
+                    sizeof(fully_connected_weights), sizeof(fully_connected_s4_weights),
+                    max_abs_diff_s8(output_s4, fully_connected_output_ref, FULLY_CONNECTED_DST_SIZE));
+}
@@ -0,0 +1,226 @@
+#include "main.h"
+
+// Model path: the DS-CNN medium layer sequence (same layers as NN_KWS_DSCNN_MEDIUM) run once
+// with s8 weights and once with packed s4 weights. Each layer gets random input and weights,
+// as in the KWS projects, so there is no reference output; the figures are cycles, stack and
+// weight flash. Repeated layers are timed once and counted repeat times in the totals.
+// The shapes use SAME padding, so the 1x1 convolutions take the 1x1 fast path in both wrappers.
+
+typedef enum {
+    DSCNN_DW_CONV,
+    DSCNN_CONV,
+    DSCNN_AVGPOOL,
+    DSCNN_FC
+} dscnn_layer_type;
+
+typedef struct {
+    const char *name;
+    dscnn_layer_type type;
+    int repeat;
+    cmsis_nn_dims input_dims;       // n, h, w, c
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+    cmsis_nn_tile stride;           // w, h
+    cmsis_nn_tile padding;
+    int32_t ch_mult;
+} dscnn_layer;
+
+static const dscnn_layer DSCNN_MEDIUM_LAYERS[] = {
+    {"Layer 0: DEPTHWISE_CONV_2D 10x4", DSCNN_DW_CONV, 1,
+     {1, 49, 10, 1}, {1, 10, 4, 172}, {1, 25, 10, 172}, {1, 2}, {1, 4}, 172},
+    {"Layer 2: DEPTHWISE_CONV_2D 3x3/2", DSCNN_DW_CONV, 1,
+     {1, 25, 10, 172}, {1, 3, 3, 172}, {1, 13, 5, 172}, {2, 2}, {1, 1}, 1},
+    {"Layers 3, 5, 7, 9, 11: CONV_2D 1x1", DSCNN_CONV, 5,
+     {1, 13, 5, 172}, {172, 1, 1, 172}, {1, 13, 5, 172}, {1, 1}, {0, 0}, 0},
+    {"Layers 4, 6, 8, 10: DEPTHWISE_CONV_2D 3x3", DSCNN_DW_CONV, 4,
+     {1, 13, 5, 172}, {1, 3, 3, 172}, {1, 13, 5, 172}, {1, 1}, {1, 1}, 1},
+    {"Layer 12: AVERAGE_POOL_2D", DSCNN_AVGPOOL, 1,
+     {1, 13, 5, 172}, {1, 13, 5, 1}, {1, 1, 1, 172}, {5, 13}, {0, 0}, 0},
+    {"Layer 13: FULLY_CONNECTED", DSCNN_FC, 1,
+     {1, 1, 1, 172}, {172, 1, 1, 12}, {1, 1, 1, 12}, {1, 1}, {0, 0}, 0},
+};
+
+#define DSCNN_MEDIUM_LAYER_COUNT ((int)(sizeof(DSCNN_MEDIUM_LAYERS) / sizeof(DSCNN_MEDIUM_LAYERS[0])))
+
+static int32_t dscnn_weight_count(const dscnn_layer *l)
+{
+    const cmsis_nn_dims *f = &l->filter_dims;
+    switch (l->type) {
+    case DSCNN_DW_CONV: return f->h * f->w * f->c;
+    case DSCNN_CONV:    return f->n * f->h * f->w * f->c;
+    case DSCNN_FC:      return f->n * f->c;
+    default:            return 0;
+    }
+}
+
+// Two int4 weights per byte, so an odd count still takes a whole byte
+static int32_t dscnn_weight_bytes(const dscnn_layer *l, int s4)
+{
+    const int32_t count = dscnn_weight_count(l);
+    return s4 ? (count + 1) / 2 : count;
+}
+
+static int32_t dscnn_buffer_size(const dscnn_layer *l, int s4,
+                                 const cmsis_nn_conv_params *conv_params,
+                                 const cmsis_nn_dw_conv_params *dw_conv_params)
+{
+    switch (l->type) {
+    case DSCNN_DW_CONV:
+        return s4 ? arm_depthwise_conv_wrapper_s4_get_buffer_size(dw_conv_params, &l->input_dims, &l->filter_dims, &l->output_dims)
+                  : arm_depthwise_conv_wrapper_s8_get_buffer_size(dw_conv_params, &l->input_dims, &l->filter_dims, &l->output_dims);
+    case DSCNN_CONV:
+        return s4 ? arm_convolve_wrapper_s4_get_buffer_size(conv_params, &l->input_dims, &l->filter_dims, &l->output_dims)
+                  : arm_convolve_wrapper_s8_get_buffer_size(conv_params, &l->input_dims, &l->filter_dims, &l->output_dims);
+    case DSCNN_AVGPOOL:
+        return arm_avgpool_s8_get_buffer_size(l->output_dims.w, l->input_dims.c);
+    case DSCNN_FC:
+        return arm_fully_connected_s8_get_buffer_size(&l->filter_dims);
+    }
+    return 0;
+}
+
+// Runs one layer with s8 or s4 weights; returns the cycle count and stores the stack usage
+RAM_FUNC static uint32_t run_dscnn_layer(const dscnn_layer *l, int s4, uint32_t *stack_used)
+{
+    const int32_t input_size = l->input_dims.n * l->input_dims.h * l->input_dims.w * l->input_dims.c;
+    const int32_t output_size = l->output_dims.n * l->output_dims.h * l->output_dims.w * l->output_dims.c;
+    const int32_t weight_bytes = dscnn_weight_bytes(l, s4);
+    const int32_t out_ch = l->output_dims.c;
+
+    int8_t *input = malloc(input_size);
+    int8_t *weights = malloc(weight_bytes ? weight_bytes : 1);
+    int32_t *biases = malloc(out_ch * sizeof(int32_t));
+    int32_t *output_mult = malloc(out_ch * sizeof(int32_t));
+    int32_t *output_shift = malloc(out_ch * sizeof(int32_t));
+    int8_t *output = malloc(output_size);
+    if (!input || !weights || !biases || !output_mult || !output_shift || !output) {
+        printf("Memory allocation failed for %s\n\r", l->name);
+        free(input); free(weights); free(biases); free(output_mult); free(output_shift); free(output);
+        *stack_used = 0;
+        return 0;
+    }
+
+    // Any byte is a valid pair of packed int4 weights, so the same fill serves both paths
+    generate_rand_s8(input, input_size);
+    generate_rand_s8(weights, weight_bytes);
+    for (int32_t i = 0; i < out_ch; i++) {
+        biases[i] = (rand() % 32768) - 16384;
+        output_mult[i] = 0x40000000;
+        output_shift[i] = -8;
+    }
+
+    const cmsis_nn_activation activation = {-128, 127};
+    const cmsis_nn_tile dilation = {1, 1};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+
+    cmsis_nn_conv_params conv_params;
+    memset(&conv_params, 0, sizeof(conv_params));
+    conv_params.stride = l->stride;
+    conv_params.padding = l->padding;
+    conv_params.dilation = dilation;
+    conv_params.activation = activation;
+
+    cmsis_nn_dw_conv_params dw_conv_params;
+    memset(&dw_conv_params, 0, sizeof(dw_conv_params));
+    dw_conv_params.ch_mult = l->ch_mult;
+    dw_conv_params.stride = l->stride;
+    dw_conv_params.padding = l->padding;
+    dw_conv_params.dilation = dilation;
+    dw_conv_params.activation = activation;
+
+    cmsis_nn_pool_params pool_params;
+    pool_params.stride = l->stride;
+    pool_params.padding = l->padding;
+    pool_params.activation = activation;
+
+    cmsis_nn_fc_params fc_params;
+    memset(&fc_params, 0, sizeof(fc_params));
+    fc_params.activation = activation;
+
+    cmsis_nn_per_channel_quant_params quant_params = {output_mult, output_shift};
+    cmsis_nn_per_tensor_quant_params fc_quant_params = {output_mult[0], output_shift[0]};
+
+    const int32_t buf_size = dscnn_buffer_size(l, s4, &conv_params, &dw_conv_params);
+    cmsis_nn_context ctx;
+    ctx.buf = buf_size > 0 ? malloc(buf_size) : NULL;
+    ctx.size = buf_size;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    switch (l->type) {
+    case DSCNN_DW_CONV:
+        (s4 ? arm_depthwise_conv_wrapper_s4 : arm_depthwise_conv_wrapper_s8)(
+            &ctx, &dw_conv_params, &quant_params, &l->input_dims, input, &l->filter_dims, weights,
+            &bias_dims, biases, &l->output_dims, output);
+        break;
+    case DSCNN_CONV:
+        (s4 ? arm_convolve_wrapper_s4 : arm_convolve_wrapper_s8)(
+            &ctx, &conv_params, &quant_params, &l->input_dims, input, &l->filter_dims, weights,
+            &bias_dims, biases, &l->output_dims, output);
+        break;
+    case DSCNN_AVGPOOL:
+        arm_avgpool_s8(&ctx, &pool_params, &l->input_dims, input, &l->filter_dims, &l->output_dims, output);
+        break;
+    case DSCNN_FC:
+        (s4 ? arm_fully_connected_s4 : arm_fully_connected_s8)(
+            &ctx, &fc_params, &fc_quant_params, &l->input_dims, input, &l->filter_dims, weights,
+            &bias_dims, biases, &l->output_dims, output);
+        break;
+    }
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    *stack_used = measure_stack_usage();
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);  // Security wipe
+        free(ctx.buf);
+    }
+    free(input); free(weights); free(biases); free(output_mult); free(output_shift); free(output);
+    return cycle_count;
+}
+
+RAM_FUNC void dscnn_medium_model_s4_vs_s8(void)
+{
+    uint32_t total_cycles[2] = {0, 0};
+    uint32_t total_weight_bytes[2] = {0, 0};
+    uint32_t max_stack[2] = {0, 0};
+
+    for (int i = 0; i < DSCNN_MEDIUM_LAYER_COUNT; i++) {
+        const dscnn_layer *l = &DSCNN_MEDIUM_LAYERS[i];
+        uint32_t cycles[2];
+
+        for (int s4 = 0; s4 <= 1; s4++) {
+            uint32_t stack_used;
+            cycles[s4] = run_dscnn_layer(l, s4, &stack_used);
+            total_cycles[s4] += cycles[s4] * l->repeat;
+            total_weight_bytes[s4] += dscnn_weight_bytes(l, s4) * l->repeat;
+            if (stack_used > max_stack[s4]) {
+                max_stack[s4] = stack_used;
+            }
+        }
+
+        printf("%s (x%d)\n\r", l->name, l->repeat);
+        printf("Cycle Count: s8 %lu, s4 %lu", (unsigned long)cycles[0], (unsigned long)cycles[1]);
+        if (cycles[0] && cycles[1]) {
+            printf(" (s4/s8 = %.2f)", (float)cycles[1] / cycles[0]);
+        }
+        printf("\n\r");
+        printf("Weight Flash: s8 %lu bytes, s4 %lu bytes\n\r\n",
+               (unsigned long)dscnn_weight_bytes(l, 0), (unsigned long)dscnn_weight_bytes(l, 1));
+    }
+
+    printf("DS-CNN medium model s4 vs s8:\n\r");
+    printf("Weight Flash: s8 %lu bytes, s4 %lu bytes\n\r",
+           (unsigned long)total_weight_bytes[0], (unsigned long)total_weight_bytes[1]);
+    printf("Total Cycle Count: s8 %lu, s4 %lu (s4/s8 = %.2f)\n\r",
+           (unsigned long)total_cycles[0], (unsigned long)total_cycles[1],
+           total_cycles[0] ? (float)total_cycles[1] / total_cycles[0] : 0.0f);
+    printf("Execution Time (approx): s8 %.3f ms, s4 %.3f ms\n\r",
+           (float)total_cycles[0] / clkFastfreq * 1e3f, (float)total_cycles[1] / clkFastfreq * 1e3f);
+    printf("Max Stack Used: s8 %lu bytes, s4 %lu bytes\n\r\n",
+           (unsigned long)max_stack[0], (unsigned long)max_stack[1]);
+}
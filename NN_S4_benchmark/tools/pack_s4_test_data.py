@@ -0,0 +1,302 @@
+"""Convert s8 CMSIS-NN TestData cases into packed int4 (s4) cases.
+
+Weights are requantised to [-7, 7] (per output channel for conv and depthwise, per tensor
+for fully connected) and packed two per byte, low nibble first, as the arm_*_s4 kernels
+expect. The weight scale change is folded into the output multiplier/shift and the bias,
+and the reference output is recomputed with the CMSIS-NN integer arithmetic so the s4
+kernels can be validated bit-exactly. Before anything is written the reference is run on
+the original s8 weights and must reproduce the s8 output_ref.
+
+Usage:
+    python pack_s4_test_data.py <s8 case dir> <kind> <s4 case name> [<TestData dir>]
+
+kind is one of:
+    conv       arm_convolve_wrapper_s8 case -> arm_convolve_wrapper_s4
+    depthwise  arm_depthwise_conv_wrapper_s8 case -> arm_depthwise_conv_wrapper_s4
+    fc         per-tensor arm_fully_connected_s8 case -> arm_fully_connected_s4
+    fc_1x1     per-channel fully connected case recast as a 1x1 convolution
+               (arm_convolve_1x1_s4_fast)
+"""
+
+import math
+import os
+import re
+import sys
+
+INT4_MAX = 7
+
+
+def parse_case(case_dir):
+    """Collect #defines and const arrays from the headers included by test_data.h."""
+    defines = {}
+    arrays = {}
+    with open(os.path.join(case_dir, 'test_data.h')) as f:
+        headers = re.findall(r'#include\s+"(?:[^"]*/)?([^/"]+\.h)"', f.read())
+
+    for header in headers:
+        with open(os.path.join(case_dir, header)) as f:
+            text = f.read()
+        for name, value in re.findall(r'#define\s+(\w+)\s+(\S+)', text):
+            defines[name] = value
+        for name, body in re.findall(r'const\s+\w+\s+(\w+)\[\d*\]\s*=\s*\{([^}]*)\}', text):
+            arrays[name] = [int(v) for v in body.replace('\n', ' ').split(',') if v.strip()]
+    return defines, arrays
+
+
+def find_array(arrays, prefix, *suffixes):
+    for suffix in suffixes:
+        if prefix + '_' + suffix in arrays:
+            return arrays[prefix + '_' + suffix]
+    raise KeyError('%s_{%s} not found' % (prefix, ','.join(suffixes)))
+
+
+def to_int32(v):
+    v &= 0xFFFFFFFF
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def requantize(val, multiplier, shift):
+    """arm_nn_requantize() without CMSIS_NN_USE_SINGLE_ROUNDING."""
+    left_shift = shift if shift > 0 else 0
+    right_shift = -shift if shift < 0 else 0
+    result = to_int32((to_int32(val * (1 << left_shift)) * multiplier + (1 << 30)) >> 31)
+    mask = (1 << right_shift) - 1
+    remainder = result & mask
+    result >>= right_shift
+    threshold = (mask >> 1) + (1 if result < 0 else 0)
+    if remainder > threshold:
+        result += 1
+    return result
+
+
+def quantize_multiplier(real):
+    if real == 0.0:
+        return 0, 0
+    mantissa, exponent = math.frexp(real)
+    q = int(round(mantissa * (1 << 31)))
+    if q == (1 << 31):
+        q //= 2
+        exponent += 1
+    return q, exponent
+
+
+def real_multiplier(multiplier, shift):
+    return multiplier * 2.0 ** (shift - 31)
+
+
+def conv_reference(p, weights, biases, mults, shifts):
+    """NHWC convolution / depthwise convolution with per-channel requantisation."""
+    out = []
+    depthwise = p['depthwise']
+    for b in range(p['batches']):
+        for oy in range(p['out_h']):
+            for ox in range(p['out_w']):
+                for oc in range(p['out_ch']):
+                    acc = biases[oc] if biases else 0
+                    for ky in range(p['filter_y']):
+                        iy = oy * p['stride_y'] - p['pad_y'] + ky * p['dilation_y']
+                        if iy < 0 or iy >= p['in_h']:
+                            continue
+                        for kx in range(p['filter_x']):
+                            ix = ox * p['stride_x'] - p['pad_x'] + kx * p['dilation_x']
+                            if ix < 0 or ix >= p['in_w']:
+                                continue
+                            base = ((b * p['in_h'] + iy) * p['in_w'] + ix) * p['in_ch']
+                            if depthwise:
+                                ic = oc // p['ch_mult']
+                                w = weights[(ky * p['filter_x'] + kx) * p['out_ch'] + oc]
+                                acc += (p['inputs'][base + ic] + p['input_offset']) * w
+                            else:
+                                for ic in range(p['in_ch']):
+                                    w = weights[((oc * p['filter_y'] + ky) * p['filter_x'] + kx) * p['in_ch'] + ic]
+                                    acc += (p['inputs'][base + ic] + p['input_offset']) * w
+                    v = requantize(acc, mults[oc], shifts[oc]) + p['output_offset']
+                    out.append(min(max(v, p['act_min']), p['act_max']))
+    return out
+
+
+def channel_of(p, index):
+    if p['depthwise']:
+        return index % p['out_ch']
+    return index // (len(p['weights']) // p['out_ch'])
+
+
+def requantize_weights(p, per_tensor):
+    """Scale weights into [-7, 7]; returns (weights, ratio per output channel)."""
+    weights = p['weights']
+    if per_tensor:
+        peak = max(abs(w) for w in weights)
+        ratios = [max(peak / INT4_MAX, 1.0)] * p['out_ch']
+    else:
+        peaks = [0] * p['out_ch']
+        for i, w in enumerate(weights):
+            c = channel_of(p, i)
+            peaks[c] = max(peaks[c], abs(w))
+        ratios = [max(peak / INT4_MAX, 1.0) for peak in peaks]
+
+    w4 = []
+    for i, w in enumerate(weights):
+        q = int(round(w / ratios[channel_of(p, i)]))
+        w4.append(min(max(q, -INT4_MAX), INT4_MAX))
+    return w4, ratios
+
+
+def pack_int4(values):
+    packed = []
+    for i in range(0, len(values), 2):
+        lo = values[i] & 0x0F
+        hi = (values[i + 1] & 0x0F) if i + 1 < len(values) else 0
+        byte = lo | (hi << 4)
+        packed.append(byte - 256 if byte > 127 else byte)
+    return packed
+
+
+def load(case_dir, kind):
+    prefix = os.path.basename(os.path.normpath(case_dir))
+    P = prefix.upper() + '_'
+    d, arrays = parse_case(case_dir)
+
+    def i(name, default=None):
+        return int(d[P + name]) if (P + name) in d or default is None else default
+
+    p = {'prefix': prefix, 'kind': kind, 'depthwise': kind == 'depthwise'}
+    p['inputs'] = find_array(arrays, prefix, 'input')
+    p['weights'] = find_array(arrays, prefix, 'weights')
+    p['biases'] = find_array(arrays, prefix, 'biases', 'bias')
+    p['output_ref'] = find_array(arrays, prefix, 'output_ref', 'output')
+    p['input_offset'] = i('INPUT_OFFSET')
+    p['output_offset'] = i('OUTPUT_OFFSET')
+    p['act_min'] = i('OUT_ACTIVATION_MIN')
+    p['act_max'] = i('OUT_ACTIVATION_MAX')
+
+    if kind in ('conv', 'depthwise'):
+        p['batches'] = i('INPUT_BATCHES')
+        p['in_w'], p['in_h'], p['in_ch'] = i('INPUT_W'), i('INPUT_H'), i('IN_CH')
+        p['out_w'], p['out_h'], p['out_ch'] = i('OUTPUT_W'), i('OUTPUT_H'), i('OUT_CH')
+        p['filter_x'], p['filter_y'] = i('FILTER_X'), i('FILTER_Y')
+        p['stride_x'], p['stride_y'] = i('STRIDE_X'), i('STRIDE_Y')
+        p['pad_x'], p['pad_y'] = i('PAD_X'), i('PAD_Y')
+        p['dilation_x'], p['dilation_y'] = i('DILATION_X', 1), i('DILATION_Y', 1)
+        p['ch_mult'] = i('CH_MULT', 1)
+        p['mults'] = find_array(arrays, prefix, 'output_mult', 'output_multiplier')
+        p['shifts'] = find_array(arrays, prefix, 'output_shift')
+    else:
+        # Fully connected as a 1x1 convolution over batches x 1 x 1 pixels
+        depth = i('ACCUMULATION_DEPTH')
+        p['batches'] = len(p['inputs']) // depth
+        p['in_w'], p['in_h'], p['in_ch'] = 1, 1, depth
+        p['out_w'], p['out_h'], p['out_ch'] = 1, 1, i('OUT_CH')
+        p['filter_x'] = p['filter_y'] = 1
+        p['stride_x'] = p['stride_y'] = 1
+        p['pad_x'] = p['pad_y'] = 0
+        p['dilation_x'] = p['dilation_y'] = 1
+        p['ch_mult'] = 1
+        if kind == 'fc':
+            p['mults'] = [i('OUTPUT_MULTIPLIER')] * p['out_ch']
+            p['shifts'] = [i('OUTPUT_SHIFT')] * p['out_ch']
+        else:
+            p['mults'] = find_array(arrays, prefix, 'output_mult', 'output_multiplier')
+            p['shifts'] = find_array(arrays, prefix, 'output_shift')
+    return p
+
+
+def c_array(ctype, name, values, per_line=16):
+    lines = []
+    for k in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[k:k + per_line]))
+    return 'const %s %s[%d] = {\n%s};\n' % (ctype, name, len(values), ',\n'.join(lines))
+
+
+def write_case(out_root, name, source, p, packed, biases, mults, shifts, output_ref):
+    out_dir = os.path.join(out_root, name)
+    os.makedirs(out_dir, exist_ok=True)
+    banner = '// Generated by pack_s4_test_data.py from the s8 case "%s".\n' % source
+    N = name.upper() + '_'
+
+    config = {
+        'OUT_CH': p['out_ch'], 'IN_CH': p['in_ch'],
+        'INPUT_W': p['in_w'], 'INPUT_H': p['in_h'],
+        'DST_SIZE': len(output_ref), 'INPUT_SIZE': len(p['inputs']),
+        'OUT_ACTIVATION_MIN': p['act_min'], 'OUT_ACTIVATION_MAX': p['act_max'],
+        'INPUT_BATCHES': p['batches'],
+    }
+    if p['kind'] == 'fc':
+        config['ACCUMULATION_DEPTH'] = p['in_ch']
+        config['OUTPUT_MULTIPLIER'] = mults[0]
+        config['OUTPUT_SHIFT'] = shifts[0]
+    else:
+        config['FILTER_X'], config['FILTER_Y'] = p['filter_x'], p['filter_y']
+        config['STRIDE_X'], config['STRIDE_Y'] = p['stride_x'], p['stride_y']
+        config['PAD_X'], config['PAD_Y'] = p['pad_x'], p['pad_y']
+        config['OUTPUT_W'], config['OUTPUT_H'] = p['out_w'], p['out_h']
+    if p['depthwise']:
+        config['CH_MULT'] = p['ch_mult']
+    config['INPUT_OFFSET'] = p['input_offset']
+    config['OUTPUT_OFFSET'] = p['output_offset']
+    if p['kind'] != 'fc':
+        config['DILATION_X'] = p['dilation_x']
+        config['DILATION_Y'] = p['dilation_y']
+    config['WEIGHTS_SIZE'] = len(packed)
+
+    files = {
+        'config_data.h': ''.join('#define %s%s %d\n' % (N, k, v) for k, v in config.items()),
+        'input_data.h': c_array('int8_t', name + '_input', p['inputs']),
+        'weights_data.h': c_array('int8_t', name + '_weights', packed),
+        'biases_data.h': c_array('int32_t', name + '_biases', biases),
+        'output_ref_data.h': c_array('int8_t', name + '_output_ref', output_ref),
+    }
+    if p['kind'] != 'fc':
+        files['output_mult_data.h'] = c_array('int32_t', name + '_output_mult', mults)
+        files['output_shift_data.h'] = c_array('int32_t', name + '_output_shift', shifts)
+
+    for fname, body in files.items():
+        with open(os.path.join(out_dir, fname), 'w') as f:
+            f.write(banner + '#pragma once\n')
+            if fname != 'config_data.h':
+                f.write('#include <stdint.h>\n\n')
+            f.write(body)
+
+    with open(os.path.join(out_dir, 'test_data.h'), 'w') as f:
+        f.write(banner)
+        for fname in sorted(files):
+            f.write('#include "../../TestData/%s/%s"\n' % (name, fname))
+
+
+def main():
+    if len(sys.argv) < 4:
+        print(__doc__)
+        sys.exit(1)
+
+    case_dir, kind, name = sys.argv[1], sys.argv[2], sys.argv[3]
+    out_root = sys.argv[4] if len(sys.argv) > 4 else os.path.join(os.path.dirname(__file__), '..', 'TestData')
+    if kind not in ('conv', 'depthwise', 'fc', 'fc_1x1'):
+        print('Unknown kind: %s' % kind)
+        sys.exit(1)
+
+    p = load(case_dir, kind)
+    ref_s8 = conv_reference(p, p['weights'], p['biases'], p['mults'], p['shifts'])
+    if ref_s8 != p['output_ref']:
+        print('[!] Reference does not reproduce %s output_ref, not writing' % p['prefix'])
+        sys.exit(1)
+
+    w4, ratios = requantize_weights(p, per_tensor=(kind == 'fc'))
+    biases = [int(round(b / ratios[c])) for c, b in enumerate(p['biases'])]
+    mults, shifts = [], []
+    for c in range(p['out_ch']):
+        m, s = quantize_multiplier(real_multiplier(p['mults'][c], p['shifts'][c]) * ratios[c])
+        mults.append(m)
+        shifts.append(s)
+    if kind == 'fc':
+        mults, shifts = mults[:1] * p['out_ch'], shifts[:1] * p['out_ch']
+
+    ref_s4 = conv_reference(p, w4, biases, mults, shifts)
+    packed = pack_int4(w4)
+    write_case(out_root, name, p['prefix'], p, packed, biases, mults, shifts, ref_s4)
+
+    max_diff = max(abs(a - b) for a, b in zip(ref_s4, p['output_ref']))
+    print('[*] %s -> %s: weights %d -> %d bytes, max output diff vs s8 = %d'
+          % (p['prefix'], name, len(p['weights']), len(packed), max_diff))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,85 @@
+#include "main.h"
+
+void enable_cycle_counter() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;      // Enable trace
+    DWT->CTRL |= (1 << 0);                               // CYCCNTENA
+    DWT->CTRL |= (1 << 16);                              // CPICNT
+    DWT->CTRL |= (1 << 17);                              // EXCCNT
+    DWT->CTRL |= (1 << 18);                              // SLEEPCNT
+    DWT->CTRL |= (1 << 19);                              // LSUCNT
+    DWT->CTRL |= (1 << 20);                              // FOLDCNT
+
+    DWT->CYCCNT = 0;
+    DWT->CPICNT = 0;
+    DWT->EXCCNT = 0;
+    DWT->SLEEPCNT = 0;
+    DWT->LSUCNT = 0;
+    DWT->FOLDCNT = 0;
+}
+
+uint32_t read_cycle_counter(void) {
+    return DWT->CYCCNT;
+}
+
+void fill_stack_pattern_to_sp(void) {
+    register uint32_t *sp;
+    __asm volatile("mov %0, sp" : "=r"(sp));
+
+    uint32_t *p = (uint32_t *)&__StackLimit;
+    while (p < sp) {
+        *p++ = 0xAAAAAAAA;
+    }
+}
+
+uint32_t measure_stack_usage(void) {
+    register uint32_t *sp;
+    __asm volatile("mov %0, sp" : "=r"(sp));
+
+    uint32_t *p = (uint32_t *)&__StackLimit;
+    while (p < sp) {
+        if (*p != 0xAAAAAAAA) {
+            break;
+        }
+        p++;
+    }
+
+    return ((uint32_t)sp - (uint32_t)p); // Stack usage in bytes
+}
+
+void generate_rand_s8(int8_t *src, int length) {
+    enable_cycle_counter();
+    srand(read_cycle_counter());
+    for (int i = 0; i < length; i++) {
+        src[i] = (int8_t)((rand() % 256) - 128); // Range: [-128, 127]
+    }
+}
+
+void generate_rand_s16(int16_t *src, int length) {
+    enable_cycle_counter();
+    srand(read_cycle_counter());
+    for (int i = 0; i < length; i++) {
+        src[i] = (int16_t)((rand() % 65536) - 32768); // Range: [-32768, 32767]
+    }
+}
+
+int max_abs_diff_s8(const int8_t *a, const int8_t *b, int size) {
+    int max_diff = 0;
+    for (int i = 0; i < size; i++) {
+        int diff = abs(a[i] - b[i]);
+        if (diff > max_diff) {
+            max_diff = diff;
+        }
+    }
+    return max_diff;
+}
+
+void report_s4_vs_s8(const char *name, uint32_t cycles_s8, uint32_t cycles_s4,
+                     uint32_t weight_bytes_s8, uint32_t weight_bytes_s4, int max_diff) {
+    printf("%s s4 vs s8:\n\r", name);
+    printf("Weight Flash: s8 %lu bytes, s4 %lu bytes\n\r", (unsigned long)weight_bytes_s8, (unsigned long)weight_bytes_s4);
+    if (cycles_s8 && cycles_s4) {
+        printf("Cycle Count: s8 %lu, s4 %lu (s4/s8 = %.2f)\n\r",
+               (unsigned long)cycles_s8, (unsigned long)cycles_s4, (float)cycles_s4 / cycles_s8);
+    }
+    printf("Max Abs Diff s4 vs s8 reference output: %d\n\r\n", max_diff);
+}
@@ -0,0 +1,6 @@
+// Generated by generate_svdf_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int32_t svdf_s16_biases[16] = {
+    -336, 435, 679, -433, 740, 848, 61, 165, -862, -155, 839, -150, 367, 475, -931, -68};
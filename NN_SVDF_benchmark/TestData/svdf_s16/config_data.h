@@ -0,0 +1,20 @@
+// Generated by generate_svdf_test_data.py (seed 2).
+#pragma once
+#define SVDF_S16_INPUT_BATCHES 1
+#define SVDF_S16_INPUT_SIZE 40
+#define SVDF_S16_NUMBER_UNITS 16
+#define SVDF_S16_RANK 1
+#define SVDF_S16_FEATURE_BATCHES 16
+#define SVDF_S16_TIME_BATCHES 10
+#define SVDF_S16_NUMBER_INPUTS 5
+#define SVDF_S16_DST_SIZE 16
+#define SVDF_S16_INPUT_OFFSET 0
+#define SVDF_S16_OUTPUT_OFFSET -3
+#define SVDF_S16_MULTIPLIER_IN 1916875880
+#define SVDF_S16_SHIFT_IN -2
+#define SVDF_S16_MULTIPLIER_OUT 1455853961
+#define SVDF_S16_SHIFT_OUT -19
+#define SVDF_S16_IN_ACTIVATION_MIN -32768
+#define SVDF_S16_IN_ACTIVATION_MAX 32767
+#define SVDF_S16_OUT_ACTIVATION_MIN -128
+#define SVDF_S16_OUT_ACTIVATION_MAX 127
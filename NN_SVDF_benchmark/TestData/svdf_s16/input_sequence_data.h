@@ -0,0 +1,18 @@
+// Generated by generate_svdf_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int8_t svdf_s16_input_sequence[200] = {
+    -100, -82, -85, 56, -42, 29, 0, -20, -110, -47, 92, 73, 62, 99, 9, -110,
+    -114, 58, 110, 35, 66, 88, -44, -38, -8, -10, -116, -38, 38, -40, -59, 56,
+    -35, 100, 84, 58, 53, 57, 100, -46, 76, 108, -1, 122, 14, 127, 53, 104,
+    108, 51, 105, 121, -15, 38, -43, 9, 117, 30, 27, 80, 31, -22, 122, 59,
+    -90, 46, -124, -31, -74, -98, -103, 11, -12, -74, -59, 8, -3, -21, -98, 88,
+    -112, -99, 57, 56, -40, -1, -116, -86, -70, -94, -116, -108, -118, 63, 2, -63,
+    -48, -34, -128, 69, -106, -2, -51, -110, -126, 48, -71, 18, 44, 122, -113, 29,
+    101, -105, 7, 77, -50, 114, -13, -81, 33, -76, -116, 101, -63, 73, 121, 39,
+    -55, 46, 4, 6, 86, -119, -57, -99, 1, -111, -61, -46, -41, -79, 104, -10,
+    -112, -2, -9, 99, -91, 0, -87, -12, 56, 3, 88, 14, -126, -51, -110, 68,
+    81, -46, -72, -84, -5, -76, -77, -118, -35, -10, -75, -17, -116, 109, 104, 30,
+    66, -20, -21, 94, 89, -118, -102, 86, -36, -80, 117, 59, -119, -68, 59, 20,
+    62, 29, -119, 83, -77, -75, 28, -27};
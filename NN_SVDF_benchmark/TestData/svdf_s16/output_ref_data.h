@@ -0,0 +1,6 @@
+// Generated by generate_svdf_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int8_t svdf_s16_output_ref[16] = {
+    6, 2, 5, -6, -23, 47, 10, 8, -3, -14, 5, -37, 8, -2, 13, 61};
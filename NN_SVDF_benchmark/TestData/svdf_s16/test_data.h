@@ -0,0 +1,7 @@
+// Generated by generate_svdf_test_data.py (seed 2).
+#include "../../TestData/svdf_s16/biases_data.h"
+#include "../../TestData/svdf_s16/config_data.h"
+#include "../../TestData/svdf_s16/input_sequence_data.h"
+#include "../../TestData/svdf_s16/output_ref_data.h"
+#include "../../TestData/svdf_s16/weights_feature_data.h"
+#include "../../TestData/svdf_s16/weights_time_data.h"
@@ -0,0 +1,45 @@
+// Generated by generate_svdf_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int8_t svdf_s16_weights_feature[640] = {
+    88, 71, 45, 84, -123, 80, -12, -112, -22, 36, -3, -9, -74, 100, 23, 30,
+    -109, -126, -55, -121, -32, -49, 112, 58, -108, -71, 66, -2, -78, -98, 19, -32,
+    -27, 56, -9, -92, 65, -39, -26, 100, -96, -62, -96, -96, -107, 30, 90, -42,
+    37, -27, 118, -73, 50, -101, -121, 31, 41, -7, 71, -116, 58, 53, 0, -53,
+    -36, 118, -10, -91, 77, -32, -59, -4, 7, 94, -5, 57, 117, 59, 78, -20,
+    111, -2, 87, 47, -52, -26, -68, -87, -2, 25, -61, 13, -18, 51, 46, 51,
+    108, -106, 22, 59, 82, 20, -103, -109, -36, -82, 12, -90, 79, -21, 102, -110,
+    77, -105, 106, 102, 47, 126, 80, 38, -118, -95, 122, -52, -28, -68, 54, 44,
+    99, 47, -43, -15, -83, 7, -54, -99, -88, 11, 125, 116, 121, 66, -19, -103,
+    -43, 5, -64, 56, 4, -62, -84, 102, -87, -9, 115, 53, -67, -24, 96, 127,
+    -36, 73, 68, 19, 59, -90, -8, -15, 57, -120, 80, 25, -29, 98, 61, -81,
+    -27, 3, -114, -4, -57, -24, -63, 54, 60, 112, -22, 53, 38, -7, -35, 119,
+    13, -43, 55, 63, 106, 41, -107, 67, 82, 91, 58, -70, 9, 32, -79, -24,
+    81, 43, -30, 123, 98, 35, 107, -125, -47, -9, 7, 55, 105, 99, -8, 39,
+    -82, 81, -103, -123, -24, 114, -72, 59, 18, 28, -29, 104, -72, 99, 121, -102,
+    -28, 81, 15, 69, 78, -76, -57, 63, 108, 23, 21, -78, -2, 78, 29, -92,
+    -125, 29, 46, -16, -4, -63, 4, 17, -83, -8, 55, -75, 121, 120, 67, -109,
+    -38, -127, 104, -3, 9, 87, 44, 41, -111, 66, 24, -3, 109, 45, 109, -42,
+    -10, -59, 97, 1, -10, -120, 125, -107, 30, 66, -39, -83, 67, 65, 113, 73,
+    -24, -62, 45, 33, 74, 86, 94, 57, -93, -114, -86, 0, -30, 127, -9, 45,
+    -52, -88, -125, -55, 15, -8, 120, -127, -34, -119, 10, 90, -30, 17, -14, -75,
+    95, 46, -49, 0, 39, -93, -4, 49, 10, 55, 107, -50, -108, -61, 84, -47,
+    -50, -42, 38, 115, 76, -48, 40, 37, -27, 5, 88, 108, -104, 3, 35, -74,
+    -27, 25, 8, 90, 90, -89, 77, 2, 33, -105, -49, -117, -68, 116, -10, 16,
+    -68, 6, -56, -112, 118, -99, -99, 45, 82, 74, -30, 92, -34, -73, -46, -36,
+    -108, -42, -10, -35, -85, 0, -14, 95, -53, -9, 102, -93, 108, 56, -14, 126,
+    36, -72, 110, -58, -44, -87, -102, 100, -67, -7, -79, 65, 46, 89, -32, -80,
+    -36, -92, 76, -93, -68, -59, 79, 13, 35, -31, -25, 79, 83, 64, -40, -56,
+    97, 57, 110, 25, 1, 21, 49, 60, 115, -45, 63, -25, 65, 55, 95, 53,
+    112, 34, 65, 121, 123, 56, -53, 9, 32, 36, 44, -109, -33, -49, -26, -4,
+    -83, -61, 118, 103, -37, -15, -5, -105, 101, 109, -80, -47, 118, -30, -95, 120,
+    -120, -101, -38, -85, -36, -108, 107, 97, 99, 60, 67, 39, -16, -125, 11, -45,
+    -67, 84, 86, 25, -28, 11, -55, -7, 36, 103, -89, -35, -47, -76, 110, 0,
+    -103, 121, -91, 73, -75, -43, -63, -91, -20, -35, -63, -105, -40, -79, -64, 54,
+    -66, 59, 29, -116, -41, 113, -32, 38, 69, 29, -112, 93, -91, -82, 90, -111,
+    -17, -14, 72, -58, -94, -45, 6, 20, 89, -98, -41, 38, 69, 54, 29, 118,
+    -26, -69, -114, -27, 69, -6, -2, 31, 96, -46, 12, 87, 32, 25, -104, 23,
+    3, 10, 43, 125, -1, 126, -25, 88, 50, -11, -84, -22, -29, 7, -12, -116,
+    97, -100, -12, 127, 24, -95, -97, 112, 108, 47, 1, 107, -83, -108, -27, -49,
+    -10, 77, 54, -125, -63, -100, 44, -38, -71, -83, -121, -90, -18, 44, 124, -104};
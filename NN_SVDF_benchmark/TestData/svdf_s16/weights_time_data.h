@@ -0,0 +1,15 @@
+// Generated by generate_svdf_test_data.py (seed 2).
+#pragma once
+#include <stdint.h>
+
+const int16_t svdf_s16_weights_time[160] = {
+    -671, 1932, 1310, 612, -141, -1844, 1468, 1634, -103, -1058, -1783, -75, -1476, 241, -1923, -1480,
+    802, 9, 173, -1800, -1849, -1230, 190, 1715, -2022, 1320, 1288, 94, -665, 745, 117, 1539,
+    -1071, -1474, -526, -32, -2041, -1508, 165, -1570, -1037, -1604, -137, -1180, 1221, -1830, 476, -1166,
+    518, -495, -668, 503, 605, 1469, -434, 1656, 1782, 892, 101, 30, 1151, 1708, 719, -1380,
+    45, -1616, 1366, 1302, -1427, 521, 1873, -1186, -1337, -502, -1221, -829, -652, -283, -1459, -296,
+    -1513, -417, -763, 1220, -822, 1276, -1641, 256, -1638, -111, -932, -882, 113, 1087, -45, 1995,
+    -901, -1109, -324, 832, -1484, 816, 193, 649, -1622, -1922, 418, 212, 1032, -1220, -1178, -1251,
+    -444, 327, -1887, 595, -1482, 514, -1951, 993, -972, 831, 909, -101, 163, -1852, 969, 1116,
+    1480, 1324, -1128, 1375, -1456, 402, -767, -1891, 775, -1245, 2037, -1604, -1472, 557, 795, 182,
+    1708, -1284, 1077, 1868, -1670, 1958, 765, 1636, 1509, -147, 531, -852, 1897, -1192, -1402, 1328};
@@ -0,0 +1,6 @@
+// Generated by generate_svdf_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int32_t svdf_s8_biases[4] = {
+    -395, 487, 221, -345};
@@ -0,0 +1,20 @@
+// Generated by generate_svdf_test_data.py (seed 1).
+#pragma once
+#define SVDF_S8_INPUT_BATCHES 2
+#define SVDF_S8_INPUT_SIZE 20
+#define SVDF_S8_NUMBER_UNITS 4
+#define SVDF_S8_RANK 2
+#define SVDF_S8_FEATURE_BATCHES 8
+#define SVDF_S8_TIME_BATCHES 8
+#define SVDF_S8_NUMBER_INPUTS 4
+#define SVDF_S8_DST_SIZE 8
+#define SVDF_S8_INPUT_OFFSET 0
+#define SVDF_S8_OUTPUT_OFFSET 7
+#define SVDF_S8_MULTIPLIER_IN 2142837056
+#define SVDF_S8_SHIFT_IN -10
+#define SVDF_S8_MULTIPLIER_OUT 1384528206
+#define SVDF_S8_SHIFT_OUT -7
+#define SVDF_S8_IN_ACTIVATION_MIN -128
+#define SVDF_S8_IN_ACTIVATION_MAX 127
+#define SVDF_S8_OUT_ACTIVATION_MIN -128
+#define SVDF_S8_OUT_ACTIVATION_MAX 127
@@ -0,0 +1,6 @@
+// Generated by generate_svdf_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t svdf_s8_output_ref[8] = {
+    -57, 29, -19, -11, -39, 31, 19, -3};
@@ -0,0 +1,7 @@
+// Generated by generate_svdf_test_data.py (seed 1).
+#include "../../TestData/svdf_s8/biases_data.h"
+#include "../../TestData/svdf_s8/config_data.h"
+#include "../../TestData/svdf_s8/input_sequence_data.h"
+#include "../../TestData/svdf_s8/output_ref_data.h"
+#include "../../TestData/svdf_s8/weights_feature_data.h"
+#include "../../TestData/svdf_s8/weights_time_data.h"
@@ -0,0 +1,15 @@
+// Generated by generate_svdf_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t svdf_s8_weights_feature[160] = {
+    97, -115, -49, -109, 92, -108, -48, 107, 113, -51, 63, -87, -21, 17, -63, -94,
+    -125, 16, 97, 90, -118, 24, 82, -72, 119, 103, 18, -10, -84, 84, 95, 95,
+    122, 72, 53, 32, 3, -118, -31, -76, -39, -102, -75, 19, 45, 102, -17, 24,
+    -78, -1, -101, 113, 43, -28, -52, 2, 0, -123, -44, 29, 96, -25, 103, -55,
+    -123, -87, -76, 92, -44, 80, 125, 17, 73, -93, -41, -18, -73, -59, 45, -103,
+    87, -30, 111, 13, -39, 107, 98, 87, 48, 9, -3, 69, 125, 9, -67, -111,
+    58, -117, -106, -93, -84, -85, 106, 10, -73, -59, 67, -42, 26, 2, 88, -62,
+    -33, -41, -40, -98, -53, -67, 95, 114, 27, 72, 117, 56, 100, -2, -93, 21,
+    14, 70, -101, -45, -117, -23, -109, -30, 94, 126, 74, -90, 85, -95, -40, -98,
+    30, 23, 73, 110, -31, -108, 19, 13, -70, 17, -107, 116, -59, -34, 101, -52};
@@ -0,0 +1,9 @@
+// Generated by generate_svdf_test_data.py (seed 1).
+#pragma once
+#include <stdint.h>
+
+const int8_t svdf_s8_weights_time[64] = {
+    17, 9, 109, -98, -10, 102, -57, -100, 74, -116, 84, -52, -124, 30, 44, -124,
+    -104, -22, -98, 84, 99, 75, -117, -79, -66, 74, 125, 23, -20, -86, -98, -12,
+    -85, 47, -66, -87, 63, 89, -101, -16, 106, 119, -31, 79, 121, 11, 105, 82,
+    -52, 13, -63, 55, -5, -47, -102, -74, 39, -46, -117, -121, -125, 74, 124, 109};
@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['j2_20header_20pins_0',['J2 Header Pins',['../group__group__bsp__pins__j2.html',1,'']]]
+];
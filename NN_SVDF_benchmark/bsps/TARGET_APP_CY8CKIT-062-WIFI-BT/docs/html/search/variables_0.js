@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['cybsp_5fbt_5fplatform_5fcfg_0',['cybsp_bt_platform_cfg',['../group__group__bsp__bt.html#gad2a1cd8a260feac884c816510f34c23e',1,'cybsp_bt_platform_cfg():&#160;cybsp_bt_config.c'],['../group__group__bsp__bt.html#gad2a1cd8a260feac884c816510f34c23e',1,'cybsp_bt_platform_cfg():&#160;cybsp_bt_config.c']]]
+];
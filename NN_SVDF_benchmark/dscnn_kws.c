@@ -0,0 +1,200 @@
+#include "main.h"
+
+// DS-CNN small and medium KWS models (same layers as NN_KWS_DSCNN_SMALL / _MEDIUM), run here
+// so the SVDF window can be compared with them in one table. One inference covers the whole
+// 49x10 feature window. Layers get random data; repeated layers are timed once and counted
+// repeat times, and the layer shapes use SAME padding.
+
+typedef enum {
+    DSCNN_DW_CONV,
+    DSCNN_CONV,
+    DSCNN_AVGPOOL,
+    DSCNN_FC
+} dscnn_layer_type;
+
+typedef struct {
+    dscnn_layer_type type;
+    int repeat;
+    cmsis_nn_dims input_dims;       // n, h, w, c
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+    cmsis_nn_tile stride;           // w, h
+    cmsis_nn_tile padding;
+    int32_t ch_mult;
+} dscnn_layer;
+
+static const dscnn_layer DSCNN_SMALL_LAYERS[] = {
+    {DSCNN_DW_CONV, 1, {1, 49, 10, 1}, {1, 10, 4, 64}, {1, 25, 5, 64}, {2, 2}, {1, 4}, 64},
+    {DSCNN_DW_CONV, 5, {1, 25, 5, 64}, {1, 3, 3, 64}, {1, 25, 5, 64}, {1, 1}, {1, 1}, 1},
+    {DSCNN_CONV,    5, {1, 25, 5, 64}, {64, 1, 1, 64}, {1, 25, 5, 64}, {1, 1}, {0, 0}, 0},
+    {DSCNN_AVGPOOL, 1, {1, 25, 5, 64}, {1, 25, 5, 1}, {1, 1, 1, 64}, {5, 25}, {0, 0}, 0},
+    {DSCNN_FC,      1, {1, 1, 1, 64}, {64, 1, 1, 12}, {1, 1, 1, 12}, {1, 1}, {0, 0}, 0},
+};
+
+static const dscnn_layer DSCNN_MEDIUM_LAYERS[] = {
+    {DSCNN_DW_CONV, 1, {1, 49, 10, 1}, {1, 10, 4, 172}, {1, 25, 10, 172}, {1, 2}, {1, 4}, 172},
+    {DSCNN_DW_CONV, 1, {1, 25, 10, 172}, {1, 3, 3, 172}, {1, 13, 5, 172}, {2, 2}, {1, 1}, 1},
+    {DSCNN_CONV,    5, {1, 13, 5, 172}, {172, 1, 1, 172}, {1, 13, 5, 172}, {1, 1}, {0, 0}, 0},
+    {DSCNN_DW_CONV, 4, {1, 13, 5, 172}, {1, 3, 3, 172}, {1, 13, 5, 172}, {1, 1}, {1, 1}, 1},
+    {DSCNN_AVGPOOL, 1, {1, 13, 5, 172}, {1, 13, 5, 1}, {1, 1, 1, 172}, {5, 13}, {0, 0}, 0},
+    {DSCNN_FC,      1, {1, 1, 1, 172}, {172, 1, 1, 12}, {1, 1, 1, 12}, {1, 1}, {0, 0}, 0},
+};
+
+static const struct {
+    const char *name;
+    const dscnn_layer *layers;
+    int num_layers;
+} DSCNN_KWS_MODELS[DSCNN_KWS_VARIANTS] = {
+    {"DS-CNN small", DSCNN_SMALL_LAYERS, (int)(sizeof(DSCNN_SMALL_LAYERS) / sizeof(DSCNN_SMALL_LAYERS[0]))},
+    {"DS-CNN medium", DSCNN_MEDIUM_LAYERS, (int)(sizeof(DSCNN_MEDIUM_LAYERS) / sizeof(DSCNN_MEDIUM_LAYERS[0]))},
+};
+
+static int32_t dscnn_weight_bytes(const dscnn_layer *l)
+{
+    const cmsis_nn_dims *f = &l->filter_dims;
+    switch (l->type) {
+    case DSCNN_DW_CONV: return f->h * f->w * f->c;
+    case DSCNN_CONV:    return f->n * f->h * f->w * f->c;
+    case DSCNN_FC:      return f->n * f->c;
+    default:            return 0;
+    }
+}
+
+// Runs one layer; returns the cycle count and stores stack usage and the RAM the layer needs
+RAM_FUNC static uint32_t run_dscnn_layer(const dscnn_layer *l, uint32_t *stack_used, uint32_t *ram_bytes)
+{
+    const int32_t input_size = l->input_dims.n * l->input_dims.h * l->input_dims.w * l->input_dims.c;
+    const int32_t output_size = l->output_dims.n * l->output_dims.h * l->output_dims.w * l->output_dims.c;
+    const int32_t weight_bytes = dscnn_weight_bytes(l);
+    const int32_t out_ch = l->output_dims.c;
+
+    int8_t *input = malloc(input_size);
+    int8_t *weights = malloc(weight_bytes ? weight_bytes : 1);
+    int32_t *biases = malloc(out_ch * sizeof(int32_t));
+    int32_t *output_mult = malloc(out_ch * sizeof(int32_t));
+    int32_t *output_shift = malloc(out_ch * sizeof(int32_t));
+    int8_t *output = malloc(output_size);
+    if (!input || !weights || !biases || !output_mult || !output_shift || !output) {
+        printf("Memory allocation failed for DS-CNN layer\n\r");
+        free(input); free(weights); free(biases); free(output_mult); free(output_shift); free(output);
+        *stack_used = 0;
+        *ram_bytes = 0;
+        return 0;
+    }
+
+    generate_rand_s8(input, input_size);
+    generate_rand_s8(weights, weight_bytes);
+    for (int32_t i = 0; i < out_ch; i++) {
+        biases[i] = (rand() % 32768) - 16384;
+        output_mult[i] = 0x40000000;
+        output_shift[i] = -8;
+    }
+
+    const cmsis_nn_activation activation = {-128, 127};
+    const cmsis_nn_tile dilation = {1, 1};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+
+    cmsis_nn_conv_params conv_params;
+    memset(&conv_params, 0, sizeof(conv_params));
+    conv_params.stride = l->stride;
+    conv_params.padding = l->padding;
+    conv_params.dilation = dilation;
+    conv_params.activation = activation;
+
+    cmsis_nn_dw_conv_params dw_conv_params;
+    memset(&dw_conv_params, 0, sizeof(dw_conv_params));
+    dw_conv_params.ch_mult = l->ch_mult;
+    dw_conv_params.stride = l->stride;
+    dw_conv_params.padding = l->padding;
+    dw_conv_params.dilation = dilation;
+    dw_conv_params.activation = activation;
+
+    cmsis_nn_pool_params pool_params;
+    pool_params.stride = l->stride;
+    pool_params.padding = l->padding;
+    pool_params.activation = activation;
+
+    cmsis_nn_fc_params fc_params;
+    memset(&fc_params, 0, sizeof(fc_params));
+    fc_params.activation = activation;
+
+    cmsis_nn_per_channel_quant_params quant_params = {output_mult, output_shift};
+    cmsis_nn_per_tensor_quant_params fc_quant_params = {output_mult[0], output_shift[0]};
+
+    int32_t buf_size = 0;
+    switch (l->type) {
+    case DSCNN_DW_CONV:
+        buf_size = arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &l->input_dims,
+                                                                 &l->filter_dims, &l->output_dims);
+        break;
+    case DSCNN_CONV:
+        buf_size = arm_convolve_wrapper_s8_get_buffer_size(&conv_params, &l->input_dims,
+                                                           &l->filter_dims, &l->output_dims);
+        break;
+    case DSCNN_AVGPOOL:
+        buf_size = arm_avgpool_s8_get_buffer_size(l->output_dims.w, l->input_dims.c);
+        break;
+    case DSCNN_FC:
+        buf_size = arm_fully_connected_s8_get_buffer_size(&l->filter_dims);
+        break;
+    }
+    cmsis_nn_context ctx;
+    ctx.buf = buf_size > 0 ? malloc(buf_size) : NULL;
+    ctx.size = buf_size;
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    switch (l->type) {
+    case DSCNN_DW_CONV:
+        arm_depthwise_conv_wrapper_s8(&ctx, &dw_conv_params, &quant_params, &l->input_dims, input,
+                                      &l->filter_dims, weights, &bias_dims, biases, &l->output_dims, output);
+        break;
+    case DSCNN_CONV:
+        arm_convolve_wrapper_s8(&ctx, &conv_params, &quant_params, &l->input_dims, input,
+                                &l->filter_dims, weights, &bias_dims, biases, &l->output_dims, output);
+        break;
+    case DSCNN_AVGPOOL:
+        arm_avgpool_s8(&ctx, &pool_params, &l->input_dims, input, &l->filter_dims, &l->output_dims, output);
+        break;
+    case DSCNN_FC:
+        arm_fully_connected_s8(&ctx, &fc_params, &fc_quant_params, &l->input_dims, input,
+                               &l->filter_dims, weights, &bias_dims, biases, &l->output_dims, output);
+        break;
+    }
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    *stack_used = measure_stack_usage();
+    *ram_bytes = input_size + output_size + (buf_size > 0 ? buf_size : 0);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);  // Security wipe
+        free(ctx.buf);
+    }
+    free(input); free(weights); free(biases); free(output_mult); free(output_shift); free(output);
+    return cycle_count;
+}
+
+RAM_FUNC void dscnn_kws_measure(int variant, kws_model_figures *figures)
+{
+    memset(figures, 0, sizeof(*figures));
+    figures->name = DSCNN_KWS_MODELS[variant].name;
+
+    for (int i = 0; i < DSCNN_KWS_MODELS[variant].num_layers; i++) {
+        const dscnn_layer *l = &DSCNN_KWS_MODELS[variant].layers[i];
+        uint32_t stack_used, ram_bytes;
+        uint32_t cycles = run_dscnn_layer(l, &stack_used, &ram_bytes);
+
+        figures->cycles += cycles * l->repeat;
+        figures->weight_bytes += dscnn_weight_bytes(l) * l->repeat;
+        if (stack_used > figures->stack_bytes) {
+            figures->stack_bytes = stack_used;
+        }
+        if (ram_bytes > figures->ram_bytes) {
+            figures->ram_bytes = ram_bytes;
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#include "main.h"
+
+void svdf_s8_arm_svdf_s8(void);
+void svdf_s16_arm_svdf_state_s16_s8(void);
+void benchmark_svdf_kws(void);
+
+uint32_t clkFastfreq = 0;
+
+RAM_FUNC int main(void)
+{
+	__disable_irq();  // Disable all interrupts
+    cy_rslt_t result;
+
+    // Initialize the device and board peripherals
+    result = cybsp_init();
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Initialize retarget-io to use the debug UART port
+    result = cy_retarget_io_init_fc(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                    CYBSP_DEBUG_UART_CTS, CYBSP_DEBUG_UART_RTS, CY_RETARGET_IO_BAUDRATE);
+    if (result != CY_RSLT_SUCCESS) {
+        CY_ASSERT(0);
+    }
+
+    // Get the clock frequency
+    clkFastfreq = Cy_SysClk_ClkFastGetFrequency();
+
+    // Print system details
+    printf("\n\r");
+    printf("-----Starting CMSIS-NN SVDF Benchmark-----\n\r");
+    printf("\n\r");
+    printf("CPU Clock Frequency: %lu Hz\n\r", clkFastfreq);
+    printf("\n\r");
+
+    // Perform benchmarks
+    printf("*****ARM SVDF S8*****\n\r");
+    svdf_s8_arm_svdf_s8();
+    printf("\n\r");
+
+    printf("*****ARM SVDF STATE S16 S8*****\n\r");
+    svdf_s16_arm_svdf_state_s16_s8();
+    printf("\n\r");
+
+    printf("*****Streaming SVDF KWS*****\n\r");
+    benchmark_svdf_kws();
+    printf("\n\r");
+
+    printf("Finish SVDF Benchmark\n\r");
+    return 0;
+}
@@ -0,0 +1,101 @@
+#ifndef MAIN_H_
+#define MAIN_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <arm_nnfunctions.h>
+#include <arm_math.h>
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "core_cm4.h"
+#include "validate.h"
+
+// RAM function attribute
+#define RAM_FUNC __attribute__((section(".cy_ramfunc")))
+
+// Stack Limit
+extern uint32_t __StackLimit;
+
+// Clock Frequency
+extern uint32_t clkFastfreq;
+
+// Function Prototypes
+void enable_cycle_counter(void);
+uint32_t read_cycle_counter(void);
+void fill_stack_pattern_to_sp(void);
+uint32_t measure_stack_usage(void);
+void generate_rand_s8(int8_t *src, int length);
+void generate_rand_s16(int16_t *src, int length);
+
+// Streaming SVDF keyword-spotting model: one MFCC frame in per call, class scores out.
+// Feature/frame counts match the 49x10 input of the DS-CNN KWS projects.
+#define SVDF_KWS_FEATURES      10
+#define SVDF_KWS_FRAMES        49
+#define SVDF_KWS_LAYERS        2
+#define SVDF_KWS_UNITS         64
+#define SVDF_KWS_RANK          1
+#define SVDF_KWS_MEMORY        12
+#define SVDF_KWS_CLASSES       12
+
+typedef struct {
+    cmsis_nn_svdf_params svdf_params;
+    cmsis_nn_per_tensor_quant_params input_quant_params;
+    cmsis_nn_per_tensor_quant_params output_quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims state_dims;
+    cmsis_nn_dims weights_feature_dims;
+    cmsis_nn_dims weights_time_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+    int8_t *weights_feature;
+    int16_t *weights_time;
+    int32_t *bias;
+    int16_t *state;
+} svdf_kws_layer;
+
+typedef struct {
+    svdf_kws_layer svdf[SVDF_KWS_LAYERS];
+    cmsis_nn_fc_params fc_params;
+    cmsis_nn_per_tensor_quant_params fc_quant_params;
+    cmsis_nn_dims fc_input_dims;
+    cmsis_nn_dims fc_filter_dims;
+    cmsis_nn_dims fc_bias_dims;
+    cmsis_nn_dims fc_output_dims;
+    int8_t *fc_weights;
+    int32_t *fc_bias;
+    cmsis_nn_context input_ctx;     // shared by all SVDF layers, sized for the largest
+    cmsis_nn_context output_ctx;
+    cmsis_nn_context fc_ctx;
+    int8_t *activation[2];          // ping-pong buffers between layers
+    uint32_t weight_bytes;
+    uint32_t state_bytes;
+    uint32_t scratch_bytes;
+    uint32_t activation_bytes;
+} svdf_kws_model;
+
+int svdf_kws_init(svdf_kws_model *model);
+void svdf_kws_reset(svdf_kws_model *model);
+void svdf_kws_process_frame(svdf_kws_model *model, const int8_t *features, int8_t *scores);
+void svdf_kws_free(svdf_kws_model *model);
+
+// DS-CNN KWS models run for the SVDF comparison; one inference covers the 49-frame window
+enum {
+    DSCNN_KWS_SMALL,
+    DSCNN_KWS_MEDIUM,
+    DSCNN_KWS_VARIANTS
+};
+
+typedef struct {
+    const char *name;
+    uint32_t cycles;                // one inference
+    uint32_t weight_bytes;
+    uint32_t ram_bytes;             // largest layer input + output + scratch
+    uint32_t stack_bytes;
+} kws_model_figures;
+
+void dscnn_kws_measure(int variant, kws_model_figures *figures);
+
+#endif /* MAIN_H_ */
@@ -0,0 +1,211 @@
+#include "main.h"
+
+// Softmax quantization, same as the NN_Softmax_Benchmark s8 case
+#define SVDF_KWS_SOFTMAX_MULT       1077952640
+#define SVDF_KWS_SOFTMAX_SHIFT      19
+#define SVDF_KWS_SOFTMAX_DIFF_MIN   -3968
+
+// Sets up one SVDF layer with dummy weights and an int16 state
+static int svdf_kws_init_layer(svdf_kws_layer *layer, int32_t input_size, uint32_t *weight_bytes)
+{
+    const int32_t feature_batches = SVDF_KWS_UNITS * SVDF_KWS_RANK;
+
+    layer->input_dims.n = 1;
+    layer->input_dims.h = input_size;
+    layer->state_dims.n = feature_batches;
+    layer->state_dims.h = SVDF_KWS_MEMORY;
+    layer->weights_feature_dims.n = feature_batches;
+    layer->weights_feature_dims.h = input_size;
+    layer->weights_time_dims.h = SVDF_KWS_MEMORY;
+    layer->bias_dims.n = SVDF_KWS_UNITS;
+    layer->output_dims.n = 1;
+    layer->output_dims.h = SVDF_KWS_UNITS;
+
+    layer->svdf_params.rank = SVDF_KWS_RANK;
+    layer->svdf_params.input_offset = 0;
+    layer->svdf_params.output_offset = 0;
+    layer->svdf_params.input_activation.min = -32768;
+    layer->svdf_params.input_activation.max = 32767;
+    layer->svdf_params.output_activation.min = -128;
+    layer->svdf_params.output_activation.max = 127;
+
+    layer->input_quant_params.multiplier = 1342580370;
+    layer->input_quant_params.shift = -1;
+    layer->output_quant_params.multiplier = 1342580370;
+    layer->output_quant_params.shift = -17;
+
+    const int32_t weights_feature_size = feature_batches * input_size;
+    const int32_t weights_time_size = feature_batches * SVDF_KWS_MEMORY;
+    const int32_t state_size = feature_batches * SVDF_KWS_MEMORY;
+
+    layer->weights_feature = malloc(weights_feature_size);
+    layer->weights_time = malloc(weights_time_size * sizeof(int16_t));
+    layer->bias = malloc(SVDF_KWS_UNITS * sizeof(int32_t));
+    layer->state = calloc(state_size, sizeof(int16_t));
+    if (!layer->weights_feature || !layer->weights_time || !layer->bias || !layer->state) {
+        return -1;
+    }
+
+    generate_rand_s8(layer->weights_feature, weights_feature_size);
+    generate_rand_s16(layer->weights_time, weights_time_size);
+    for (int i = 0; i < weights_time_size; i++) {
+        // The time stage accumulates state * weight in 32 bits
+        layer->weights_time[i] >>= 4;
+    }
+    for (int i = 0; i < SVDF_KWS_UNITS; i++) {
+        layer->bias[i] = (rand() % 32768) - 16384;
+    }
+
+    *weight_bytes += weights_feature_size + weights_time_size * sizeof(int16_t) + SVDF_KWS_UNITS * sizeof(int32_t);
+    return 0;
+}
+
+int svdf_kws_init(svdf_kws_model *model)
+{
+    memset(model, 0, sizeof(*model));
+
+    for (int l = 0; l < SVDF_KWS_LAYERS; l++) {
+        const int32_t input_size = (l == 0) ? SVDF_KWS_FEATURES : SVDF_KWS_UNITS;
+        if (svdf_kws_init_layer(&model->svdf[l], input_size, &model->weight_bytes) != 0) {
+            return -1;
+        }
+        model->state_bytes += SVDF_KWS_UNITS * SVDF_KWS_RANK * SVDF_KWS_MEMORY * sizeof(int16_t);
+    }
+
+    // Classifier on the last SVDF layer's output
+    model->fc_input_dims.n = 1;
+    model->fc_input_dims.h = 1;
+    model->fc_input_dims.w = 1;
+    model->fc_input_dims.c = SVDF_KWS_UNITS;
+    model->fc_filter_dims.n = SVDF_KWS_UNITS;
+    model->fc_filter_dims.c = SVDF_KWS_CLASSES;
+    model->fc_output_dims.n = 1;
+    model->fc_output_dims.c = SVDF_KWS_CLASSES;
+
+    model->fc_params.input_offset = 0;
+    model->fc_params.filter_offset = 0;
+    model->fc_params.output_offset = 0;
+    model->fc_params.activation.min = -128;
+    model->fc_params.activation.max = 127;
+    model->fc_quant_params.multiplier = 1342580370;
+    model->fc_quant_params.shift = -9;
+
+    model->fc_weights = malloc(SVDF_KWS_UNITS * SVDF_KWS_CLASSES);
+    model->fc_bias = malloc(SVDF_KWS_CLASSES * sizeof(int32_t));
+    if (!model->fc_weights || !model->fc_bias) {
+        return -1;
+    }
+    generate_rand_s8(model->fc_weights, SVDF_KWS_UNITS * SVDF_KWS_CLASSES);
+    for (int i = 0; i < SVDF_KWS_CLASSES; i++) {
+        model->fc_bias[i] = (rand() % 32768) - 16384;
+    }
+    model->weight_bytes += SVDF_KWS_UNITS * SVDF_KWS_CLASSES + SVDF_KWS_CLASSES * sizeof(int32_t);
+
+    // Scratch buffers are shared across layers
+    model->input_ctx.size = SVDF_KWS_UNITS * SVDF_KWS_RANK * sizeof(int32_t);
+    model->input_ctx.buf = malloc(model->input_ctx.size);
+    model->output_ctx.size = SVDF_KWS_UNITS * sizeof(int32_t);
+    model->output_ctx.buf = malloc(model->output_ctx.size);
+    model->fc_ctx.size = arm_fully_connected_s8_get_buffer_size(&model->fc_filter_dims);
+    model->fc_ctx.buf = model->fc_ctx.size ? malloc(model->fc_ctx.size) : NULL;
+    if (!model->input_ctx.buf || !model->output_ctx.buf || (model->fc_ctx.size && !model->fc_ctx.buf)) {
+        return -1;
+    }
+    model->scratch_bytes = model->input_ctx.size + model->output_ctx.size + model->fc_ctx.size;
+
+    model->activation[0] = malloc(SVDF_KWS_UNITS);
+    model->activation[1] = malloc(SVDF_KWS_UNITS);
+    if (!model->activation[0] || !model->activation[1]) {
+        return -1;
+    }
+    model->activation_bytes = 2 * SVDF_KWS_UNITS;
+
+    return 0;
+}
+
+void svdf_kws_reset(svdf_kws_model *model)
+{
+    for (int l = 0; l < SVDF_KWS_LAYERS; l++) {
+        memset(model->svdf[l].state, 0, SVDF_KWS_UNITS * SVDF_KWS_RANK * SVDF_KWS_MEMORY * sizeof(int16_t));
+    }
+}
+
+// Runs one frame through the model. The SVDF states keep the last SVDF_KWS_MEMORY frames,
+// so each call only does the work for the newest frame.
+RAM_FUNC void svdf_kws_process_frame(svdf_kws_model *model, const int8_t *features, int8_t *scores)
+{
+    const int8_t *layer_in = features;
+
+    for (int l = 0; l < SVDF_KWS_LAYERS; l++) {
+        svdf_kws_layer *layer = &model->svdf[l];
+        int8_t *layer_out = model->activation[l & 1];
+
+        arm_svdf_state_s16_s8(&model->input_ctx,
+                              &model->output_ctx,
+                              &layer->svdf_params,
+                              &layer->input_quant_params,
+                              &layer->output_quant_params,
+                              &layer->input_dims,
+                              layer_in,
+                              &layer->state_dims,
+                              layer->state,
+                              &layer->weights_feature_dims,
+                              layer->weights_feature,
+                              &layer->weights_time_dims,
+                              layer->weights_time,
+                              &layer->bias_dims,
+                              layer->bias,
+                              &layer->output_dims,
+                              layer_out);
+        layer_in = layer_out;
+    }
+
+    arm_fully_connected_s8(&model->fc_ctx,
+                           &model->fc_params,
+                           &model->fc_quant_params,
+                           &model->fc_input_dims,
+                           layer_in,
+                           &model->fc_filter_dims,
+                           model->fc_weights,
+                           &model->fc_bias_dims,
+                           model->fc_bias,
+                           &model->fc_output_dims,
+                           scores);
+
+    arm_softmax_s8(scores,
+                   1,
+                   SVDF_KWS_CLASSES,
+                   SVDF_KWS_SOFTMAX_MULT,
+                   SVDF_KWS_SOFTMAX_SHIFT,
+                   SVDF_KWS_SOFTMAX_DIFF_MIN,
+                   scores);
+}
+
+void svdf_kws_free(svdf_kws_model *model)
+{
+    for (int l = 0; l < SVDF_KWS_LAYERS; l++) {
+        free(model->svdf[l].weights_feature);
+        free(model->svdf[l].weights_time);
+        free(model->svdf[l].bias);
+        free(model->svdf[l].state);
+    }
+    free(model->fc_weights);
+    free(model->fc_bias);
+
+    // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+    if (model->input_ctx.buf) {
+        memset(model->input_ctx.buf, 0, model->input_ctx.size);
+    }
+    if (model->output_ctx.buf) {
+        memset(model->output_ctx.buf, 0, model->output_ctx.size);
+    }
+    if (model->fc_ctx.buf) {
+        memset(model->fc_ctx.buf, 0, model->fc_ctx.size);
+    }
+    free(model->input_ctx.buf);
+    free(model->output_ctx.buf);
+    free(model->fc_ctx.buf);
+    free(model->activation[0]);
+    free(model->activation[1]);
+    memset(model, 0, sizeof(*model));
+}
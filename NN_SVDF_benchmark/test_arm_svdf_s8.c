@@ -0,0 +1,130 @@
+#include "main.h"
+#include "../TestData/svdf_s8/test_data.h"
+
+RAM_FUNC void svdf_s8_arm_svdf_s8(void)
+{
+    cmsis_nn_context ctx;
+    cmsis_nn_context input_ctx;
+    cmsis_nn_context output_ctx;
+    cmsis_nn_svdf_params svdf_params;
+    cmsis_nn_per_tensor_quant_params input_quant_params;
+    cmsis_nn_per_tensor_quant_params output_quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims state_dims;
+    cmsis_nn_dims weights_feature_dims;
+    cmsis_nn_dims weights_time_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+
+    const int32_t state_size = SVDF_S8_INPUT_BATCHES * SVDF_S8_FEATURE_BATCHES * SVDF_S8_TIME_BATCHES;
+    int8_t state_data[SVDF_S8_INPUT_BATCHES * SVDF_S8_FEATURE_BATCHES * SVDF_S8_TIME_BATCHES] = {0};
+    int8_t output_data[SVDF_S8_DST_SIZE] = {0};
+
+    input_dims.n = SVDF_S8_INPUT_BATCHES;
+    input_dims.h = SVDF_S8_INPUT_SIZE;
+    state_dims.n = SVDF_S8_FEATURE_BATCHES;
+    state_dims.h = SVDF_S8_TIME_BATCHES;
+    weights_feature_dims.n = SVDF_S8_FEATURE_BATCHES;
+    weights_feature_dims.h = SVDF_S8_INPUT_SIZE;
+    weights_time_dims.h = SVDF_S8_TIME_BATCHES;
+    bias_dims.n = SVDF_S8_NUMBER_UNITS;
+    output_dims.n = SVDF_S8_INPUT_BATCHES;
+    output_dims.h = SVDF_S8_NUMBER_UNITS;
+
+    svdf_params.rank = SVDF_S8_RANK;
+    svdf_params.input_offset = SVDF_S8_INPUT_OFFSET;
+    svdf_params.output_offset = SVDF_S8_OUTPUT_OFFSET;
+    svdf_params.input_activation.min = SVDF_S8_IN_ACTIVATION_MIN;
+    svdf_params.input_activation.max = SVDF_S8_IN_ACTIVATION_MAX;
+    svdf_params.output_activation.min = SVDF_S8_OUT_ACTIVATION_MIN;
+    svdf_params.output_activation.max = SVDF_S8_OUT_ACTIVATION_MAX;
+
+    input_quant_params.multiplier = SVDF_S8_MULTIPLIER_IN;
+    input_quant_params.shift = SVDF_S8_SHIFT_IN;
+    output_quant_params.multiplier = SVDF_S8_MULTIPLIER_OUT;
+    output_quant_params.shift = SVDF_S8_SHIFT_OUT;
+
+    const int32_t buf_size = arm_svdf_s8_get_buffer_size(&weights_feature_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+    const int32_t input_ctx_size = SVDF_S8_INPUT_BATCHES * SVDF_S8_FEATURE_BATCHES * sizeof(int32_t);
+    input_ctx.buf = malloc(input_ctx_size);
+    input_ctx.size = input_ctx_size;
+
+    const int32_t output_ctx_size = SVDF_S8_INPUT_BATCHES * SVDF_S8_NUMBER_UNITS * sizeof(int32_t);
+    output_ctx.buf = malloc(output_ctx_size);
+    output_ctx.size = output_ctx_size;
+
+    uint32_t total_cycles = 0;
+    uint32_t max_cycles = 0;
+    uint32_t max_stack = 0;
+
+    // One call per time step; the state buffer carries the history between calls
+    for (int step = 0; step < SVDF_S8_NUMBER_INPUTS; step++)
+    {
+        const int8_t *input_data = svdf_s8_input_sequence + step * SVDF_S8_INPUT_BATCHES * SVDF_S8_INPUT_SIZE;
+
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        uint32_t start_cycles = read_cycle_counter();
+
+        arm_svdf_s8(&ctx,
+                    &input_ctx,
+                    &output_ctx,
+                    &svdf_params,
+                    &input_quant_params,
+                    &output_quant_params,
+                    &input_dims,
+                    input_data,
+                    &state_dims,
+                    state_data,
+                    &weights_feature_dims,
+                    svdf_s8_weights_feature,
+                    &weights_time_dims,
+                    svdf_s8_weights_time,
+                    &bias_dims,
+                    svdf_s8_biases,
+                    &output_dims,
+                    output_data);
+
+        uint32_t end_cycles = read_cycle_counter();
+        uint32_t cycle_count = end_cycles - start_cycles;
+        uint32_t stack_used = measure_stack_usage();
+
+        total_cycles += cycle_count;
+        if (cycle_count > max_cycles) {
+            max_cycles = cycle_count;
+        }
+        if (stack_used > max_stack) {
+            max_stack = stack_used;
+        }
+    }
+
+    // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+    if (ctx.buf) {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    memset(input_ctx.buf, 0, input_ctx_size);
+    free(input_ctx.buf);
+    memset(output_ctx.buf, 0, output_ctx_size);
+    free(output_ctx.buf);
+
+    uint32_t avg_cycles = total_cycles / SVDF_S8_NUMBER_INPUTS;
+    float time_us = (float)avg_cycles / clkFastfreq * 1e6f;
+
+    printf("\n\r");
+    if (validate(output_data, svdf_s8_output_ref, SVDF_S8_DST_SIZE)) {
+        printf("svdf_s8_arm_svdf_s8 output validation PASSED\n\r");
+    } else {
+        printf("svdf_s8_arm_svdf_s8 output validation FAILED\n\r");
+    }
+    printf("Time Steps: %d\n\r", SVDF_S8_NUMBER_INPUTS);
+    printf("Cycle Count per step (avg): %lu\n\r", (unsigned long)avg_cycles);
+    printf("Cycle Count per step (max): %lu\n\r", (unsigned long)max_cycles);
+    printf("Execution Time per step (approx): %.3f us\n\r", time_us);
+    printf("State Buffer: %lu bytes\n\r", (unsigned long)(state_size * sizeof(int8_t)));
+    printf("Scratch Buffers: %lu bytes\n\r", (unsigned long)(buf_size + input_ctx_size + output_ctx_size));
+    printf("Stack Used: %lu bytes\n\r\n", (unsigned long)max_stack);
+}
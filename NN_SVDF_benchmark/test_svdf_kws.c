@@ -0,0 +1,84 @@
+#include "main.h"
+
+// Streams SVDF_KWS_FRAMES frames through the SVDF KWS model, one call per frame, then runs
+// the DS-CNN small and medium models once each on the same 49x10 window and prints one
+// comparison row per model.
+
+static void print_kws_comparison_row(const kws_model_figures *f, int calls, uint32_t window_cycles)
+{
+    printf("%-16s %6d %12lu %14lu %12.3f %10lu %10lu %10lu\n\r",
+           f->name, calls, (unsigned long)f->cycles, (unsigned long)window_cycles,
+           (float)window_cycles / clkFastfreq * 1e3f, (unsigned long)f->weight_bytes,
+           (unsigned long)f->ram_bytes, (unsigned long)f->stack_bytes);
+}
+
+RAM_FUNC void benchmark_svdf_kws(void)
+{
+    svdf_kws_model model;
+    int8_t features[SVDF_KWS_FRAMES * SVDF_KWS_FEATURES];
+    int8_t scores[SVDF_KWS_CLASSES];
+
+    if (svdf_kws_init(&model) != 0) {
+        printf("Failed to allocate SVDF KWS model\n\r");
+        svdf_kws_free(&model);
+        return;
+    }
+    generate_rand_s8(features, SVDF_KWS_FRAMES * SVDF_KWS_FEATURES);
+
+    uint32_t total_cycles = 0;
+    uint32_t max_cycles = 0;
+    uint32_t min_cycles = UINT32_MAX;
+    uint32_t max_stack = 0;
+
+    for (int frame = 0; frame < SVDF_KWS_FRAMES; frame++) {
+        enable_cycle_counter();
+        fill_stack_pattern_to_sp();
+        uint32_t start_cycles = read_cycle_counter();
+
+        svdf_kws_process_frame(&model, &features[frame * SVDF_KWS_FEATURES], scores);
+
+        uint32_t end_cycles = read_cycle_counter();
+        uint32_t cycle_count = end_cycles - start_cycles;
+        uint32_t stack_used = measure_stack_usage();
+
+        total_cycles += cycle_count;
+        if (cycle_count > max_cycles) {
+            max_cycles = cycle_count;
+        }
+        if (cycle_count < min_cycles) {
+            min_cycles = cycle_count;
+        }
+        if (stack_used > max_stack) {
+            max_stack = stack_used;
+        }
+    }
+
+    uint32_t avg_cycles = total_cycles / SVDF_KWS_FRAMES;
+    uint32_t ram_bytes = model.state_bytes + model.scratch_bytes + model.activation_bytes;
+
+    printf("SVDF KWS: %d SVDF layers (%d units, rank %d, memory %d) + FC %d classes\n\r",
+           SVDF_KWS_LAYERS, SVDF_KWS_UNITS, SVDF_KWS_RANK, SVDF_KWS_MEMORY, SVDF_KWS_CLASSES);
+    printf("Per-frame Cycle Count (avg): %lu\n\r", (unsigned long)avg_cycles);
+    printf("Per-frame Cycle Count (min): %lu\n\r", (unsigned long)min_cycles);
+    printf("Per-frame Cycle Count (max): %lu\n\r", (unsigned long)max_cycles);
+    printf("Per-frame Latency (approx): %.3f us\n\r", (float)avg_cycles / clkFastfreq * 1e6f);
+    printf("State RAM: %lu bytes\n\r", (unsigned long)model.state_bytes);
+    printf("Scratch RAM: %lu bytes\n\r", (unsigned long)model.scratch_bytes);
+    printf("Activation RAM: %lu bytes\n\r", (unsigned long)model.activation_bytes);
+    printf("Total RAM: %lu bytes\n\r", (unsigned long)ram_bytes);
+    printf("Weights: %lu bytes\n\r", (unsigned long)model.weight_bytes);
+
+    kws_model_figures svdf_figures = {"SVDF KWS", avg_cycles, model.weight_bytes, ram_bytes, max_stack};
+    svdf_kws_free(&model);
+
+    printf("\n\r");
+    printf("-----KWS models over one %d-frame window-----\n\r", SVDF_KWS_FRAMES);
+    printf("%-16s %6s %12s %14s %12s %10s %10s %10s\n\r",
+           "Model", "Calls", "Cycles/Call", "Window Cycles", "Window (ms)", "Weights", "RAM", "Stack");
+    print_kws_comparison_row(&svdf_figures, SVDF_KWS_FRAMES, total_cycles);
+    for (int variant = 0; variant < DSCNN_KWS_VARIANTS; variant++) {
+        kws_model_figures dscnn_figures;
+        dscnn_kws_measure(variant, &dscnn_figures);
+        print_kws_comparison_row(&dscnn_figures, 1, dscnn_figures.cycles);
+    }
+}
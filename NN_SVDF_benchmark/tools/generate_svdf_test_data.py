@@ -0,0 +1,170 @@
+"""Generate SVDF reference vectors for arm_svdf_s8 and arm_svdf_state_s16_s8.
+
+Weights, bias and inputs are drawn from a seeded RNG. The input/output multipliers are
+picked from the accumulator ranges so that neither stage saturates wholesale, and the
+reference output is computed with the CMSIS-NN integer arithmetic:
+
+    state <<= 1 (per feature, oldest sample dropped)
+    state[f][T-1] = clamp(requantize(sum_k (x[k] - input_offset) * w_feature[f][k], in))
+    a[f]          = sum_t w_time[f][t] * state[f][t]
+    out[u]        = clamp(requantize(bias[u] + sum_r a[u * rank + r], out) + output_offset)
+
+The reference output is the one produced after the last of NUMBER_INPUTS time steps.
+
+Usage:
+    python generate_svdf_test_data.py [<TestData dir>]
+"""
+
+import math
+import os
+import random
+import sys
+
+CASES = [
+    # name,   state, batches, input_size, units, rank, time, steps, input_offset, output_offset, seed
+    ('svdf_s8', 8, 2, 20, 4, 2, 8, 4, 0, 7, 1),
+    ('svdf_s16', 16, 1, 40, 16, 1, 10, 5, 0, -3, 2),
+]
+
+
+def to_int32(v):
+    v &= 0xFFFFFFFF
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def requantize(val, multiplier, shift):
+    """arm_nn_requantize() without CMSIS_NN_USE_SINGLE_ROUNDING."""
+    left_shift = shift if shift > 0 else 0
+    right_shift = -shift if shift < 0 else 0
+    result = to_int32((to_int32(val * (1 << left_shift)) * multiplier + (1 << 30)) >> 31)
+    mask = (1 << right_shift) - 1
+    remainder = result & mask
+    result >>= right_shift
+    threshold = (mask >> 1) + (1 if result < 0 else 0)
+    if remainder > threshold:
+        result += 1
+    return result
+
+
+def quantize_multiplier(real):
+    mantissa, exponent = math.frexp(real)
+    q = int(round(mantissa * (1 << 31)))
+    if q == (1 << 31):
+        q //= 2
+        exponent += 1
+    return q, exponent
+
+
+def clamp(v, lo, hi):
+    return min(max(v, lo), hi)
+
+
+def run_svdf(c, inputs, w_feature, w_time, bias, quant_in, quant_out):
+    """Returns (outputs of the last step, feature accumulators, time accumulators)."""
+    fb = c['units'] * c['rank']
+    T = c['time']
+    state = [0] * (c['batches'] * fb * T)
+    feature_accs, time_accs = [], []
+    out = []
+    for step in range(c['steps']):
+        state = state[1:] + state[-1:]
+        for b in range(c['batches']):
+            x = inputs[(step * c['batches'] + b) * c['input_size']:][:c['input_size']]
+            for f in range(fb):
+                acc = sum((x[k] - c['input_offset']) * w_feature[f * c['input_size'] + k]
+                          for k in range(c['input_size']))
+                feature_accs.append(acc)
+                if quant_in:
+                    v = clamp(requantize(acc, *quant_in), c['state_min'], c['state_max'])
+                    state[(b * fb + f) * T + T - 1] = v
+
+        out = []
+        for b in range(c['batches']):
+            a = [sum(w_time[f * T + t] * state[(b * fb + f) * T + t] for t in range(T)) for f in range(fb)]
+            for u in range(c['units']):
+                acc = bias[u] + sum(a[u * c['rank'] + r] for r in range(c['rank']))
+                time_accs.append(acc)
+                if quant_out:
+                    out.append(clamp(requantize(acc, *quant_out) + c['output_offset'], -128, 127))
+    return out, feature_accs, time_accs
+
+
+def c_array(ctype, name, values, per_line=16):
+    lines = []
+    for k in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[k:k + per_line]))
+    return 'const %s %s[%d] = {\n%s};\n' % (ctype, name, len(values), ',\n'.join(lines))
+
+
+def generate(out_root, name, state_bits, batches, input_size, units, rank, time, steps,
+             input_offset, output_offset, seed):
+    rng = random.Random(seed)
+    c = {
+        'batches': batches, 'input_size': input_size, 'units': units, 'rank': rank,
+        'time': time, 'steps': steps, 'input_offset': input_offset, 'output_offset': output_offset,
+        'state_min': -(1 << (state_bits - 1)), 'state_max': (1 << (state_bits - 1)) - 1,
+    }
+    fb = units * rank
+    # The s16 state kernel accumulates state * weights_time in 32 bits, keep it clear of overflow
+    time_max = 127 if state_bits == 8 else 2047
+    inputs = [rng.randint(-128, 127) for _ in range(steps * batches * input_size)]
+    w_feature = [rng.randint(-127, 127) for _ in range(fb * input_size)]
+    w_time = [rng.randint(-time_max, time_max) for _ in range(fb * time)]
+    bias = [rng.randint(-1000, 1000) for _ in range(units)]
+
+    # Map the feature accumulators onto half the state range, then the time accumulators
+    # onto half the output range
+    _, feature_accs, _ = run_svdf(c, inputs, w_feature, w_time, bias, None, None)
+    quant_in = quantize_multiplier(0.5 * c['state_max'] / max(abs(v) for v in feature_accs))
+    _, _, time_accs = run_svdf(c, inputs, w_feature, w_time, bias, quant_in, None)
+    assert max(abs(v) for v in time_accs) < (1 << 31)
+    quant_out = quantize_multiplier(0.5 * 127 / max(abs(v) for v in time_accs))
+    output_ref, _, _ = run_svdf(c, inputs, w_feature, w_time, bias, quant_in, quant_out)
+
+    out_dir = os.path.join(out_root, name)
+    os.makedirs(out_dir, exist_ok=True)
+    banner = '// Generated by generate_svdf_test_data.py (seed %d).\n' % seed
+    N = name.upper() + '_'
+    time_type = 'int8_t' if state_bits == 8 else 'int16_t'
+
+    config = [
+        ('INPUT_BATCHES', batches), ('INPUT_SIZE', input_size), ('NUMBER_UNITS', units),
+        ('RANK', rank), ('FEATURE_BATCHES', fb), ('TIME_BATCHES', time),
+        ('NUMBER_INPUTS', steps), ('DST_SIZE', len(output_ref)),
+        ('INPUT_OFFSET', input_offset), ('OUTPUT_OFFSET', output_offset),
+        ('MULTIPLIER_IN', quant_in[0]), ('SHIFT_IN', quant_in[1]),
+        ('MULTIPLIER_OUT', quant_out[0]), ('SHIFT_OUT', quant_out[1]),
+        ('IN_ACTIVATION_MIN', c['state_min']), ('IN_ACTIVATION_MAX', c['state_max']),
+        ('OUT_ACTIVATION_MIN', -128), ('OUT_ACTIVATION_MAX', 127),
+    ]
+    files = {
+        'config_data.h': ''.join('#define %s%s %d\n' % (N, k, v) for k, v in config),
+        'input_sequence_data.h': c_array('int8_t', name + '_input_sequence', inputs),
+        'weights_feature_data.h': c_array('int8_t', name + '_weights_feature', w_feature),
+        'weights_time_data.h': c_array(time_type, name + '_weights_time', w_time),
+        'biases_data.h': c_array('int32_t', name + '_biases', bias),
+        'output_ref_data.h': c_array('int8_t', name + '_output_ref', output_ref),
+    }
+    for fname, body in files.items():
+        with open(os.path.join(out_dir, fname), 'w') as f:
+            f.write(banner + '#pragma once\n')
+            if fname != 'config_data.h':
+                f.write('#include <stdint.h>\n\n')
+            f.write(body)
+
+    with open(os.path.join(out_dir, 'test_data.h'), 'w') as f:
+        f.write(banner)
+        for fname in sorted(files):
+            f.write('#include "../../TestData/%s/%s"\n' % (name, fname))
+
+    print('[*] %s: %d steps, output %s' % (name, steps, output_ref))
+
+
+def main():
+    out_root = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), '..', 'TestData')
+    for case in CASES:
+        generate(out_root, *case)
+
+
+if __name__ == '__main__':
+    main()
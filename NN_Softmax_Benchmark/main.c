@@ -4,6 +4,7 @@ void softmax_arm_softmax_s8();
 void softmax_invalid_diff_min_arm_softmax_s8();
 void softmax_s16_arm_softmax_s16();
 void softmax_s8_s16_arm_softmax_s8_s16();
+void benchmark_softmax_lut_s8();
 
 uint32_t clkFastfreq = 0;
 
@@ -46,6 +47,10 @@ RAM_FUNC int main(void)
 
     printf("*****ARM Softmax Functions S8_S16*****\n\r");
     softmax_s8_s16_arm_softmax_s8_s16();
+    printf("\n\r");
+
+    printf("*****Softmax S8 with Precomputed Exp LUT*****\n\r");
+    benchmark_softmax_lut_s8();
 
     printf("All tests are passed.\n\r");
 	printf("Finish Softmax Functions benchmark\n\r");
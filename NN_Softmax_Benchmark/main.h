@@ -30,4 +30,16 @@ uint32_t measure_stack_usage(void);
 void generate_rand_s8(int8_t *src, int length);
 void generate_rand_s16(int16_t *src, int length);
 
+// Softmax s8 with a 256-entry exp table built once per (mult, shift, diff_min)
+typedef struct {
+    int32_t exp_lut[256];    // indexed by max - x, zero where x - max < diff_min
+} softmax_lut_s8_params;
+
+void softmax_lut_s8_init(int32_t mult, int32_t shift, int32_t diff_min, softmax_lut_s8_params *params);
+void softmax_lut_s8(const int8_t *input,
+                    int32_t num_rows,
+                    int32_t row_size,
+                    const softmax_lut_s8_params *params,
+                    int8_t *output);
+
 #endif /* MAIN_H_ */
@@ -0,0 +1,67 @@
+#include "main.h"
+#include <arm_nnsupportfunctions.h>
+
+/*
+ * Softmax s8 with the exponentials precomputed.
+ *
+ * arm_softmax_s8 evaluates EXP_ON_NEG(MUL_SAT(diff * (1 << shift), mult)) twice per element,
+ * where diff = x - max lies in [-255, 0]. For the fixed mult/shift/diff_min of a deployed model
+ * that is a function of diff alone, so softmax_lut_s8_init tabulates it once (1 KB) and each row
+ * reduces to a max, a table gather for the sum, one reciprocal and a second gather for the
+ * outputs. The arithmetic is the same as arm_softmax_s8, so the results are bit-exact.
+ * Like the library kernel it stays in flash, so the cycle comparison is like for like.
+ */
+
+#define ACCUM_BITS 12
+
+void softmax_lut_s8_init(int32_t mult, int32_t shift, int32_t diff_min, softmax_lut_s8_params *params)
+{
+    const int32_t mask = (1 << shift);
+
+    for (int32_t d = 0; d < 256; d++)
+    {
+        const int32_t diff = -d;
+        params->exp_lut[d] = (diff >= diff_min) ? EXP_ON_NEG(MUL_SAT(diff * mask, mult)) : 0;
+    }
+}
+
+void softmax_lut_s8(const int8_t *input,
+                    int32_t num_rows,
+                    int32_t row_size,
+                    const softmax_lut_s8_params *params,
+                    int8_t *output)
+{
+    const int32_t *lut = params->exp_lut;
+
+    for (int32_t row = 0; row < num_rows; row++)
+    {
+        int32_t max = input[0];
+        for (int32_t col = 1; col < row_size; col++)
+        {
+            max = MAX(max, input[col]);
+        }
+
+        // Entries below diff_min are zero and drop out of the sum
+        int32_t sum = 0;
+        for (int32_t col = 0; col < row_size; col++)
+        {
+            sum += DIV_POW2(lut[max - input[col]], ACCUM_BITS);
+        }
+
+        // The max element contributes 1 << (31 - ACCUM_BITS), so sum > 0
+        const int32_t headroom = __CLZ(sum);
+        const int32_t shifted_scale = ONE_OVER1((sum << headroom) - (1 << 31));
+        const int32_t bits_over_unit = ACCUM_BITS - headroom + 23;
+
+        for (int32_t col = 0; col < row_size; col++)
+        {
+            // A zero entry gives NN_Q7_MIN, as arm_softmax_s8 does below diff_min
+            const int32_t res =
+                DIV_POW2(MUL_SAT(shifted_scale, lut[max - input[col]]), bits_over_unit) + NN_Q7_MIN;
+            output[col] = (int8_t)CLAMP(res, (int32_t)NN_Q7_MAX, (int32_t)NN_Q7_MIN);
+        }
+
+        input += row_size;
+        output += row_size;
+    }
+}
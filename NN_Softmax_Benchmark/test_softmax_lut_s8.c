@@ -0,0 +1,160 @@
+#include "main.h"
+#include "../Include/softmax/config_data.h"
+#include "../Include/softmax_s8_s16/config_data.h"
+#include "../Include/softmax_s16/config_data.h"
+
+// Reference tensors are defined once, in the test_arm_softmax_*.c files
+extern const int8_t softmax_input[];
+extern const int8_t softmax_output_ref[];
+extern const int8_t softmax_s8_s16_input[];
+extern const int16_t softmax_s16_input[];
+extern const int16_t softmax_s16_exp_lut[];
+extern const int16_t softmax_s16_one_by_one_lut[];
+
+typedef struct {
+    const char *name;
+    int32_t num_rows;
+    int32_t row_size;
+    int32_t mult;
+    int32_t shift;
+    int32_t diff_min;
+    const int8_t *input;          // NULL: random s8 input
+    const int8_t *output_ref;     // NULL: validate against arm_softmax_s8
+    const int16_t *input_s16;     // NULL: random s16 input for arm_softmax_s16
+} softmax_lut_case;
+
+// One case per row size in the test data. The s16 case has no s8 quantization, so it reuses
+// the s8 softmax parameters on random input.
+static const softmax_lut_case softmax_lut_cases[] = {
+    {"softmax", SOFTMAX_NUM_ROWS, SOFTMAX_ROW_SIZE, SOFTMAX_INPUT_MULT, SOFTMAX_INPUT_LEFT_SHIFT,
+     SOFTMAX_DIFF_MIN, softmax_input, softmax_output_ref, NULL},
+    {"softmax_s16", SOFTMAX_S16_NUM_ROWS, SOFTMAX_S16_ROW_SIZE, SOFTMAX_INPUT_MULT, SOFTMAX_INPUT_LEFT_SHIFT,
+     SOFTMAX_DIFF_MIN, NULL, NULL, softmax_s16_input},
+    {"softmax_s8_s16", SOFTMAX_S8_S16_NUM_ROWS, SOFTMAX_S8_S16_ROW_SIZE, SOFTMAX_S8_S16_INPUT_MULT,
+     SOFTMAX_S8_S16_INPUT_LEFT_SHIFT, SOFTMAX_S8_S16_DIFF_MIN, softmax_s8_s16_input, NULL, NULL},
+};
+
+#define NUM_SOFTMAX_LUT_CASES ((int)(sizeof(softmax_lut_cases) / sizeof(softmax_lut_cases[0])))
+
+// Built once at "model load"
+static softmax_lut_s8_params lut_params;
+
+static void run_softmax_lut_case(const softmax_lut_case *s)
+{
+    const int32_t size = s->num_rows * s->row_size;
+    int8_t *input = malloc(size);
+    int8_t *output = malloc(size);
+    int8_t *output_ref = malloc(size);
+    int16_t *input_s16 = malloc(size * sizeof(int16_t));
+    int16_t *output_s16 = malloc(size * sizeof(int16_t));
+
+    if (!input || !output || !output_ref || !input_s16 || !output_s16) {
+        printf("Failed to allocate softmax buffers\n\r");
+        free(input);
+        free(output);
+        free(output_ref);
+        free(input_s16);
+        free(output_s16);
+        return;
+    }
+
+    if (s->input) {
+        memcpy(input, s->input, size);
+    } else {
+        generate_rand_s8(input, size);
+    }
+    if (s->input_s16) {
+        memcpy(input_s16, s->input_s16, size * sizeof(int16_t));
+    } else {
+        generate_rand_s16(input_s16, size);
+    }
+
+    // Table build, paid once per model
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+    softmax_lut_s8_init(s->mult, s->shift, s->diff_min, &lut_params);
+    uint32_t init_cycles = read_cycle_counter() - start_cycles;
+
+    // softmax_lut_s8
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    start_cycles = read_cycle_counter();
+
+    softmax_lut_s8(input, s->num_rows, s->row_size, &lut_params, output);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t lut_cycles = end_cycles - start_cycles;
+    uint32_t instr_est = lut_cycles
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    // arm_softmax_s8 on the same input
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    arm_softmax_s8(input, s->num_rows, s->row_size, s->mult, s->shift, s->diff_min, output_ref);
+    uint32_t s8_cycles = read_cycle_counter() - start_cycles;
+
+    // arm_softmax_s8_s16 on the same input
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    arm_softmax_s8_s16(input, s->num_rows, s->row_size, s->mult, s->shift, s->diff_min, output_s16);
+    uint32_t s8_s16_cycles = read_cycle_counter() - start_cycles;
+
+    // arm_softmax_s16 with the same shape
+    const cmsis_nn_softmax_lut_s16 softmax_s16_params = {.exp_lut = softmax_s16_exp_lut,
+                                                         .one_by_one_lut = softmax_s16_one_by_one_lut};
+    enable_cycle_counter();
+    start_cycles = read_cycle_counter();
+    arm_softmax_s16(input_s16, s->num_rows, s->row_size, SOFTMAX_S16_INPUT_MULT, SOFTMAX_S16_INPUT_LEFT_SHIFT,
+                    &softmax_s16_params, output_s16);
+    uint32_t s16_cycles = read_cycle_counter() - start_cycles;
+
+    float time_us = (float)lut_cycles / clkFastfreq * 1e6f;
+    int passed = validate(output, output_ref, size);
+    if (s->output_ref) {
+        passed = passed && validate(output, s->output_ref, size);
+    }
+
+    printf("\n\r");
+    printf("%s: %ld rows x %ld\n\r", s->name, (long)s->num_rows, (long)s->row_size);
+    if (passed) {
+        printf("softmax_lut_s8 output validation PASSED\n\r");
+        printf("Cycle Count: %lu\n\r", (unsigned long)lut_cycles);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r", (unsigned long)stack_used);
+        printf("LUT Build Cycle Count: %lu, LUT Size: %lu bytes\n\r",
+               (unsigned long)init_cycles, (unsigned long)sizeof(lut_params));
+        printf("arm_softmax_s8 Cycle Count: %lu (%.2fx)\n\r",
+               (unsigned long)s8_cycles, (float)s8_cycles / lut_cycles);
+        printf("arm_softmax_s8_s16 Cycle Count: %lu (%.2fx)\n\r",
+               (unsigned long)s8_s16_cycles, (float)s8_s16_cycles / lut_cycles);
+        printf("arm_softmax_s16 Cycle Count: %lu (%.2fx)\n\r",
+               (unsigned long)s16_cycles, (float)s16_cycles / lut_cycles);
+        if (s8_cycles > lut_cycles) {
+            printf("LUT build amortized after %lu calls\n\r\n",
+                   (unsigned long)((init_cycles + s8_cycles - lut_cycles - 1) / (s8_cycles - lut_cycles)));
+        } else {
+            printf("LUT build not amortized at this row size\n\r\n");
+        }
+    } else {
+        printf("softmax_lut_s8 output validation FAILED\n\r");
+    }
+
+    free(input);
+    free(output);
+    free(output_ref);
+    free(input_s16);
+    free(output_s16);
+}
+
+RAM_FUNC void benchmark_softmax_lut_s8(void)
+{
+    for (int i = 0; i < NUM_SOFTMAX_LUT_CASES; i++) {
+        run_softmax_lut_case(&softmax_lut_cases[i]);
+    }
+}
@@ -3,6 +3,9 @@
 void transpose_default_arm_transpose_s8();
 void transpose_3dim2_arm_transpose_s8();
 void transpose_matrix_arm_transpose_s8();
+void transpose_chwn_arm_transpose_s8();
+void benchmark_transpose_tiled_s8(void);
+void benchmark_transpose_tiled_vs_arm_transpose_s8(void);
 void transpose_conv_1_arm_transpose_conv_s8();
 void transpose_conv_2_arm_transpose_conv_s8();
 void transpose_conv_3_arm_transpose_conv_s8();
@@ -41,6 +44,15 @@ RAM_FUNC int main(void)
     transpose_default_arm_transpose_s8();
     transpose_3dim2_arm_transpose_s8();
     transpose_matrix_arm_transpose_s8();
+    transpose_chwn_arm_transpose_s8();
+    printf("\n\r");
+
+    printf("*****Tiled Transpose S8*****\n\r");
+    benchmark_transpose_tiled_s8();
+    printf("\n\r");
+
+    printf("*****Tiled Transpose vs arm_transpose_s8 (large tensors)*****\n\r");
+    benchmark_transpose_tiled_vs_arm_transpose_s8();
     printf("\n\r");
 
     printf("*****ARM Transpose Convolution S8*****\n\r");
@@ -30,4 +30,11 @@ uint32_t measure_stack_usage(void);
 void generate_rand_s8(int8_t *src, int length);
 void generate_rand_s16(int16_t *src, int length);
 
+// Tiled int8 transpose (4x4 byte tiles), same interface as arm_transpose_s8
+arm_cmsis_nn_status transpose_tiled_s8(const int8_t *input,
+                                       int8_t *const output,
+                                       const cmsis_nn_dims *const input_dims,
+                                       const cmsis_nn_dims *const output_dims,
+                                       const cmsis_nn_transpose_params *const transpose_params);
+
 #endif /* MAIN_H_ */
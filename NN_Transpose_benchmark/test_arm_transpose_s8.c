@@ -2,6 +2,7 @@
 #include "../TestData/transpose_3dim2/test_data.h"
 #include "../TestData/transpose_matrix/test_data.h"
 #include "TestData/transpose_default/test_data.h"
+#include "TestData/transpose_chwn/test_data.h"
 #define REPEAT_NUM (2)
 
 RAM_FUNC void transpose_default_arm_transpose_s8(void)
@@ -144,3 +145,47 @@ RAM_FUNC void transpose_matrix_arm_transpose_s8(void)
     }
 }
 
+RAM_FUNC void transpose_chwn_arm_transpose_s8(void)
+{
+    int8_t output_data[TRANSPOSE_CHWN_SIZE] = {0};
+    int8_t *output_ptr = output_data;
+
+    const cmsis_nn_dims input_dims = TRANSPOSE_CHWN_IN_DIM;
+    const cmsis_nn_dims output_dims = TRANSPOSE_CHWN_OUT_DIM;
+
+    const int8_t *input_data = transpose_chwn_input_tensor;
+    const int8_t *const output_ref = transpose_chwn_output;
+    const int32_t output_ref_size = TRANSPOSE_CHWN_SIZE;
+
+    const uint32_t perm[TRANSPOSE_CHWN_PERM_SIZE] = TRANSPOSE_CHWN_PERM;
+    const cmsis_nn_transpose_params transpose_params = {TRANSPOSE_CHWN_PERM_SIZE, perm};
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_transpose_s8(input_data, output_ptr, &input_dims, &output_dims, &transpose_params);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n\r");
+    if (validate(output_data, output_ref, output_ref_size)) {
+        printf("arm_transpose_chwn_s8 output validation PASSED\n\r");
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("arm_transpose_chwn_s8 output validation FAILED\n\r");
+    }
+}
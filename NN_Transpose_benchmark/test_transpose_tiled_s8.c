@@ -0,0 +1,215 @@
+#include "main.h"
+#include "TestData/transpose_default/config_data.h"
+#include "TestData/transpose_3dim2/config_data.h"
+#include "TestData/transpose_matrix/config_data.h"
+#include "TestData/transpose_chwn/config_data.h"
+
+// Reference tensors are defined once, in test_arm_transpose_s8.c
+extern const int8_t transpose_default_input_tensor[];
+extern const int8_t transpose_default_output[];
+extern const int8_t transpose_3dim2_input_tensor[];
+extern const int8_t transpose_3dim2_output[];
+extern const int8_t transpose_matrix_input_tensor[];
+extern const int8_t transpose_matrix_output[];
+extern const int8_t transpose_chwn_input_tensor[];
+extern const int8_t transpose_chwn_output[];
+
+typedef struct {
+    const char *name;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims output_dims;
+    int32_t num_dims;
+    uint32_t perm[4];
+    const int8_t *input;
+    const int8_t *output_ref;
+    int32_t size;
+} tiled_case;
+
+// Large activations, up to 64 KB
+typedef struct {
+    const char *name;
+    int32_t num_dims;
+    int32_t dims[4];
+    uint32_t perm[4];
+} tiled_shape;
+
+static const tiled_shape tiled_shapes[] = {
+    {"nhwc_to_nchw_32x32x32", 4, {1, 32, 32, 32}, {0, 3, 1, 2}},
+    {"nhwc_to_nchw_64x64x16", 4, {1, 64, 64, 16}, {0, 3, 1, 2}},
+    {"nchw_to_nhwc_16x64x64", 4, {1, 16, 64, 64}, {0, 2, 3, 1}},
+    {"dscnn_49x10x64_to_nchw", 4, {1, 49, 10, 64}, {0, 3, 1, 2}},
+    {"chwn_16x32x32x4", 4, {16, 32, 32, 4}, {3, 1, 2, 0}},
+    {"matrix_256x256", 2, {256, 256, 0, 0}, {1, 0, 0, 0}},
+    {"swap_hw_64x64x16", 4, {1, 64, 64, 16}, {0, 2, 1, 3}},
+};
+
+#define NUM_TILED_SHAPES ((int)(sizeof(tiled_shapes) / sizeof(tiled_shapes[0])))
+
+static void dims_from_array(cmsis_nn_dims *d, const int32_t *a)
+{
+    d->n = a[0];
+    d->h = a[1];
+    d->w = a[2];
+    d->c = a[3];
+}
+
+// Checks every output element against the input element the permutation maps it from
+static int transpose_check_s8(const int8_t *input, const int8_t *output, int32_t num_dims,
+                              const int32_t *dims, const uint32_t *perm)
+{
+    int32_t out_dims[4];
+    int32_t total = 1;
+    for (int32_t j = 0; j < num_dims; j++) {
+        out_dims[j] = dims[perm[j]];
+        total *= dims[j];
+    }
+
+    for (int32_t o = 0; o < total; o++) {
+        int32_t in_coord[4];
+        int32_t rem = o;
+        for (int32_t j = num_dims - 1; j >= 0; j--) {
+            in_coord[perm[j]] = rem % out_dims[j];
+            rem /= out_dims[j];
+        }
+        int32_t in_index = 0;
+        for (int32_t i = 0; i < num_dims; i++) {
+            in_index = in_index * dims[i] + in_coord[i];
+        }
+        if (output[o] != input[in_index]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+RAM_FUNC static void run_tiled_case(const tiled_case *t)
+{
+    int8_t *output = malloc(t->size);
+    if (!output) {
+        printf("Failed to allocate transpose buffer\n\r");
+        return;
+    }
+    memset(output, 0, t->size);
+
+    const cmsis_nn_transpose_params transpose_params = {t->num_dims, t->perm};
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_cmsis_nn_status result = transpose_tiled_s8(t->input, output, &t->input_dims, &t->output_dims,
+                                                    &transpose_params);
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+    float time_sec = (float)cycle_count / clkFastfreq;
+    float time_us = time_sec * 1e6f;
+
+    printf("\n\r");
+    if (result == ARM_CMSIS_NN_SUCCESS && validate(output, t->output_ref, t->size)) {
+        printf("%s output validation PASSED\n\r", t->name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+    } else {
+        printf("%s output validation FAILED\n\r", t->name);
+    }
+    free(output);
+}
+
+RAM_FUNC void benchmark_transpose_tiled_s8(void)
+{
+    const tiled_case cases[] = {
+        {"transpose_default_transpose_tiled_s8", TRANSPOSE_DEFAULT_IN_DIM, TRANSPOSE_DEFAULT_OUT_DIM,
+         TRANSPOSE_DEFAULT_PERM_SIZE, TRANSPOSE_DEFAULT_PERM, transpose_default_input_tensor,
+         transpose_default_output, TRANSPOSE_DEFAULT_SIZE},
+        {"transpose_3dim2_transpose_tiled_s8", TRANSPOSE_3DIM2_IN_DIM, TRANSPOSE_3DIM2_OUT_DIM,
+         TRANSPOSE_3DIM2_PERM_SIZE, TRANSPOSE_3DIM2_PERM, transpose_3dim2_input_tensor,
+         transpose_3dim2_output, TRANSPOSE_3DIM2_SIZE},
+        {"transpose_matrix_transpose_tiled_s8", TRANSPOSE_MATRIX_IN_DIM, TRANSPOSE_MATRIX_OUT_DIM,
+         TRANSPOSE_MATRIX_PERM_SIZE, TRANSPOSE_MATRIX_PERM, transpose_matrix_input_tensor,
+         transpose_matrix_output, TRANSPOSE_MATRIX_SIZE},
+        {"transpose_chwn_transpose_tiled_s8", TRANSPOSE_CHWN_IN_DIM, TRANSPOSE_CHWN_OUT_DIM,
+         TRANSPOSE_CHWN_PERM_SIZE, TRANSPOSE_CHWN_PERM, transpose_chwn_input_tensor,
+         transpose_chwn_output, TRANSPOSE_CHWN_SIZE},
+    };
+
+    for (int i = 0; i < (int)(sizeof(cases) / sizeof(cases[0])); i++) {
+        run_tiled_case(&cases[i]);
+    }
+}
+
+RAM_FUNC static void run_tiled_shape(const tiled_shape *s)
+{
+    int32_t out_array[4] = {0, 0, 0, 0};
+    int32_t size = 1;
+    for (int32_t j = 0; j < s->num_dims; j++) {
+        out_array[j] = s->dims[s->perm[j]];
+        size *= s->dims[j];
+    }
+
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims output_dims;
+    dims_from_array(&input_dims, s->dims);
+    dims_from_array(&output_dims, out_array);
+    const cmsis_nn_transpose_params transpose_params = {s->num_dims, s->perm};
+
+    int8_t *input = malloc(size);
+    int8_t *output = malloc(size);
+
+    if (!input || !output) {
+        printf("Failed to allocate transpose buffers\n\r");
+        free(input);
+        free(output);
+        return;
+    }
+
+    generate_rand_s8(input, size);
+
+    // arm_transpose_s8
+    memset(output, 0, size);
+    enable_cycle_counter();
+    uint32_t start_cycles = read_cycle_counter();
+    arm_transpose_s8(input, output, &input_dims, &output_dims, &transpose_params);
+    uint32_t ref_cycles = read_cycle_counter() - start_cycles;
+    int ref_ok = transpose_check_s8(input, output, s->num_dims, s->dims, s->perm);
+
+    // Tiled
+    memset(output, 0, size);
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    start_cycles = read_cycle_counter();
+    transpose_tiled_s8(input, output, &input_dims, &output_dims, &transpose_params);
+    uint32_t tiled_cycles = read_cycle_counter() - start_cycles;
+    uint32_t stack_used = measure_stack_usage();
+    int tiled_ok = transpose_check_s8(input, output, s->num_dims, s->dims, s->perm);
+
+    printf("\n\r");
+    printf("%s (%ld bytes)\n\r", s->name, (long)size);
+    printf("arm_transpose_s8 validation %s, transpose_tiled_s8 validation %s\n\r",
+           ref_ok ? "PASSED" : "FAILED", tiled_ok ? "PASSED" : "FAILED");
+    printf("arm_transpose_s8 Cycle Count: %lu (%.3f bytes/cycle)\n\r",
+           (unsigned long)ref_cycles, (float)(2 * size) / ref_cycles);
+    printf("transpose_tiled_s8 Cycle Count: %lu (%.3f bytes/cycle)\n\r",
+           (unsigned long)tiled_cycles, (float)(2 * size) / tiled_cycles);
+    printf("Speedup: %.2fx, Tiled Stack Used: %lu bytes\n\r\n",
+           (float)ref_cycles / tiled_cycles, (unsigned long)stack_used);
+
+    free(input);
+    free(output);
+}
+
+RAM_FUNC void benchmark_transpose_tiled_vs_arm_transpose_s8(void)
+{
+    for (int i = 0; i < NUM_TILED_SHAPES; i++) {
+        run_tiled_shape(&tiled_shapes[i]);
+    }
+}
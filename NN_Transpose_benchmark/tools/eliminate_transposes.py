@@ -0,0 +1,387 @@
+"""Graph pass that removes TRANSPOSE ops whose consumer can read the permuted layout directly.
+
+Models imported from NCHW frameworks carry TRANSPOSE ops that only change layout for the next
+op. This pass rewrites a small JSON graph description until no rule applies, then reports every
+transpose it removed with the bytes it no longer moves and the cycles saved. Cycles come from a
+linear fit (cycles = a + b * bytes, clamped at 0) over the arm_transpose_s8 results in a UART
+log of this benchmark. Transposes rewritten to RESHAPE are listed but not counted as saved.
+
+Rules, applied to a fixed point:
+    identity      perm is the identity                          -> drop
+    size-1 only   perm only moves size-1 axes                   -> RESHAPE (no data movement)
+    constant      input is a constant                           -> permute the constant offline
+    compose       TRANSPOSE -> TRANSPOSE                        -> one TRANSPOSE (or none)
+    fc fold       TRANSPOSE [-> RESHAPE flatten] -> FC          -> permute FC weight columns
+    sink          TRANSPOSE -> layout-agnostic op -> ... -> a   -> move the TRANSPOSE past the op
+                  transpose or FC                                  (constants permuted by p^-1)
+
+Layout-agnostic ops are elementwise ops (every non-constant input transposed with the same perm,
+constants scalar or permuted offline) and 1x1 stride-1 CONV_2D when the perm keeps channels last.
+Sinking only happens when the chain ends in a rule that removes the transpose.
+
+Graph format (tensors by name, ops in execution order):
+    {"tensors": {"x": {"shape": [1, 3, 32, 32], "const": false, "data": [...]}, ...},
+     "ops": [{"name": "t0", "type": "TRANSPOSE", "inputs": ["x"], "outputs": ["y"],
+              "perm": [0, 2, 3, 1]}, ...],
+     "outputs": ["logits"]}
+"data" is optional on constants; without it the offline permutation is recorded on every op
+that reads the constant as "const_perm" (or on the FC as "input_perm") for the exporter to
+apply. Tensors no longer referenced after the rewrite are dropped from the output graph.
+
+Usage:
+    python eliminate_transposes.py <graph.json> [--output <out.json>] [--timings <uart_log.txt>]
+"""
+
+import argparse
+import json
+import math
+import re
+import sys
+
+ELEMENTWISE = {'ADD', 'SUB', 'MUL', 'MAXIMUM', 'MINIMUM', 'RELU', 'RELU6', 'TANH', 'LOGISTIC',
+               'QUANTIZE', 'DEQUANTIZE'}
+
+
+def prod(values):
+    return math.prod(values) if values else 1
+
+
+def invert(perm):
+    inv = [0] * len(perm)
+    for j, p in enumerate(perm):
+        inv[p] = j
+    return inv
+
+
+def permute_shape(shape, perm):
+    return [shape[p] for p in perm]
+
+
+def permute_data(data, shape, perm):
+    """Flat row-major data of `shape` transposed by `perm`."""
+    out_shape = permute_shape(shape, perm)
+    in_strides = [prod(shape[i + 1:]) for i in range(len(shape))]
+    out = []
+    for o in range(len(data)):
+        rem, index = o, 0
+        for j in range(len(out_shape) - 1, -1, -1):
+            index += (rem % out_shape[j]) * in_strides[perm[j]]
+            rem //= out_shape[j]
+        out.append(data[index])
+    return out
+
+
+class Graph:
+    def __init__(self, desc):
+        self.tensors = desc['tensors']
+        self.ops = desc['ops']
+        self.outputs = set(desc.get('outputs', []))
+
+    def producer(self, tensor):
+        for op in self.ops:
+            if tensor in op['outputs']:
+                return op
+        return None
+
+    def consumers(self, tensor):
+        return [op for op in self.ops if tensor in op['inputs']]
+
+    def is_const(self, tensor):
+        return self.tensors[tensor].get('const', False)
+
+    def shape(self, tensor):
+        return self.tensors[tensor]['shape']
+
+    def rename_input(self, old, new):
+        for op in self.ops:
+            op['inputs'] = [new if t == old else t for t in op['inputs']]
+        if old in self.outputs:
+            self.outputs.discard(old)
+            self.outputs.add(new)
+
+    def remove(self, op):
+        self.ops.remove(op)
+
+    def permute_const(self, tensor, perm):
+        t = self.tensors[tensor]
+        if 'data' in t:
+            t['data'] = permute_data(t['data'], t['shape'], perm)
+        else:
+            for op in self.consumers(tensor):
+                recorded = op.setdefault('const_perm', {})
+                # a second permutation composes with the one the exporter already has to apply
+                previous = recorded.get(tensor)
+                recorded[tensor] = [previous[p] for p in perm] if previous else perm
+        t['shape'] = permute_shape(t['shape'], perm)
+
+    def clone_const(self, tensor, owner):
+        """Private copy of a shared constant for `owner`, so permuting it leaves other readers alone."""
+        name = '%s_%s' % (tensor, owner['name'])
+        self.tensors[name] = json.loads(json.dumps(self.tensors[tensor]))
+        owner['inputs'] = [name if t == tensor else t for t in owner['inputs']]
+        return name
+
+    def prune(self):
+        """Drop tensors that no op reads or writes and that are not graph outputs."""
+        live = set(self.outputs)
+        for op in self.ops:
+            live.update(op['inputs'])
+            live.update(op['outputs'])
+        self.tensors = {name: t for name, t in self.tensors.items() if name in live}
+
+    def to_json(self):
+        return {'tensors': self.tensors, 'ops': self.ops, 'outputs': sorted(self.outputs)}
+
+
+def dump_graph(desc, f):
+    """JSON with every shape, perm and data array kept on one line."""
+    text = json.dumps(desc, indent=1)
+    f.write(re.sub(r'\[[-0-9.,\s]*\]', lambda m: ' '.join(m.group(0).split()).replace('[ ', '[').replace(' ]', ']'),
+                   text) + '\n')
+
+
+def single_consumer(graph, tensor):
+    users = graph.consumers(tensor)
+    if len(users) != 1 or tensor in graph.outputs:
+        return None
+    return users[0]
+
+
+def is_flatten(graph, op):
+    """RESHAPE that keeps the batch axis and flattens the rest."""
+    if op['type'] != 'RESHAPE':
+        return False
+    in_shape, out_shape = graph.shape(op['inputs'][0]), graph.shape(op['outputs'][0])
+    return len(out_shape) == 2 and out_shape[0] == in_shape[0] and out_shape[1] == prod(in_shape[1:])
+
+
+def is_layout_agnostic(graph, op, perm, tensor):
+    """`op` gives the same result if `tensor` and its other inputs are not permuted by `perm`."""
+    if op['type'] in ELEMENTWISE:
+        for name in op['inputs']:
+            if name == tensor:
+                continue
+            producer = graph.producer(name)
+            if producer is not None and producer['type'] == 'TRANSPOSE' and producer['perm'] == perm:
+                continue
+            if graph.is_const(name) and (prod(graph.shape(name)) == 1 or len(graph.shape(name)) == len(perm)):
+                continue
+            return False
+        return True
+    if op['type'] == 'CONV_2D':
+        w_shape = graph.shape(op['inputs'][1])
+        unit = w_shape[1] == 1 and w_shape[2] == 1 and op.get('stride', [1, 1]) == [1, 1]
+        return unit and perm[-1] == len(perm) - 1
+    return False
+
+
+def fc_foldable(graph, perm, op, tensor):
+    """`op` reads `tensor` (transposed by `perm`) as an FC input, directly or through a flatten."""
+    if perm[0] != 0 or op['inputs'][0] != tensor:
+        return False
+    if op['type'] == 'FULLY_CONNECTED':
+        # FULLY_CONNECTED flattens everything after the batch axis itself
+        return True
+    if is_flatten(graph, op):
+        fc = single_consumer(graph, op['outputs'][0])
+        return fc is not None and fc['type'] == 'FULLY_CONNECTED'
+    return False
+
+
+def sink_target(graph, transpose):
+    """Follow single-consumer layout-agnostic ops; True if the chain ends in a removable spot."""
+    perm = transpose['perm']
+    tensor = transpose['outputs'][0]
+    op = single_consumer(graph, tensor)
+    depth = 0
+    while op is not None and is_layout_agnostic(graph, op, perm, tensor):
+        depth += 1
+        tensor = op['outputs'][0]
+        op = single_consumer(graph, tensor)
+    if depth == 0 or op is None:
+        return False
+    return op['type'] == 'TRANSPOSE' or fc_foldable(graph, perm, op, tensor)
+
+
+class Pass:
+    def __init__(self, graph):
+        self.graph = graph
+        self.report = []
+
+    def eliminated(self, transpose, rule, moved_bytes, saved=True):
+        self.report.append({'op': transpose['name'], 'rule': rule,
+                            'shape': self.graph.shape(transpose['inputs'][0]),
+                            'perm': transpose['perm'], 'bytes': moved_bytes, 'saved': saved})
+
+    def drop(self, transpose):
+        self.graph.rename_input(transpose['outputs'][0], transpose['inputs'][0])
+        self.graph.remove(transpose)
+
+    def try_rules(self, t):
+        g = self.graph
+        src, dst = t['inputs'][0], t['outputs'][0]
+        perm = t['perm']
+        size = prod(g.shape(src))
+
+        if perm == sorted(perm):
+            self.drop(t)
+            self.eliminated(t, 'identity', size)
+            return True
+
+        moved = [p for p in perm if g.shape(src)[p] != 1]
+        if moved == sorted(moved):
+            # the RESHAPE still runs, so nothing is counted as saved
+            self.eliminated(t, 'size-1 only', size, saved=False)
+            t['type'] = 'RESHAPE'
+            t.pop('perm')
+            return True
+
+        if g.is_const(src) and len(g.consumers(src)) == 1 and dst not in g.outputs:
+            self.drop(t)
+            g.permute_const(src, perm)
+            self.eliminated(t, 'constant', size)
+            return True
+
+        consumer = single_consumer(g, dst)
+        if consumer is None:
+            return False
+
+        if consumer['type'] == 'TRANSPOSE':
+            inner = consumer['perm']
+            consumer['perm'] = [perm[p] for p in inner]
+            consumer['inputs'] = [src]
+            g.remove(t)
+            self.eliminated(t, 'compose', size)
+            return True
+
+        if fc_foldable(g, perm, consumer, dst):
+            fc = consumer if consumer['type'] == 'FULLY_CONNECTED' else single_consumer(g, consumer['outputs'][0])
+            self.fold_into_fc(t, fc)
+            self.drop(t)
+            self.eliminated(t, 'fc fold', size)
+            return True
+
+        if sink_target(g, t):
+            self.sink(t, consumer)
+            return True
+
+        return False
+
+    def fold_into_fc(self, t, fc):
+        """FC input column k (permuted layout) becomes column j (original layout)."""
+        g = self.graph
+        shape = g.shape(t['inputs'][0])[1:]
+        perm = [p - 1 for p in t['perm'][1:]]
+        weights = fc['inputs'][1]
+        if 'data' in g.tensors[weights] and len(g.consumers(weights)) > 1:
+            weights = g.clone_const(weights, fc)
+        w = g.tensors[weights]
+        if 'data' in w:
+            rows, cols = w['shape']
+            # column index of the permuted layout for every original column
+            order = permute_data(list(range(cols)), permute_shape(shape, perm), invert(perm))
+            data = w['data']
+            w['data'] = [data[r * cols + order[j]] for r in range(rows) for j in range(cols)]
+        else:
+            fc['input_perm'] = {'shape': shape, 'perm': perm}
+
+    def sink(self, t, op):
+        """Run `op` on the untransposed tensors and transpose its output instead."""
+        g = self.graph
+        perm, inv = t['perm'], invert(t['perm'])
+        new_inputs = []
+        for name in op['inputs']:
+            producer = g.producer(name)
+            if producer is not None and producer['type'] == 'TRANSPOSE' and producer['perm'] == perm:
+                new_inputs.append(producer['inputs'][0])
+                if producer is not t and len(g.consumers(name)) == 1:
+                    g.remove(producer)
+                    self.eliminated(producer, 'sink (merged)', prod(g.shape(name)))
+            elif g.is_const(name) and prod(g.shape(name)) > 1 and op['type'] in ELEMENTWISE:
+                if len(g.consumers(name)) > 1:
+                    name = g.clone_const(name, op)
+                g.permute_const(name, inv)
+                new_inputs.append(name)
+            else:
+                new_inputs.append(name)
+        op['inputs'] = new_inputs
+        out = op['outputs'][0]
+        pre = out + '_pre_transpose'
+        g.tensors[pre] = dict(g.tensors[out], shape=permute_shape(g.shape(out), inv))
+        op['outputs'] = [pre]
+        t['inputs'], t['outputs'] = [pre], [out]
+        g.remove(t)
+        g.ops.insert(g.ops.index(op) + 1, t)
+
+    def run(self):
+        changed = True
+        while changed:
+            changed = False
+            for op in list(self.graph.ops):
+                if op['type'] == 'TRANSPOSE' and op in self.graph.ops and self.try_rules(op):
+                    changed = True
+                    break
+        self.graph.prune()
+        return self.report
+
+
+def fit_timings(log_path):
+    """Least-squares cycles = a + b * bytes over arm_transpose_s8 results in a UART log."""
+    points = []
+    size = None
+    with open(log_path) as f:
+        for line in f:
+            m = re.match(r'\s*\S+ \((\d+) bytes\)', line)
+            if m:
+                size = int(m.group(1))
+                continue
+            m = re.match(r'\s*arm_transpose_s8 Cycle Count: (\d+)', line)
+            if m and size is not None:
+                points.append((size, int(m.group(1))))
+                size = None
+    if len(points) < 2:
+        sys.exit('need at least two arm_transpose_s8 results in %s' % log_path)
+    n = len(points)
+    mx = sum(p[0] for p in points) / n
+    my = sum(p[1] for p in points) / n
+    b = sum((x - mx) * (y - my) for x, y in points) / sum((x - mx) ** 2 for x, _ in points)
+    return my - b * mx, b
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('graph')
+    parser.add_argument('--output', help='write the rewritten graph here')
+    parser.add_argument('--timings', help='UART log of NN_Transpose_benchmark for the cycle model')
+    args = parser.parse_args()
+
+    with open(args.graph) as f:
+        graph = Graph(json.load(f))
+    before = sum(op['type'] == 'TRANSPOSE' for op in graph.ops)
+    report = Pass(graph).run()
+    after = sum(op['type'] == 'TRANSPOSE' for op in graph.ops)
+
+    model = fit_timings(args.timings) if args.timings else None
+    if model:
+        print('cycle model: %.1f + %.3f * bytes (arm_transpose_s8)' % model)
+
+    total_bytes = total_cycles = 0
+    print('%-14s %-14s %-18s %-14s %10s %10s' % ('op', 'rule', 'shape', 'perm', 'bytes', 'cycles'))
+    for r in report:
+        # a transpose reads and writes every byte once; the fit can go negative for tiny tensors
+        moved = 2 * r['bytes'] if r['saved'] else 0
+        cycles = max(0, round(model[0] + model[1] * r['bytes'])) if model and r['saved'] else None
+        total_bytes += moved
+        total_cycles += cycles or 0
+        print('%-14s %-14s %-18s %-14s %10d %10s' % (r['op'], r['rule'], 'x'.join(map(str, r['shape'])),
+                                                      r['perm'], moved, '-' if cycles is None else cycles))
+    print('TRANSPOSE ops: %d -> %d, bytes saved per inference: %d%s' % (
+        before, after, total_bytes, ', cycles saved: %d' % total_cycles if model else ''))
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            dump_graph(graph.to_json(), f)
+
+
+if __name__ == '__main__':
+    main()
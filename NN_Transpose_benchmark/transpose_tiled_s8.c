@@ -0,0 +1,167 @@
+#include "main.h"
+
+/*
+ * Tiled int8 transpose, a drop-in for arm_transpose_s8 (same arguments, NHWC dims with the
+ * leading num_dims entries used).
+ *
+ * The permutation is split into a 2D plane and up to two outer axes. The plane is spanned by
+ * the input's innermost axis (unit stride in the input) and the axis that becomes innermost in
+ * the output (unit stride in the output). The plane is moved as 4x4 byte tiles: four word loads
+ * from four input rows, a byte transpose in registers with UXTB16/PKHBT/PKHTB, and four word
+ * stores to four output rows, instead of sixteen byte loads and stores. When the innermost axis
+ * is not permuted, contiguous runs are copied with memcpy. It runs from flash, as
+ * arm_transpose_s8 does, so the cycle comparison is like for like.
+ */
+
+static inline uint32_t read_u8x4(const int8_t *p)
+{
+    uint32_t val;
+    memcpy(&val, p, 4);
+    return val;
+}
+
+static inline void write_u8x4(int8_t *p, uint32_t val)
+{
+    memcpy(p, &val, 4);
+}
+
+// in[r * in_row_stride + c] -> out[c * out_row_stride + r]
+static void transpose_plane_s8(const int8_t *in,
+                               int8_t *out,
+                               int32_t rows,
+                               int32_t cols,
+                               int32_t in_row_stride,
+                               int32_t out_row_stride)
+{
+    int32_t r = 0;
+
+    for (; r <= rows - 4; r += 4)
+    {
+        const int8_t *src = in + r * in_row_stride;
+        int8_t *dst = out + r;
+        int32_t c = 0;
+
+        for (; c <= cols - 4; c += 4)
+        {
+            // Row k holds bytes k0 k1 k2 k3 (lowest byte first)
+            const uint32_t row0 = read_u8x4(src + c);
+            const uint32_t row1 = read_u8x4(src + in_row_stride + c);
+            const uint32_t row2 = read_u8x4(src + 2 * in_row_stride + c);
+            const uint32_t row3 = read_u8x4(src + 3 * in_row_stride + c);
+
+            // Interleave pairs of rows: (00 10 02 12), (01 11 03 13), (20 30 22 32), (21 31 23 33)
+            const uint32_t even01 = __UXTB16(row0) | (__UXTB16(row1) << 8);
+            const uint32_t odd01 = __UXTB16(__ROR(row0, 8)) | (__UXTB16(__ROR(row1, 8)) << 8);
+            const uint32_t even23 = __UXTB16(row2) | (__UXTB16(row3) << 8);
+            const uint32_t odd23 = __UXTB16(__ROR(row2, 8)) | (__UXTB16(__ROR(row3, 8)) << 8);
+
+            // Combine halfwords into the output rows: column k = (0k 1k 2k 3k)
+            write_u8x4(dst + c * out_row_stride, __PKHBT(even01, even23, 16));
+            write_u8x4(dst + (c + 1) * out_row_stride, __PKHBT(odd01, odd23, 16));
+            write_u8x4(dst + (c + 2) * out_row_stride, __PKHTB(even23, even01, 16));
+            write_u8x4(dst + (c + 3) * out_row_stride, __PKHTB(odd23, odd01, 16));
+        }
+
+        for (; c < cols; c++)
+        {
+            int8_t *d = dst + c * out_row_stride;
+            d[0] = src[c];
+            d[1] = src[in_row_stride + c];
+            d[2] = src[2 * in_row_stride + c];
+            d[3] = src[3 * in_row_stride + c];
+        }
+    }
+
+    for (; r < rows; r++)
+    {
+        const int8_t *src = in + r * in_row_stride;
+        for (int32_t c = 0; c < cols; c++)
+        {
+            out[c * out_row_stride + r] = src[c];
+        }
+    }
+}
+
+arm_cmsis_nn_status transpose_tiled_s8(const int8_t *input,
+                                       int8_t *const output,
+                                       const cmsis_nn_dims *const input_dims,
+                                       const cmsis_nn_dims *const output_dims,
+                                       const cmsis_nn_transpose_params *const transpose_params)
+{
+    const int32_t num_dims = transpose_params->num_dims;
+    const uint32_t *perm = transpose_params->permutations;
+    const int32_t dims[4] = {input_dims->n, input_dims->h, input_dims->w, input_dims->c};
+    int32_t in_strides[4];
+    int32_t out_strides[4];    // output stride of each input axis
+    int32_t total = 1;
+    (void)output_dims;
+
+    if (num_dims < 2 || num_dims > 4)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    for (int32_t i = num_dims - 1; i >= 0; i--)
+    {
+        in_strides[i] = total;
+        total *= dims[i];
+    }
+    int32_t stride = 1;
+    for (int32_t j = num_dims - 1; j >= 0; j--)
+    {
+        out_strides[perm[j]] = stride;
+        stride *= dims[perm[j]];
+    }
+
+    const int32_t inner = num_dims - 1;
+    const int32_t row_axis = (int32_t)perm[num_dims - 1];
+
+    if (row_axis == inner)
+    {
+        // Innermost axis kept: copy contiguous runs
+        const int32_t run = dims[inner];
+        for (int32_t base = 0; base < total; base += run)
+        {
+            int32_t out_offset = 0;
+            for (int32_t i = 0; i < inner; i++)
+            {
+                out_offset += ((base / in_strides[i]) % dims[i]) * out_strides[i];
+            }
+            memcpy(output + out_offset, input + base, run);
+        }
+        return ARM_CMSIS_NN_SUCCESS;
+    }
+
+    // Up to two outer axes, padded with size-1 axes
+    int32_t outer_size[2] = {1, 1};
+    int32_t outer_in_stride[2] = {0, 0};
+    int32_t outer_out_stride[2] = {0, 0};
+    int32_t num_outer = 0;
+    for (int32_t i = 0; i < num_dims; i++)
+    {
+        if (i != inner && i != row_axis)
+        {
+            outer_size[num_outer] = dims[i];
+            outer_in_stride[num_outer] = in_strides[i];
+            outer_out_stride[num_outer] = out_strides[i];
+            num_outer++;
+        }
+    }
+
+    for (int32_t i0 = 0; i0 < outer_size[0]; i0++)
+    {
+        for (int32_t i1 = 0; i1 < outer_size[1]; i1++)
+        {
+            const int32_t in_offset = i0 * outer_in_stride[0] + i1 * outer_in_stride[1];
+            const int32_t out_offset = i0 * outer_out_stride[0] + i1 * outer_out_stride[1];
+            transpose_plane_s8(input + in_offset,
+                               output + out_offset,
+                               dims[row_axis],
+                               dims[inner],
+                               in_strides[row_axis],
+                               out_strides[inner]);
+        }
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
@@ -12,6 +12,9 @@ void depthwise_dilation_arm_depthwise_conv_s8(void);
 void dw_int16xint8_arm_depthwise_conv_s16(void);
 void dw_int16xint8_mult4_arm_depthwise_conv_s16(void);
 void dw_int16xint8_dilation_arm_depthwise_conv_s16(void);
+void benchmark_arm_convolve_1x1_s8_fast(void);
+void benchmark_arm_convolve_1_x_n_s8(void);
+void benchmark_arm_depthwise_conv_3x3_s8(void);
 
 uint32_t clkFastfreq = 0;
 
@@ -66,6 +69,16 @@ RAM_FUNC int main(void)
     dw_int16xint8_arm_depthwise_conv_s16();
     dw_int16xint8_mult4_arm_depthwise_conv_s16();
     dw_int16xint8_dilation_arm_depthwise_conv_s16();
+    printf("\n\r");
+
+    printf("*****ARM CONVOLVE 1X1 S8 FAST vs NEAR-MISS SHAPES*****\n\r");
+    benchmark_arm_convolve_1x1_s8_fast();
+
+    printf("*****ARM CONVOLVE 1_X_N S8 vs NEAR-MISS SHAPES*****\n\r");
+    benchmark_arm_convolve_1_x_n_s8();
+
+    printf("*****ARM DEPTHWISE CONVOLVE 3X3 S8 vs NEAR-MISS SHAPES*****\n\r");
+    benchmark_arm_depthwise_conv_3x3_s8();
 
     printf("Finish Convolution Functions Benchmark\n\r");
     return 0;
@@ -0,0 +1,453 @@
+#include "main.h"
+#include <arm_nnsupportfunctions.h>
+
+/*
+ * Direct benchmarks of the specialised kernels that the conv/depthwise wrappers dispatch to:
+ * arm_convolve_1x1_s8_fast, arm_convolve_1_x_n_s8 and arm_depthwise_conv_3x3_s8.
+ *
+ * Each family has one shape that qualifies for the fast kernel and a few near-miss shapes
+ * that break exactly one of its conditions, with the same (nominal) MAC count. The near-miss
+ * shapes go through the wrapper, i.e. whatever path a model would really get, and the cycle
+ * cliff is reported as the cycles/MAC ratio against the fast kernel.
+ *
+ * Inputs and weights are random; every output is checked against a plain C reference.
+ */
+
+#define FAST_PATH_INPUT_OFFSET  3
+#define FAST_PATH_OUTPUT_OFFSET -2
+#define FAST_PATH_MULTIPLIER    0x40000000
+
+typedef struct {
+    const char *name;
+    int32_t in_h, in_w, in_ch;
+    int32_t filter_h, filter_w;
+    int32_t out_ch;
+    int32_t ch_mult;        // 0 for regular convolution
+    int32_t stride_h, stride_w;
+    int32_t pad_h, pad_w;
+    int32_t dilation_h, dilation_w;
+    int32_t out_shift;      // keeps the random accumulators inside the int8 range
+} fast_path_shape;
+
+typedef struct {
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+    int8_t *input;
+    int8_t *weights;
+    int32_t *bias;
+    int8_t *output;
+    int8_t *output_ref;
+    int32_t output_size;
+    uint32_t macs;
+} fast_path_case;
+
+typedef arm_cmsis_nn_status (*conv_kernel)(const cmsis_nn_context *ctx,
+                                           const cmsis_nn_conv_params *conv_params,
+                                           const cmsis_nn_per_channel_quant_params *quant_params,
+                                           const cmsis_nn_dims *input_dims,
+                                           const int8_t *input_data,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const int8_t *filter_data,
+                                           const cmsis_nn_dims *bias_dims,
+                                           const int32_t *bias_data,
+                                           const cmsis_nn_dims *output_dims,
+                                           int8_t *output_data);
+
+typedef arm_cmsis_nn_status (*dw_conv_kernel)(const cmsis_nn_context *ctx,
+                                              const cmsis_nn_dw_conv_params *dw_conv_params,
+                                              const cmsis_nn_per_channel_quant_params *quant_params,
+                                              const cmsis_nn_dims *input_dims,
+                                              const int8_t *input_data,
+                                              const cmsis_nn_dims *filter_dims,
+                                              const int8_t *filter_data,
+                                              const cmsis_nn_dims *bias_dims,
+                                              const int32_t *bias_data,
+                                              const cmsis_nn_dims *output_dims,
+                                              int8_t *output_data);
+
+static const fast_path_shape conv_1x1_shapes[] = {
+    // name                         in_h in_w in_ch fh fw out_ch mult sh sw ph pw dh dw shift
+    {"1x1 10x10x32 (fast)",          10,  10,  32,  1, 1,  32,   0,  1, 1, 0, 0, 1, 1, -9},
+    {"1x1 near-miss: stride 2",      19,  19,  32,  1, 1,  32,   0,  2, 2, 0, 0, 1, 1, -9},
+    {"1x1 near-miss: padding 1",      8,   8,  32,  1, 1,  32,   0,  1, 1, 1, 1, 1, 1, -9},
+};
+
+static const fast_path_shape conv_1_x_n_shapes[] = {
+    {"1x5 1x64x16 (fast)",            1,  64,  16,  1, 5,  16,   0,  1, 1, 0, 2, 1, 1, -10},
+    {"1x5 near-miss: in_ch 15",       1,  64,  15,  1, 5,  16,   0,  1, 1, 0, 2, 1, 1, -10},
+    {"1x5 near-miss: 2 input rows",   2,  32,  16,  1, 5,  16,   0,  1, 1, 0, 2, 1, 1, -10},
+};
+
+static const fast_path_shape dw_3x3_shapes[] = {
+    {"dw 3x3 16x16x32 (fast)",       16,  16,  32,  3, 3,  32,   1,  1, 1, 1, 1, 1, 1, -8},
+    {"dw 3x3 near-miss: padding 2",  14,  14,  32,  3, 3,  32,   1,  1, 1, 2, 2, 1, 1, -8},
+    {"dw 3x3 near-miss: dilation 2", 16,  16,  32,  3, 3,  32,   1,  1, 1, 2, 2, 2, 2, -8},
+    {"dw 3x3 near-miss: ch_mult 2",  16,  16,  16,  3, 3,  32,   2,  1, 1, 1, 1, 1, 1, -8},
+};
+
+#define NUM_SHAPES(a) ((int)(sizeof(a) / sizeof((a)[0])))
+
+static int32_t out_dim(int32_t in, int32_t k, int32_t stride, int32_t pad, int32_t dilation)
+{
+    return (in + 2 * pad - dilation * (k - 1) - 1) / stride + 1;
+}
+
+static void conv_ref_s8(const fast_path_case *c, int is_dw)
+{
+    const cmsis_nn_dims *in = &c->input_dims;
+    const cmsis_nn_dims *f = &c->filter_dims;
+    const cmsis_nn_dims *out = &c->output_dims;
+    const cmsis_nn_tile stride = is_dw ? c->dw_conv_params.stride : c->conv_params.stride;
+    const cmsis_nn_tile pad = is_dw ? c->dw_conv_params.padding : c->conv_params.padding;
+    const cmsis_nn_tile dilation = is_dw ? c->dw_conv_params.dilation : c->conv_params.dilation;
+    const int32_t ch_mult = c->dw_conv_params.ch_mult;
+
+    for (int oy = 0; oy < out->h; oy++) {
+        for (int ox = 0; ox < out->w; ox++) {
+            for (int oc = 0; oc < out->c; oc++) {
+                int32_t acc = c->bias[oc];
+                for (int ky = 0; ky < f->h; ky++) {
+                    const int iy = oy * stride.h - pad.h + ky * dilation.h;
+                    if (iy < 0 || iy >= in->h) {
+                        continue;
+                    }
+                    for (int kx = 0; kx < f->w; kx++) {
+                        const int ix = ox * stride.w - pad.w + kx * dilation.w;
+                        if (ix < 0 || ix >= in->w) {
+                            continue;
+                        }
+                        const int8_t *in_px = &c->input[(iy * in->w + ix) * in->c];
+                        if (is_dw) {
+                            const int32_t w = c->weights[(ky * f->w + kx) * out->c + oc];
+                            acc += (in_px[oc / ch_mult] + FAST_PATH_INPUT_OFFSET) * w;
+                        } else {
+                            const int8_t *w = &c->weights[((oc * f->h + ky) * f->w + kx) * in->c];
+                            for (int ic = 0; ic < in->c; ic++) {
+                                acc += (in_px[ic] + FAST_PATH_INPUT_OFFSET) * w[ic];
+                            }
+                        }
+                    }
+                }
+                acc = arm_nn_requantize(acc, c->quant_params.multiplier[oc], c->quant_params.shift[oc]);
+                acc += FAST_PATH_OUTPUT_OFFSET;
+                acc = MAX(acc, -128);
+                acc = MIN(acc, 127);
+                c->output_ref[(oy * out->w + ox) * out->c + oc] = (int8_t)acc;
+            }
+        }
+    }
+}
+
+static void free_case(fast_path_case *c)
+{
+    free(c->input);
+    free(c->weights);
+    free(c->bias);
+    free(c->quant_params.multiplier);
+    free(c->quant_params.shift);
+    free(c->output);
+    free(c->output_ref);
+}
+
+// Allocates random tensors for one shape and computes the reference output; returns 0 on success
+static int setup_case(const fast_path_shape *s, fast_path_case *c)
+{
+    const int is_dw = s->ch_mult != 0;
+    memset(c, 0, sizeof(*c));
+
+    c->input_dims.n = 1;
+    c->input_dims.h = s->in_h;
+    c->input_dims.w = s->in_w;
+    c->input_dims.c = s->in_ch;
+    c->filter_dims.n = is_dw ? 1 : s->out_ch;
+    c->filter_dims.h = s->filter_h;
+    c->filter_dims.w = s->filter_w;
+    c->filter_dims.c = is_dw ? s->out_ch : s->in_ch;
+    c->bias_dims.c = s->out_ch;
+    c->output_dims.n = 1;
+    c->output_dims.h = out_dim(s->in_h, s->filter_h, s->stride_h, s->pad_h, s->dilation_h);
+    c->output_dims.w = out_dim(s->in_w, s->filter_w, s->stride_w, s->pad_w, s->dilation_w);
+    c->output_dims.c = s->out_ch;
+
+    if (is_dw) {
+        c->dw_conv_params.ch_mult = s->ch_mult;
+        c->dw_conv_params.stride.h = s->stride_h;
+        c->dw_conv_params.stride.w = s->stride_w;
+        c->dw_conv_params.padding.h = s->pad_h;
+        c->dw_conv_params.padding.w = s->pad_w;
+        c->dw_conv_params.dilation.h = s->dilation_h;
+        c->dw_conv_params.dilation.w = s->dilation_w;
+        c->dw_conv_params.input_offset = FAST_PATH_INPUT_OFFSET;
+        c->dw_conv_params.output_offset = FAST_PATH_OUTPUT_OFFSET;
+        c->dw_conv_params.activation.min = -128;
+        c->dw_conv_params.activation.max = 127;
+    } else {
+        c->conv_params.stride.h = s->stride_h;
+        c->conv_params.stride.w = s->stride_w;
+        c->conv_params.padding.h = s->pad_h;
+        c->conv_params.padding.w = s->pad_w;
+        c->conv_params.dilation.h = s->dilation_h;
+        c->conv_params.dilation.w = s->dilation_w;
+        c->conv_params.input_offset = FAST_PATH_INPUT_OFFSET;
+        c->conv_params.output_offset = FAST_PATH_OUTPUT_OFFSET;
+        c->conv_params.activation.min = -128;
+        c->conv_params.activation.max = 127;
+    }
+
+    const int32_t input_size = s->in_h * s->in_w * s->in_ch;
+    const int32_t weight_size = is_dw ? s->filter_h * s->filter_w * s->out_ch
+                                      : s->out_ch * s->filter_h * s->filter_w * s->in_ch;
+    const int32_t taps = is_dw ? s->filter_h * s->filter_w : s->filter_h * s->filter_w * s->in_ch;
+
+    c->output_size = c->output_dims.h * c->output_dims.w * s->out_ch;
+    c->macs = (uint32_t)c->output_size * taps;
+
+    c->input = malloc(input_size);
+    c->weights = malloc(weight_size);
+    c->bias = malloc(s->out_ch * sizeof(int32_t));
+    c->quant_params.multiplier = malloc(s->out_ch * sizeof(int32_t));
+    c->quant_params.shift = malloc(s->out_ch * sizeof(int32_t));
+    c->output = malloc(c->output_size);
+    c->output_ref = malloc(c->output_size);
+    if (!c->input || !c->weights || !c->bias || !c->quant_params.multiplier || !c->quant_params.shift ||
+        !c->output || !c->output_ref) {
+        free_case(c);
+        return -1;
+    }
+
+    generate_rand_s8(c->input, input_size);
+    generate_rand_s8(c->weights, weight_size);
+    for (int i = 0; i < s->out_ch; i++) {
+        c->bias[i] = (rand() % 2048) - 1024;
+        c->quant_params.multiplier[i] = FAST_PATH_MULTIPLIER;
+        c->quant_params.shift[i] = s->out_shift;
+    }
+
+    conv_ref_s8(c, is_dw);
+    return 0;
+}
+
+// Prints the usual per-kernel block; returns 1 if the output matched the reference
+static int print_result(const char *name, const fast_path_case *c, uint32_t cycle_count, uint32_t instr_est,
+                        uint32_t stack_used)
+{
+    float time_us = (float)cycle_count / clkFastfreq * 1e6f;
+
+    printf("\n\r");
+    if (validate(c->output, c->output_ref, c->output_size)) {
+        printf("%s output validation PASSED\n\r", name);
+        printf("Cycle Count: %lu\n\r", (unsigned long)cycle_count);
+        printf("Estimated Instruction Count: %lu\n\r", instr_est);
+        printf("Execution Time (approx): %.3f us\n\r", time_us);
+        printf("Cycles per MAC: %.3f\n\r", (float)cycle_count / c->macs);
+        printf("Stack Used: %lu bytes\n\r\n", (unsigned long)stack_used);
+        return 1;
+    }
+    printf("%s output validation FAILED\n\r", name);
+    return 0;
+}
+
+// Runs one kernel on one case: conv_kernel for convolutions, dw_conv_kernel (conv NULL) for
+// depthwise. Returns the cycle count, or 0 if the kernel rejected the shape or validation failed.
+RAM_FUNC static uint32_t run_kernel(const char *name, conv_kernel conv, dw_conv_kernel dw_conv, int32_t buf_size,
+                                    fast_path_case *c)
+{
+    cmsis_nn_context ctx;
+    ctx.buf = buf_size > 0 ? malloc(buf_size) : NULL;
+    ctx.size = buf_size;
+    memset(c->output, 0, c->output_size);
+
+    enable_cycle_counter();
+    fill_stack_pattern_to_sp();
+    uint32_t start_cycles = read_cycle_counter();
+
+    arm_cmsis_nn_status status;
+    if (conv) {
+        status = conv(&ctx, &c->conv_params, &c->quant_params, &c->input_dims, c->input, &c->filter_dims,
+                      c->weights, &c->bias_dims, c->bias, &c->output_dims, c->output);
+    } else {
+        status = dw_conv(&ctx, &c->dw_conv_params, &c->quant_params, &c->input_dims, c->input, &c->filter_dims,
+                         c->weights, &c->bias_dims, c->bias, &c->output_dims, c->output);
+    }
+
+    uint32_t end_cycles = read_cycle_counter();
+    uint32_t cycle_count = end_cycles - start_cycles;
+    uint32_t instr_est = cycle_count
+                       - DWT->CPICNT
+                       - DWT->EXCCNT
+                       - DWT->SLEEPCNT
+                       - DWT->LSUCNT
+                       + DWT->FOLDCNT;
+    uint32_t stack_used = measure_stack_usage();
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);  // Security wipe
+        free(ctx.buf);
+    }
+
+    if (status != ARM_CMSIS_NN_SUCCESS) {
+        printf("\n\r%s rejected the shape (status %d)\n\r", name, (int)status);
+        return 0;
+    }
+    return print_result(name, c, cycle_count, instr_est, stack_used) ? cycle_count : 0;
+}
+
+static uint32_t run_conv_kernel(const char *name, conv_kernel kernel, int32_t buf_size, fast_path_case *c)
+{
+    return run_kernel(name, kernel, NULL, buf_size, c);
+}
+
+static uint32_t run_dw_conv_kernel(const char *name, dw_conv_kernel kernel, int32_t buf_size, fast_path_case *c)
+{
+    return run_kernel(name, NULL, kernel, buf_size, c);
+}
+
+typedef struct {
+    const char *name;
+    uint32_t cycles;
+    uint32_t macs;
+} cliff_entry;
+
+static void report_cycle_cliff(const char *family, const cliff_entry *entries, int count)
+{
+    const float fast_cpm = entries[0].cycles ? (float)entries[0].cycles / entries[0].macs : 0.0f;
+
+    printf("-----%s cycle cliff (relative to the fast kernel)-----\n\r", family);
+    for (int i = 0; i < count; i++) {
+        if (entries[i].cycles == 0) {
+            printf("%-32s n/a\n\r", entries[i].name);
+            continue;
+        }
+        const float cpm = (float)entries[i].cycles / entries[i].macs;
+        printf("%-32s %8lu cycles  %6.3f cycles/MAC  x%.2f\n\r", entries[i].name,
+               (unsigned long)entries[i].cycles, cpm, fast_cpm > 0.0f ? cpm / fast_cpm : 0.0f);
+    }
+    printf("\n\r");
+}
+
+RAM_FUNC void benchmark_arm_convolve_1x1_s8_fast(void)
+{
+    cliff_entry cliff[NUM_SHAPES(conv_1x1_shapes) + 1];
+    int num_cliff = 0;
+    fast_path_case c;
+
+    for (int i = 0; i < NUM_SHAPES(conv_1x1_shapes); i++) {
+        const fast_path_shape *s = &conv_1x1_shapes[i];
+        if (setup_case(s, &c) != 0) {
+            printf("Failed to allocate buffers for %s\n\r", s->name);
+            continue;
+        }
+        const int32_t wrapper_buf_size =
+            arm_convolve_wrapper_s8_get_buffer_size(&c.conv_params, &c.input_dims, &c.filter_dims, &c.output_dims);
+
+        printf("%s\n\r", s->name);
+        if (i == 0) {
+            // The qualifying shape: fast kernel, the strided 1x1 kernel, and the wrapper
+            cliff[num_cliff].name = "arm_convolve_1x1_s8_fast";
+            cliff[num_cliff].cycles = run_conv_kernel("arm_convolve_1x1_s8_fast", arm_convolve_1x1_s8_fast,
+                                                      arm_convolve_1x1_s8_fast_get_buffer_size(&c.input_dims), &c);
+            cliff[num_cliff++].macs = c.macs;
+            cliff[num_cliff].name = "arm_convolve_1x1_s8 (same shape)";
+            cliff[num_cliff].cycles = run_conv_kernel("arm_convolve_1x1_s8", arm_convolve_1x1_s8, 0, &c);
+            cliff[num_cliff++].macs = c.macs;
+            run_conv_kernel("arm_convolve_wrapper_s8", arm_convolve_wrapper_s8, wrapper_buf_size, &c);
+        } else {
+            cliff[num_cliff].name = s->name;
+            cliff[num_cliff].cycles = run_conv_kernel("arm_convolve_wrapper_s8", arm_convolve_wrapper_s8,
+                                                      wrapper_buf_size, &c);
+            cliff[num_cliff++].macs = c.macs;
+        }
+        free_case(&c);
+    }
+
+    report_cycle_cliff("arm_convolve_1x1_s8_fast", cliff, num_cliff);
+}
+
+RAM_FUNC void benchmark_arm_convolve_1_x_n_s8(void)
+{
+    cliff_entry cliff[NUM_SHAPES(conv_1_x_n_shapes)];
+    int num_cliff = 0;
+    fast_path_case c;
+
+    for (int i = 0; i < NUM_SHAPES(conv_1_x_n_shapes); i++) {
+        const fast_path_shape *s = &conv_1_x_n_shapes[i];
+        if (setup_case(s, &c) != 0) {
+            printf("Failed to allocate buffers for %s\n\r", s->name);
+            continue;
+        }
+        const int32_t wrapper_buf_size =
+            arm_convolve_wrapper_s8_get_buffer_size(&c.conv_params, &c.input_dims, &c.filter_dims, &c.output_dims);
+
+        printf("%s\n\r", s->name);
+        if (i == 0) {
+            // Without MVE arm_convolve_1_x_n_s8 forwards to arm_convolve_s8, which is also what the
+            // wrapper picks for the near-miss shapes, so the wrapper is not run a second time here
+            const int32_t buf_size =
+                arm_convolve_1_x_n_s8_get_buffer_size(&c.conv_params, &c.input_dims, &c.filter_dims, &c.output_dims);
+            cliff[num_cliff].name = "arm_convolve_1_x_n_s8";
+            cliff[num_cliff].cycles = run_conv_kernel("arm_convolve_1_x_n_s8", arm_convolve_1_x_n_s8, buf_size, &c);
+            cliff[num_cliff++].macs = c.macs;
+        } else {
+            cliff[num_cliff].name = s->name;
+            cliff[num_cliff].cycles = run_conv_kernel("arm_convolve_wrapper_s8", arm_convolve_wrapper_s8,
+                                                      wrapper_buf_size, &c);
+            cliff[num_cliff++].macs = c.macs;
+        }
+        free_case(&c);
+    }
+
+    report_cycle_cliff("arm_convolve_1_x_n_s8", cliff, num_cliff);
+    printf("Note: on Cortex-M4 (no MVE) arm_convolve_1_x_n_s8 runs arm_convolve_s8, the same kernel as\n\r");
+    printf("the near-miss shapes, so this table shows the shape effect only, not a fast path.\n\r\n\r");
+}
+
+RAM_FUNC void benchmark_arm_depthwise_conv_3x3_s8(void)
+{
+    cliff_entry cliff[NUM_SHAPES(dw_3x3_shapes) + 2];
+    int num_cliff = 0;
+    fast_path_case c;
+
+    for (int i = 0; i < NUM_SHAPES(dw_3x3_shapes); i++) {
+        const fast_path_shape *s = &dw_3x3_shapes[i];
+        if (setup_case(s, &c) != 0) {
+            printf("Failed to allocate buffers for %s\n\r", s->name);
+            continue;
+        }
+        const int32_t wrapper_buf_size = arm_depthwise_conv_wrapper_s8_get_buffer_size(&c.dw_conv_params,
+                                                                                       &c.input_dims,
+                                                                                       &c.filter_dims,
+                                                                                       &c.output_dims);
+
+        printf("%s\n\r", s->name);
+        if (i == 0) {
+            // The qualifying shape: 3x3 kernel, then the two general depthwise kernels on the same data
+            cliff[num_cliff].name = "arm_depthwise_conv_3x3_s8";
+            cliff[num_cliff].cycles = run_dw_conv_kernel("arm_depthwise_conv_3x3_s8", arm_depthwise_conv_3x3_s8, 0, &c);
+            cliff[num_cliff++].macs = c.macs;
+            cliff[num_cliff].name = "arm_depthwise_conv_s8_opt (same)";
+            cliff[num_cliff].cycles = run_dw_conv_kernel("arm_depthwise_conv_s8_opt", arm_depthwise_conv_s8_opt,
+                                                         arm_depthwise_conv_s8_opt_get_buffer_size(&c.input_dims,
+                                                                                                   &c.filter_dims),
+                                                         &c);
+            cliff[num_cliff++].macs = c.macs;
+            cliff[num_cliff].name = "arm_depthwise_conv_s8 (same)";
+            cliff[num_cliff].cycles = run_dw_conv_kernel("arm_depthwise_conv_s8", arm_depthwise_conv_s8, 0, &c);
+            cliff[num_cliff++].macs = c.macs;
+            run_dw_conv_kernel("arm_depthwise_conv_wrapper_s8", arm_depthwise_conv_wrapper_s8, wrapper_buf_size, &c);
+        } else {
+            cliff[num_cliff].name = s->name;
+            cliff[num_cliff].cycles = run_dw_conv_kernel("arm_depthwise_conv_wrapper_s8", arm_depthwise_conv_wrapper_s8,
+                                                         wrapper_buf_size, &c);
+            cliff[num_cliff++].macs = c.macs;
+        }
+        free_case(&c);
+    }
+
+    report_cycle_cliff("arm_depthwise_conv_3x3_s8", cliff, num_cliff);
+}